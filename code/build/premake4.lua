@@ -86,6 +86,12 @@ newoption
     description = "Split target folders based on platforms"
 }
 
+newoption
+{
+    trigger = "headless",
+    description = "Embed the dummy display/input/sound plugins, without any window or audio device"
+}
+
 if os.is ("macosx") then
     osname = "mac"
 else
@@ -389,6 +395,11 @@ project "orxLIB"
             "AL_LIBTYPE_STATIC"
         }
 
+    if _OPTIONS["headless"] then
+        configuration {"not *Core*"}
+            defines {"__orxHEADLESS__"}
+    end
+
     -- Work around for codelite "default" configuration
     configuration {"codelite"}
         kind ("StaticLib")
@@ -433,21 +444,33 @@ project "orxLIB"
     configuration {"linux"}
         defines {"_GNU_SOURCE"}
 
-    configuration {"linux", "not *Core*"}
-        links
-        {
-            "glfw3",
-            "openal",
-            "sndfile",
-            "GL",
-            "X11",
-            "Xrandr",
-            "dl",
-            "m",
-            "rt",
-            "pthread",
-            "gcc"
-        }
+    if _OPTIONS["headless"] then
+        configuration {"linux", "not *Core*"}
+            links
+            {
+                "dl",
+                "m",
+                "rt",
+                "pthread",
+                "gcc"
+            }
+    else
+        configuration {"linux", "not *Core*"}
+            links
+            {
+                "glfw3",
+                "openal",
+                "sndfile",
+                "GL",
+                "X11",
+                "Xrandr",
+                "dl",
+                "m",
+                "rt",
+                "pthread",
+                "gcc"
+            }
+    end
 
     configuration {"linux", "*Core*"}
         buildoptions {"-fPIC"}
@@ -599,6 +622,62 @@ project "Bounce"
 -- Linux
 
 
+-- Mac OS X
+
+    configuration {"macosx"}
+        targetextension (".so")
+        linkoptions {"-single_module"}
+
+
+-- Windows
+
+    configuration {"windows", "*Core*"}
+        libdirs {"../lib/static"}
+
+    configuration {"windows", "*Core*", "*Debug*"}
+        links {"imporxd"}
+    configuration {"windows", "*Core*", "*Profile*"}
+        links {"imporxp"}
+    configuration {"windows", "*Core*", "*Release*"}
+        links {"imporx"}
+
+
+--
+-- Project: benchmark
+--
+
+project "Benchmark"
+
+    files {"../plugins/Demo/orxBenchmark.c"}
+
+    targetdir ("../bin/plugins/demo")
+
+    if _OPTIONS["split-platforms"] then
+        configuration {"x32"}
+            targetdir ("../bin/plugins/demo/x32")
+
+        configuration {"x64"}
+            targetdir ("../bin/plugins/demo/x64")
+
+        configuration {}
+    end
+
+    targetprefix ("")
+
+    kind ("SharedLib")
+
+    links
+    {
+        "orxLIB"
+    }
+
+    configuration {"not xcode*"}
+        links {"orx"}
+
+
+-- Linux
+
+
 -- Mac OS X
 
     configuration {"macosx"}
@@ -84,6 +84,7 @@ typedef enum __orxANIM_EVENT_t
   orxANIM_EVENT_LOOP,                         /**< Event sent when an animation has looped */
   orxANIM_EVENT_UPDATE,                       /**< Event sent when an animation has been updated (current key) */
   orxANIM_EVENT_CUSTOM_EVENT,                 /**< Event sent when a custom event is reached */
+  orxANIM_EVENT_UPDATE_BATCH,                 /**< Event sent once per frame with all the owners whose current key has changed, sender & recipient are orxNULL */
 
   orxANIM_EVENT_NUMBER,
 
@@ -119,6 +120,13 @@ typedef struct __orxANIM_EVENT_PAYLOAD_t
       orxFLOAT        fValue;                 /**< Custom event value : 16 */
       orxFLOAT        fTime;                  /**< Custom event time : 20 */
     } stCustom;
+
+    /* Update batch event */
+    struct
+    {
+      const orxU64   *au64GUIDList;           /**< GUIDs of the owners whose current key has changed : 12 */
+      orxU32          u32Count;               /**< Number of GUIDs : 16 */
+    } stUpdateBatch;
   };
 
 } orxANIM_EVENT_PAYLOAD;
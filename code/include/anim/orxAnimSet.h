@@ -58,7 +58,9 @@
 #define orxANIMSET_KU32_FLAG_NONE                   0x00000000  /**< No flags. */
 
 #define orxANIMSET_KU32_FLAG_REFERENCE_LOCK         0x00100000  /**< If there's already a reference on it, the AnimSet is locked for changes. */
-#define orxANIMSET_KU32_FLAG_LINK_STATIC            0x00200000  /**< If not static, animpointer should duplicate the link table upon linking/creation. */
+#define orxANIMSET_KU32_FLAG_LINK_STATIC            0x00200000  /**< If not static, animpointer will duplicate the shared link table when first updating a loop count. */
+#define orxANIMSET_KU32_FLAG_NO_UPDATE_EVENT        0x00400000  /**< If set, animpointers won't send orxANIM_EVENT_UPDATE events for this AnimSet. */
+#define orxANIMSET_KU32_FLAG_NO_LOOP_EVENT          0x00800000  /**< If set, animpointers won't send orxANIM_EVENT_LOOP events for this AnimSet. */
 
 /** AnimSet Link Flags
  */
@@ -207,12 +209,12 @@ extern orxDLLAPI orxU32 orxFASTCALL                 orxAnimSet_GetLinkProperty(c
  * @param[in]   _u32SrcAnim                         Source (current) Anim ID
  * @param[in]   _u32DstAnim                         Destination Anim ID, if none (auto mode) set it to orxU32_UNDEFINED
  * @param[in,out] _pfTime                           Pointer to the current timestamp relative to the source Anim (time elapsed since the beginning of this anim)
- * @param[in,out] _pstLinkTable                     Anim Pointer link table (updated if AnimSet link table isn't static, when using loop counts for example)
+ * @param[in,out] _ppstLinkTable                    Anim Pointer link table storage (orxNULL content while sharing the AnimSet one, a local copy is created when a loop count has to be updated), orxNULL to always use the shared one
  * @param[out] _pbCut                               Animation has been cut
  * @param[out] _pbClearTarget                       Animation has requested a target clearing
  * @return Current Anim ID. If it's not the source one, _pu32Time will contain the new timestamp, relative to the new Anim
 */
-extern orxDLLAPI orxU32 orxFASTCALL                 orxAnimSet_ComputeAnim(orxANIMSET *_pstAnimSet, orxU32 _u32SrcAnim, orxU32 _u32DstAnim, orxFLOAT *_pfTime, orxANIMSET_LINK_TABLE *_pstLinkTable, orxBOOL *_pbCut, orxBOOL *_pbClearTarget);
+extern orxDLLAPI orxU32 orxFASTCALL                 orxAnimSet_ComputeAnim(orxANIMSET *_pstAnimSet, orxU32 _u32SrcAnim, orxU32 _u32DstAnim, orxFLOAT *_pfTime, orxANIMSET_LINK_TABLE **_ppstLinkTable, orxBOOL *_pbCut, orxBOOL *_pbClearTarget);
 
 /** Finds next Anim given current and destination Anim IDs
  * @param[in]   _pstAnimSet                         Concerned AnimSet
@@ -241,6 +243,12 @@ extern orxDLLAPI orxU32 orxFASTCALL                 orxAnimSet_GetAnimStorageSiz
  */
 extern orxDLLAPI orxU32 orxFASTCALL                 orxAnimSet_GetAnimCount(const orxANIMSET *_pstAnimSet);
 
+/** AnimSet start Anim ID get accessor
+ * @param[in]   _pstAnimSet                         Concerned AnimSet
+ * @return      Start Anim ID (StartAnim / first of StartAnimList when created from config, first added Anim otherwise)
+ */
+extern orxDLLAPI orxU32 orxFASTCALL                 orxAnimSet_GetStartAnimID(const orxANIMSET *_pstAnimSet);
+
 /** Gets animation ID from name
  * @param[in]   _pstAnimSet                         Concerned AnimSet
  * @param[in]   _zAnimName                          Animation name (config's section)
@@ -106,6 +106,13 @@ extern orxDLLAPI const orxSTRING orxFASTCALL  orxConfig_GetEncryptionKey();
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL        orxConfig_SetBootstrap(const orxCONFIG_BOOTSTRAP_FUNCTION _pfnBootstrap);
 
+/** Sets include prefetch status: when enabled, included files are read ahead on worker threads while their parent file is being parsed (disabled by default).
+ *  Can be called before the config module is initialized or from the bootstrap function, in order to apply to the default config file.
+ * @param[in] _bEnable          Enable / disable
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL        orxConfig_SetIncludePrefetch(orxBOOL _bEnable);
+
 /** Sets config base name
  * @param[in] _zBaseName        Base name used for default config file
  * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
@@ -144,6 +151,14 @@ extern orxDLLAPI orxSTATUS orxFASTCALL        orxConfig_ReloadHistory();
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL        orxConfig_Save(const orxSTRING _zFileName, orxBOOL _bUseEncryption, const orxCONFIG_SAVE_FUNCTION _pfnSaveCallback);
 
+/** Writes config to given file using the binary format, which is loaded without any parsing. Will overwrite any existing file.
+ * Binary files are detected by orxConfig_Load/orxConfig_LoadFromMemory using their leading tag and are only meant to be read by the same engine version/platform.
+ * @param[in] _zFileName        File name, if null or empty the default file name will be used
+ * @param[in] _pfnSaveCallback  Callback used to filter section/key to save. If NULL is passed, all section/keys will be saved
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL        orxConfig_SaveBinary(const orxSTRING _zFileName, const orxCONFIG_SAVE_FUNCTION _pfnSaveCallback);
+
 /** Copies a file with optional encryption
  * @param[in] _zDstFileName     Name of the destination file
  * @param[in] _zSrcFileName     Name of the source file
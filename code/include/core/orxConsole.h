@@ -158,6 +158,12 @@ extern orxDLLAPI const orxSTRING orxFASTCALL          orxConsole_GetCompletion(o
  */
 extern orxDLLAPI const orxSTRING orxFASTCALL          orxConsole_GetTrailLogLine(orxU32 _u32TrailLineIndex);
 
+/** Gets log line ID from the end (trail), using internal offset: a line keeps its ID, and its content, for as long as it remains in the log
+ * @param[in]   _u32TrailLineIndex Index of the line starting from end
+ * @return Line ID / orxU32_UNDEFINED
+ */
+extern orxDLLAPI orxU32 orxFASTCALL                   orxConsole_GetTrailLogLineID(orxU32 _u32TrailLineIndex);
+
 /** Gets log line offset from the end
  * @return Log line offset from the end
  */
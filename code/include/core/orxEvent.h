@@ -191,6 +191,13 @@ extern orxDLLAPI orxSTATUS orxFASTCALL  orxEvent_Send(orxEVENT *_pstEvent);
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL  orxEvent_SendShort(orxEVENT_TYPE _eEventType, orxENUM _eEventID);
 
+/** Has a handler for the given event type & ID?
+ * @param[in] _eEventType           Event type
+ * @param[in] _eEventID             Event ID
+ * @return orxTRUE if at least one handler would be called for this event, orxFALSE otherwise
+ */
+extern orxDLLAPI orxBOOL orxFASTCALL    orxEvent_HasHandler(orxEVENT_TYPE _eEventType, orxENUM _eEventID);
+
 /** Is currently sending an event?
  * @return orxTRUE / orxFALSE
  */
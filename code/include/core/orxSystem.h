@@ -150,6 +150,11 @@ extern orxDLLAPI orxDOUBLE orxFASTCALL        orxSystem_GetSystemTime();
  */
 extern orxDLLAPI void orxFASTCALL             orxSystem_Delay(orxFLOAT _fSeconds);
 
+/** Delays the program until given time
+ * @param[in] _dTime                Time to wait for, expressed as returned by orxSystem_GetTime()
+ */
+extern orxDLLAPI void orxFASTCALL             orxSystem_DelayUntil(orxDOUBLE _dTime);
+
 /** Gets orx version (compiled)
  * @param[out] _pstVersion          Structure to fill with current version
  * @return Compiled version
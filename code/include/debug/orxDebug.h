@@ -76,6 +76,8 @@
 #define orxDEBUG_KZ_DEFAULT_LOG_SUFFIX                ".log"
 #define orxDEBUG_KZ_DEFAULT_DEBUG_SUFFIX              "-debug.log"
 
+#define orxDEBUG_KU32_DEFAULT_FILE_MAX_SIZE           0x01000000 /**< 16MB, files get rotated once reached */
+
 
 /* Debug levels */
 typedef enum __orxDEBUG_LEVEL_t
@@ -433,6 +435,26 @@ extern orxDLLAPI void orxFASTCALL             _orxDebug_SetLogFile(const orxSTRI
 */
 extern orxDLLAPI void orxFASTCALL             _orxDebug_SetLogCallback(const orxDEBUG_CALLBACK_FUNCTION _pfnLogCallback);
 
+/** Sets max size of debug & log files, once reached they get rotated
+ * @param[in]   _u32MaxSize                   Max size in bytes, 0 to disable rotation
+ */
+extern orxDLLAPI void orxFASTCALL             _orxDebug_SetFileMaxSize(orxU32 _u32MaxSize);
+
+/** Enables/disables asynchronous writing: when enabled, terminal & file outputs are only written by _orxDebug_Flush()
+ * @param[in]   _bEnable                      Enable / disable
+ */
+extern orxDLLAPI void orxFASTCALL             _orxDebug_EnableAsyncWriting(orxBOOL _bEnable);
+
+/** Writes all pending records to terminal & files, in a single batch. Never blocks: returns right away if another thread is already writing
+ * @return      Number of written records
+ */
+extern orxDLLAPI orxU32 orxFASTCALL           _orxDebug_Flush();
+
+/** Gets the number of records dropped since init because the ring was full
+ * @return      Dropped record count
+ */
+extern orxDLLAPI orxU32 orxFASTCALL           _orxDebug_GetDropCount();
+
 #endif /* __orxDEBUG_H_ */
 
 /** @} */
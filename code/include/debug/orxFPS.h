@@ -46,6 +46,18 @@
 #include "orxInclude.h"
 
 
+/** Frame time stats
+ */
+typedef struct __orxFPS_FRAME_TIME_t
+{
+  orxFLOAT  fAverage;                             /**< Average frame time : 4 */
+  orxFLOAT  fDeviation;                           /**< Frame time standard deviation : 8 */
+  orxFLOAT  fMin;                                 /**< Shortest frame time : 12 */
+  orxFLOAT  fMax;                                 /**< Longest frame time : 16 */
+
+} orxFPS_FRAME_TIME;
+
+
 /** Setups FPS module */
 extern orxDLLAPI void orxFASTCALL                 orxFPS_Setup();
 
@@ -65,6 +77,12 @@ extern orxDLLAPI void orxFASTCALL                 orxFPS_IncreaseFrameCount();
  */
 extern orxDLLAPI orxU32 orxFASTCALL               orxFPS_GetFPS();
 
+/** Gets frame time stats, computed over the last second
+ * @param[out] _pstFrameTime      Frame time stats
+ * @return orxFPS_FRAME_TIME
+ */
+extern orxDLLAPI orxFPS_FRAME_TIME *orxFASTCALL   orxFPS_GetFrameTime(orxFPS_FRAME_TIME *_pstFrameTime);
+
 #endif /* _orxFPS_H_ */
 
 /** @} */
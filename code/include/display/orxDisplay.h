@@ -205,6 +205,10 @@ typedef struct __orxCOLOR_t
 
 } orxCOLOR;
 
+/** Bitmap read back function, called from the task thread with RGBA (4 channels, top-down) data that is only valid during the call
+ */
+typedef void (orxFASTCALL *orxDISPLAY_READ_BACK_FUNCTION)(const orxU8 *_au8Data, orxU32 _u32Width, orxU32 _u32Height, void *_pContext);
+
 
 /** Config parameters
  */
@@ -982,6 +986,14 @@ extern orxDLLAPI orxSTATUS orxFASTCALL                orxDisplay_SetBitmapData(o
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL                orxDisplay_GetBitmapData(const orxBITMAP *_pstBitmap, orxU8 *_au8Data, orxU32 _u32ByteNumber);
 
+/** Reads back a bitmap data asynchronously (RGBA memory format), without stalling the GPU: the data is delivered a couple of frames later, in request order; fails (frame dropped) rather than wait when too many read backs are still in flight
+ * @param[in]   _pstBitmap                            Concerned bitmap, its content is captured at call time
+ * @param[in]   _pfnCallback                          Function that will receive the data (4 channels, RGBA, top-down), called from the task thread
+ * @param[in]   _pContext                             Context that will be transmitted to the callback
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL                orxDisplay_ReadBackBitmapData(const orxBITMAP *_pstBitmap, orxDISPLAY_READ_BACK_FUNCTION _pfnCallback, void *_pContext);
+
 /** Sets a bitmap color (lighting/hue)
  * @param[in]   _pstBitmap                            Concerned bitmap
  * @param[in]   _stColor                              Color to apply on the bitmap
@@ -267,6 +267,12 @@ extern orxDLLAPI orxVECTOR *orxFASTCALL       orxGraphic_GetOrigin(const orxGRAP
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL        orxGraphic_UpdateSize(orxGRAPHIC *_pstGraphic);
 
+/** Gets graphic version, incremented every time its data, size or pivot changes
+ * @param[in]   _pstGraphic     Concerned graphic
+ * @return      Graphic version
+ */
+extern orxDLLAPI orxU32 orxFASTCALL           orxGraphic_GetVersion(const orxGRAPHIC *_pstGraphic);
+
 /** Sets graphic smoothing
  * @param[in]   _pstGraphic     Concerned graphic
  * @param[in]   _eSmoothing     Smoothing type (enabled, default or none)
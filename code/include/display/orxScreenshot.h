@@ -72,6 +72,10 @@
 
 #endif
 
+#define orxSCREENSHOT_KZ_DEFAULT_RECORD_FORMAT    "y4m"
+#define orxSCREENSHOT_KU32_DEFAULT_RECORD_FRAME_RATE 60
+#define orxSCREENSHOT_KU32_DEFAULT_RECORD_MAX_PENDING 8
+
 
 /** Screenshot module setup
  */
@@ -91,6 +95,21 @@ extern orxDLLAPI void orxFASTCALL       orxScreenshot_Exit();
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL  orxScreenshot_Capture();
 
+/** Starts recording every rendered frame to disk (Y4M / raw RGBA stream or TGA sequence), frames are read back asynchronously and written on the task thread
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL  orxScreenshot_StartRecording();
+
+/** Stops recording, pending frames will still be written
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL  orxScreenshot_StopRecording();
+
+/** Is recording?
+ * @return orxTRUE / orxFALSE
+ */
+extern orxDLLAPI orxBOOL orxFASTCALL    orxScreenshot_IsRecording();
+
 #endif /* _orxSCREENSHOT_H_ */
 
 /** @} */
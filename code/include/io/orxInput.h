@@ -58,6 +58,8 @@
 #define orxINPUT_KZ_CONFIG_DEFAULT_THRESHOLD          "DefaultThreshold"  /**< Input default threshold */
 #define orxINPUT_KZ_CONFIG_DEFAULT_MULTIPLIER         "DefaultMultiplier" /**< Input default multiplier */
 #define orxINPUT_KZ_CONFIG_COMBINE_LIST               "CombineList"       /**< Combine input list */
+#define orxINPUT_KZ_CONFIG_RECORD                     "Record"            /**< Record file */
+#define orxINPUT_KZ_CONFIG_REPLAY                     "Replay"            /**< Replay file */
 
 #define orxINPUT_KU32_BINDING_NUMBER      8
 
@@ -352,6 +354,39 @@ extern orxDLLAPI orxSTATUS orxFASTCALL            orxInput_GetBindingType(const
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL            orxInput_GetActiveBinding(orxINPUT_TYPE *_peType, orxENUM *_peID, orxFLOAT *_pfValue);
 
+
+/** Starts recording all bound peripheral inputs to a file, along with the current random seeds
+ * @param[in]   _zFileName      Name of the record file
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL            orxInput_StartRecording(const orxSTRING _zFileName);
+
+/** Stops recording inputs
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL            orxInput_StopRecording();
+
+/** Is recording inputs?
+ * @return orxTRUE / orxFALSE
+ */
+extern orxDLLAPI orxBOOL orxFASTCALL              orxInput_IsRecording();
+
+/** Starts replaying inputs from a record file, peripherals won't be polled anymore till the end of the replay
+ * @param[in]   _zFileName      Name of the record file
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL            orxInput_StartReplay(const orxSTRING _zFileName);
+
+/** Stops replaying inputs
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL            orxInput_StopReplay();
+
+/** Is replaying inputs?
+ * @return orxTRUE / orxFALSE
+ */
+extern orxDLLAPI orxBOOL orxFASTCALL              orxInput_IsReplaying();
+
 #endif /*_orxINPUT_H_*/
 
 /** @} */
@@ -85,6 +85,18 @@
 #endif
 
 
+/** Atomic operation macros (32-bit) */
+#if defined(__orxGCC__) || defined(__orxLLVM__)
+  #define orxMEMORY_COMPARE_AND_SWAP(PTR, OLD, NEW)       (__sync_bool_compare_and_swap((PTR), (OLD), (NEW)) ? orxTRUE : orxFALSE)
+  #define orxMEMORY_INCREMENT(PTR)                        __sync_add_and_fetch((PTR), 1)
+#elif defined(__orxMSVC__)
+  #define orxMEMORY_COMPARE_AND_SWAP(PTR, OLD, NEW)       ((InterlockedCompareExchange((volatile LONG *)(PTR), (LONG)(NEW), (LONG)(OLD)) == (LONG)(OLD)) ? orxTRUE : orxFALSE)
+  #define orxMEMORY_INCREMENT(PTR)                        InterlockedIncrement((volatile LONG *)(PTR))
+#else
+  #error !!ERROR!! This compiler does not have any builtin atomic operation.
+#endif
+
+
 /** Memory tracking macros */
 #ifdef __orxPROFILER__
   #define orxMEMORY_TRACK(TYPE, SIZE, ALLOCATE)           orxMemory_Track(orxMEMORY_TYPE_##TYPE, SIZE, ALLOCATE)
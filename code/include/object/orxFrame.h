@@ -165,6 +165,12 @@ extern orxDLLAPI orxFRAME *orxFASTCALL        orxFrame_GetSibling(const orxFRAME
  */
 extern orxDLLAPI orxBOOL orxFASTCALL          orxFrame_IsRootChild(const orxFRAME *_pstFrame);
 
+/** Gets frame version, incremented every time its global data changes
+ * @param[in]   _pstFrame       Concerned frame
+ * @return Frame version
+ */
+extern orxDLLAPI orxU32 orxFASTCALL           orxFrame_GetVersion(const orxFRAME *_pstFrame);
+
 
 /** Sets frame position
  * @param[in]   _pstFrame       Concerned frame
@@ -55,6 +55,7 @@
 #include "math/orxOBox.h"
 #include "memory/orxBank.h"
 #include "object/orxStructure.h"
+#include "physics/orxPhysics.h"
 #include "sound/orxSound.h"
 
 
@@ -129,6 +130,14 @@ extern orxDLLAPI orxSTATUS orxFASTCALL      orxObject_Delete(orxOBJECT *_pstObje
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL      orxObject_Update(orxOBJECT *_pstObject, const orxCLOCK_INFO *_pstClockInfo);
 
+/** Recycles an object as if it was newly created from its config section: resets its state (position, rotation, scale, speed, color, lifetime, active time),
+ * restarts its anim set's start animation, FXs, sounds & timeline tracks, recreates its children, re-enables it recursively and sends an orxOBJECT_EVENT_CREATE event.
+ * Graphic and body are kept as is. A pooled object got a new GUID when pooled: references to its previous GUID resolve to orxNULL.
+ * @param[in] _pstObject        Concerned object
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL      orxObject_Recycle(orxOBJECT *_pstObject);
+
 /** Enables/disables an object. Note that enabling/disabling an object is not recursive, so its children will not be affected, see orxObject_EnableRecursive().
  * @param[in]   _pstObject    Concerned object
  * @param[in]   _bEnable      Enable / disable
@@ -657,6 +666,21 @@ extern orxDLLAPI orxSTATUS orxFASTCALL      orxObject_ApplyImpulse(orxOBJECT *_p
  * @return Colliding orxOBJECT / orxNULL
  */
 extern orxDLLAPI orxOBJECT *orxFASTCALL     orxObject_Raycast(const orxVECTOR *_pvBegin, const orxVECTOR *_pvEnd, orxU16 _u16SelfFlags, orxU16 _u16CheckMask, orxBOOL _bEarlyExit, orxVECTOR *_pvContact, orxVECTOR *_pvNormal);
+
+/** Issues a batch of raycasts against objects with bodies, each query's hResult will contain the colliding orxOBJECT / orxHANDLE_UNDEFINED
+ * @param[in,out] _astRaycastList List of raycast queries
+ * @param[in]   _u32Number      Number of queries
+ * @return Number of raycasts that hit an object
+ */
+extern orxDLLAPI orxU32 orxFASTCALL         orxObject_RaycastBatch(orxPHYSICS_RAYCAST *_astRaycastList, orxU32 _u32Number);
+
+/** Issues a batch of box overlap queries against objects with bodies, each query's result buffer will receive the overlapping orxOBJECT.
+ * Contrary to orxObject_BoxPick(), this relies on the physics broadphase and doesn't allocate any memory.
+ * @param[in,out] _astOverlapList List of overlap queries
+ * @param[in]   _u32Number      Number of queries
+ * @return Total number of overlapping objects found
+ */
+extern orxDLLAPI orxU32 orxFASTCALL         orxObject_OverlapBatch(orxPHYSICS_OVERLAP *_astOverlapList, orxU32 _u32Number);
 /** @} */
 
 
@@ -1074,12 +1098,46 @@ extern orxDLLAPI orxSTATUS orxFASTCALL      orxObject_SetGroupID(orxOBJECT *_pst
  */
 extern orxDLLAPI void orxFASTCALL           orxObject_SetGroupIDRecursive(orxOBJECT *_pstObject, orxSTRINGID _stGroupID);
 
-/** Gets next object in group.
+/** Gets next object in group. The given object can have left the group since it was returned (group change or deletion
+ * of a previous object), as long as the object module hasn't been updated in between. An object that joins a group
+ * during an iteration is appended to its end.
  * @param[in]   _pstObject      Concerned object, orxNULL to get the first one
  * @param[in]   _stGroupID      Group ID to consider, orxSTRINGID_UNDEFINED for all
  * @return      orxOBJECT / orxNULL
  */
 extern orxDLLAPI orxOBJECT *orxFASTCALL     orxObject_GetNext(const orxOBJECT *_pstObject, orxSTRINGID _stGroupID);
+
+/** Adds object to an additional group. The object stays in its main group (see orxObject_SetGroupID()).
+ * An object can be part of up to 3 additional groups.
+ * @param[in]   _pstObject      Concerned object
+ * @param[in]   _stGroupID      Group ID to add. This is the string ID (see orxString_GetID()) of the group name.
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL      orxObject_AddGroupID(orxOBJECT *_pstObject, orxSTRINGID _stGroupID);
+
+/** Removes object from an additional group. The main group can't be removed, only changed with orxObject_SetGroupID().
+ * @param[in]   _pstObject      Concerned object
+ * @param[in]   _stGroupID      Group ID to remove. This is the string ID (see orxString_GetID()) of the group name.
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL      orxObject_RemoveGroupID(orxOBJECT *_pstObject, orxSTRINGID _stGroupID);
+
+/** Is object part of a group, either as its main group or as an additional one?
+ * @param[in]   _pstObject      Concerned object
+ * @param[in]   _stGroupID      Group ID to test. This is the string ID (see orxString_GetID()) of the group name.
+ * @return      orxTRUE / orxFALSE
+ */
+extern orxDLLAPI orxBOOL orxFASTCALL        orxObject_IsInGroup(const orxOBJECT *_pstObject, orxSTRINGID _stGroupID);
+
+/** Gets the contiguous object array of a group, for batch or chunked processing (disjoint chunks can be processed in parallel).
+ * Callers must skip orxNULL entries: objects leaving a group leave a hole instead of being swapped with the last entry, so that
+ * ongoing iterations (see orxObject_GetNext()) neither skip nor revisit objects. Holes are compacted on the next object module update.
+ * The array is only valid until the next object creation, deletion or group change.
+ * @param[in]   _stGroupID      Concerned group ID
+ * @param[out]  _pu32Count      Number of entries in the array, holes included
+ * @return      Object array / orxNULL
+ */
+extern orxDLLAPI orxOBJECT *const *orxFASTCALL orxObject_GetGroupArray(orxSTRINGID _stGroupID, orxU32 *_pu32Count);
 /** @} */
 
 
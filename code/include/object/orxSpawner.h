@@ -178,6 +178,29 @@ extern orxDLLAPI orxU32 orxFASTCALL         orxSpawner_GetTotalObjectCount(const
  */
 extern orxDLLAPI orxU32 orxFASTCALL         orxSpawner_GetActiveObjectCount(const orxSPAWNER *_pstSpawner);
 
+/** Gets spawner pool stats
+ * @param[in]   _pstSpawner     Concerned spawner
+ * @param[out]  _pu32HitCount   Number of spawns served by the pool, orxNULL to ignore
+ * @param[out]  _pu32MissCount  Number of spawns that had to create a new object, orxNULL to ignore
+ * @param[out]  _pu32PooledCount Number of objects currently waiting in the pool, orxNULL to ignore
+ * @return      Pool size, 0 if the spawner isn't pooling its objects
+ */
+extern orxDLLAPI orxU32 orxFASTCALL         orxSpawner_GetPoolStats(const orxSPAWNER *_pstSpawner, orxU32 *_pu32HitCount, orxU32 *_pu32MissCount, orxU32 *_pu32PooledCount);
+
+/** Stores an expired spawned object in the spawner's pool instead of deleting it. Called by the object module once the object's
+ * delete event has been accepted: the object will be disabled and recycled by a later spawn of the same object.
+ * @param[in]   _pstSpawner     Concerned spawner
+ * @param[in]   _pstObject      Concerned object, has to be owned by the spawner
+ * @return      orxSTATUS_SUCCESS if pooled, orxSTATUS_FAILURE if it should be deleted
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL      orxSpawner_PoolObject(orxSPAWNER *_pstSpawner, orxSTRUCTURE *_pstObject);
+
+/** Removes an object from the spawner's pool. Called by the object module when a pooled object gets deleted.
+ * @param[in]   _pstSpawner     Concerned spawner
+ * @param[in]   _pstObject      Concerned object
+ */
+extern orxDLLAPI void orxFASTCALL           orxSpawner_UnpoolObject(orxSPAWNER *_pstSpawner, const orxSTRUCTURE *_pstObject);
+
 
 /** Sets spawner wave size
  * @param[in]   _pstSpawner     Concerned spawner
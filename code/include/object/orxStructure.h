@@ -333,6 +333,12 @@ extern orxDLLAPI orxSTRUCTURE *orxFASTCALL              orxStructure_GetOwner(co
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL                  orxStructure_SetOwner(void *_pStructure, void *_pOwner);
 
+/** Renews structure's GUID: keeps its item ID but gives it a new instance ID, previous GUID won't resolve anymore
+ * @param[in]   _pStructure    Concerned structure
+ * @return      New GUID
+ */
+extern orxDLLAPI orxU64 orxFASTCALL                     orxStructure_RenewGUID(void *_pStructure);
+
 /** Gets first stored structure (first list cell or tree root depending on storage type)
  * @param[in]   _eStructureID   Concerned structure ID
  * @return      orxSTRUCTURE
@@ -442,6 +442,19 @@ extern orxDLLAPI orxBOOL orxFASTCALL          orxBody_IsPartSolid(const orxBODY_
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL        orxBody_SetPartSolid(orxBODY_PART *_pstBodyPart, orxBOOL _bSolid);
 
+/** Enables / disables contact events for a body part: contacts are only reported when at least one of their parts has them enabled
+ * @param[in]   _pstBodyPart    Concerned body part
+ * @param[in]   _bEnable        Enable / disable
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL        orxBody_EnablePartContactEvent(orxBODY_PART *_pstBodyPart, orxBOOL _bEnable);
+
+/** Are contact events enabled for a body part?
+ * @param[in]   _pstBodyPart    Concerned body part
+ * @return      orxTRUE / orxFALSE
+ */
+extern orxDLLAPI orxBOOL orxFASTCALL          orxBody_IsPartContactEventEnabled(const orxBODY_PART *_pstBodyPart);
+
 
 /** Enables a (revolute) body joint motor
  * @param[in]   _pstBodyJoint   Concerned body joint
@@ -491,6 +504,20 @@ extern orxDLLAPI orxFLOAT orxFASTCALL         orxBody_GetJointReactionTorque(con
  */
 extern orxDLLAPI orxBODY *orxFASTCALL         orxBody_Raycast(const orxVECTOR *_pvBegin, const orxVECTOR *_pvEnd, orxU16 _u16SelfFlags, orxU16 _u16CheckMask, orxBOOL _bEarlyExit, orxVECTOR *_pvContact, orxVECTOR *_pvNormal);
 
+/** Issues a batch of raycasts, each query's hResult will contain the colliding orxBODY / orxHANDLE_UNDEFINED
+ * @param[in,out] _astRaycastList List of raycast queries
+ * @param[in]   _u32Number      Number of queries
+ * @return Number of raycasts that hit a body
+ */
+extern orxDLLAPI orxU32 orxFASTCALL           orxBody_RaycastBatch(orxPHYSICS_RAYCAST *_astRaycastList, orxU32 _u32Number);
+
+/** Issues a batch of box overlap queries, each query's result buffer will receive the overlapping orxBODY
+ * @param[in,out] _astOverlapList List of overlap queries
+ * @param[in]   _u32Number      Number of queries
+ * @return Total number of overlapping bodies found
+ */
+extern orxDLLAPI orxU32 orxFASTCALL           orxBody_OverlapBatch(orxPHYSICS_OVERLAP *_astOverlapList, orxU32 _u32Number);
+
 #endif /* _orxBODY_H_ */
 
 /** @} */
@@ -47,6 +47,7 @@
 #include "orxInclude.h"
 #include "plugin/orxPluginCore.h"
 #include "math/orxAABox.h"
+#include "math/orxOBox.h"
 
 
 /** Body definition flags
@@ -75,6 +76,7 @@
 #define orxBODY_PART_DEF_KU32_MASK_TYPE               0x0000001F /**< Type body part def mask */
 
 #define orxBODY_PART_DEF_KU32_FLAG_SOLID              0x10000000  /**< Solid body part def flag */
+#define orxBODY_PART_DEF_KU32_FLAG_NO_CONTACT_EVENT   0x20000000  /**< No contact event body part def flag */
 
 #define orxBODY_PART_DEF_KU32_MASK_ALL                0xFFFFFFFF  /**< Body part def all mask */
 
@@ -282,6 +284,7 @@ typedef enum __orxPHYSICS_EVENT_t
 {
   orxPHYSICS_EVENT_CONTACT_ADD = 0,
   orxPHYSICS_EVENT_CONTACT_REMOVE,
+  orxPHYSICS_EVENT_CONTACT_BATCH,
 
   orxPHYSICS_EVENT_NUMBER,
 
@@ -300,6 +303,54 @@ typedef struct __orxPHYSICS_EVENT_PAYLOAD_t
 
 } orxPHYSICS_EVENT_PAYLOAD;
 
+/** Contact (batched contact events)
+ */
+typedef struct __orxPHYSICS_CONTACT_t
+{
+  orxHANDLE                 hSender;                  /**< Sender (source body's owner) : 4 */
+  orxHANDLE                 hRecipient;               /**< Recipient (destination body's owner) : 8 */
+  orxPHYSICS_EVENT          eID;                      /**< Contact event ID (orxPHYSICS_EVENT_CONTACT_ADD / orxPHYSICS_EVENT_CONTACT_REMOVE) : 12 */
+  orxPHYSICS_EVENT_PAYLOAD  stPayload;                /**< Contact payload : 44 */
+
+} orxPHYSICS_CONTACT;
+
+/** Contact batch event payload
+ */
+typedef struct __orxPHYSICS_CONTACT_BATCH_PAYLOAD_t
+{
+  const orxPHYSICS_CONTACT *astContactList;           /**< Contact list, only valid during the event : 4 */
+  orxU32                    u32ContactCount;          /**< Contact count : 8 */
+
+} orxPHYSICS_CONTACT_BATCH_PAYLOAD;
+
+/** Raycast query (batched raycasts)
+ */
+typedef struct __orxPHYSICS_RAYCAST_t
+{
+  orxVECTOR     vBegin;                               /**< Beginning of raycast (in) : 12 */
+  orxVECTOR     vEnd;                                 /**< End of raycast (in) : 24 */
+  orxVECTOR     vContact;                             /**< Contact, if any (out) : 36 */
+  orxVECTOR     vNormal;                              /**< Contact normal, if any (out) : 48 */
+  orxHANDLE     hResult;                              /**< Colliding body's user data / orxHANDLE_UNDEFINED (out) : 52 */
+  orxU16        u16SelfFlags;                         /**< Self flags used for filtering, 0xFFFF for no filtering (in) : 54 */
+  orxU16        u16CheckMask;                         /**< Check mask used for filtering, 0xFFFF for no filtering (in) : 56 */
+  orxBOOL       bEarlyExit;                           /**< Should stop as soon as a body has been hit, which might not be the closest (in) : 60 */
+
+} orxPHYSICS_RAYCAST;
+
+/** Overlap query (batched box overlaps)
+ */
+typedef struct __orxPHYSICS_OVERLAP_t
+{
+  orxOBOX       stBox;                                /**< Query box, only its 2D part is used (in) : 60 */
+  orxHANDLE    *ahResultList;                         /**< Caller-provided buffer that will receive the overlapping bodies' user data (out) : 64 */
+  orxU32        u32Size;                              /**< Size of the result buffer (in) : 68 */
+  orxU32        u32Count;                             /**< Number of overlapping bodies stored in the result buffer (out) : 72 */
+  orxU16        u16SelfFlags;                         /**< Self flags used for filtering, 0xFFFF for no filtering (in) : 74 */
+  orxU16        u16CheckMask;                         /**< Check mask used for filtering, 0xFFFF for no filtering (in) : 76 */
+
+} orxPHYSICS_OVERLAP;
+
 /** Internal physics body structure
  */
 typedef struct __orxPHYSICS_BODY_t                    orxPHYSICS_BODY;
@@ -324,6 +375,8 @@ typedef struct __orxPHYSICS_BODY_JOINT_t              orxPHYSICS_BODY_JOINT;
 #define orxPHYSICS_KZ_CONFIG_SHOW_DEBUG               "ShowDebug"
 #define orxPHYSICS_KZ_CONFIG_COLLISION_FLAG_LIST      "CollisionFlagList"
 #define orxPHYSICS_KZ_CONFIG_INTERPOLATE              "Interpolate"
+#define orxPHYSICS_KZ_CONFIG_THREADED                 "Threaded"
+#define orxPHYSICS_KZ_CONFIG_CONTACT_BATCH            "ContactBatch"
 
 
 /***************************************************************************
@@ -623,6 +676,13 @@ extern orxDLLAPI orxBOOL orxFASTCALL                  orxPhysics_IsPartSolid(con
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL                orxPhysics_SetPartSolid(orxPHYSICS_BODY_PART *_pstBodyPart, orxBOOL _bSolid);
 
+/** Enables / disables contact events for a physical body part, called before the part's definition gets updated
+ * @param[in]   _pstBodyPart                          Concerned physical body part
+ * @param[in]   _bEnable                              Enable / disable
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL                orxPhysics_EnablePartContactEvent(orxPHYSICS_BODY_PART *_pstBodyPart, orxBOOL _bEnable);
+
 
 /** Enables a (revolute) body joint motor
  * @param[in]   _pstBodyJoint                         Concerned body joint
@@ -672,6 +732,20 @@ extern orxDLLAPI orxFLOAT orxFASTCALL                 orxPhysics_GetJointReactio
  */
 extern orxDLLAPI orxHANDLE orxFASTCALL                orxPhysics_Raycast(const orxVECTOR *_pvBegin, const orxVECTOR *_pvEnd, orxU16 _u16SelfFlags, orxU16 _u16CheckMask, orxBOOL _bEarlyExit, orxVECTOR *_pvContact, orxVECTOR *_pvNormal);
 
+/** Issues a batch of raycasts, results are stored in the queries themselves
+ * @param[in,out] _astRaycastList                     List of raycast queries
+ * @param[in]   _u32Number                            Number of queries
+ * @return      Number of raycasts that hit a body
+ */
+extern orxDLLAPI orxU32 orxFASTCALL                   orxPhysics_RaycastBatch(orxPHYSICS_RAYCAST *_astRaycastList, orxU32 _u32Number);
+
+/** Issues a batch of box overlap queries, results are stored in the buffers provided by the queries
+ * @param[in,out] _astOverlapList                     List of overlap queries
+ * @param[in]   _u32Number                            Number of queries
+ * @return      Total number of overlapping bodies found
+ */
+extern orxDLLAPI orxU32 orxFASTCALL                   orxPhysics_OverlapBatch(orxPHYSICS_OVERLAP *_astOverlapList, orxU32 _u32Number);
+
 
 /** Enables/disables physics simulation
  * @param[in]   _bEnable                              Enable / disable
@@ -65,6 +65,7 @@ typedef enum __orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_t
   orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_SET_BITMAP_COLOR_KEY,
   orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_SET_BITMAP_DATA,
   orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_GET_BITMAP_DATA,
+  orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_READ_BACK_BITMAP_DATA,
   orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_SET_BITMAP_COLOR,
   orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_GET_BITMAP_COLOR,
   orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_GET_BITMAP_SIZE,
@@ -97,6 +97,7 @@ typedef enum __orxPLUGIN_FUNCTION_BASE_ID_PHYSICS_t
 
   orxPLUGIN_FUNCTION_BASE_ID_PHYSICS_IS_PART_SOLID,
   orxPLUGIN_FUNCTION_BASE_ID_PHYSICS_SET_PART_SOLID,
+  orxPLUGIN_FUNCTION_BASE_ID_PHYSICS_ENABLE_PART_CONTACT_EVENT,
 
   orxPLUGIN_FUNCTION_BASE_ID_PHYSICS_ENABLE_MOTOR,
   orxPLUGIN_FUNCTION_BASE_ID_PHYSICS_SET_JOINT_MOTOR_SPEED,
@@ -106,6 +107,8 @@ typedef enum __orxPLUGIN_FUNCTION_BASE_ID_PHYSICS_t
   orxPLUGIN_FUNCTION_BASE_ID_PHYSICS_GET_JOINT_REACTION_TORQUE,
 
   orxPLUGIN_FUNCTION_BASE_ID_PHYSICS_RAYCAST,
+  orxPLUGIN_FUNCTION_BASE_ID_PHYSICS_RAYCAST_BATCH,
+  orxPLUGIN_FUNCTION_BASE_ID_PHYSICS_OVERLAP_BATCH,
 
   orxPLUGIN_FUNCTION_BASE_ID_PHYSICS_ENABLE_SIMULATION,
 
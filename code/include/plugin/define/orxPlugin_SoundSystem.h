@@ -85,6 +85,7 @@ typedef enum __orxPLUGIN_FUNCTION_BASE_ID_SOUNDSYSTEM_t
   orxPLUGIN_FUNCTION_BASE_ID_SOUNDSYSTEM_GET_GLOBAL_VOLUME,
   orxPLUGIN_FUNCTION_BASE_ID_SOUNDSYSTEM_SET_LISTENER_POSITION,
   orxPLUGIN_FUNCTION_BASE_ID_SOUNDSYSTEM_GET_LISTENER_POSITION,
+  orxPLUGIN_FUNCTION_BASE_ID_SOUNDSYSTEM_GET_UNDERRUN_COUNT,
 
   orxPLUGIN_FUNCTION_BASE_ID_SOUNDSYSTEM_NUMBER,
 
@@ -60,6 +60,7 @@
 #define orxRENDER_KZ_CONFIG_SHOW_PROFILER           "ShowProfiler"
 #define orxRENDER_KZ_CONFIG_MIN_FREQUENCY           "MinFrequency"
 #define orxRENDER_KZ_CONFIG_CONSOLE_COLOR           "ConsoleColor"
+#define orxRENDER_KZ_CONFIG_FRAME_GRAPH             "FrameGraph"
 
 
 /** Inputs
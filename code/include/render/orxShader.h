@@ -253,6 +253,20 @@ extern orxDLLAPI orxBOOL orxFASTCALL            orxShader_IsEnabled(const orxSHA
  */
 extern orxDLLAPI const orxSTRING orxFASTCALL    orxShader_GetName(const orxSHADER *_pstShader);
 
+/** Gets shader texture count, ie. the number of texture parameter values currently bound
+ * @param[in]   _pstShader            Concerned Shader
+ * @return      Number of bound textures
+ */
+extern orxDLLAPI orxU32 orxFASTCALL             orxShader_GetTextureCount(const orxSHADER *_pstShader);
+
+/** Gets shader textures, ie. the textures currently bound to its texture parameters
+ * @param[in]   _pstShader            Concerned Shader
+ * @param[in]   _u32TextureNumber     Number of textures to retrieve
+ * @param[out]  _apstTextureList      List of textures
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL          orxShader_GetTextureList(const orxSHADER *_pstShader, orxU32 _u32TextureNumber, const orxTEXTURE **_apstTextureList);
+
 #endif /* _orxSHADER_H_ */
 
 /** @} */
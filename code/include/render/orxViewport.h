@@ -184,6 +184,18 @@ extern orxDLLAPI void orxFASTCALL             orxViewport_Enable(orxVIEWPORT *_p
  */
 extern orxDLLAPI orxBOOL orxFASTCALL          orxViewport_IsEnabled(const orxVIEWPORT *_pstViewport);
 
+/** Enables / disables a viewport's cache: a cached viewport is only re-rendered when its content changes
+ * @param[in]   _pstViewport    Concerned viewport
+ * @param[in]   _bEnable        Enable / disable
+ */
+extern orxDLLAPI void orxFASTCALL             orxViewport_EnableCache(orxVIEWPORT *_pstViewport, orxBOOL _bEnable);
+
+/** Is a viewport's cache enabled?
+ * @param[in]   _pstViewport    Concerned viewport
+ * @return      orxTRUE / orxFALSE
+ */
+extern orxDLLAPI orxBOOL orxFASTCALL          orxViewport_IsCacheEnabled(const orxVIEWPORT *_pstViewport);
+
 
 /** Sets a viewport camera
  * @param[in]   _pstViewport    Concerned viewport
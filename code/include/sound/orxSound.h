@@ -117,6 +117,21 @@ typedef struct __orxSOUND_STREAM_PACKET_t
 
 } orxSOUND_STREAM_PACKET;
 
+/** Sound sample cache info
+ */
+typedef struct __orxSOUND_SAMPLE_CACHE_INFO_t
+{
+  orxU32    u32SampleCount;                   /**< Number of resident samples : 4 */
+  orxU32    u32IdleCount;                     /**< Number of resident samples not referenced by any sound (evictable) : 8 */
+  orxU32    u32PendingCount;                  /**< Number of samples still being decoded : 12 */
+  orxU32    u32Size;                          /**< Decoded size of resident samples, in bytes : 16 */
+  orxU32    u32MaxSize;                       /**< Cache size (SampleCacheSize), in bytes, 0 if unreferenced samples are unloaded right away : 20 */
+  orxU32    u32HitCount;                      /**< Number of sample loads served by the cache : 24 */
+  orxU32    u32MissCount;                     /**< Number of sample loads that needed decoding : 28 */
+  orxU32    u32EvictionCount;                 /**< Number of idle samples evicted to stay within the cache size : 32 */
+
+} orxSOUND_SAMPLE_CACHE_INFO;
+
 /** Sound event payload
  */
 typedef struct __orxSOUND_EVENT_PAYLOAD_t
@@ -311,6 +326,13 @@ extern orxDLLAPI orxSTATUS orxFASTCALL        orxSound_SetReferenceDistance(orxS
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL        orxSound_Loop(orxSOUND *_pstSound, orxBOOL _bLoop);
 
+/** Sets sound priority
+ * @param[in] _pstSound       Concerned Sound
+ * @param[in] _fPriority      Desired priority, sounds with higher priorities keep their voices when the voice budget is exceeded
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL        orxSound_SetPriority(orxSOUND *_pstSound, orxFLOAT _fPriority);
+
 
 /** Gets sound volume
  * @param[in] _pstSound       Concerned Sound
@@ -355,6 +377,12 @@ extern orxDLLAPI orxFLOAT orxFASTCALL         orxSound_GetReferenceDistance(cons
  */
 extern orxDLLAPI orxBOOL orxFASTCALL          orxSound_IsLooping(const orxSOUND *_pstSound);
 
+/** Gets sound priority
+ * @param[in] _pstSound       Concerned Sound
+ * @return orxFLOAT
+ */
+extern orxDLLAPI orxFLOAT orxFASTCALL         orxSound_GetPriority(const orxSOUND *_pstSound);
+
 
 /** Gets sound duration
  * @param[in] _pstSound       Concerned Sound
@@ -368,6 +396,34 @@ extern orxDLLAPI orxFLOAT orxFASTCALL         orxSound_GetDuration(const orxSOUN
  */
 extern orxDLLAPI orxSOUND_STATUS orxFASTCALL  orxSound_GetStatus(const orxSOUND *_pstSound);
 
+/** Is sound virtual (ie. currently without any sound system voice)?
+ * @param[in] _pstSound       Concerned Sound
+ * @return orxTRUE / orxFALSE
+ */
+extern orxDLLAPI orxBOOL orxFASTCALL          orxSound_IsVirtual(const orxSOUND *_pstSound);
+
+/** Is sound ready (ie. its sample has been decoded)? A sound that isn't ready yet can still be played: it'll start once decoded
+ * @param[in] _pstSound       Concerned Sound
+ * @return orxTRUE / orxFALSE
+ */
+extern orxDLLAPI orxBOOL orxFASTCALL          orxSound_IsReady(const orxSOUND *_pstSound);
+
+/** Gets sample cache info
+ * @param[out] _pstInfo       Sample cache info
+ * @return orxSOUND_SAMPLE_CACHE_INFO
+ */
+extern orxDLLAPI orxSOUND_SAMPLE_CACHE_INFO *orxFASTCALL orxSound_GetSampleCacheInfo(orxSOUND_SAMPLE_CACHE_INFO *_pstInfo);
+
+/** Gets real voice count (ie. playing or paused sounds currently owning a sound system voice), as of the last voice update
+ * @return Real voice count
+ */
+extern orxDLLAPI orxU32 orxFASTCALL           orxSound_GetRealVoiceCount();
+
+/** Gets virtual voice count (ie. playing or paused sounds whose cursor is tracked without any sound system voice), as of the last voice update
+ * @return Virtual voice count
+ */
+extern orxDLLAPI orxU32 orxFASTCALL           orxSound_GetVirtualVoiceCount();
+
 /** Gets sound config name
  * @param[in]   _pstSound     Concerned sound
  * @return      orxSTRING / orxSTRING_EMPTY
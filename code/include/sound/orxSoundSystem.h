@@ -78,6 +78,7 @@ typedef enum __orxSOUNDSYSTEM_STATUS_t
 #define orxSOUNDSYSTEM_KZ_CONFIG_RATIO                "DimensionRatio"
 #define orxSOUNDSYSTEM_KZ_CONFIG_STREAM_BUFFER_SIZE   "StreamBufferSize"
 #define orxSOUNDSYSTEM_KZ_CONFIG_STREAM_BUFFER_NUMBER "StreamBufferNumber"
+#define orxSOUNDSYSTEM_KZ_CONFIG_STREAM_MAX_BUFFER_NUMBER "StreamMaxBufferNumber"
 
 
 /***************************************************************************
@@ -127,7 +128,7 @@ extern orxDLLAPI orxSTATUS orxFASTCALL                orxSoundSystem_DeleteSampl
  * @param[in]   _pu32ChannelNumber                    Number of channels of the sample
  * @param[in]   _pu32FrameNumber                      Number of frame of the sample (number of "samples" = number of frames * number of channels)
  * @param[in]   _pu32SampleRate                       Sampling rate of the sample (ie. number of frames per second)
- * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE (ie. also while the sample is still being decoded in the background)
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL                orxSoundSystem_GetSampleInfo(const orxSOUNDSYSTEM_SAMPLE *_pstSample, orxU32 *_pu32ChannelNumber, orxU32 *_pu32FrameNumber, orxU32 *_pu32SampleRate);
 
@@ -329,6 +330,11 @@ extern orxDLLAPI orxSTATUS orxFASTCALL                orxSoundSystem_SetListener
  */
 extern orxDLLAPI orxVECTOR *orxFASTCALL               orxSoundSystem_GetListenerPosition(orxVECTOR *_pvPosition);
 
+/** Gets the number of stream underruns (streams that ran out of queued data while playing) since init
+ * @return Underrun count
+ */
+extern orxDLLAPI orxU32 orxFASTCALL                   orxSoundSystem_GetUnderrunCount();
+
 #endif /* _orxSOUNDSYSTEM_H_ */
 
 /** @} */
@@ -0,0 +1,486 @@
+/* Orx - Portable Game Engine
+ *
+ * Copyright (c) 2008-2018 Orx-Project
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ *    1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ *    2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ *    3. This notice may not be removed or altered from any source
+ *    distribution.
+ */
+
+/**
+ * @file orxBenchmark.c
+ * @date 19/10/2026
+ * @author agent@local
+ *
+ * Benchmark
+ *
+ * Runs all the scenarios listed in Benchmark.ini, one after the other, with a fixed DT and a fixed random seed,
+ * then writes the frame and profiler marker times of each scenario to a CSV and a JSON report before quitting.
+ * Run it with: orx -c Benchmark.ini
+ * Per-module times are only available in profile builds, and a headless build removes any display cost variance.
+ *
+ */
+
+
+#include "orxPluginAPI.h"
+
+
+/** Config defines
+ */
+#define orxBENCHMARK_KZ_CONFIG_SECTION            "Benchmark"
+#define orxBENCHMARK_KZ_CONFIG_SCENARIO_LIST      "ScenarioList"
+#define orxBENCHMARK_KZ_CONFIG_VIEWPORT_LIST      "ViewportList"
+#define orxBENCHMARK_KZ_CONFIG_REPORT             "Report"
+#define orxBENCHMARK_KZ_CONFIG_FRAMES             "Frames"
+#define orxBENCHMARK_KZ_CONFIG_WARMUP             "Warmup"
+#define orxBENCHMARK_KZ_CONFIG_DT                 "DT"
+#define orxBENCHMARK_KZ_CONFIG_SEED               "Seed"
+#define orxBENCHMARK_KZ_CONFIG_OBJECT_LIST        "ObjectList"
+#define orxBENCHMARK_KZ_CONFIG_COUNT              "Count"
+#define orxBENCHMARK_KZ_CONFIG_CREATE_LIST        "CreateList"
+#define orxBENCHMARK_KZ_CONFIG_CREATE_COUNT       "CreateCount"
+#define orxBENCHMARK_KZ_CONFIG_RELOAD_LIST        "ReloadList"
+#define orxBENCHMARK_KZ_CONFIG_RELOAD_CONFIG      "ReloadConfig"
+#define orxBENCHMARK_KZ_CONFIG_RELOAD_INTERVAL    "ReloadInterval"
+
+#define orxBENCHMARK_KU32_MARKER_BANK_SIZE        128
+
+/** Marker statistics
+ */
+typedef struct __orxBENCHMARK_MARKER_t
+{
+  orxDOUBLE dTotalTime;
+  orxDOUBLE dMaxTime;
+  orxU32    u32PushCount;
+
+} orxBENCHMARK_MARKER;
+
+static orxCLOCK      *spstClock                             = orxNULL;
+static orxHASHTABLE  *spstMarkerTable                       = orxNULL;
+static orxBANK       *spstMarkerBank                        = orxNULL;
+static orxFILE       *spstCSVFile                           = orxNULL;
+static orxFILE       *spstJSONFile                          = orxNULL;
+static const orxSTRING szScenario                           = orxNULL;
+static orxS32         ss32ScenarioIndex                     = 0;
+static orxU32         su32Frame                             = 0;
+static orxU32         su32FrameNumber                       = 0;
+static orxU32         su32WarmupNumber                      = 0;
+static orxU32         su32RecordNumber                      = 0;
+static orxDOUBLE      sdFrameTimeStamp                      = orx2D(0.0);
+static orxDOUBLE      sdTotalTime                           = orx2D(0.0);
+static orxDOUBLE      sdMinTime                             = orx2D(0.0);
+static orxDOUBLE      sdMaxTime                             = orx2D(0.0);
+
+/** Records the last frame
+ */
+static void orxBenchmark_Record(orxDOUBLE _dFrameTime)
+{
+  /* Updates frame stats */
+  sdTotalTime += _dFrameTime;
+  sdMinTime    = (su32RecordNumber == 0) ? _dFrameTime : orxMIN(sdMinTime, _dFrameTime);
+  sdMaxTime    = orxMAX(sdMaxTime, _dFrameTime);
+  su32RecordNumber++;
+
+#ifdef __orxPROFILER__
+  {
+    orxS32 s32MarkerID;
+
+    /* Queries last frame */
+    orxProfiler_SelectQueryFrame(0, orxTHREAD_KU32_MAIN_THREAD_ID);
+
+    /* For all markers */
+    for(s32MarkerID = orxProfiler_GetNextMarkerID(orxPROFILER_KS32_MARKER_ID_NONE);
+        s32MarkerID != orxPROFILER_KS32_MARKER_ID_NONE;
+        s32MarkerID = orxProfiler_GetNextMarkerID(s32MarkerID))
+    {
+      orxU32 u32PushCount;
+
+      /* Gets its push count */
+      u32PushCount = orxProfiler_GetMarkerPushCount(s32MarkerID);
+
+      /* Was used? */
+      if(u32PushCount != 0)
+      {
+        orxBENCHMARK_MARKER **ppstMarker;
+
+        /* Retrieves its stats */
+        ppstMarker = (orxBENCHMARK_MARKER **)orxHashTable_Retrieve(spstMarkerTable, (orxU64)s32MarkerID);
+
+        /* New? */
+        if(*ppstMarker == orxNULL)
+        {
+          /* Creates it */
+          *ppstMarker = (orxBENCHMARK_MARKER *)orxBank_Allocate(spstMarkerBank);
+          orxMemory_Zero(*ppstMarker, sizeof(orxBENCHMARK_MARKER));
+        }
+
+        /* Updates it */
+        (*ppstMarker)->dTotalTime    += orxProfiler_GetMarkerTime(s32MarkerID);
+        (*ppstMarker)->dMaxTime       = orxMAX((*ppstMarker)->dMaxTime, orxProfiler_GetMarkerTime(s32MarkerID));
+        (*ppstMarker)->u32PushCount  += u32PushCount;
+      }
+    }
+  }
+#endif /* __orxPROFILER__ */
+}
+
+/** Writes the report of the current scenario
+ */
+static void orxBenchmark_WriteReport()
+{
+  orxDOUBLE dRecordNumber;
+
+  /* Gets record number */
+  dRecordNumber = (su32RecordNumber != 0) ? (orxDOUBLE)su32RecordNumber : orx2D(1.0);
+
+  /* Writes frame stats */
+  if(spstCSVFile != orxNULL)
+  {
+    orxFile_Print(spstCSVFile, "%s,Frame,%u,%.6f,%.6f,%.6f,1\n", szScenario, su32RecordNumber, orx2D(1000.0) * sdTotalTime / dRecordNumber, orx2D(1000.0) * sdMinTime, orx2D(1000.0) * sdMaxTime);
+  }
+  if(spstJSONFile != orxNULL)
+  {
+    orxFile_Print(spstJSONFile, "%s\n    {\"name\": \"%s\", \"frames\": %u, \"frame\": {\"avg_ms\": %.6f, \"min_ms\": %.6f, \"max_ms\": %.6f}, \"markers\": [", (ss32ScenarioIndex != 0) ? "," : "", szScenario, su32RecordNumber, orx2D(1000.0) * sdTotalTime / dRecordNumber, orx2D(1000.0) * sdMinTime, orx2D(1000.0) * sdMaxTime);
+  }
+
+#ifdef __orxPROFILER__
+  {
+    orxS32  s32MarkerID;
+    orxBOOL bFirst = orxTRUE;
+
+    /* For all markers */
+    for(s32MarkerID = orxProfiler_GetNextMarkerID(orxPROFILER_KS32_MARKER_ID_NONE);
+        s32MarkerID != orxPROFILER_KS32_MARKER_ID_NONE;
+        s32MarkerID = orxProfiler_GetNextMarkerID(s32MarkerID))
+    {
+      orxBENCHMARK_MARKER *pstMarker;
+
+      /* Gets its stats */
+      pstMarker = (orxBENCHMARK_MARKER *)orxHashTable_Get(spstMarkerTable, (orxU64)s32MarkerID);
+
+      /* Valid? */
+      if(pstMarker != orxNULL)
+      {
+        /* Writes them */
+        if(spstCSVFile != orxNULL)
+        {
+          orxFile_Print(spstCSVFile, "%s,%s,%u,%.6f,,%.6f,%.2f\n", szScenario, orxProfiler_GetMarkerName(s32MarkerID), su32RecordNumber, orx2D(1000.0) * pstMarker->dTotalTime / dRecordNumber, orx2D(1000.0) * pstMarker->dMaxTime, (orxDOUBLE)pstMarker->u32PushCount / dRecordNumber);
+        }
+        if(spstJSONFile != orxNULL)
+        {
+          orxFile_Print(spstJSONFile, "%s\n      {\"name\": \"%s\", \"avg_ms\": %.6f, \"max_ms\": %.6f, \"avg_calls\": %.2f}", (bFirst != orxFALSE) ? "" : ",", orxProfiler_GetMarkerName(s32MarkerID), orx2D(1000.0) * pstMarker->dTotalTime / dRecordNumber, orx2D(1000.0) * pstMarker->dMaxTime, (orxDOUBLE)pstMarker->u32PushCount / dRecordNumber);
+        }
+
+        /* Updates status */
+        bFirst = orxFALSE;
+      }
+    }
+  }
+#endif /* __orxPROFILER__ */
+
+  /* Closes scenario */
+  if(spstJSONFile != orxNULL)
+  {
+    orxFile_Print(spstJSONFile, "]}");
+  }
+
+  /* Logs */
+  orxLOG("[BENCHMARK] %s: %u frames, avg %.3fms, min %.3fms, max %.3fms.", szScenario, su32RecordNumber, orx2D(1000.0) * sdTotalTime / dRecordNumber, orx2D(1000.0) * sdMinTime, orx2D(1000.0) * sdMaxTime);
+
+  /* Clears marker stats */
+  orxHashTable_Clear(spstMarkerTable);
+  orxBank_Clear(spstMarkerBank);
+}
+
+/** Closes the report
+ */
+static void orxBenchmark_CloseReport()
+{
+  /* Closes files */
+  if(spstCSVFile != orxNULL)
+  {
+    orxFile_Close(spstCSVFile);
+    spstCSVFile = orxNULL;
+  }
+  if(spstJSONFile != orxNULL)
+  {
+    orxFile_Print(spstJSONFile, "\n  ]\n}\n");
+    orxFile_Close(spstJSONFile);
+    spstJSONFile = orxNULL;
+  }
+}
+
+/** Creates all the objects of a list, multiple times
+ */
+static void orxBenchmark_CreateObjects(const orxSTRING _zListKey, orxU32 _u32Count)
+{
+  orxS32 i, s32Number;
+  orxU32 j;
+
+  /* For all objects */
+  for(i = 0, s32Number = orxConfig_GetListCount(_zListKey); i < s32Number; i++)
+  {
+    /* For all instances */
+    for(j = 0; j < _u32Count; j++)
+    {
+      /* Creates it */
+      orxObject_CreateFromConfig(orxConfig_GetListString(_zListKey, i));
+    }
+  }
+}
+
+/** Starts a scenario
+ */
+static void orxBenchmark_Start(const orxSTRING _zScenario)
+{
+  /* Stores it */
+  szScenario = orxString_Store(_zScenario);
+
+  /* Pushes its section */
+  orxConfig_PushSection(szScenario);
+
+  /* Gets frame info */
+  su32FrameNumber   = orxConfig_GetU32(orxBENCHMARK_KZ_CONFIG_FRAMES);
+  su32WarmupNumber  = orxConfig_GetU32(orxBENCHMARK_KZ_CONFIG_WARMUP);
+  su32Frame         = 0;
+
+  /* Resets stats */
+  su32RecordNumber  = 0;
+  sdTotalTime       = sdMinTime = sdMaxTime = orx2D(0.0);
+
+  /* Uses a fixed DT and seed */
+  orxClock_SetModifier(spstClock, orxCLOCK_MOD_TYPE_FIXED, orxConfig_GetFloat(orxBENCHMARK_KZ_CONFIG_DT));
+  orxMath_InitRandom(orxConfig_GetU32(orxBENCHMARK_KZ_CONFIG_SEED));
+
+  /* Creates initial objects */
+  orxBenchmark_CreateObjects(orxBENCHMARK_KZ_CONFIG_OBJECT_LIST, orxConfig_HasValue(orxBENCHMARK_KZ_CONFIG_COUNT) ? orxConfig_GetU32(orxBENCHMARK_KZ_CONFIG_COUNT) : 1);
+
+  /* Pops config section */
+  orxConfig_PopSection();
+}
+
+/** Steps the current scenario
+ */
+static void orxBenchmark_Step()
+{
+  orxU32 u32Interval;
+
+  /* Pushes its section */
+  orxConfig_PushSection(szScenario);
+
+  /* Creates per-frame objects */
+  orxBenchmark_CreateObjects(orxBENCHMARK_KZ_CONFIG_CREATE_LIST, orxConfig_GetU32(orxBENCHMARK_KZ_CONFIG_CREATE_COUNT));
+
+  /* Gets reload interval */
+  u32Interval = orxConfig_GetU32(orxBENCHMARK_KZ_CONFIG_RELOAD_INTERVAL);
+
+  /* Should reload? */
+  if((u32Interval != 0) && ((su32Frame % u32Interval) == 0))
+  {
+    orxS32 i, s32Number;
+
+    /* For all textures */
+    for(i = 0, s32Number = orxConfig_GetListCount(orxBENCHMARK_KZ_CONFIG_RELOAD_LIST); i < s32Number; i++)
+    {
+      orxTEXTURE *pstTexture;
+
+      /* Loads it */
+      pstTexture = orxTexture_CreateFromFile(orxConfig_GetListString(orxBENCHMARK_KZ_CONFIG_RELOAD_LIST, i), orxFALSE);
+
+      /* Success? */
+      if(pstTexture != orxNULL)
+      {
+        /* Unloads it */
+        orxTexture_Delete(pstTexture);
+      }
+    }
+
+    /* Should reload config? */
+    if(orxConfig_GetBool(orxBENCHMARK_KZ_CONFIG_RELOAD_CONFIG) != orxFALSE)
+    {
+      /* Reloads it */
+      orxConfig_ReloadHistory();
+    }
+  }
+
+  /* Pops config section */
+  orxConfig_PopSection();
+}
+
+/** Stops the current scenario
+ */
+static void orxBenchmark_Stop()
+{
+  orxOBJECT *pstObject;
+
+  /* Writes report */
+  orxBenchmark_WriteReport();
+
+  /* For all objects */
+  for(pstObject = orxOBJECT(orxStructure_GetFirst(orxSTRUCTURE_ID_OBJECT));
+      pstObject != orxNULL;
+      pstObject = orxOBJECT(orxStructure_GetNext(pstObject)))
+  {
+    /* Marks it for deletion */
+    orxObject_SetLifeTime(pstObject, orxFLOAT_0);
+  }
+
+  /* Goes to next scenario */
+  szScenario = orxNULL;
+  ss32ScenarioIndex++;
+}
+
+/** Update callback
+ */
+static void orxFASTCALL orxBenchmark_Update(const orxCLOCK_INFO *_pstClockInfo, void *_pContext)
+{
+  orxDOUBLE dTime;
+
+  /* Gets current time */
+  dTime = orxSystem_GetTime();
+
+  /* Running a scenario? */
+  if(szScenario != orxNULL)
+  {
+    /* Past warmup? */
+    if(su32Frame > su32WarmupNumber)
+    {
+      /* Records last frame */
+      orxBenchmark_Record(dTime - sdFrameTimeStamp);
+    }
+
+    /* Done? */
+    if(su32Frame >= su32WarmupNumber + su32FrameNumber)
+    {
+      /* Stops it */
+      orxBenchmark_Stop();
+    }
+    else
+    {
+      /* Steps it */
+      orxBenchmark_Step();
+
+      /* Updates frame */
+      su32Frame++;
+    }
+  }
+  else
+  {
+    /* Pushes config section */
+    orxConfig_PushSection(orxBENCHMARK_KZ_CONFIG_SECTION);
+
+    /* Has remaining scenario? */
+    if(ss32ScenarioIndex < orxConfig_GetListCount(orxBENCHMARK_KZ_CONFIG_SCENARIO_LIST))
+    {
+      /* Starts it */
+      orxBenchmark_Start(orxConfig_GetListString(orxBENCHMARK_KZ_CONFIG_SCENARIO_LIST, ss32ScenarioIndex));
+    }
+    else
+    {
+      /* Closes report */
+      orxBenchmark_CloseReport();
+
+      /* Quits */
+      orxEvent_SendShort(orxEVENT_TYPE_SYSTEM, orxSYSTEM_EVENT_CLOSE);
+    }
+
+    /* Pops config section */
+    orxConfig_PopSection();
+  }
+
+  /* Stores time stamp */
+  sdFrameTimeStamp = dTime;
+}
+
+/** Event handler
+ */
+static orxSTATUS orxFASTCALL orxBenchmark_EventHandler(const orxEVENT *_pstEvent)
+{
+  /* Closing before the end? */
+  if((_pstEvent->eType == orxEVENT_TYPE_SYSTEM) && (_pstEvent->eID == orxSYSTEM_EVENT_CLOSE))
+  {
+    /* Closes report */
+    orxBenchmark_CloseReport();
+  }
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+/** Inits the benchmark
+ */
+static orxSTATUS orxBenchmark_Init()
+{
+  orxS32    i;
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Loads config file and selects its section */
+  orxConfig_Load("Benchmark.ini");
+  orxConfig_SelectSection(orxBENCHMARK_KZ_CONFIG_SECTION);
+
+  /* Creates marker storage */
+  spstMarkerTable = orxHashTable_Create(orxBENCHMARK_KU32_MARKER_BANK_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+  spstMarkerBank  = orxBank_Create(orxBENCHMARK_KU32_MARKER_BANK_SIZE, sizeof(orxBENCHMARK_MARKER), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+
+  /* Gets core clock */
+  spstClock = orxClock_FindFirst(orx2F(-1.0f), orxCLOCK_TYPE_CORE);
+
+  /* Valid? */
+  if((spstMarkerTable != orxNULL) && (spstMarkerBank != orxNULL) && (spstClock != orxNULL))
+  {
+    orxCHAR acBuffer[256];
+
+    /* Opens report files */
+    acBuffer[orxString_NPrint(acBuffer, sizeof(acBuffer) - 1, "%s.csv", orxConfig_GetString(orxBENCHMARK_KZ_CONFIG_REPORT))] = orxCHAR_NULL;
+    spstCSVFile = orxFile_Open(acBuffer, orxFILE_KU32_FLAG_OPEN_WRITE);
+    acBuffer[orxString_NPrint(acBuffer, sizeof(acBuffer) - 1, "%s.json", orxConfig_GetString(orxBENCHMARK_KZ_CONFIG_REPORT))] = orxCHAR_NULL;
+    spstJSONFile = orxFile_Open(acBuffer, orxFILE_KU32_FLAG_OPEN_WRITE);
+
+    /* Writes headers */
+    if(spstCSVFile != orxNULL)
+    {
+      orxFile_Print(spstCSVFile, "Scenario,Marker,Frames,AverageMS,MinMS,MaxMS,AverageCalls\n");
+    }
+    if(spstJSONFile != orxNULL)
+    {
+#ifdef __orxPROFILER__
+      orxFile_Print(spstJSONFile, "{\n  \"version\": \"%s\",\n  \"profiler\": true,\n  \"scenarios\":\n  [", orxSystem_GetVersionFullString());
+#else /* __orxPROFILER__ */
+      orxFile_Print(spstJSONFile, "{\n  \"version\": \"%s\",\n  \"profiler\": false,\n  \"scenarios\":\n  [", orxSystem_GetVersionFullString());
+#endif /* __orxPROFILER__ */
+    }
+
+    /* Creates all viewports */
+    for(i = 0; i < orxConfig_GetListCount(orxBENCHMARK_KZ_CONFIG_VIEWPORT_LIST); i++)
+    {
+      orxViewport_CreateFromConfig(orxConfig_GetListString(orxBENCHMARK_KZ_CONFIG_VIEWPORT_LIST, i));
+    }
+
+    /* Registers callback */
+    eResult = orxClock_Register(spstClock, &orxBenchmark_Update, orxNULL, orxMODULE_ID_MAIN, orxCLOCK_PRIORITY_LOWEST);
+
+    /* Registers event handler */
+    eResult = (eResult != orxSTATUS_FAILURE) ? orxEvent_AddHandler(orxEVENT_TYPE_SYSTEM, orxBenchmark_EventHandler) : orxSTATUS_FAILURE;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/* Registers plugin entry */
+orxPLUGIN_DECLARE_ENTRY_POINT(orxBenchmark_Init);
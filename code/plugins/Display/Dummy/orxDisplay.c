@@ -0,0 +1,1531 @@
+/* Orx - Portable Game Engine
+ *
+ * Copyright (c) 2008-2018 Orx-Project
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ *    1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ *    2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ *    3. This notice may not be removed or altered from any source
+ *    distribution.
+ */
+
+/**
+ * @file orxDisplay.c
+ * @date 19/10/2026
+ * @author agent@local
+ *
+ * Dummy (headless) display plugin implementation
+ *
+ * Bitmaps live in CPU memory and all draw calls are no-ops that are only counted,
+ * which lets the simulation run without any window or graphics context.
+ * Only uncompressed TGA/BMP images get their pixels decoded, PNG/JPEG only get their size,
+ * and bitmaps can only be saved as uncompressed TGA.
+ *
+ */
+
+
+#include "orxPluginAPI.h"
+
+
+/** Module flags
+ */
+#define orxDISPLAY_KU32_STATIC_FLAG_NONE        0x00000000  /**< No flags */
+
+#define orxDISPLAY_KU32_STATIC_FLAG_READY       0x00000001  /**< Ready flag */
+#define orxDISPLAY_KU32_STATIC_FLAG_VSYNC       0x00000002  /**< VSync flag */
+#define orxDISPLAY_KU32_STATIC_FLAG_FULLSCREEN  0x00000004  /**< Full screen flag */
+
+#define orxDISPLAY_KU32_STATIC_MASK_ALL         0xFFFFFFFF  /**< All mask */
+
+#define orxDISPLAY_KU32_BITMAP_BANK_SIZE        256
+
+#define orxDISPLAY_KU32_MAX_TEXTURE_UNIT_NUMBER 32
+
+#define orxDISPLAY_KU32_DEFAULT_WIDTH           1024
+#define orxDISPLAY_KU32_DEFAULT_HEIGHT          768
+#define orxDISPLAY_KU32_DEFAULT_DEPTH           32
+#define orxDISPLAY_KU32_DEFAULT_REFRESH_RATE    60
+
+#define orxDISPLAY_KU32_TGA_HEADER_SIZE         18
+#define orxDISPLAY_KU32_BMP_HEADER_SIZE         54
+
+
+/***************************************************************************
+ * Structure declaration                                                   *
+ ***************************************************************************/
+
+/** Internal bitmap structure
+ */
+struct __orxBITMAP_t
+{
+  orxU8                    *au8Data;
+  orxFLOAT                  fWidth, fHeight;
+  orxU32                    u32Width, u32Height;
+  orxAABOX                  stClip;
+  orxRGBA                   stColor;
+  orxRGBA                   stClearColor;
+  const orxSTRING           zLocation;
+  orxSTRINGID               stFilenameID;
+  orxU32                    u32ID;
+};
+
+/** Internal read back info structure
+ */
+typedef struct __orxDISPLAY_READ_BACK_INFO_t
+{
+  orxDISPLAY_READ_BACK_FUNCTION pfnCallback;
+  void                     *pContext;
+  orxU8                    *pu8ImageData;
+  orxU32                    u32Width;
+  orxU32                    u32Height;
+
+} orxDISPLAY_READ_BACK_INFO;
+
+/** Static structure
+ */
+typedef struct __orxDISPLAY_STATIC_t
+{
+  orxBANK                  *pstBitmapBank;
+  orxBITMAP                *pstScreen;
+  const orxBITMAP          *pstTempBitmap;
+  orxBITMAP                *apstDestinationBitmapList[orxDISPLAY_KU32_MAX_TEXTURE_UNIT_NUMBER];
+  orxU32                    u32DestinationBitmapCount;
+  orxU32                    u32Depth, u32RefreshRate;
+  orxU32                    u32BitmapID;
+  orxU32                    u32DrawCallCount, u32ItemCount;
+  orxU32                    u32FrameCount;
+  orxU32                    u32MaxDrawCallCount, u32MaxItemCount;
+  orxU64                    u64TotalDrawCallCount, u64TotalItemCount;
+  orxDISPLAY_BLEND_MODE     eBlendMode;
+  orxU32                    u32Flags;
+
+} orxDISPLAY_STATIC;
+
+
+/***************************************************************************
+ * Static variables                                                        *
+ ***************************************************************************/
+
+/** Static data
+ */
+static orxDISPLAY_STATIC sstDisplay;
+
+
+/***************************************************************************
+ * Private functions                                                       *
+ ***************************************************************************/
+
+/** Counts a draw call
+ */
+static orxINLINE void orxDisplay_Dummy_CountDrawCall(orxU32 _u32ItemNumber)
+{
+  /* Updates counters */
+  sstDisplay.u32DrawCallCount++;
+  sstDisplay.u32ItemCount += _u32ItemNumber;
+
+  /* Done! */
+  return;
+}
+
+/** Gets 16-bit little endian value
+ */
+static orxINLINE orxU32 orxDisplay_Dummy_GetU16LE(const orxU8 *_pu8Data)
+{
+  /* Done! */
+  return (orxU32)_pu8Data[0] | ((orxU32)_pu8Data[1] << 8);
+}
+
+/** Gets 32-bit little endian value
+ */
+static orxINLINE orxU32 orxDisplay_Dummy_GetU32LE(const orxU8 *_pu8Data)
+{
+  /* Done! */
+  return (orxU32)_pu8Data[0] | ((orxU32)_pu8Data[1] << 8) | ((orxU32)_pu8Data[2] << 16) | ((orxU32)_pu8Data[3] << 24);
+}
+
+/** Gets 16-bit big endian value
+ */
+static orxINLINE orxU32 orxDisplay_Dummy_GetU16BE(const orxU8 *_pu8Data)
+{
+  /* Done! */
+  return ((orxU32)_pu8Data[0] << 8) | (orxU32)_pu8Data[1];
+}
+
+/** Gets 32-bit big endian value
+ */
+static orxINLINE orxU32 orxDisplay_Dummy_GetU32BE(const orxU8 *_pu8Data)
+{
+  /* Done! */
+  return ((orxU32)_pu8Data[0] << 24) | ((orxU32)_pu8Data[1] << 16) | ((orxU32)_pu8Data[2] << 8) | (orxU32)_pu8Data[3];
+}
+
+/** Fills a pixel region with a color
+ */
+static void orxFASTCALL orxDisplay_Dummy_Fill(orxU8 *_au8Data, orxU32 _u32Stride, orxU32 _u32TLX, orxU32 _u32TLY, orxU32 _u32BRX, orxU32 _u32BRY, orxRGBA _stColor)
+{
+  orxU32 i, j;
+
+  /* For all lines */
+  for(j = _u32TLY; j < _u32BRY; j++)
+  {
+    orxRGBA *pstPixel;
+
+    /* For all pixels */
+    for(i = _u32TLX, pstPixel = (orxRGBA *)(_au8Data + 4 * (j * _u32Stride + i)); i < _u32BRX; i++, pstPixel++)
+    {
+      /* Stores color */
+      *pstPixel = _stColor;
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Allocates bitmap pixel data, filled with its last clear color
+ */
+static orxSTATUS orxFASTCALL orxDisplay_Dummy_AllocateData(orxBITMAP *_pstBitmap)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Not already allocated? */
+  if(_pstBitmap->au8Data == orxNULL)
+  {
+    /* Allocates it */
+    _pstBitmap->au8Data = (orxU8 *)orxMemory_Allocate(_pstBitmap->u32Width * _pstBitmap->u32Height * 4 * sizeof(orxU8), orxMEMORY_TYPE_VIDEO);
+
+    /* Success? */
+    if(_pstBitmap->au8Data != orxNULL)
+    {
+      /* Fills it */
+      orxDisplay_Dummy_Fill(_pstBitmap->au8Data, _pstBitmap->u32Width, 0, 0, _pstBitmap->u32Width, _pstBitmap->u32Height, _pstBitmap->stClearColor);
+    }
+    else
+    {
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Resizes a bitmap, discarding its content
+ */
+static void orxFASTCALL orxDisplay_Dummy_ResizeBitmap(orxBITMAP *_pstBitmap, orxU32 _u32Width, orxU32 _u32Height)
+{
+  /* Frees current data */
+  if(_pstBitmap->au8Data != orxNULL)
+  {
+    orxMemory_Free(_pstBitmap->au8Data);
+    _pstBitmap->au8Data = orxNULL;
+  }
+
+  /* Updates size */
+  _pstBitmap->u32Width  = _u32Width;
+  _pstBitmap->u32Height = _u32Height;
+  _pstBitmap->fWidth    = orxU2F(_u32Width);
+  _pstBitmap->fHeight   = orxU2F(_u32Height);
+
+  /* Resets clipping */
+  orxVector_Copy(&(_pstBitmap->stClip.vTL), &orxVECTOR_0);
+  orxVector_Set(&(_pstBitmap->stClip.vBR), _pstBitmap->fWidth, _pstBitmap->fHeight, orxFLOAT_0);
+
+  /* Done! */
+  return;
+}
+
+/** Decodes an image header and, when uncompressed, its pixels
+ */
+static orxSTATUS orxFASTCALL orxDisplay_Dummy_DecodeImage(orxBITMAP *_pstBitmap, const orxU8 *_pu8Buffer, orxU32 _u32Size)
+{
+  orxU32    u32Width = 0, u32Height = 0, u32Depth = 0, u32Offset = 0;
+  orxBOOL   bTopDown = orxFALSE, bBGR = orxFALSE;
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* PNG? */
+  if((_u32Size >= 24)
+  && (_pu8Buffer[0] == 0x89) && (_pu8Buffer[1] == 'P') && (_pu8Buffer[2] == 'N') && (_pu8Buffer[3] == 'G'))
+  {
+    /* Gets size from IHDR chunk */
+    u32Width  = orxDisplay_Dummy_GetU32BE(_pu8Buffer + 16);
+    u32Height = orxDisplay_Dummy_GetU32BE(_pu8Buffer + 20);
+  }
+  /* JPEG? */
+  else if((_u32Size >= 4) && (_pu8Buffer[0] == 0xFF) && (_pu8Buffer[1] == 0xD8))
+  {
+    orxU32 u32Index;
+
+    /* For all segments */
+    for(u32Index = 2; u32Index + 9 <= _u32Size; u32Index += 2 + orxDisplay_Dummy_GetU16BE(_pu8Buffer + u32Index + 2))
+    {
+      orxU8 u8Marker;
+
+      /* Invalid marker? */
+      if(_pu8Buffer[u32Index] != 0xFF)
+      {
+        break;
+      }
+
+      /* Gets marker */
+      u8Marker = _pu8Buffer[u32Index + 1];
+
+      /* Start of frame? */
+      if((u8Marker >= 0xC0) && (u8Marker <= 0xCF) && (u8Marker != 0xC4) && (u8Marker != 0xC8) && (u8Marker != 0xCC))
+      {
+        /* Gets size */
+        u32Height = orxDisplay_Dummy_GetU16BE(_pu8Buffer + u32Index + 5);
+        u32Width  = orxDisplay_Dummy_GetU16BE(_pu8Buffer + u32Index + 7);
+
+        break;
+      }
+    }
+  }
+  /* BMP? */
+  else if((_u32Size >= orxDISPLAY_KU32_BMP_HEADER_SIZE) && (_pu8Buffer[0] == 'B') && (_pu8Buffer[1] == 'M'))
+  {
+    orxS32 s32Height;
+
+    /* Gets size */
+    u32Width  = orxDisplay_Dummy_GetU32LE(_pu8Buffer + 18);
+    s32Height = (orxS32)orxDisplay_Dummy_GetU32LE(_pu8Buffer + 22);
+    u32Height = (s32Height < 0) ? (orxU32)-s32Height : (orxU32)s32Height;
+    bTopDown  = (s32Height < 0) ? orxTRUE : orxFALSE;
+    bBGR      = orxTRUE;
+
+    /* Uncompressed? */
+    if(orxDisplay_Dummy_GetU32LE(_pu8Buffer + 30) == 0)
+    {
+      /* Gets pixel info */
+      u32Depth  = orxDisplay_Dummy_GetU16LE(_pu8Buffer + 28);
+      u32Offset = orxDisplay_Dummy_GetU32LE(_pu8Buffer + 10);
+    }
+  }
+  /* Uncompressed true color TGA? */
+  else if((_u32Size >= orxDISPLAY_KU32_TGA_HEADER_SIZE) && (_pu8Buffer[1] == 0) && (_pu8Buffer[2] == 2))
+  {
+    /* Gets size */
+    u32Width  = orxDisplay_Dummy_GetU16LE(_pu8Buffer + 12);
+    u32Height = orxDisplay_Dummy_GetU16LE(_pu8Buffer + 14);
+    u32Depth  = _pu8Buffer[16];
+    u32Offset = orxDISPLAY_KU32_TGA_HEADER_SIZE + _pu8Buffer[0];
+    bTopDown  = orxFLAG_TEST(_pu8Buffer[17], 0x20) ? orxTRUE : orxFALSE;
+    bBGR      = orxTRUE;
+  }
+
+  /* Valid size? */
+  if((u32Width != 0) && (u32Height != 0))
+  {
+    /* Resizes bitmap */
+    orxDisplay_Dummy_ResizeBitmap(_pstBitmap, u32Width, u32Height);
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+
+    /* Has decodable pixels? */
+    if((u32Depth == 24) || (u32Depth == 32))
+    {
+      orxU32 u32PixelSize, u32Stride;
+
+      /* Gets line info */
+      u32PixelSize  = u32Depth >> 3;
+      u32Stride     = (_pu8Buffer[0] == 'B') ? (u32Width * u32PixelSize + 3) & ~3 : u32Width * u32PixelSize;
+
+      /* Enough data? */
+      if((u32Offset + u32Stride * u32Height <= _u32Size)
+      && (orxDisplay_Dummy_AllocateData(_pstBitmap) != orxSTATUS_FAILURE))
+      {
+        orxU32 i, j;
+
+        /* For all lines */
+        for(j = 0; j < u32Height; j++)
+        {
+          const orxU8  *pu8Src;
+          orxU8        *pu8Dst;
+
+          /* Gets source & destination */
+          pu8Src = _pu8Buffer + u32Offset + u32Stride * ((bTopDown != orxFALSE) ? j : u32Height - 1 - j);
+          pu8Dst = _pstBitmap->au8Data + 4 * u32Width * j;
+
+          /* For all pixels */
+          for(i = 0; i < u32Width; i++, pu8Src += u32PixelSize, pu8Dst += 4)
+          {
+            /* Stores it */
+            pu8Dst[0] = (bBGR != orxFALSE) ? pu8Src[2] : pu8Src[0];
+            pu8Dst[1] = pu8Src[1];
+            pu8Dst[2] = (bBGR != orxFALSE) ? pu8Src[0] : pu8Src[2];
+            pu8Dst[3] = (u32PixelSize == 4) ? pu8Src[3] : 0xFF;
+          }
+        }
+      }
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Delivers read back data (task thread)
+ */
+static orxSTATUS orxFASTCALL orxDisplay_Dummy_ReadBackData(void *_pContext)
+{
+  orxDISPLAY_READ_BACK_INFO *pstInfo;
+
+  /* Gets read back info */
+  pstInfo = (orxDISPLAY_READ_BACK_INFO *)_pContext;
+
+  /* Calls user callback */
+  pstInfo->pfnCallback(pstInfo->pu8ImageData, pstInfo->u32Width, pstInfo->u32Height, pstInfo->pContext);
+
+  /* Deletes data */
+  orxMemory_Free(pstInfo->pu8ImageData);
+
+  /* Deletes read back info */
+  orxMemory_Free(pstInfo);
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+
+/***************************************************************************
+ * Plugin functions                                                        *
+ ***************************************************************************/
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_Swap()
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Updates stats */
+  sstDisplay.u32FrameCount++;
+  sstDisplay.u64TotalDrawCallCount += sstDisplay.u32DrawCallCount;
+  sstDisplay.u64TotalItemCount     += sstDisplay.u32ItemCount;
+  sstDisplay.u32MaxDrawCallCount    = orxMAX(sstDisplay.u32MaxDrawCallCount, sstDisplay.u32DrawCallCount);
+  sstDisplay.u32MaxItemCount        = orxMAX(sstDisplay.u32MaxItemCount, sstDisplay.u32ItemCount);
+
+  /* Resets frame counters */
+  sstDisplay.u32DrawCallCount = 0;
+  sstDisplay.u32ItemCount     = 0;
+
+  /* Done! */
+  return eResult;
+}
+
+orxBITMAP *orxFASTCALL orxDisplay_Dummy_GetScreenBitmap()
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Done! */
+  return sstDisplay.pstScreen;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_GetScreenSize(orxFLOAT *_pfWidth, orxFLOAT *_pfHeight)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pfWidth != orxNULL);
+  orxASSERT(_pfHeight != orxNULL);
+
+  /* Gets size */
+  *_pfWidth   = sstDisplay.pstScreen->fWidth;
+  *_pfHeight  = sstDisplay.pstScreen->fHeight;
+
+  /* Done! */
+  return eResult;
+}
+
+orxBITMAP *orxFASTCALL orxDisplay_Dummy_CreateBitmap(orxU32 _u32Width, orxU32 _u32Height)
+{
+  orxBITMAP *pstBitmap;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Allocates bitmap */
+  pstBitmap = (orxBITMAP *)orxBank_Allocate(sstDisplay.pstBitmapBank);
+
+  /* Valid? */
+  if(pstBitmap != orxNULL)
+  {
+    /* Inits it */
+    orxMemory_Zero(pstBitmap, sizeof(orxBITMAP));
+    pstBitmap->stColor      = orx2RGBA(0xFF, 0xFF, 0xFF, 0xFF);
+    pstBitmap->stClearColor = orx2RGBA(0x00, 0x00, 0x00, 0x00);
+    pstBitmap->zLocation    = orxSTRING_EMPTY;
+    pstBitmap->stFilenameID = orxSTRINGID_UNDEFINED;
+    pstBitmap->u32ID        = ++sstDisplay.u32BitmapID;
+    orxDisplay_Dummy_ResizeBitmap(pstBitmap, _u32Width, _u32Height);
+  }
+
+  /* Done! */
+  return pstBitmap;
+}
+
+void orxFASTCALL orxDisplay_Dummy_DeleteBitmap(orxBITMAP *_pstBitmap)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+
+  /* Not screen? */
+  if(_pstBitmap != sstDisplay.pstScreen)
+  {
+    orxU32 i;
+
+    /* For all destinations */
+    for(i = 0; i < sstDisplay.u32DestinationBitmapCount; i++)
+    {
+      /* Was used? */
+      if(sstDisplay.apstDestinationBitmapList[i] == _pstBitmap)
+      {
+        /* Falls back to screen */
+        sstDisplay.apstDestinationBitmapList[i] = sstDisplay.pstScreen;
+      }
+    }
+
+    /* Frees its data */
+    if(_pstBitmap->au8Data != orxNULL)
+    {
+      orxMemory_Free(_pstBitmap->au8Data);
+    }
+
+    /* Deletes it */
+    orxBank_Free(sstDisplay.pstBitmapBank, _pstBitmap);
+  }
+
+  /* Done! */
+  return;
+}
+
+orxBITMAP *orxFASTCALL orxDisplay_Dummy_LoadBitmap(const orxSTRING _zFilename)
+{
+  const orxSTRING zResourceLocation;
+  orxBITMAP      *pstResult = orxNULL;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_zFilename != orxNULL);
+
+  /* Locates resource */
+  zResourceLocation = orxResource_Locate(orxTEXTURE_KZ_RESOURCE_GROUP, _zFilename);
+
+  /* Success? */
+  if(zResourceLocation != orxNULL)
+  {
+    orxHANDLE hResource;
+
+    /* Opens it */
+    hResource = orxResource_Open(zResourceLocation, orxFALSE);
+
+    /* Success? */
+    if(hResource != orxHANDLE_UNDEFINED)
+    {
+      orxS64 s64Size;
+
+      /* Gets its size */
+      s64Size = orxResource_GetSize(hResource);
+
+      /* Valid? */
+      if((s64Size > 0) && (s64Size < 0xFFFFFFFF))
+      {
+        orxU8 *pu8Buffer;
+
+        /* Allocates buffer */
+        pu8Buffer = (orxU8 *)orxMemory_Allocate((orxU32)s64Size, orxMEMORY_TYPE_MAIN);
+
+        /* Success? */
+        if(pu8Buffer != orxNULL)
+        {
+          /* Loads content */
+          if(orxResource_Read(hResource, s64Size, pu8Buffer, orxNULL, orxNULL) == s64Size)
+          {
+            /* Creates bitmap */
+            pstResult = orxDisplay_Dummy_CreateBitmap(0, 0);
+
+            /* Success? */
+            if(pstResult != orxNULL)
+            {
+              /* Stores info */
+              pstResult->zLocation    = zResourceLocation;
+              pstResult->stFilenameID = orxString_GetID(_zFilename);
+
+              /* Decodes image */
+              if(orxDisplay_Dummy_DecodeImage(pstResult, pu8Buffer, (orxU32)s64Size) != orxSTATUS_FAILURE)
+              {
+                orxDISPLAY_EVENT_PAYLOAD stPayload;
+
+                /* Inits payload */
+                stPayload.stBitmap.zLocation      = pstResult->zLocation;
+                stPayload.stBitmap.stFilenameID   = pstResult->stFilenameID;
+                stPayload.stBitmap.u32ID          = pstResult->u32ID;
+
+                /* Sends event */
+                orxEVENT_SEND(orxEVENT_TYPE_DISPLAY, orxDISPLAY_EVENT_LOAD_BITMAP, pstResult, orxNULL, &stPayload);
+              }
+              else
+              {
+                /* Logs message */
+                orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Couldn't process data for bitmap <%s>: unsupported format.", zResourceLocation);
+
+                /* Deletes bitmap */
+                orxDisplay_Dummy_DeleteBitmap(pstResult);
+                pstResult = orxNULL;
+              }
+            }
+          }
+
+          /* Frees buffer */
+          orxMemory_Free(pu8Buffer);
+        }
+      }
+
+      /* Closes resource */
+      orxResource_Close(hResource);
+    }
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_GetBitmapData(const orxBITMAP *_pstBitmap, orxU8 *_au8Data, orxU32 _u32ByteNumber)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+  orxASSERT(_au8Data != orxNULL);
+
+  /* Valid size? */
+  if(_u32ByteNumber == _pstBitmap->u32Width * _pstBitmap->u32Height * 4 * sizeof(orxU8))
+  {
+    /* Has data? */
+    if(_pstBitmap->au8Data != orxNULL)
+    {
+      /* Copies it */
+      orxMemory_Copy(_au8Data, _pstBitmap->au8Data, _u32ByteNumber);
+    }
+    else
+    {
+      /* Fills with clear color */
+      orxDisplay_Dummy_Fill(_au8Data, _pstBitmap->u32Width, 0, 0, _pstBitmap->u32Width, _pstBitmap->u32Height, _pstBitmap->stClearColor);
+    }
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can't get bitmap data: buffer size %u is different than %ux%ux4.", _u32ByteNumber, _pstBitmap->u32Width, _pstBitmap->u32Height);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_ReadBackBitmapData(const orxBITMAP *_pstBitmap, orxDISPLAY_READ_BACK_FUNCTION _pfnCallback, void *_pContext)
+{
+  orxDISPLAY_READ_BACK_INFO  *pstInfo;
+  orxU8                      *pu8ImageData;
+  orxU32                      u32BufferSize;
+  orxSTATUS                   eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+  orxASSERT(_pfnCallback != orxNULL);
+
+  /* Gets buffer size */
+  u32BufferSize = _pstBitmap->u32Width * _pstBitmap->u32Height * 4 * sizeof(orxU8);
+
+  /* Allocates info & data */
+  pstInfo       = (orxDISPLAY_READ_BACK_INFO *)orxMemory_Allocate(sizeof(orxDISPLAY_READ_BACK_INFO), orxMEMORY_TYPE_TEMP);
+  pu8ImageData  = (orxU8 *)orxMemory_Allocate(u32BufferSize, orxMEMORY_TYPE_MAIN);
+
+  /* Valid? */
+  if((pstInfo != orxNULL) && (pu8ImageData != orxNULL))
+  {
+    /* Gets data right away, there's no pipeline to stall */
+    if(orxDisplay_Dummy_GetBitmapData(_pstBitmap, pu8ImageData, u32BufferSize) != orxSTATUS_FAILURE)
+    {
+      /* Inits info */
+      pstInfo->pfnCallback  = _pfnCallback;
+      pstInfo->pContext     = _pContext;
+      pstInfo->pu8ImageData = pu8ImageData;
+      pstInfo->u32Width     = _pstBitmap->u32Width;
+      pstInfo->u32Height    = _pstBitmap->u32Height;
+
+      /* Delivers it on the task thread */
+      eResult = orxThread_RunTask(&orxDisplay_Dummy_ReadBackData, orxNULL, orxNULL, (void *)pstInfo);
+    }
+  }
+
+  /* Failure? */
+  if(eResult == orxSTATUS_FAILURE)
+  {
+    /* Frees info */
+    if(pstInfo != orxNULL)
+    {
+      orxMemory_Free(pstInfo);
+    }
+
+    /* Frees data */
+    if(pu8ImageData != orxNULL)
+    {
+      orxMemory_Free(pu8ImageData);
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_SaveBitmap(const orxBITMAP *_pstBitmap, const orxSTRING _zFilename)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+  orxASSERT(_zFilename != orxNULL);
+
+  /* TGA? */
+  if(orxString_ICompare(orxString_GetExtension(_zFilename), "tga") == 0)
+  {
+    orxU32  u32BufferSize;
+    orxU8  *pu8ImageData;
+
+    /* Gets buffer size */
+    u32BufferSize = orxDISPLAY_KU32_TGA_HEADER_SIZE + _pstBitmap->u32Width * _pstBitmap->u32Height * 4 * sizeof(orxU8);
+
+    /* Allocates buffer */
+    pu8ImageData = (orxU8 *)orxMemory_Allocate(u32BufferSize, orxMEMORY_TYPE_MAIN);
+
+    /* Valid? */
+    if(pu8ImageData != orxNULL)
+    {
+      /* Gets bitmap data */
+      if(orxDisplay_Dummy_GetBitmapData(_pstBitmap, pu8ImageData + orxDISPLAY_KU32_TGA_HEADER_SIZE, u32BufferSize - orxDISPLAY_KU32_TGA_HEADER_SIZE) != orxSTATUS_FAILURE)
+      {
+        orxFILE  *pstFile;
+        orxU8    *pu8Pixel;
+
+        /* Inits header: uncompressed 32-bit true color, top-down */
+        orxMemory_Zero(pu8ImageData, orxDISPLAY_KU32_TGA_HEADER_SIZE);
+        pu8ImageData[2]   = 2;
+        pu8ImageData[12]  = (orxU8)(_pstBitmap->u32Width & 0xFF);
+        pu8ImageData[13]  = (orxU8)(_pstBitmap->u32Width >> 8);
+        pu8ImageData[14]  = (orxU8)(_pstBitmap->u32Height & 0xFF);
+        pu8ImageData[15]  = (orxU8)(_pstBitmap->u32Height >> 8);
+        pu8ImageData[16]  = 32;
+        pu8ImageData[17]  = 0x28;
+
+        /* For all pixels */
+        for(pu8Pixel = pu8ImageData + orxDISPLAY_KU32_TGA_HEADER_SIZE; pu8Pixel < pu8ImageData + u32BufferSize; pu8Pixel += 4)
+        {
+          orxU8 u8Red;
+
+          /* Swaps red & blue */
+          u8Red       = pu8Pixel[0];
+          pu8Pixel[0] = pu8Pixel[2];
+          pu8Pixel[2] = u8Red;
+        }
+
+        /* Opens file */
+        pstFile = orxFile_Open(_zFilename, orxFILE_KU32_FLAG_OPEN_WRITE | orxFILE_KU32_FLAG_OPEN_BINARY);
+
+        /* Success? */
+        if(pstFile != orxNULL)
+        {
+          /* Writes image */
+          eResult = (orxFile_Write(pu8ImageData, sizeof(orxU8), (orxS64)u32BufferSize, pstFile) == (orxS64)u32BufferSize) ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+
+          /* Closes file */
+          orxFile_Close(pstFile);
+        }
+      }
+
+      /* Frees buffer */
+      orxMemory_Free(pu8ImageData);
+    }
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can't save bitmap to <%s>: only TGA files are supported by this display plugin.", _zFilename);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_SetTempBitmap(const orxBITMAP *_pstBitmap)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Stores it (loading is always synchronous) */
+  sstDisplay.pstTempBitmap = _pstBitmap;
+
+  /* Done! */
+  return eResult;
+}
+
+const orxBITMAP *orxFASTCALL orxDisplay_Dummy_GetTempBitmap()
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Done! */
+  return sstDisplay.pstTempBitmap;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_SetDestinationBitmaps(orxBITMAP **_apstBitmapList, orxU32 _u32Number)
+{
+  orxU32    i;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_apstBitmapList != orxNULL);
+
+  /* Too many destinations? */
+  if(_u32Number > orxDISPLAY_KU32_MAX_TEXTURE_UNIT_NUMBER)
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can only attach the first <%u> bitmaps as destinations, out of the <%u> requested.", orxDISPLAY_KU32_MAX_TEXTURE_UNIT_NUMBER, _u32Number);
+
+    /* Updates count */
+    _u32Number = orxDISPLAY_KU32_MAX_TEXTURE_UNIT_NUMBER;
+  }
+
+  /* For all destinations */
+  for(i = 0; i < _u32Number; i++)
+  {
+    /* Stores it */
+    sstDisplay.apstDestinationBitmapList[i] = (_apstBitmapList[i] != orxNULL) ? _apstBitmapList[i] : sstDisplay.pstScreen;
+  }
+
+  /* Stores count */
+  sstDisplay.u32DestinationBitmapCount = _u32Number;
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_SetBitmapClipping(orxBITMAP *_pstBitmap, orxU32 _u32TLX, orxU32 _u32TLY, orxU32 _u32BRX, orxU32 _u32BRY)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* No bitmap? */
+  if(_pstBitmap == orxNULL)
+  {
+    /* Gets first destination */
+    _pstBitmap = (sstDisplay.u32DestinationBitmapCount != 0) ? sstDisplay.apstDestinationBitmapList[0] : sstDisplay.pstScreen;
+  }
+
+  /* Stores clipping */
+  orxVector_Set(&(_pstBitmap->stClip.vTL), orxU2F(orxMIN(_u32TLX, _pstBitmap->u32Width)), orxU2F(orxMIN(_u32TLY, _pstBitmap->u32Height)), orxFLOAT_0);
+  orxVector_Set(&(_pstBitmap->stClip.vBR), orxU2F(orxMIN(_u32BRX, _pstBitmap->u32Width)), orxU2F(orxMIN(_u32BRY, _pstBitmap->u32Height)), orxFLOAT_0);
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_ClearBitmap(orxBITMAP *_pstBitmap, orxRGBA _stColor)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* No bitmap? */
+  if(_pstBitmap == orxNULL)
+  {
+    orxU32 i;
+
+    /* For all destinations */
+    for(i = 0; (i < sstDisplay.u32DestinationBitmapCount) && (eResult != orxSTATUS_FAILURE); i++)
+    {
+      /* Clears it */
+      eResult = orxDisplay_Dummy_ClearBitmap(sstDisplay.apstDestinationBitmapList[i], _stColor);
+    }
+  }
+  else
+  {
+    orxU32 u32TLX, u32TLY, u32BRX, u32BRY;
+
+    /* Gets clipping */
+    u32TLX = orxF2U(_pstBitmap->stClip.vTL.fX);
+    u32TLY = orxF2U(_pstBitmap->stClip.vTL.fY);
+    u32BRX = orxF2U(_pstBitmap->stClip.vBR.fX);
+    u32BRY = orxF2U(_pstBitmap->stClip.vBR.fY);
+
+    /* Whole bitmap without any pixel data? */
+    if((_pstBitmap->au8Data == orxNULL)
+    && (u32TLX == 0) && (u32TLY == 0) && (u32BRX == _pstBitmap->u32Width) && (u32BRY == _pstBitmap->u32Height))
+    {
+      /* Only stores clear color */
+      _pstBitmap->stClearColor = _stColor;
+    }
+    /* Has data? */
+    else if(orxDisplay_Dummy_AllocateData(_pstBitmap) != orxSTATUS_FAILURE)
+    {
+      /* Fills clipped region */
+      orxDisplay_Dummy_Fill(_pstBitmap->au8Data, _pstBitmap->u32Width, u32TLX, u32TLY, u32BRX, u32BRY, _stColor);
+    }
+    else
+    {
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_SetBlendMode(orxDISPLAY_BLEND_MODE _eBlendMode)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Stores it */
+  sstDisplay.eBlendMode = _eBlendMode;
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_SetBitmapColorKey(orxBITMAP *_pstBitmap, orxRGBA _stColor, orxBOOL _bEnable)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+
+  /* Not supported */
+  return orxSTATUS_FAILURE;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_SetBitmapData(orxBITMAP *_pstBitmap, const orxU8 *_au8Data, orxU32 _u32ByteNumber)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+  orxASSERT(_au8Data != orxNULL);
+
+  /* Valid size? */
+  if(_u32ByteNumber == _pstBitmap->u32Width * _pstBitmap->u32Height * 4 * sizeof(orxU8))
+  {
+    /* Has data? */
+    if(orxDisplay_Dummy_AllocateData(_pstBitmap) != orxSTATUS_FAILURE)
+    {
+      /* Copies it */
+      orxMemory_Copy(_pstBitmap->au8Data, _au8Data, _u32ByteNumber);
+
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can't set bitmap data: format needs to be RGBA, got %u bytes for %ux%u.", _u32ByteNumber, _pstBitmap->u32Width, _pstBitmap->u32Height);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_SetBitmapColor(orxBITMAP *_pstBitmap, orxRGBA _stColor)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+
+  /* Stores it */
+  _pstBitmap->stColor = _stColor;
+
+  /* Done! */
+  return eResult;
+}
+
+orxRGBA orxFASTCALL orxDisplay_Dummy_GetBitmapColor(const orxBITMAP *_pstBitmap)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+
+  /* Done! */
+  return _pstBitmap->stColor;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_GetBitmapSize(const orxBITMAP *_pstBitmap, orxFLOAT *_pfWidth, orxFLOAT *_pfHeight)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+  orxASSERT(_pfWidth != orxNULL);
+  orxASSERT(_pfHeight != orxNULL);
+
+  /* Gets size */
+  *_pfWidth   = _pstBitmap->fWidth;
+  *_pfHeight  = _pstBitmap->fHeight;
+
+  /* Done! */
+  return eResult;
+}
+
+orxU32 orxFASTCALL orxDisplay_Dummy_GetBitmapID(const orxBITMAP *_pstBitmap)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+
+  /* Done! */
+  return _pstBitmap->u32ID;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_TransformBitmap(const orxBITMAP *_pstSrc, const orxDISPLAY_TRANSFORM *_pstTransform, orxDISPLAY_SMOOTHING _eSmoothing, orxDISPLAY_BLEND_MODE _eBlendMode)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstSrc != orxNULL);
+
+  /* Counts it */
+  orxDisplay_Dummy_CountDrawCall(1);
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_TransformText(const orxSTRING _zString, const orxBITMAP *_pstFont, const orxCHARACTER_MAP *_pstMap, const orxDISPLAY_TRANSFORM *_pstTransform, orxDISPLAY_SMOOTHING _eSmoothing, orxDISPLAY_BLEND_MODE _eBlendMode)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_zString != orxNULL);
+  orxASSERT(_pstFont != orxNULL);
+  orxASSERT(_pstMap != orxNULL);
+  orxASSERT(_pstTransform != orxNULL);
+
+  /* Counts it */
+  orxDisplay_Dummy_CountDrawCall(orxString_GetCharacterCount(_zString));
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_DrawLine(const orxVECTOR *_pvStart, const orxVECTOR *_pvEnd, orxRGBA _stColor)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pvStart != orxNULL);
+  orxASSERT(_pvEnd != orxNULL);
+
+  /* Counts it */
+  orxDisplay_Dummy_CountDrawCall(1);
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_DrawPolyline(const orxVECTOR *_avVertexList, orxU32 _u32VertexNumber, orxRGBA _stColor)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_avVertexList != orxNULL);
+  orxASSERT(_u32VertexNumber > 0);
+
+  /* Counts it */
+  orxDisplay_Dummy_CountDrawCall(_u32VertexNumber - 1);
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_DrawPolygon(const orxVECTOR *_avVertexList, orxU32 _u32VertexNumber, orxRGBA _stColor, orxBOOL _bFill)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_avVertexList != orxNULL);
+  orxASSERT(_u32VertexNumber > 0);
+
+  /* Counts it */
+  orxDisplay_Dummy_CountDrawCall(_u32VertexNumber);
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_DrawCircle(const orxVECTOR *_pvCenter, orxFLOAT _fRadius, orxRGBA _stColor, orxBOOL _bFill)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pvCenter != orxNULL);
+  orxASSERT(_fRadius >= orxFLOAT_0);
+
+  /* Counts it */
+  orxDisplay_Dummy_CountDrawCall(1);
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_DrawOBox(const orxOBOX *_pstBox, orxRGBA _stColor, orxBOOL _bFill)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBox != orxNULL);
+
+  /* Counts it */
+  orxDisplay_Dummy_CountDrawCall(1);
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_DrawMesh(const orxDISPLAY_MESH *_pstMesh, const orxBITMAP *_pstBitmap, orxDISPLAY_SMOOTHING _eSmoothing, orxDISPLAY_BLEND_MODE _eBlendMode)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstMesh != orxNULL);
+
+  /* Counts it */
+  orxDisplay_Dummy_CountDrawCall((_pstMesh->au16IndexList != orxNULL) ? _pstMesh->u32IndexNumber : _pstMesh->u32VertexNumber);
+
+  /* Done! */
+  return eResult;
+}
+
+orxBOOL orxFASTCALL orxDisplay_Dummy_HasShaderSupport()
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Done! */
+  return orxFALSE;
+}
+
+orxHANDLE orxFASTCALL orxDisplay_Dummy_CreateShader(const orxSTRING *_azCodeList, orxU32 _u32Size, const orxLINKLIST *_pstParamList, orxBOOL _bUseCustomParam)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Not supported */
+  return orxHANDLE_UNDEFINED;
+}
+
+void orxFASTCALL orxDisplay_Dummy_DeleteShader(orxHANDLE _hShader)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Done! */
+  return;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_StartShader(const orxHANDLE _hShader)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Not supported */
+  return orxSTATUS_FAILURE;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_StopShader(const orxHANDLE _hShader)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Not supported */
+  return orxSTATUS_FAILURE;
+}
+
+orxS32 orxFASTCALL orxDisplay_Dummy_GetParameterID(const orxHANDLE _hShader, const orxSTRING _zParam, orxS32 _s32Index, orxBOOL _bIsTexture)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Not supported */
+  return -1;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_SetShaderBitmap(orxHANDLE _hShader, orxS32 _s32ID, const orxBITMAP *_pstValue)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Not supported */
+  return orxSTATUS_FAILURE;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_SetShaderFloat(orxHANDLE _hShader, orxS32 _s32ID, orxFLOAT _fValue)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Not supported */
+  return orxSTATUS_FAILURE;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_SetShaderVector(orxHANDLE _hShader, orxS32 _s32ID, const orxVECTOR *_pvValue)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Not supported */
+  return orxSTATUS_FAILURE;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_EnableVSync(orxBOOL _bEnable)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Updates flags (no actual synchronization happens) */
+  orxFLAG_SET(sstDisplay.u32Flags, (_bEnable != orxFALSE) ? orxDISPLAY_KU32_STATIC_FLAG_VSYNC : orxDISPLAY_KU32_STATIC_FLAG_NONE, (_bEnable != orxFALSE) ? orxDISPLAY_KU32_STATIC_FLAG_NONE : orxDISPLAY_KU32_STATIC_FLAG_VSYNC);
+
+  /* Done! */
+  return eResult;
+}
+
+orxBOOL orxFASTCALL orxDisplay_Dummy_IsVSyncEnabled()
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Done! */
+  return orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_VSYNC) ? orxTRUE : orxFALSE;
+}
+
+orxBOOL orxFASTCALL orxDisplay_Dummy_IsFullScreen()
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Done! */
+  return orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_FULLSCREEN) ? orxTRUE : orxFALSE;
+}
+
+orxU32 orxFASTCALL orxDisplay_Dummy_GetVideoModeCount()
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Only the current mode is available */
+  return 1;
+}
+
+orxDISPLAY_VIDEO_MODE *orxFASTCALL orxDisplay_Dummy_GetVideoMode(orxU32 _u32Index, orxDISPLAY_VIDEO_MODE *_pstVideoMode)
+{
+  orxDISPLAY_VIDEO_MODE *pstResult = orxNULL;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstVideoMode != orxNULL);
+
+  /* Valid index? */
+  if((_u32Index == 0) || (_u32Index == orxU32_UNDEFINED))
+  {
+    /* Stores current mode */
+    _pstVideoMode->u32Width       = sstDisplay.pstScreen->u32Width;
+    _pstVideoMode->u32Height      = sstDisplay.pstScreen->u32Height;
+    _pstVideoMode->u32Depth       = sstDisplay.u32Depth;
+    _pstVideoMode->u32RefreshRate = sstDisplay.u32RefreshRate;
+    _pstVideoMode->bFullScreen    = orxDisplay_Dummy_IsFullScreen();
+
+    /* Updates result */
+    pstResult = _pstVideoMode;
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_SetVideoMode(const orxDISPLAY_VIDEO_MODE *_pstVideoMode)
+{
+  orxDISPLAY_EVENT_PAYLOAD  stPayload;
+  orxDISPLAY_VIDEO_MODE     stVideoMode;
+  orxSTATUS                 eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Pushes display section */
+  orxConfig_PushSection(orxDISPLAY_KZ_CONFIG_SECTION);
+
+  /* No specified video mode? */
+  if(_pstVideoMode == orxNULL)
+  {
+    /* Uses config one */
+    stVideoMode.u32Width        = orxConfig_HasValue(orxDISPLAY_KZ_CONFIG_WIDTH) ? orxConfig_GetU32(orxDISPLAY_KZ_CONFIG_WIDTH) : orxDISPLAY_KU32_DEFAULT_WIDTH;
+    stVideoMode.u32Height       = orxConfig_HasValue(orxDISPLAY_KZ_CONFIG_HEIGHT) ? orxConfig_GetU32(orxDISPLAY_KZ_CONFIG_HEIGHT) : orxDISPLAY_KU32_DEFAULT_HEIGHT;
+    stVideoMode.u32Depth        = orxConfig_HasValue(orxDISPLAY_KZ_CONFIG_DEPTH) ? orxConfig_GetU32(orxDISPLAY_KZ_CONFIG_DEPTH) : orxDISPLAY_KU32_DEFAULT_DEPTH;
+    stVideoMode.u32RefreshRate  = orxConfig_HasValue(orxDISPLAY_KZ_CONFIG_REFRESH_RATE) ? orxConfig_GetU32(orxDISPLAY_KZ_CONFIG_REFRESH_RATE) : orxDISPLAY_KU32_DEFAULT_REFRESH_RATE;
+    stVideoMode.bFullScreen     = orxConfig_GetBool(orxDISPLAY_KZ_CONFIG_FULLSCREEN);
+    _pstVideoMode               = &stVideoMode;
+  }
+
+  /* Inits event payload */
+  orxMemory_Zero(&stPayload, sizeof(orxDISPLAY_EVENT_PAYLOAD));
+  stPayload.stVideoMode.u32Width                = _pstVideoMode->u32Width;
+  stPayload.stVideoMode.u32Height               = _pstVideoMode->u32Height;
+  stPayload.stVideoMode.u32Depth                = _pstVideoMode->u32Depth;
+  stPayload.stVideoMode.u32RefreshRate          = _pstVideoMode->u32RefreshRate;
+  stPayload.stVideoMode.u32PreviousWidth        = sstDisplay.pstScreen->u32Width;
+  stPayload.stVideoMode.u32PreviousHeight       = sstDisplay.pstScreen->u32Height;
+  stPayload.stVideoMode.u32PreviousDepth        = sstDisplay.u32Depth;
+  stPayload.stVideoMode.u32PreviousRefreshRate  = sstDisplay.u32RefreshRate;
+  stPayload.stVideoMode.bFullScreen             = _pstVideoMode->bFullScreen;
+
+  /* Resizes screen */
+  orxDisplay_Dummy_ResizeBitmap(sstDisplay.pstScreen, _pstVideoMode->u32Width, _pstVideoMode->u32Height);
+
+  /* Stores info */
+  sstDisplay.u32Depth       = _pstVideoMode->u32Depth;
+  sstDisplay.u32RefreshRate = _pstVideoMode->u32RefreshRate;
+  orxFLAG_SET(sstDisplay.u32Flags, (_pstVideoMode->bFullScreen != orxFALSE) ? orxDISPLAY_KU32_STATIC_FLAG_FULLSCREEN : orxDISPLAY_KU32_STATIC_FLAG_NONE, (_pstVideoMode->bFullScreen != orxFALSE) ? orxDISPLAY_KU32_STATIC_FLAG_NONE : orxDISPLAY_KU32_STATIC_FLAG_FULLSCREEN);
+
+  /* Updates config */
+  orxConfig_SetU32(orxDISPLAY_KZ_CONFIG_WIDTH, _pstVideoMode->u32Width);
+  orxConfig_SetU32(orxDISPLAY_KZ_CONFIG_HEIGHT, _pstVideoMode->u32Height);
+  orxConfig_SetU32(orxDISPLAY_KZ_CONFIG_DEPTH, _pstVideoMode->u32Depth);
+
+  /* Pops config section */
+  orxConfig_PopSection();
+
+  /* Sends event */
+  orxEVENT_SEND(orxEVENT_TYPE_DISPLAY, orxDISPLAY_EVENT_SET_VIDEO_MODE, orxNULL, orxNULL, &stPayload);
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_SetFullScreen(orxBOOL _bFullScreen)
+{
+  orxDISPLAY_VIDEO_MODE stVideoMode;
+  orxSTATUS             eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Changed? */
+  if(orxDisplay_Dummy_IsFullScreen() != _bFullScreen)
+  {
+    /* Gets current mode */
+    orxDisplay_Dummy_GetVideoMode(orxU32_UNDEFINED, &stVideoMode);
+
+    /* Updates it */
+    stVideoMode.bFullScreen = _bFullScreen;
+
+    /* Applies it */
+    eResult = orxDisplay_Dummy_SetVideoMode(&stVideoMode);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+orxBOOL orxFASTCALL orxDisplay_Dummy_IsVideoModeAvailable(const orxDISPLAY_VIDEO_MODE *_pstVideoMode)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstVideoMode != orxNULL);
+
+  /* Any mode can be emulated */
+  return orxTRUE;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_Init()
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Was not already initialized? */
+  if(!(sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY))
+  {
+    /* Cleans static controller */
+    orxMemory_Zero(&sstDisplay, sizeof(orxDISPLAY_STATIC));
+
+    /* Creates bitmap bank */
+    sstDisplay.pstBitmapBank = orxBank_Create(orxDISPLAY_KU32_BITMAP_BANK_SIZE, sizeof(orxBITMAP), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+
+    /* Valid? */
+    if(sstDisplay.pstBitmapBank != orxNULL)
+    {
+      /* Sets module as ready */
+      sstDisplay.u32Flags = orxDISPLAY_KU32_STATIC_FLAG_READY;
+
+      /* Allocates screen bitmap */
+      sstDisplay.pstScreen = (orxBITMAP *)orxBank_Allocate(sstDisplay.pstBitmapBank);
+      orxMemory_Zero(sstDisplay.pstScreen, sizeof(orxBITMAP));
+      sstDisplay.pstScreen->stColor       = orx2RGBA(0xFF, 0xFF, 0xFF, 0xFF);
+      sstDisplay.pstScreen->zLocation     = orxSTRING_EMPTY;
+      sstDisplay.pstScreen->stFilenameID  = orxSTRINGID_UNDEFINED;
+
+      /* Targets it */
+      sstDisplay.apstDestinationBitmapList[0] = sstDisplay.pstScreen;
+      sstDisplay.u32DestinationBitmapCount    = 1;
+
+      /* Sets video mode from config */
+      eResult = orxDisplay_Dummy_SetVideoMode(orxNULL);
+
+      /* Pushes display section */
+      orxConfig_PushSection(orxDISPLAY_KZ_CONFIG_SECTION);
+
+      /* Stores VSync */
+      orxDisplay_Dummy_EnableVSync(orxConfig_HasValue(orxDISPLAY_KZ_CONFIG_VSYNC) ? orxConfig_GetBool(orxDISPLAY_KZ_CONFIG_VSYNC) : orxTRUE);
+
+      /* Pops config section */
+      orxConfig_PopSection();
+
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Running headless: nothing will be rendered to screen.");
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+void orxFASTCALL orxDisplay_Dummy_Exit()
+{
+  /* Was initialized? */
+  if(sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY)
+  {
+    /* Had frames? */
+    if(sstDisplay.u32FrameCount != 0)
+    {
+      /* Logs stats */
+      orxLOG("[HEADLESS] %u frames, %llu draw calls (avg %g / max %u per frame), %llu items (avg %g / max %u per frame).",
+             sstDisplay.u32FrameCount,
+             sstDisplay.u64TotalDrawCallCount, (orxDOUBLE)sstDisplay.u64TotalDrawCallCount / (orxDOUBLE)sstDisplay.u32FrameCount, sstDisplay.u32MaxDrawCallCount,
+             sstDisplay.u64TotalItemCount, (orxDOUBLE)sstDisplay.u64TotalItemCount / (orxDOUBLE)sstDisplay.u32FrameCount, sstDisplay.u32MaxItemCount);
+    }
+
+    /* Deletes screen */
+    if(sstDisplay.pstScreen->au8Data != orxNULL)
+    {
+      orxMemory_Free(sstDisplay.pstScreen->au8Data);
+    }
+    orxBank_Free(sstDisplay.pstBitmapBank, sstDisplay.pstScreen);
+
+    /* Deletes bank */
+    orxBank_Delete(sstDisplay.pstBitmapBank);
+
+    /* Cleans static controller */
+    orxMemory_Zero(&sstDisplay, sizeof(orxDISPLAY_STATIC));
+  }
+
+  /* Done! */
+  return;
+}
+
+
+/***************************************************************************
+ * Plugin Related                                                          *
+ ***************************************************************************/
+
+orxPLUGIN_USER_CORE_FUNCTION_START(DISPLAY);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_Init, DISPLAY, INIT);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_Exit, DISPLAY, EXIT);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_Swap, DISPLAY, SWAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_GetScreenBitmap, DISPLAY, GET_SCREEN_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_GetScreenSize, DISPLAY, GET_SCREEN_SIZE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_CreateBitmap, DISPLAY, CREATE_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_DeleteBitmap, DISPLAY, DELETE_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_LoadBitmap, DISPLAY, LOAD_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_SaveBitmap, DISPLAY, SAVE_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_SetTempBitmap, DISPLAY, SET_TEMP_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_GetTempBitmap, DISPLAY, GET_TEMP_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_SetDestinationBitmaps, DISPLAY, SET_DESTINATION_BITMAPS);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_ClearBitmap, DISPLAY, CLEAR_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_SetBlendMode, DISPLAY, SET_BLEND_MODE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_SetBitmapClipping, DISPLAY, SET_BITMAP_CLIPPING);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_SetBitmapColorKey, DISPLAY, SET_BITMAP_COLOR_KEY);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_SetBitmapData, DISPLAY, SET_BITMAP_DATA);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_GetBitmapData, DISPLAY, GET_BITMAP_DATA);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_ReadBackBitmapData, DISPLAY, READ_BACK_BITMAP_DATA);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_SetBitmapColor, DISPLAY, SET_BITMAP_COLOR);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_GetBitmapColor, DISPLAY, GET_BITMAP_COLOR);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_GetBitmapSize, DISPLAY, GET_BITMAP_SIZE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_GetBitmapID, DISPLAY, GET_BITMAP_ID);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_TransformBitmap, DISPLAY, TRANSFORM_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_TransformText, DISPLAY, TRANSFORM_TEXT);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_DrawLine, DISPLAY, DRAW_LINE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_DrawPolyline, DISPLAY, DRAW_POLYLINE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_DrawPolygon, DISPLAY, DRAW_POLYGON);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_DrawCircle, DISPLAY, DRAW_CIRCLE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_DrawOBox, DISPLAY, DRAW_OBOX);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_DrawMesh, DISPLAY, DRAW_MESH);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_HasShaderSupport, DISPLAY, HAS_SHADER_SUPPORT);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_CreateShader, DISPLAY, CREATE_SHADER);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_DeleteShader, DISPLAY, DELETE_SHADER);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_StartShader, DISPLAY, START_SHADER);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_StopShader, DISPLAY, STOP_SHADER);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_GetParameterID, DISPLAY, GET_PARAMETER_ID);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_SetShaderBitmap, DISPLAY, SET_SHADER_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_SetShaderFloat, DISPLAY, SET_SHADER_FLOAT);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_SetShaderVector, DISPLAY, SET_SHADER_VECTOR);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_EnableVSync, DISPLAY, ENABLE_VSYNC);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_IsVSyncEnabled, DISPLAY, IS_VSYNC_ENABLED);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_SetFullScreen, DISPLAY, SET_FULL_SCREEN);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_IsFullScreen, DISPLAY, IS_FULL_SCREEN);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_GetVideoModeCount, DISPLAY, GET_VIDEO_MODE_COUNT);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_GetVideoMode, DISPLAY, GET_VIDEO_MODE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_SetVideoMode, DISPLAY, SET_VIDEO_MODE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_IsVideoModeAvailable, DISPLAY, IS_VIDEO_MODE_AVAILABLE);
+orxPLUGIN_USER_CORE_FUNCTION_END();
@@ -123,6 +123,8 @@
 #define orxDISPLAY_KU32_STATIC_FLAG_NO_DECORATION 0x00001000 /**< No decoration flag */
 #define orxDISPLAY_KU32_STATIC_FLAG_FULLSCREEN  0x00002000  /**< Full screen flag */
 #define orxDISPLAY_KU32_STATIC_FLAG_CUSTOM_IBO  0x00004000  /**< Custom IBO flag */
+#define orxDISPLAY_KU32_STATIC_FLAG_PBO         0x00008000  /**< PBO support flag */
+#define orxDISPLAY_KU32_STATIC_FLAG_SYNC        0x00010000  /**< Sync object support flag */
 #define orxDISPLAY_KU32_STATIC_FLAG_VSYNC_FIX   0x10000000  /**< VSync fix flag */
 
 #define orxDISPLAY_KU32_STATIC_MASK_ALL         0xFFFFFFFF  /**< All mask */
@@ -155,6 +157,9 @@
 
 #define orxDISPLAY_KU32_MAX_ICON_NUMBER         16
 
+#define orxDISPLAY_KU32_READ_BACK_NUMBER        4           /**< Needs to be a power of 2 */
+#define orxDISPLAY_KU32_READ_BACK_LATENCY       2           /**< Only used when fences aren't supported */
+
 
 /**  Misc defines
  */
@@ -273,13 +278,41 @@ struct __orxBITMAP_t
  */
 typedef struct __orxDISPLAY_SAVE_INFO_t
 {
-  orxU8  *pu8ImageData;
-  orxU32  u32Width;
-  orxU32  u32Height;
   orxSTRINGID stFilenameID;
 
 } orxDISPLAY_SAVE_INFO;
 
+/** Internal read back structure
+ */
+typedef struct __orxDISPLAY_READ_BACK_t
+{
+  orxDISPLAY_READ_BACK_FUNCTION pfnCallback;
+  void                     *pContext;
+  GLsync                    hFence;
+  GLuint                    uiBuffer;
+  orxU32                    u32BufferSize;
+  orxU32                    u32Width;
+  orxU32                    u32Height;
+  orxU32                    u32LineSize;
+  orxU32                    u32Frame;
+  orxBOOL                   bScreen;
+
+} orxDISPLAY_READ_BACK;
+
+/** Internal read back info structure
+ */
+typedef struct __orxDISPLAY_READ_BACK_INFO_t
+{
+  orxDISPLAY_READ_BACK_FUNCTION pfnCallback;
+  void                     *pContext;
+  orxU8                    *pu8ImageData;
+  orxU32                    u32Width;
+  orxU32                    u32Height;
+  orxU32                    u32LineSize;
+  orxBOOL                   bScreen;
+
+} orxDISPLAY_READ_BACK_INFO;
+
 /** Internal bitmap load info structure
  */
 typedef struct __orxDISPLAY_LOAD_INFO_t
@@ -373,7 +406,11 @@ typedef struct __orxDISPLAY_STATIC_t
   orxU32                    u32DefaultDepth;
   orxU32                    u32DefaultRefreshRate;
   orxS32                    s32ActiveTextureUnit;
+  orxU32                    u32FrameCount;
+  orxU32                    u32ReadBackIndex;
+  orxU32                    u32ReadBackCount;
   stbi_io_callbacks         stSTBICallbacks;
+  orxDISPLAY_READ_BACK      astReadBackList[orxDISPLAY_KU32_READ_BACK_NUMBER];
   GLenum                    aeDrawBufferList[orxDISPLAY_KU32_MAX_TEXTURE_UNIT_NUMBER];
   orxBITMAP                *apstDestinationBitmapList[orxDISPLAY_KU32_MAX_TEXTURE_UNIT_NUMBER];
   const orxBITMAP          *apstBoundBitmapList[orxDISPLAY_KU32_MAX_TEXTURE_UNIT_NUMBER];
@@ -418,6 +455,12 @@ PFNGLDELETEBUFFERSARBPROC           glDeleteBuffersARB          = NULL;
 PFNGLBINDBUFFERARBPROC              glBindBufferARB             = NULL;
 PFNGLBUFFERDATAARBPROC              glBufferDataARB             = NULL;
 PFNGLBUFFERSUBDATAARBPROC           glBufferSubDataARB          = NULL;
+PFNGLMAPBUFFERARBPROC               glMapBufferARB              = NULL;
+PFNGLUNMAPBUFFERARBPROC             glUnmapBufferARB            = NULL;
+
+PFNGLFENCESYNCPROC                  glFenceSync                 = NULL;
+PFNGLDELETESYNCPROC                 glDeleteSync                = NULL;
+PFNGLCLIENTWAITSYNCPROC             glClientWaitSync            = NULL;
 
 PFNGLGENFRAMEBUFFERSEXTPROC         glGenFramebuffersEXT        = NULL;
 PFNGLDELETEFRAMEBUFFERSEXTPROC      glDeleteFramebuffersEXT     = NULL;
@@ -1100,6 +1143,48 @@ static orxINLINE void orxDisplay_GLFW_InitExtensions()
       orxFLAG_SET(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_NONE, orxDISPLAY_KU32_STATIC_FLAG_VBO);
     }
 
+    /* Can support pixel buffer objects? */
+    if((orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_VBO))
+    && (glfwExtensionSupported("GL_ARB_pixel_buffer_object") != GLFW_FALSE))
+    {
+#ifndef __orxMAC__
+
+      /* Loads buffer mapping extension functions */
+      orxDISPLAY_LOAD_EXTENSION_FUNCTION(PFNGLMAPBUFFERARBPROC, glMapBufferARB);
+      orxDISPLAY_LOAD_EXTENSION_FUNCTION(PFNGLUNMAPBUFFERARBPROC, glUnmapBufferARB);
+
+#endif /* __orxMAC__ */
+
+      /* Updates status flags */
+      orxFLAG_SET(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_PBO, orxDISPLAY_KU32_STATIC_FLAG_NONE);
+    }
+    else
+    {
+      /* Updates status flags */
+      orxFLAG_SET(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_NONE, orxDISPLAY_KU32_STATIC_FLAG_PBO);
+    }
+
+    /* Can support sync objects? */
+    if(glfwExtensionSupported("GL_ARB_sync") != GLFW_FALSE)
+    {
+#ifndef __orxMAC__
+
+      /* Loads sync extension functions */
+      orxDISPLAY_LOAD_EXTENSION_FUNCTION(PFNGLFENCESYNCPROC, glFenceSync);
+      orxDISPLAY_LOAD_EXTENSION_FUNCTION(PFNGLDELETESYNCPROC, glDeleteSync);
+      orxDISPLAY_LOAD_EXTENSION_FUNCTION(PFNGLCLIENTWAITSYNCPROC, glClientWaitSync);
+
+#endif /* __orxMAC__ */
+
+      /* Updates status flags */
+      orxFLAG_SET(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_SYNC, orxDISPLAY_KU32_STATIC_FLAG_NONE);
+    }
+    else
+    {
+      /* Updates status flags */
+      orxFLAG_SET(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_NONE, orxDISPLAY_KU32_STATIC_FLAG_SYNC);
+    }
+
     /* Can support shader? */
     if((glfwExtensionSupported("GL_ARB_shader_objects") != GLFW_FALSE)
     && (glfwExtensionSupported("GL_ARB_shading_language_100") != GLFW_FALSE)
@@ -1582,19 +1667,15 @@ static void orxFASTCALL orxDisplay_GLFW_ReadResourceCallback(orxHANDLE _hResourc
 }
 
 
-static orxSTATUS orxFASTCALL orxDisplay_GLFW_SaveBitmapData(void *_pContext)
+static orxSTATUS orxFASTCALL orxDisplay_GLFW_WriteBitmapData(orxSTRINGID _stFilenameID, orxU32 _u32Width, orxU32 _u32Height, const orxU8 *_au8Data)
 {
-  orxDISPLAY_SAVE_INFO *pstInfo;
   const orxCHAR        *zExtension;
   const orxSTRING       zFilename;
   orxU32                u32Length;
   orxSTATUS             eResult = orxSTATUS_FAILURE;
 
-  /* Gets save info */
-  pstInfo = (orxDISPLAY_SAVE_INFO *)_pContext;
-
   /* Gets filename */
-  zFilename = orxString_GetFromID(pstInfo->stFilenameID);
+  zFilename = orxString_GetFromID(_stFilenameID);
 
   /* Gets file name's length */
   u32Length = orxString_GetLength(zFilename);
@@ -1606,29 +1687,247 @@ static orxSTATUS orxFASTCALL orxDisplay_GLFW_SaveBitmapData(void *_pContext)
   if(orxString_ICompare(zExtension, "png") == 0)
   {
     /* Saves image to disk */
-    eResult = stbi_write_png(zFilename, pstInfo->u32Width, pstInfo->u32Height, 4, pstInfo->pu8ImageData, 0) != 0 ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+    eResult = stbi_write_png(zFilename, _u32Width, _u32Height, 4, _au8Data, 0) != 0 ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
   }
   /* BMP? */
   else if(orxString_ICompare(zExtension, "bmp") == 0)
   {
     /* Saves image to disk */
-    eResult = stbi_write_bmp(zFilename, pstInfo->u32Width, pstInfo->u32Height, 4, pstInfo->pu8ImageData) != 0 ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+    eResult = stbi_write_bmp(zFilename, _u32Width, _u32Height, 4, _au8Data) != 0 ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
   }
   /* TGA */
   else
   {
     /* Saves image to disk */
-    eResult = stbi_write_tga(zFilename, pstInfo->u32Width, pstInfo->u32Height, 4, pstInfo->pu8ImageData) != 0 ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+    eResult = stbi_write_tga(zFilename, _u32Width, _u32Height, 4, _au8Data) != 0 ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
   }
 
+  /* Done! */
+  return eResult;
+}
+
+static void orxFASTCALL orxDisplay_GLFW_SaveReadBackData(const orxU8 *_au8Data, orxU32 _u32Width, orxU32 _u32Height, void *_pContext)
+{
+  orxDISPLAY_SAVE_INFO *pstInfo;
+
+  /* Gets save info */
+  pstInfo = (orxDISPLAY_SAVE_INFO *)_pContext;
+
+  /* Writes it */
+  orxDisplay_GLFW_WriteBitmapData(pstInfo->stFilenameID, _u32Width, _u32Height, _au8Data);
+
+  /* Deletes save info */
+  orxMemory_Free(pstInfo);
+
+  /* Done! */
+  return;
+}
+
+static orxSTATUS orxFASTCALL orxDisplay_GLFW_ReadBackData(void *_pContext)
+{
+  orxDISPLAY_READ_BACK_INFO  *pstInfo;
+  orxU32                      u32LineSize, i;
+
+  /* Gets read back info */
+  pstInfo = (orxDISPLAY_READ_BACK_INFO *)_pContext;
+
+  /* Gets line size */
+  u32LineSize = pstInfo->u32Width * 4 * sizeof(orxU8);
+
+  /* Screen? */
+  if(pstInfo->bScreen != orxFALSE)
+  {
+    orxRGBA stOpaque;
+
+    /* Sets opaque pixel */
+    stOpaque = orx2RGBA(0x00, 0x00, 0x00, 0xFF);
+
+    /* For all top half lines */
+    for(i = 0; i < (pstInfo->u32Height + 1) / 2; i++)
+    {
+      orxRGBA  *astTop, *astBottom;
+      orxU32    j;
+
+      /* Gets both mirrored lines */
+      astTop    = (orxRGBA *)(pstInfo->pu8ImageData + i * pstInfo->u32LineSize);
+      astBottom = (orxRGBA *)(pstInfo->pu8ImageData + (pstInfo->u32Height - 1 - i) * pstInfo->u32LineSize);
+
+      /* For all columns */
+      for(j = 0; j < pstInfo->u32Width; j++)
+      {
+        orxRGBA stPixel;
+
+        /* Swaps opaque pixels */
+        stPixel               = astTop[j];
+        astTop[j].u32RGBA     = astBottom[j].u32RGBA | stOpaque.u32RGBA;
+        astBottom[j].u32RGBA  = stPixel.u32RGBA | stOpaque.u32RGBA;
+      }
+    }
+  }
+  /* Padded lines? */
+  else if(pstInfo->u32LineSize != u32LineSize)
+  {
+    /* For all lines */
+    for(i = 1; i < pstInfo->u32Height; i++)
+    {
+      /* Packs it */
+      orxMemory_Move(pstInfo->pu8ImageData + i * u32LineSize, pstInfo->pu8ImageData + i * pstInfo->u32LineSize, u32LineSize);
+    }
+  }
+
+  /* Calls user callback */
+  pstInfo->pfnCallback(pstInfo->pu8ImageData, pstInfo->u32Width, pstInfo->u32Height, pstInfo->pContext);
+
   /* Deletes data */
   orxMemory_Free(pstInfo->pu8ImageData);
 
-  /* Deletes save info */
+  /* Deletes read back info */
   orxMemory_Free(pstInfo);
 
   /* Done! */
-  return eResult;
+  return orxSTATUS_SUCCESS;
+}
+
+static void orxFASTCALL orxDisplay_GLFW_ResolveReadBack()
+{
+  orxDISPLAY_READ_BACK       *pstReadBack;
+  orxDISPLAY_READ_BACK_INFO  *pstInfo;
+  orxU8                      *pu8ImageData;
+  orxU32                      u32Size;
+
+  /* Checks */
+  orxASSERT(sstDisplay.u32ReadBackCount > 0);
+
+  /* Gets oldest read back */
+  pstReadBack = &(sstDisplay.astReadBackList[sstDisplay.u32ReadBackIndex]);
+
+  /* Has fence? */
+  if(pstReadBack->hFence != NULL)
+  {
+    /* Deletes it */
+    glDeleteSync(pstReadBack->hFence);
+    glASSERT();
+    pstReadBack->hFence = NULL;
+  }
+
+  /* Gets data size */
+  u32Size = pstReadBack->u32LineSize * pstReadBack->u32Height;
+
+  /* Allocates info & data */
+  pstInfo       = (orxDISPLAY_READ_BACK_INFO *)orxMemory_Allocate(sizeof(orxDISPLAY_READ_BACK_INFO), orxMEMORY_TYPE_TEMP);
+  pu8ImageData  = (orxU8 *)orxMemory_Allocate(u32Size, orxMEMORY_TYPE_MAIN);
+
+  /* Valid? */
+  if((pstInfo != orxNULL) && (pu8ImageData != orxNULL))
+  {
+    const orxU8 *pu8Source;
+
+    /* Maps pixel buffer (data is ready or about to be) */
+    glBindBufferARB(GL_PIXEL_PACK_BUFFER_ARB, pstReadBack->uiBuffer);
+    glASSERT();
+    pu8Source = (const orxU8 *)glMapBufferARB(GL_PIXEL_PACK_BUFFER_ARB, GL_READ_ONLY_ARB);
+    glASSERT();
+
+    /* Success? */
+    if(pu8Source != NULL)
+    {
+      /* Copies data, any conversion will happen on the task thread */
+      orxMemory_Copy(pu8ImageData, pu8Source, u32Size);
+
+      /* Unmaps buffer */
+      glUnmapBufferARB(GL_PIXEL_PACK_BUFFER_ARB);
+      glASSERT();
+
+      /* Inits info */
+      pstInfo->pfnCallback  = pstReadBack->pfnCallback;
+      pstInfo->pContext     = pstReadBack->pContext;
+      pstInfo->pu8ImageData = pu8ImageData;
+      pstInfo->u32Width     = pstReadBack->u32Width;
+      pstInfo->u32Height    = pstReadBack->u32Height;
+      pstInfo->u32LineSize  = pstReadBack->u32LineSize;
+      pstInfo->bScreen      = pstReadBack->bScreen;
+
+      /* Runs asynchronous task */
+      if(orxThread_RunTask(&orxDisplay_GLFW_ReadBackData, orxNULL, orxNULL, (void *)pstInfo) != orxSTATUS_FAILURE)
+      {
+        /* Hands them over */
+        pstInfo       = orxNULL;
+        pu8ImageData  = orxNULL;
+      }
+    }
+
+    /* Unbinds pixel buffer */
+    glBindBufferARB(GL_PIXEL_PACK_BUFFER_ARB, 0);
+    glASSERT();
+  }
+
+  /* Not handed over? */
+  if(pstInfo != orxNULL)
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Couldn't deliver read back data for frame %u.", pstReadBack->u32Frame);
+
+    /* Deletes info */
+    orxMemory_Free(pstInfo);
+  }
+  if(pu8ImageData != orxNULL)
+  {
+    /* Deletes data */
+    orxMemory_Free(pu8ImageData);
+  }
+
+  /* Pops it */
+  sstDisplay.u32ReadBackIndex = (sstDisplay.u32ReadBackIndex + 1) & (orxDISPLAY_KU32_READ_BACK_NUMBER - 1);
+  sstDisplay.u32ReadBackCount--;
+
+  /* Done! */
+  return;
+}
+
+static void orxFASTCALL orxDisplay_GLFW_UpdateReadBack(orxBOOL _bFlush)
+{
+  /* While there are pending read backs */
+  while(sstDisplay.u32ReadBackCount > 0)
+  {
+    orxDISPLAY_READ_BACK *pstReadBack;
+    orxBOOL               bReady;
+
+    /* Gets oldest read back */
+    pstReadBack = &(sstDisplay.astReadBackList[sstDisplay.u32ReadBackIndex]);
+
+    /* Flushing? */
+    if(_bFlush != orxFALSE)
+    {
+      /* Is ready */
+      bReady = orxTRUE;
+    }
+    /* Has fence? */
+    else if(pstReadBack->hFence != NULL)
+    {
+      /* Is ready if signaled (polls without waiting) */
+      bReady = (glClientWaitSync(pstReadBack->hFence, 0, 0) != GL_TIMEOUT_EXPIRED) ? orxTRUE : orxFALSE;
+    }
+    else
+    {
+      /* Is ready if old enough */
+      bReady = (sstDisplay.u32FrameCount - pstReadBack->u32Frame >= orxDISPLAY_KU32_READ_BACK_LATENCY) ? orxTRUE : orxFALSE;
+    }
+
+    /* Ready? */
+    if(bReady != orxFALSE)
+    {
+      /* Resolves it */
+      orxDisplay_GLFW_ResolveReadBack();
+    }
+    else
+    {
+      /* Stops, read backs are delivered in order */
+      break;
+    }
+  }
+
+  /* Done! */
+  return;
 }
 
 
@@ -3323,6 +3622,12 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_Swap()
     /* Swap buffers */
     glfwSwapBuffers(sstDisplay.pstWindow);
 
+    /* Updates frame count */
+    sstDisplay.u32FrameCount++;
+
+    /* Delivers ready read backs */
+    orxDisplay_GLFW_UpdateReadBack(orxFALSE);
+
     /* Is fullscreen & VSync? */
     if(orxFLAG_TEST_ALL(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_FULLSCREEN | orxDISPLAY_KU32_STATIC_FLAG_VSYNC))
     {
@@ -3583,6 +3888,190 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_GetBitmapData(const orxBITMAP *_pstBitmap,
   return eResult;
 }
 
+orxSTATUS orxFASTCALL orxDisplay_GLFW_ReadBackBitmapData(const orxBITMAP *_pstBitmap, orxDISPLAY_READ_BACK_FUNCTION _pfnCallback, void *_pContext)
+{
+  orxU32    u32Width, u32Height;
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+  orxASSERT(_pfnCallback != orxNULL);
+
+  /* Gets bitmap size */
+  u32Width  = orxF2U(_pstBitmap->fWidth);
+  u32Height = orxF2U(_pstBitmap->fHeight);
+
+  /* Has PBO support? */
+  if(orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_PBO))
+  {
+    orxDISPLAY_READ_BACK *pstReadBack;
+    orxU32                u32LineSize, u32BufferSize;
+
+    /* Is ring full? */
+    if(sstDisplay.u32ReadBackCount == orxDISPLAY_KU32_READ_BACK_NUMBER)
+    {
+      /* Resolves all ready read backs (never waits on a fence) */
+      orxDisplay_GLFW_UpdateReadBack(orxFALSE);
+    }
+
+    /* Still full? */
+    if(sstDisplay.u32ReadBackCount == orxDISPLAY_KU32_READ_BACK_NUMBER)
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can't read back bitmap <0x%X>: all %u pending read backs are still in flight, dropping request.", _pstBitmap, orxDISPLAY_KU32_READ_BACK_NUMBER);
+    }
+    else
+    {
+      /* Gets next read back */
+      pstReadBack = &(sstDisplay.astReadBackList[(sstDisplay.u32ReadBackIndex + sstDisplay.u32ReadBackCount) & (orxDISPLAY_KU32_READ_BACK_NUMBER - 1)]);
+
+      /* Gets line & buffer sizes */
+      u32LineSize   = ((_pstBitmap == sstDisplay.pstScreen) ? u32Width : _pstBitmap->u32RealWidth) * 4 * sizeof(orxU8);
+      u32BufferSize = u32LineSize * ((_pstBitmap == sstDisplay.pstScreen) ? u32Height : _pstBitmap->u32RealHeight);
+
+      /* Draws remaining items */
+      orxDisplay_GLFW_DrawArrays();
+
+      /* No buffer yet? */
+      if(pstReadBack->uiBuffer == 0)
+      {
+        /* Generates it */
+        glGenBuffersARB(1, &(pstReadBack->uiBuffer));
+        glASSERT();
+      }
+
+      /* Binds it */
+      glBindBufferARB(GL_PIXEL_PACK_BUFFER_ARB, pstReadBack->uiBuffer);
+      glASSERT();
+
+      /* Not big enough? */
+      if(pstReadBack->u32BufferSize < u32BufferSize)
+      {
+        /* Resizes it */
+        glBufferDataARB(GL_PIXEL_PACK_BUFFER_ARB, (GLsizeiptrARB)u32BufferSize, NULL, GL_STREAM_READ_ARB);
+        glASSERT();
+
+        /* Stores its size */
+        pstReadBack->u32BufferSize = u32BufferSize;
+      }
+
+      /* Screen? */
+      if(_pstBitmap == sstDisplay.pstScreen)
+      {
+        /* Is screen not the current frame buffer? */
+        if((orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_FRAMEBUFFER))
+        && (sstDisplay.uiLastFrameBuffer != 0))
+        {
+          /* Binds screen */
+          glBindFramebufferEXT(GL_FRAMEBUFFER_EXT, 0);
+          glASSERT();
+        }
+
+        /* Queues screen copy into the pixel buffer */
+        glReadPixels(0, 0, (GLsizei)u32Width, (GLsizei)u32Height, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+        glASSERT();
+
+        /* Should restore frame buffer? */
+        if((orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_FRAMEBUFFER))
+        && (sstDisplay.uiLastFrameBuffer != 0))
+        {
+          /* Restores it */
+          glBindFramebufferEXT(GL_FRAMEBUFFER_EXT, sstDisplay.uiLastFrameBuffer);
+          glASSERT();
+        }
+      }
+      else
+      {
+        /* Binds bitmap's associated texture */
+        glBindTexture(GL_TEXTURE_2D, _pstBitmap->uiTexture);
+        glASSERT();
+
+        /* Queues texture copy into the pixel buffer */
+        glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+        glASSERT();
+
+        /* Restores previous texture */
+        glBindTexture(GL_TEXTURE_2D, (sstDisplay.apstBoundBitmapList[sstDisplay.s32ActiveTextureUnit] != orxNULL) ? sstDisplay.apstBoundBitmapList[sstDisplay.s32ActiveTextureUnit]->uiTexture : 0);
+        glASSERT();
+      }
+
+      /* Unbinds pixel buffer */
+      glBindBufferARB(GL_PIXEL_PACK_BUFFER_ARB, 0);
+      glASSERT();
+
+      /* Inits read back */
+      pstReadBack->pfnCallback  = _pfnCallback;
+      pstReadBack->pContext     = _pContext;
+      pstReadBack->hFence       = (orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_SYNC)) ? glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0) : NULL;
+      pstReadBack->u32Width     = u32Width;
+      pstReadBack->u32Height    = u32Height;
+      pstReadBack->u32LineSize  = u32LineSize;
+      pstReadBack->u32Frame     = sstDisplay.u32FrameCount;
+      pstReadBack->bScreen      = (_pstBitmap == sstDisplay.pstScreen) ? orxTRUE : orxFALSE;
+      glASSERT();
+
+      /* Pushes it */
+      sstDisplay.u32ReadBackCount++;
+
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
+  }
+  else
+  {
+    orxDISPLAY_READ_BACK_INFO  *pstInfo;
+    orxU8                      *pu8ImageData;
+    orxU32                      u32BufferSize;
+
+    /* Gets buffer size */
+    u32BufferSize = u32Width * u32Height * 4 * sizeof(orxU8);
+
+    /* Allocates info & data */
+    pstInfo       = (orxDISPLAY_READ_BACK_INFO *)orxMemory_Allocate(sizeof(orxDISPLAY_READ_BACK_INFO), orxMEMORY_TYPE_TEMP);
+    pu8ImageData  = (orxU8 *)orxMemory_Allocate(u32BufferSize, orxMEMORY_TYPE_MAIN);
+
+    /* Valid? */
+    if((pstInfo != orxNULL) && (pu8ImageData != orxNULL))
+    {
+      /* Gets bitmap data synchronously */
+      if(orxDisplay_GLFW_GetBitmapData(_pstBitmap, pu8ImageData, u32BufferSize) != orxSTATUS_FAILURE)
+      {
+        /* Inits info */
+        pstInfo->pfnCallback  = _pfnCallback;
+        pstInfo->pContext     = _pContext;
+        pstInfo->pu8ImageData = pu8ImageData;
+        pstInfo->u32Width     = u32Width;
+        pstInfo->u32Height    = u32Height;
+        pstInfo->u32LineSize  = u32Width * 4 * sizeof(orxU8);
+        pstInfo->bScreen      = orxFALSE;
+
+        /* Runs asynchronous task */
+        eResult = orxThread_RunTask(&orxDisplay_GLFW_ReadBackData, orxNULL, orxNULL, (void *)pstInfo);
+      }
+    }
+
+    /* Failure? */
+    if(eResult == orxSTATUS_FAILURE)
+    {
+      /* Frees info */
+      if(pstInfo != orxNULL)
+      {
+        orxMemory_Free(pstInfo);
+      }
+
+      /* Frees data */
+      if(pu8ImageData != orxNULL)
+      {
+        orxMemory_Free(pu8ImageData);
+      }
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 orxSTATUS orxFASTCALL orxDisplay_GLFW_SetBitmapColorKey(orxBITMAP *_pstBitmap, orxRGBA _stColor, orxBOOL _bEnable)
 {
   orxSTATUS eResult = orxSTATUS_FAILURE;
@@ -4137,57 +4626,31 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_TransformBitmap(const orxBITMAP *_pstSrc,
 
 orxSTATUS orxFASTCALL orxDisplay_GLFW_SaveBitmap(const orxBITMAP *_pstBitmap, const orxSTRING _zFilename)
 {
-  orxU32    u32BufferSize;
-  orxU8    *pu8ImageData;
-  orxSTATUS eResult = orxSTATUS_FAILURE;
+  orxDISPLAY_SAVE_INFO *pstInfo;
+  orxSTATUS             eResult = orxSTATUS_FAILURE;
 
   /* Checks */
   orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBitmap != orxNULL);
   orxASSERT(_zFilename != orxNULL);
 
-  /* Gets buffer size */
-  u32BufferSize = orxF2U(_pstBitmap->fWidth * _pstBitmap->fHeight) * 4 * sizeof(orxU8);
-
-  /* Allocates buffer */
-  pu8ImageData = (orxU8 *)orxMemory_Allocate(u32BufferSize, orxMEMORY_TYPE_MAIN);
+  /* Allocates save info */
+  pstInfo = (orxDISPLAY_SAVE_INFO *)orxMemory_Allocate(sizeof(orxDISPLAY_SAVE_INFO), orxMEMORY_TYPE_TEMP);
 
   /* Valid? */
-  if(pu8ImageData != orxNULL)
+  if(pstInfo != orxNULL)
   {
-    orxDISPLAY_SAVE_INFO *pstInfo = orxNULL;
-
-    /* Gets bitmap data */
-    if(orxDisplay_GLFW_GetBitmapData(_pstBitmap, pu8ImageData, u32BufferSize) != orxSTATUS_FAILURE)
-    {
-      /* Allocates save info */
-      pstInfo = (orxDISPLAY_SAVE_INFO *)orxMemory_Allocate(sizeof(orxDISPLAY_SAVE_INFO), orxMEMORY_TYPE_TEMP);
-
-      /* Valid? */
-      if(pstInfo != orxNULL)
-      {
-        /* Inits it */
-        pstInfo->pu8ImageData   = pu8ImageData;
-        pstInfo->stFilenameID   = orxString_GetID(_zFilename);
-        pstInfo->u32Width       = orxF2U(_pstBitmap->fWidth);
-        pstInfo->u32Height      = orxF2U(_pstBitmap->fHeight);
+    /* Inits it */
+    pstInfo->stFilenameID = orxString_GetID(_zFilename);
 
-        /* Runs asynchronous task */
-        eResult = orxThread_RunTask(&orxDisplay_GLFW_SaveBitmapData, orxNULL, orxNULL, (void *)pstInfo);
-      }
-    }
+    /* Reads bitmap back, it'll get saved on the task thread */
+    eResult = orxDisplay_GLFW_ReadBackBitmapData(_pstBitmap, &orxDisplay_GLFW_SaveReadBackData, (void *)pstInfo);
 
     /* Failure? */
     if(eResult == orxSTATUS_FAILURE)
     {
       /* Frees save info */
-      if(pstInfo != orxNULL)
-      {
-        orxMemory_Free(pstInfo);
-      }
-
-      /* Frees buffer */
-      orxMemory_Free(pu8ImageData);
+      orxMemory_Free(pstInfo);
     }
   }
 
@@ -4663,6 +5126,9 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_SetVideoMode(const orxDISPLAY_VIDEO_MODE *
         /* Success? */
         if(pstNewWindow != orxNULL)
         {
+          /* Delivers pending read backs */
+          orxDisplay_GLFW_UpdateReadBack(orxTRUE);
+
           /* Deletes previous window */
           glfwDestroyWindow(sstDisplay.pstWindow);
 
@@ -5405,6 +5871,8 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_Init()
 
 void orxFASTCALL orxDisplay_GLFW_Exit()
 {
+  orxU32 i;
+
   /* Was initialized? */
   if(sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY)
   {
@@ -5423,6 +5891,21 @@ void orxFASTCALL orxDisplay_GLFW_Exit()
       glfwDestroyCursor(sstDisplay.pstCursor);
     }
 
+    /* Delivers pending read backs */
+    orxDisplay_GLFW_UpdateReadBack(orxTRUE);
+
+    /* For all read backs */
+    for(i = 0; i < orxDISPLAY_KU32_READ_BACK_NUMBER; i++)
+    {
+      /* Has buffer? */
+      if(sstDisplay.astReadBackList[i].uiBuffer != 0)
+      {
+        /* Deletes it */
+        glDeleteBuffersARB(1, &(sstDisplay.astReadBackList[i].uiBuffer));
+        glASSERT();
+      }
+    }
+
     /* Exits from GLFW */
     glfwTerminate();
 
@@ -6148,6 +6631,7 @@ orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_SetBitmapClipping, DISPLAY, SET
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_SetBitmapColorKey, DISPLAY, SET_BITMAP_COLOR_KEY);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_SetBitmapData, DISPLAY, SET_BITMAP_DATA);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_GetBitmapData, DISPLAY, GET_BITMAP_DATA);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_ReadBackBitmapData, DISPLAY, READ_BACK_BITMAP_DATA);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_SetBitmapColor, DISPLAY, SET_BITMAP_COLOR);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_GetBitmapColor, DISPLAY, GET_BITMAP_COLOR);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_GetBitmapSize, DISPLAY, GET_BITMAP_SIZE);
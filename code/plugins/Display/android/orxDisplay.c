@@ -229,6 +229,18 @@ typedef struct __orxDISPLAY_SAVE_INFO_t
 
 } orxDISPLAY_SAVE_INFO;
 
+/** Internal read back info structure
+ */
+typedef struct __orxDISPLAY_READ_BACK_INFO_t
+{
+  orxDISPLAY_READ_BACK_FUNCTION pfnCallback;
+  void                     *pContext;
+  orxU8                    *pu8ImageData;
+  orxU32                    u32Width;
+  orxU32                    u32Height;
+
+} orxDISPLAY_READ_BACK_INFO;
+
 /** Internal bitmap load info structure
  */
 typedef struct __orxDISPLAY_LOAD_INFO_t
@@ -1488,6 +1500,28 @@ static void orxFASTCALL orxDisplay_Android_DeleteBitmapData(orxBITMAP *_pstBitma
 }
 
 
+/** Delivers read back data (task thread)
+ */
+static orxSTATUS orxFASTCALL orxDisplay_Android_ReadBackData(void *_pContext)
+{
+  orxDISPLAY_READ_BACK_INFO *pstInfo;
+
+  /* Gets read back info */
+  pstInfo = (orxDISPLAY_READ_BACK_INFO *)_pContext;
+
+  /* Calls user callback */
+  pstInfo->pfnCallback(pstInfo->pu8ImageData, pstInfo->u32Width, pstInfo->u32Height, pstInfo->pContext);
+
+  /* Deletes data */
+  orxMemory_Free(pstInfo->pu8ImageData);
+
+  /* Deletes read back info */
+  orxMemory_Free(pstInfo);
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
 static orxSTATUS orxFASTCALL orxDisplay_Android_SaveBitmapData(void *_pContext)
 {
   orxDISPLAY_SAVE_INFO *pstInfo;
@@ -3443,6 +3477,63 @@ orxSTATUS orxFASTCALL orxDisplay_Android_TransformBitmap(const orxBITMAP *_pstSr
   return eResult;
 }
 
+orxSTATUS orxFASTCALL orxDisplay_Android_ReadBackBitmapData(const orxBITMAP *_pstBitmap, orxDISPLAY_READ_BACK_FUNCTION _pfnCallback, void *_pContext)
+{
+  orxDISPLAY_READ_BACK_INFO  *pstInfo;
+  orxU8                      *pu8ImageData;
+  orxU32                      u32BufferSize;
+  orxSTATUS                   eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+  orxASSERT(_pfnCallback != orxNULL);
+
+  /* Gets buffer size */
+  u32BufferSize = orxF2U(_pstBitmap->fWidth * _pstBitmap->fHeight) * 4 * sizeof(orxU8);
+
+  /* Allocates info & data */
+  pstInfo       = (orxDISPLAY_READ_BACK_INFO *)orxMemory_Allocate(sizeof(orxDISPLAY_READ_BACK_INFO), orxMEMORY_TYPE_TEMP);
+  pu8ImageData  = (orxU8 *)orxMemory_Allocate(u32BufferSize, orxMEMORY_TYPE_MAIN);
+
+  /* Valid? */
+  if((pstInfo != orxNULL) && (pu8ImageData != orxNULL))
+  {
+    /* Gets data synchronously (no pixel buffer objects on this target) */
+    if(orxDisplay_Android_GetBitmapData(_pstBitmap, pu8ImageData, u32BufferSize) != orxSTATUS_FAILURE)
+    {
+      /* Inits info */
+      pstInfo->pfnCallback  = _pfnCallback;
+      pstInfo->pContext     = _pContext;
+      pstInfo->pu8ImageData = pu8ImageData;
+      pstInfo->u32Width     = orxF2U(_pstBitmap->fWidth);
+      pstInfo->u32Height    = orxF2U(_pstBitmap->fHeight);
+
+      /* Delivers it on the task thread */
+      eResult = orxThread_RunTask(&orxDisplay_Android_ReadBackData, orxNULL, orxNULL, (void *)pstInfo);
+    }
+  }
+
+  /* Failure? */
+  if(eResult == orxSTATUS_FAILURE)
+  {
+    /* Frees info */
+    if(pstInfo != orxNULL)
+    {
+      orxMemory_Free(pstInfo);
+    }
+
+    /* Frees data */
+    if(pu8ImageData != orxNULL)
+    {
+      orxMemory_Free(pu8ImageData);
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 orxSTATUS orxFASTCALL orxDisplay_Android_SaveBitmap(const orxBITMAP *_pstBitmap, const orxSTRING _zFilename)
 {
   orxU32          u32BufferSize;
@@ -4988,6 +5079,7 @@ orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_SetBitmapClipping, DISPLAY,
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_GetBitmapID, DISPLAY, GET_BITMAP_ID);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_SetBitmapData, DISPLAY, SET_BITMAP_DATA);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_GetBitmapData, DISPLAY, GET_BITMAP_DATA);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_ReadBackBitmapData, DISPLAY, READ_BACK_BITMAP_DATA);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_SetBitmapColorKey, DISPLAY, SET_BITMAP_COLOR_KEY);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_SetBitmapColor, DISPLAY, SET_BITMAP_COLOR);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_GetBitmapColor, DISPLAY, GET_BITMAP_COLOR);
@@ -250,6 +250,18 @@ typedef struct __orxDISPLAY_SAVE_INFO_t
 
 } orxDISPLAY_SAVE_INFO;
 
+/** Internal read back info structure
+ */
+typedef struct __orxDISPLAY_READ_BACK_INFO_t
+{
+  orxDISPLAY_READ_BACK_FUNCTION pfnCallback;
+  void                     *pContext;
+  orxU8                    *pu8ImageData;
+  orxU32                    u32Width;
+  orxU32                    u32Height;
+
+} orxDISPLAY_READ_BACK_INFO;
+
 /** Internal bitmap load info structure
  */
 typedef struct __orxDISPLAY_LOAD_INFO_t
@@ -1826,6 +1838,28 @@ static void orxFASTCALL orxDisplay_iOS_ReadResourceCallback(orxHANDLE _hResource
   orxResource_Close(_hResource);
 }
 
+/** Delivers read back data (task thread)
+ */
+static orxSTATUS orxFASTCALL orxDisplay_iOS_ReadBackData(void *_pContext)
+{
+  orxDISPLAY_READ_BACK_INFO *pstInfo;
+
+  /* Gets read back info */
+  pstInfo = (orxDISPLAY_READ_BACK_INFO *)_pContext;
+
+  /* Calls user callback */
+  pstInfo->pfnCallback(pstInfo->pu8ImageData, pstInfo->u32Width, pstInfo->u32Height, pstInfo->pContext);
+
+  /* Deletes data */
+  orxMemory_Free(pstInfo->pu8ImageData);
+
+  /* Deletes read back info */
+  orxMemory_Free(pstInfo);
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
 static orxSTATUS orxFASTCALL orxDisplay_iOS_SaveBitmapData(void *_pContext)
 {
   orxDISPLAY_SAVE_INFO *pstInfo;
@@ -3694,6 +3728,63 @@ orxSTATUS orxFASTCALL orxDisplay_iOS_TransformBitmap(const orxBITMAP *_pstSrc, c
   return eResult;
 }
 
+orxSTATUS orxFASTCALL orxDisplay_iOS_ReadBackBitmapData(const orxBITMAP *_pstBitmap, orxDISPLAY_READ_BACK_FUNCTION _pfnCallback, void *_pContext)
+{
+  orxDISPLAY_READ_BACK_INFO  *pstInfo;
+  orxU8                      *pu8ImageData;
+  orxU32                      u32BufferSize;
+  orxSTATUS                   eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+  orxASSERT(_pfnCallback != orxNULL);
+
+  /* Gets buffer size */
+  u32BufferSize = orxF2U(_pstBitmap->fWidth * _pstBitmap->fHeight) * 4 * sizeof(orxU8);
+
+  /* Allocates info & data */
+  pstInfo       = (orxDISPLAY_READ_BACK_INFO *)orxMemory_Allocate(sizeof(orxDISPLAY_READ_BACK_INFO), orxMEMORY_TYPE_TEMP);
+  pu8ImageData  = (orxU8 *)orxMemory_Allocate(u32BufferSize, orxMEMORY_TYPE_MAIN);
+
+  /* Valid? */
+  if((pstInfo != orxNULL) && (pu8ImageData != orxNULL))
+  {
+    /* Gets data synchronously (no pixel buffer objects on this target) */
+    if(orxDisplay_iOS_GetBitmapData(_pstBitmap, pu8ImageData, u32BufferSize) != orxSTATUS_FAILURE)
+    {
+      /* Inits info */
+      pstInfo->pfnCallback  = _pfnCallback;
+      pstInfo->pContext     = _pContext;
+      pstInfo->pu8ImageData = pu8ImageData;
+      pstInfo->u32Width     = orxF2U(_pstBitmap->fWidth);
+      pstInfo->u32Height    = orxF2U(_pstBitmap->fHeight);
+
+      /* Delivers it on the task thread */
+      eResult = orxThread_RunTask(&orxDisplay_iOS_ReadBackData, orxNULL, orxNULL, (void *)pstInfo);
+    }
+  }
+
+  /* Failure? */
+  if(eResult == orxSTATUS_FAILURE)
+  {
+    /* Frees info */
+    if(pstInfo != orxNULL)
+    {
+      orxMemory_Free(pstInfo);
+    }
+
+    /* Frees data */
+    if(pu8ImageData != orxNULL)
+    {
+      orxMemory_Free(pu8ImageData);
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 orxSTATUS orxFASTCALL orxDisplay_iOS_SaveBitmap(const orxBITMAP *_pstBitmap, const orxSTRING _zFilename)
 {
   orxU32    u32BufferSize;
@@ -4990,6 +5081,7 @@ orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_iOS_SetBitmapClipping, DISPLAY, SET_
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_iOS_SetBitmapColorKey, DISPLAY, SET_BITMAP_COLOR_KEY);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_iOS_SetBitmapData, DISPLAY, SET_BITMAP_DATA);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_iOS_GetBitmapData, DISPLAY, GET_BITMAP_DATA);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_iOS_ReadBackBitmapData, DISPLAY, READ_BACK_BITMAP_DATA);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_iOS_SetBitmapColor, DISPLAY, SET_BITMAP_COLOR);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_iOS_GetBitmapColor, DISPLAY, GET_BITMAP_COLOR);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_iOS_GetBitmapSize, DISPLAY, GET_BITMAP_SIZE);
@@ -76,9 +76,15 @@
 #define orxPHYSICS_KU32_STATIC_FLAG_ENABLED     0x00000002 /**< Enabled flag */
 #define orxPHYSICS_KU32_STATIC_FLAG_FIXED_DT    0x00000004 /**< Fixed DT flag */
 #define orxPHYSICS_KU32_STATIC_FLAG_INTERPOLATE 0x00000008 /**< Smoothed flag */
+#define orxPHYSICS_KU32_STATIC_FLAG_THREADED    0x00000010 /**< Threaded flag */
+#define orxPHYSICS_KU32_STATIC_FLAG_STEPPING    0x00000020 /**< Stepping flag */
+#define orxPHYSICS_KU32_STATIC_FLAG_PENDING     0x00000040 /**< Pending result flag */
+#define orxPHYSICS_KU32_STATIC_FLAG_BATCH       0x00000080 /**< Batched contact events flag */
 
 #define orxPHYSICS_KU32_STATIC_MASK_ALL         0xFFFFFFFF /**< All mask */
 
+#define orxPHYSICS_KZ_THREAD_NAME               "Physics"
+
 namespace orxPhysics
 {
   static const orxU32   su32DefaultIterations   = 10;
@@ -109,6 +115,10 @@ struct __orxPHYSICS_BODY_t
   b2Body                           *poBody;            /**< Box2D body */
   orxFLOAT                          fPreviousRotation; /**< Previous rotation */
   orxFLOAT                          fSmoothedRotation; /**< Smoothed rotation */
+  orxVECTOR                         vSnapshotPosition; /**< Position read while the world is being stepped */
+  orxVECTOR                         vSnapshotSpeed;    /**< Speed read while the world is being stepped */
+  orxFLOAT                          fSnapshotRotation; /**< Rotation read while the world is being stepped */
+  orxFLOAT                          fSnapshotAngularVelocity; /**< Angular velocity read while the world is being stepped */
 };
 
 /** Event storage
@@ -183,6 +193,13 @@ typedef struct __orxPHYSICS_STATIC_t
   orxFLOAT                    fOneMinusRatio;
   orxLINKLIST                 stBodyList;             /**< Body link list */
   orxBANK                    *pstBodyBank;            /**< Body bank */
+  orxTHREAD_SEMAPHORE        *pstStepSemaphore;       /**< Step semaphore */
+  orxTHREAD_SEMAPHORE        *pstSyncSemaphore;       /**< Sync semaphore */
+  orxU32                      u32StepThread;          /**< Step thread */
+  orxU32                      u32PendingSteps;        /**< Pending fixed step number */
+  orxFLOAT                    fPendingDT;             /**< Pending variable step DT */
+  orxPHYSICS_CONTACT         *astContactList;         /**< Batched contact list */
+  orxU32                      u32ContactListSize;     /**< Batched contact list size */
 
 #ifdef orxPHYSICS_ENABLE_DEBUG_DRAW
 
@@ -282,6 +299,122 @@ public:
   orxU16      u16CheckMask;
 };
 
+class OverlapCallback : public b2QueryCallback
+{
+public:
+
+  OverlapCallback() : pstOverlap(orxNULL), bPoint(false)
+  {
+    oTransform.SetIdentity();
+  }
+
+  bool ReportFixture(b2Fixture *_poFixture)
+  {
+    bool bResult = true;
+
+    /* Gets fixture's filter info */
+    const b2Filter &rstFilter = _poFixture->GetFilterData();
+
+    /* Match? */
+    if(((rstFilter.maskBits & pstOverlap->u16SelfFlags) != 0)
+    && ((rstFilter.categoryBits & pstOverlap->u16CheckMask) != 0))
+    {
+      orxHANDLE hBody;
+      orxU32    i;
+
+      /* Gets its body's user data */
+      hBody = (orxHANDLE)_poFixture->GetBody()->GetUserData();
+
+      /* Already found through another of its fixtures? */
+      for(i = 0; (i < pstOverlap->u32Count) && (pstOverlap->ahResultList[i] != hBody); i++);
+
+      /* New body? */
+      if(i == pstOverlap->u32Count)
+      {
+        bool bOverlap = false;
+
+        /* Degenerate box? */
+        if(bPoint != false)
+        {
+          /* Tests point */
+          bOverlap = _poFixture->TestPoint(vPoint);
+        }
+        else
+        {
+          int32 s32Child, s32ChildCount;
+
+          /* For all shape children (chains) */
+          for(s32Child = 0, s32ChildCount = _poFixture->GetShape()->GetChildCount(); (s32Child < s32ChildCount) && (bOverlap == false); s32Child++)
+          {
+            /* Tests overlap */
+            bOverlap = b2TestOverlap(&oShape, 0, _poFixture->GetShape(), s32Child, oTransform, _poFixture->GetBody()->GetTransform());
+          }
+        }
+
+        /* Overlap? */
+        if(bOverlap != false)
+        {
+          /* Stores body */
+          pstOverlap->ahResultList[pstOverlap->u32Count++] = hBody;
+
+          /* Stops when buffer is full */
+          bResult = (pstOverlap->u32Count < pstOverlap->u32Size);
+        }
+      }
+    }
+
+    /* Done! */
+    return bResult;
+  }
+
+  orxPHYSICS_OVERLAP *pstOverlap;
+  b2PolygonShape      oShape;
+  b2Transform         oTransform;
+  b2Vec2              vPoint;
+  bool                bPoint;
+};
+
+/** Is world being stepped by another thread? If so, transforms & velocities are read from the snapshot taken before the step and
+ * accessors of data the step never writes (mass, damping, filters, gravity) read it directly: only modifications need to sync
+ * @return      orxTRUE if the step thread currently owns the world, orxFALSE otherwise
+ */
+static orxINLINE orxBOOL orxPhysics_LiquidFun_IsStepping()
+{
+  orxBOOL bResult;
+
+  /* Updates result */
+  bResult = (orxFLAG_TEST(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_STEPPING)
+          && (orxThread_GetCurrent() != sstPhysics.u32StepThread)) ? orxTRUE : orxFALSE;
+
+  /* Done! */
+  return bResult;
+}
+
+/** Waits for the step thread to be done with the world, if needed
+ */
+static orxINLINE void orxPhysics_LiquidFun_Sync()
+{
+  /* Is world being stepped by another thread? */
+  if(orxPhysics_LiquidFun_IsStepping() != orxFALSE)
+  {
+    /* Profiles */
+    orxPROFILER_PUSH_MARKER("orxPhysics_Sync");
+
+    /* Waits for step thread */
+    orxThread_WaitSemaphore(sstPhysics.pstSyncSemaphore);
+    orxMEMORY_BARRIER();
+
+    /* Updates status */
+    orxFLAG_SET(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_NONE, orxPHYSICS_KU32_STATIC_FLAG_STEPPING);
+
+    /* Profiles */
+    orxPROFILER_POP_MARKER();
+  }
+
+  /* Done! */
+  return;
+}
+
 static void orxFASTCALL orxPhysics_LiquidFun_SendContactEvent(b2Contact *_poContact, orxPHYSICS_EVENT _eEventID)
 {
   orxBODY_PART             *pstSourceBodyPart, *pstDestinationBodyPart;
@@ -290,8 +423,11 @@ static void orxFASTCALL orxPhysics_LiquidFun_SendContactEvent(b2Contact *_poCont
   pstSourceBodyPart       = (orxBODY_PART *)_poContact->GetFixtureA()->GetUserData();
   pstDestinationBodyPart  = (orxBODY_PART *)_poContact->GetFixtureB()->GetUserData();
 
-  /* Valid? */
-  if((pstSourceBodyPart != orxNULL) && (pstDestinationBodyPart != orxNULL))
+  /* Valid and reported by at least one of the parts? */
+  if((pstSourceBodyPart != orxNULL)
+  && (pstDestinationBodyPart != orxNULL)
+  && ((orxBody_IsPartContactEventEnabled(pstSourceBodyPart) != orxFALSE)
+   || (orxBody_IsPartContactEventEnabled(pstDestinationBodyPart) != orxFALSE)))
   {
     orxPHYSICS_EVENT_STORAGE *pstEventStorage;
 
@@ -786,6 +922,9 @@ static orxSTATUS orxFASTCALL orxPhysics_LiquidFun_EventHandler(const orxEVENT *_
     {
       orxPHYSICS_DEBUG_RAY *pstRay;
 
+      /* Syncs world */
+      orxPhysics_LiquidFun_Sync();
+
       /* Draws debug */
       sstPhysics.poWorld->DrawDebugData();
 
@@ -963,6 +1102,242 @@ static void orxFASTCALL orxPhysics_LiquidFun_ResetSmoothedStates()
   }
 }
 
+/** Steps world simulation
+ * @param[in]   _u32Steps       Number of fixed steps
+ * @param[in]   _fDT            DT of the final variable step (only used when not in absolute fixed DT mode)
+ */
+static void orxFASTCALL orxPhysics_LiquidFun_Simulate(orxU32 _u32Steps, orxFLOAT _fDT)
+{
+  orxU32 i;
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxPhysics_Simulate");
+
+  /* For all steps */
+  for(i = 0; i < _u32Steps; i++)
+  {
+    /* Last step and smoothed? */
+    if((i == _u32Steps - 1) && orxFLAG_TEST(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_INTERPOLATE))
+    {
+      /* Reset smoothed states */
+      orxPhysics_LiquidFun_ResetSmoothedStates();
+    }
+
+    /* Updates world simulation */
+    sstPhysics.poWorld->Step(sstPhysics.fFixedDT, sstPhysics.u32Iterations, sstPhysics.u32Iterations >> 1, sstPhysics.u32ParticleIterations);
+  }
+
+  /* Not absolute fixed DT? */
+  if(!orxFLAG_TEST(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_FIXED_DT))
+  {
+    /* Updates last step of world simulation */
+    sstPhysics.poWorld->Step(_fDT, sstPhysics.u32Iterations, sstPhysics.u32Iterations >> 1, sstPhysics.u32ParticleIterations);
+  }
+
+  /* Clears forces */
+  sstPhysics.poWorld->ClearForces();
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return;
+}
+
+/** Step thread
+ * @param[in]   _pContext       Unused
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE (stops the thread)
+ */
+static orxSTATUS orxFASTCALL orxPhysics_LiquidFun_Step(void *_pContext)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Waits for step semaphore */
+  orxThread_WaitSemaphore(sstPhysics.pstStepSemaphore);
+  orxMEMORY_BARRIER();
+
+  /* Has work? */
+  if(orxFLAG_TEST(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_STEPPING))
+  {
+    /* Steps world */
+    orxPhysics_LiquidFun_Simulate(sstPhysics.u32PendingSteps, sstPhysics.fPendingDT);
+
+    /* Signals main thread */
+    orxMEMORY_BARRIER();
+    orxThread_SignalSemaphore(sstPhysics.pstSyncSemaphore);
+  }
+  else
+  {
+    /* Stops thread */
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Stores all bodies' transforms & velocities, they'll be returned by the accessors while the step thread owns the world
+ */
+static void orxFASTCALL orxPhysics_LiquidFun_StoreSnapshots()
+{
+  orxPHYSICS_BODY *pstPhysicBody;
+
+  /* For all physical bodies */
+  for(pstPhysicBody = (orxPHYSICS_BODY*)orxLinkList_GetFirst(&(sstPhysics.stBodyList));
+      pstPhysicBody != NULL;
+      pstPhysicBody = (orxPHYSICS_BODY*)orxLinkList_GetNext(&(pstPhysicBody->stNode)))
+  {
+    b2Body *poBody;
+    b2Vec2  vValue;
+
+    /* Gets body */
+    poBody = pstPhysicBody->poBody;
+
+    /* Stores its position & rotation */
+    vValue = poBody->GetPosition();
+    orxVector_Set(&(pstPhysicBody->vSnapshotPosition), sstPhysics.fRecDimensionRatio * vValue.x, sstPhysics.fRecDimensionRatio * vValue.y, orxFLOAT_0);
+    pstPhysicBody->fSnapshotRotation = poBody->GetAngle();
+
+    /* Stores its speed & angular velocity */
+    vValue = poBody->GetLinearVelocity();
+    orxVector_Set(&(pstPhysicBody->vSnapshotSpeed), sstPhysics.fRecDimensionRatio * vValue.x, sstPhysics.fRecDimensionRatio * vValue.y, orxFLOAT_0);
+    pstPhysicBody->fSnapshotAngularVelocity = poBody->GetAngularVelocity();
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Applies simulation results to all bodies & sends stored events
+ */
+static void orxFASTCALL orxPhysics_LiquidFun_ApplyResults()
+{
+  orxPHYSICS_BODY          *pstPhysicBody;
+  orxPHYSICS_EVENT_STORAGE *pstEventStorage;
+
+  /* For all physical bodies */
+  for(pstPhysicBody = (orxPHYSICS_BODY*)orxLinkList_GetFirst(&(sstPhysics.stBodyList));
+      pstPhysicBody != NULL;
+      pstPhysicBody = (orxPHYSICS_BODY*)orxLinkList_GetNext(&(pstPhysicBody->stNode)))
+  {
+    b2Body *poBody;
+
+    poBody = pstPhysicBody->poBody;
+
+    /* Non-static and awake? */
+    if((poBody->GetType() != b2_staticBody)
+    && (poBody->IsAwake() != false))
+    {
+      /* Applies simulation result */
+      orxPhysics_ApplySimulationResult(pstPhysicBody);
+    }
+  }
+
+  /* Batched contact events? */
+  if(orxFLAG_TEST(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_BATCH))
+  {
+    orxU32 u32Count;
+
+    /* Gets contact count */
+    u32Count = orxLinkList_GetCount(&(sstPhysics.stEventList));
+
+    /* Any? */
+    if(u32Count != 0)
+    {
+      /* Needs to grow contact list? */
+      if(u32Count > sstPhysics.u32ContactListSize)
+      {
+        orxPHYSICS_CONTACT *astNewList;
+
+        /* Allocates / reallocates it */
+        astNewList = (sstPhysics.astContactList != orxNULL)
+                   ? (orxPHYSICS_CONTACT *)orxMemory_Reallocate(sstPhysics.astContactList, u32Count * sizeof(orxPHYSICS_CONTACT))
+                   : (orxPHYSICS_CONTACT *)orxMemory_Allocate(u32Count * sizeof(orxPHYSICS_CONTACT), orxMEMORY_TYPE_PHYSICS);
+
+        /* Success? */
+        if(astNewList != orxNULL)
+        {
+          /* Stores it */
+          sstPhysics.astContactList     = astNewList;
+          sstPhysics.u32ContactListSize = u32Count;
+        }
+        else
+        {
+          /* Logs message */
+          orxDEBUG_PRINT(orxDEBUG_LEVEL_PHYSICS, "Couldn't grow contact list to %u contacts, dropping the extra ones.", u32Count);
+
+          /* Only sends what fits */
+          u32Count = sstPhysics.u32ContactListSize;
+        }
+      }
+
+      /* Has room? */
+      if(u32Count != 0)
+      {
+        orxPHYSICS_CONTACT_BATCH_PAYLOAD  stPayload;
+        orxU32                            i;
+
+        /* For all stored events */
+        for(pstEventStorage = (orxPHYSICS_EVENT_STORAGE *)orxLinkList_GetFirst(&(sstPhysics.stEventList)), i = 0;
+            (pstEventStorage != orxNULL) && (i < u32Count);
+            pstEventStorage = (orxPHYSICS_EVENT_STORAGE *)orxLinkList_GetNext(&(pstEventStorage->stNode)), i++)
+        {
+          orxPHYSICS_CONTACT *pstContact;
+
+          /* Gets contact */
+          pstContact = &(sstPhysics.astContactList[i]);
+
+          /* Inits it */
+          pstContact->hSender     = (orxHANDLE)orxStructure_GetOwner(orxBODY(pstEventStorage->poSource->GetUserData()));
+          pstContact->hRecipient  = (orxHANDLE)orxStructure_GetOwner(orxBODY(pstEventStorage->poDestination->GetUserData()));
+          pstContact->eID         = pstEventStorage->eID;
+          orxMemory_Copy(&(pstContact->stPayload), &(pstEventStorage->stPayload), sizeof(orxPHYSICS_EVENT_PAYLOAD));
+        }
+
+        /* Inits payload */
+        stPayload.astContactList  = sstPhysics.astContactList;
+        stPayload.u32ContactCount = i;
+
+        /* Sends batch event */
+        orxEVENT_SEND(orxEVENT_TYPE_PHYSICS, orxPHYSICS_EVENT_CONTACT_BATCH, orxNULL, orxNULL, &stPayload);
+      }
+    }
+  }
+  else
+  {
+    /* For all stored events */
+    for(pstEventStorage = (orxPHYSICS_EVENT_STORAGE *)orxLinkList_GetFirst(&(sstPhysics.stEventList));
+        pstEventStorage != orxNULL;
+        pstEventStorage = (orxPHYSICS_EVENT_STORAGE *)orxLinkList_GetNext(&(pstEventStorage->stNode)))
+    {
+      /* Depending on type */
+      switch(pstEventStorage->eID)
+      {
+        case orxPHYSICS_EVENT_CONTACT_ADD:
+        case orxPHYSICS_EVENT_CONTACT_REMOVE:
+        {
+          /* Sends event */
+          orxEVENT_SEND(orxEVENT_TYPE_PHYSICS, pstEventStorage->eID, orxStructure_GetOwner(orxBODY(pstEventStorage->poSource->GetUserData())), orxStructure_GetOwner(orxBODY(pstEventStorage->poDestination->GetUserData())), &(pstEventStorage->stPayload));
+
+          break;
+        }
+
+        default:
+        {
+          break;
+        }
+      }
+    }
+  }
+
+  /* Clears stored events */
+  orxLinkList_Clean(&(sstPhysics.stEventList));
+  orxBank_Clear(sstPhysics.pstEventBank);
+
+  /* Done! */
+  return;
+}
+
 /** Update (callback to register on a clock)
  * @param[in]   _pstClockInfo   Clock info of the clock used upon registration
  * @param[in]   _pContext       Context sent when registering callback to the clock
@@ -979,6 +1354,19 @@ static void orxFASTCALL orxPhysics_LiquidFun_Update(const orxCLOCK_INFO *_pstClo
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstClockInfo != orxNULL);
 
+  /* Has pending results from the step thread? */
+  if(orxFLAG_TEST(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_PENDING))
+  {
+    /* Waits for step thread */
+    orxPhysics_LiquidFun_Sync();
+
+    /* Updates status */
+    orxFLAG_SET(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_NONE, orxPHYSICS_KU32_STATIC_FLAG_PENDING);
+
+    /* Applies them */
+    orxPhysics_LiquidFun_ApplyResults();
+  }
+
   /* For all physical bodies */
   for(pstPhysicBody = (orxPHYSICS_BODY*)orxLinkList_GetFirst(&(sstPhysics.stBodyList));
       pstPhysicBody != NULL;
@@ -1077,8 +1465,7 @@ static void orxFASTCALL orxPhysics_LiquidFun_Update(const orxCLOCK_INFO *_pstClo
   /* Is simulation enabled? */
   if(orxFLAG_TEST(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_ENABLED))
   {
-    orxPHYSICS_EVENT_STORAGE *pstEventStorage;
-    orxU32                    u32Steps, i;
+    orxU32 u32Steps;
 
     /* Stores DT */
     sstPhysics.fLastDT = _pstClockInfo->fDT;
@@ -1092,33 +1479,26 @@ static void orxFASTCALL orxPhysics_LiquidFun_Update(const orxCLOCK_INFO *_pstClo
     /* Updates accumulator */
     sstPhysics.fDTAccumulator = orxMAX(orxFLOAT_0, sstPhysics.fDTAccumulator - (orxU2F(u32Steps) * sstPhysics.fFixedDT));
 
-    /* For all steps */
-    for(i = 0; i < u32Steps; i++)
+    /* Threaded? */
+    if(orxFLAG_TEST(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_THREADED))
     {
-      /* Last step and smoothed? */
-      if((i == u32Steps - 1) && orxFLAG_TEST(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_INTERPOLATE))
-      {
-        /* Reset smoothed states */
-        orxPhysics_LiquidFun_ResetSmoothedStates();
-      }
-
-      /* Updates world simulation */
-      sstPhysics.poWorld->Step(sstPhysics.fFixedDT, sstPhysics.u32Iterations, sstPhysics.u32Iterations >> 1, sstPhysics.u32ParticleIterations);
+      /* Stores steps */
+      sstPhysics.u32PendingSteps  = u32Steps;
+      sstPhysics.fPendingDT       = sstPhysics.fDTAccumulator;
+    }
+    else
+    {
+      /* Steps world */
+      orxPhysics_LiquidFun_Simulate(u32Steps, sstPhysics.fDTAccumulator);
     }
 
     /* Not absolute fixed DT? */
     if(!orxFLAG_TEST(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_FIXED_DT))
     {
-      /* Updates last step of world simulation */
-      sstPhysics.poWorld->Step(sstPhysics.fDTAccumulator, sstPhysics.u32Iterations, sstPhysics.u32Iterations >> 1, sstPhysics.u32ParticleIterations);
-
       /* Clears accumulator */
       sstPhysics.fDTAccumulator = orxFLOAT_0;
     }
 
-    /* Clears forces */
-    sstPhysics.poWorld->ClearForces();
-
     if(orxFLAG_TEST(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_INTERPOLATE))
     {
       /* Updates accumulator ratio */
@@ -1126,49 +1506,24 @@ static void orxFASTCALL orxPhysics_LiquidFun_Update(const orxCLOCK_INFO *_pstClo
       sstPhysics.fOneMinusRatio = orxFLOAT_1 - sstPhysics.fFixedTimestepAccumulatorRatio;
     }
 
-    /* For all physical bodies */
-    for(pstPhysicBody = (orxPHYSICS_BODY*)orxLinkList_GetFirst(&(sstPhysics.stBodyList));
-        pstPhysicBody != NULL;
-        pstPhysicBody = (orxPHYSICS_BODY*)orxLinkList_GetNext(&(pstPhysicBody->stNode)))
+    /* Threaded? */
+    if(orxFLAG_TEST(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_THREADED))
     {
-      poBody = pstPhysicBody->poBody;
+      /* Stores current state: accessors will read it instead of waiting for the step thread */
+      orxPhysics_LiquidFun_StoreSnapshots();
 
-      /* Non-static and awake? */
-      if((poBody->GetType() != b2_staticBody)
-      && (poBody->IsAwake() != false))
-      {
-        /* Applies simulation result */
-        orxPhysics_ApplySimulationResult(pstPhysicBody);
-      }
-    }
+      /* Updates status */
+      orxFLAG_SET(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_STEPPING | orxPHYSICS_KU32_STATIC_FLAG_PENDING, orxPHYSICS_KU32_STATIC_FLAG_NONE);
 
-    /* For all stored events */
-    for(pstEventStorage = (orxPHYSICS_EVENT_STORAGE *)orxLinkList_GetFirst(&(sstPhysics.stEventList));
-        pstEventStorage != orxNULL;
-        pstEventStorage = (orxPHYSICS_EVENT_STORAGE *)orxLinkList_GetNext(&(pstEventStorage->stNode)))
+      /* Kicks off step thread: its results will be applied during next update */
+      orxMEMORY_BARRIER();
+      orxThread_SignalSemaphore(sstPhysics.pstStepSemaphore);
+    }
+    else
     {
-      /* Depending on type */
-      switch(pstEventStorage->eID)
-      {
-        case orxPHYSICS_EVENT_CONTACT_ADD:
-        case orxPHYSICS_EVENT_CONTACT_REMOVE:
-        {
-          /* Sends event */
-          orxEVENT_SEND(orxEVENT_TYPE_PHYSICS, pstEventStorage->eID, orxStructure_GetOwner(orxBODY(pstEventStorage->poSource->GetUserData())), orxStructure_GetOwner(orxBODY(pstEventStorage->poDestination->GetUserData())), &(pstEventStorage->stPayload));
-
-          break;
-        }
-
-        default:
-        {
-          break;
-        }
-      }
+      /* Applies results */
+      orxPhysics_LiquidFun_ApplyResults();
     }
-
-    /* Clears stored events */
-    orxLinkList_Clean(&(sstPhysics.stEventList));
-    orxBank_Clear(sstPhysics.pstEventBank);
   }
 
   /* Profiles */
@@ -1188,6 +1543,9 @@ extern "C" orxPHYSICS_BODY *orxFASTCALL orxPhysics_LiquidFun_CreateBody(const or
   orxASSERT(_hUserData != orxHANDLE_UNDEFINED);
   orxASSERT(_pstBodyDef != orxNULL);
 
+  /* Syncs world */
+  orxPhysics_LiquidFun_Sync();
+
   /* 2D? */
   if(orxFLAG_TEST(_pstBodyDef->u32Flags, orxBODY_DEF_KU32_FLAG_2D))
   {
@@ -1282,6 +1640,9 @@ extern "C" void orxFASTCALL orxPhysics_LiquidFun_DeleteBody(orxPHYSICS_BODY *_ps
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBody != orxNULL);
 
+  /* Syncs world */
+  orxPhysics_LiquidFun_Sync();
+
   /* For all stored events */
   for(pstEventStorage = (orxPHYSICS_EVENT_STORAGE *)orxLinkList_GetFirst(&(sstPhysics.stEventList));
       pstEventStorage != orxNULL;
@@ -1330,6 +1691,9 @@ extern "C" orxPHYSICS_BODY_PART *orxFASTCALL orxPhysics_LiquidFun_CreatePart(orx
   orxASSERT(_pstBodyPartDef != orxNULL);
   orxASSERT(orxFLAG_TEST(_pstBodyPartDef->u32Flags, orxBODY_PART_DEF_KU32_MASK_TYPE));
 
+  /* Syncs world */
+  orxPhysics_LiquidFun_Sync();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -1522,6 +1886,9 @@ extern "C" void orxFASTCALL orxPhysics_LiquidFun_DeletePart(orxPHYSICS_BODY_PART
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBodyPart != orxNULL);
 
+  /* Syncs world */
+  orxPhysics_LiquidFun_Sync();
+
   /* Gets Fixture */
   poFixture = (b2Fixture *)_pstBodyPart;
 
@@ -1557,6 +1924,9 @@ extern "C" orxPHYSICS_BODY_JOINT *orxFASTCALL orxPhysics_LiquidFun_CreateJoint(o
   orxASSERT(_pstBodyJointDef != orxNULL);
   orxASSERT(orxFLAG_TEST(_pstBodyJointDef->u32Flags, orxBODY_JOINT_DEF_KU32_MASK_TYPE));
 
+  /* Syncs world */
+  orxPhysics_LiquidFun_Sync();
+
   /* Depending on joint type */
   switch(orxFLAG_GET(_pstBodyJointDef->u32Flags, orxBODY_JOINT_DEF_KU32_MASK_TYPE))
   {
@@ -1893,6 +2263,9 @@ extern "C" void orxFASTCALL orxPhysics_LiquidFun_DeleteJoint(orxPHYSICS_BODY_JOI
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBodyJoint != orxNULL);
 
+  /* Syncs world */
+  orxPhysics_LiquidFun_Sync();
+
   /* Deletes it */
   sstPhysics.poWorld->DestroyJoint((b2Joint *)_pstBodyJoint);
 
@@ -1907,6 +2280,9 @@ extern "C" void orxFASTCALL orxPhysics_LiquidFun_EnableMotor(orxPHYSICS_BODY_JOI
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBodyJoint != orxNULL);
 
+  /* Syncs world */
+  orxPhysics_LiquidFun_Sync();
+
   /* Gets joint */
   poJoint = (b2Joint *)_pstBodyJoint;
 
@@ -1934,6 +2310,9 @@ extern "C" void orxFASTCALL orxPhysics_LiquidFun_SetJointMotorSpeed(orxPHYSICS_B
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBodyJoint != orxNULL);
 
+  /* Syncs world */
+  orxPhysics_LiquidFun_Sync();
+
   /* Gets joint */
   poJoint = (b2Joint *)_pstBodyJoint;
 
@@ -1961,6 +2340,9 @@ extern "C" void orxFASTCALL orxPhysics_LiquidFun_SetJointMaxMotorTorque(orxPHYSI
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBodyJoint != orxNULL);
 
+  /* Syncs world */
+  orxPhysics_LiquidFun_Sync();
+
   /* Gets joint */
   poJoint = (b2Joint *)_pstBodyJoint;
 
@@ -1990,6 +2372,9 @@ extern "C" orxVECTOR *orxFASTCALL orxPhysics_LiquidFun_GetJointReactionForce(con
   orxASSERT(_pstBodyJoint != orxNULL);
   orxASSERT(_pvForce != orxNULL);
 
+  /* Syncs world */
+  orxPhysics_LiquidFun_Sync();
+
   /* Gets joint */
   poJoint = (const b2Joint *)_pstBodyJoint;
 
@@ -2012,6 +2397,9 @@ extern "C" orxFLOAT orxFASTCALL orxPhysics_LiquidFun_GetJointReactionTorque(cons
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBodyJoint != orxNULL);
 
+  /* Syncs world */
+  orxPhysics_LiquidFun_Sync();
+
   /* Gets joint */
   poJoint = (const b2Joint *)_pstBodyJoint;
 
@@ -2033,6 +2421,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetPosition(orxPHYSICS_BOD
   orxASSERT(_pstBody != orxNULL);
   orxASSERT(_pvPosition != orxNULL);
 
+  /* Syncs world */
+  orxPhysics_LiquidFun_Sync();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -2087,6 +2478,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetRotation(orxPHYSICS_BOD
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBody != orxNULL);
 
+  /* Syncs world */
+  orxPhysics_LiquidFun_Sync();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -2136,6 +2530,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetSpeed(orxPHYSICS_BODY *
   orxASSERT(_pstBody != orxNULL);
   orxASSERT(_pvSpeed != orxNULL);
 
+  /* Syncs world */
+  orxPhysics_LiquidFun_Sync();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -2169,6 +2566,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetAngularVelocity(orxPHYS
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBody != orxNULL);
 
+  /* Syncs world */
+  orxPhysics_LiquidFun_Sync();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -2199,6 +2599,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetCustomGravity(orxPHYSIC
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBody != orxNULL);
 
+  /* Syncs world */
+  orxPhysics_LiquidFun_Sync();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -2249,6 +2652,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetFixedRotation(orxPHYSIC
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBody != orxNULL);
 
+  /* Syncs world */
+  orxPhysics_LiquidFun_Sync();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -2268,6 +2674,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetDynamic(orxPHYSICS_BODY
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBody != orxNULL);
 
+  /* Syncs world */
+  orxPhysics_LiquidFun_Sync();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -2301,6 +2710,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetAllowMoving(orxPHYSICS_
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBody != orxNULL);
 
+  /* Syncs world */
+  orxPhysics_LiquidFun_Sync();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -2326,16 +2738,28 @@ extern "C" orxVECTOR *orxFASTCALL orxPhysics_LiquidFun_GetPosition(const orxPHYS
   orxASSERT(_pstBody != orxNULL);
   orxASSERT(_pvPosition != orxNULL);
 
-  /* Gets body */
-  poBody = (b2Body *)_pstBody->poBody;
+  /* Updates result */
+  pvResult = _pvPosition;
 
-  /* Gets its position */
-  vPosition = poBody->GetPosition();
+  /* Is world being stepped? */
+  if(orxPhysics_LiquidFun_IsStepping() != orxFALSE)
+  {
+    /* Uses its snapshot */
+    pvResult->fX  = _pstBody->vSnapshotPosition.fX;
+    pvResult->fY  = _pstBody->vSnapshotPosition.fY;
+  }
+  else
+  {
+    /* Gets body */
+    poBody = (b2Body *)_pstBody->poBody;
 
-  /* Updates result */
-  pvResult      = _pvPosition;
-  pvResult->fX  = sstPhysics.fRecDimensionRatio * vPosition.x;
-  pvResult->fY  = sstPhysics.fRecDimensionRatio * vPosition.y;
+    /* Gets its position */
+    vPosition = poBody->GetPosition();
+
+    /* Stores it */
+    pvResult->fX  = sstPhysics.fRecDimensionRatio * vPosition.x;
+    pvResult->fY  = sstPhysics.fRecDimensionRatio * vPosition.y;
+  }
 
   /* Done! */
   return pvResult;
@@ -2350,11 +2774,20 @@ extern "C" orxFLOAT orxFASTCALL orxPhysics_LiquidFun_GetRotation(const orxPHYSIC
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBody != orxNULL);
 
-  /* Gets body */
-  poBody = (b2Body *)_pstBody->poBody;
+  /* Is world being stepped? */
+  if(orxPhysics_LiquidFun_IsStepping() != orxFALSE)
+  {
+    /* Uses its snapshot */
+    fResult = _pstBody->fSnapshotRotation;
+  }
+  else
+  {
+    /* Gets body */
+    poBody = (b2Body *)_pstBody->poBody;
 
-  /* Gets its rotation */
-  fResult = poBody->GetAngle();
+    /* Gets its rotation */
+    fResult = poBody->GetAngle();
+  }
 
   /* Done! */
   return fResult;
@@ -2371,17 +2804,26 @@ extern "C" orxVECTOR *orxFASTCALL orxPhysics_LiquidFun_GetSpeed(const orxPHYSICS
   orxASSERT(_pstBody != orxNULL);
   orxASSERT(_pvSpeed != orxNULL);
 
-  /* Gets body */
-  poBody = (b2Body *)_pstBody->poBody;
+  /* Is world being stepped? */
+  if(orxPhysics_LiquidFun_IsStepping() != orxFALSE)
+  {
+    /* Uses its snapshot */
+    pvResult = orxVector_Copy(_pvSpeed, &(_pstBody->vSnapshotSpeed));
+  }
+  else
+  {
+    /* Gets body */
+    poBody = (b2Body *)_pstBody->poBody;
 
-  /* Gets its speed */
-  vSpeed = poBody->GetLinearVelocity();
+    /* Gets its speed */
+    vSpeed = poBody->GetLinearVelocity();
 
-  /* Updates result */
-  pvResult      = _pvSpeed;
-  pvResult->fX  = sstPhysics.fRecDimensionRatio * vSpeed.x;
-  pvResult->fY  = sstPhysics.fRecDimensionRatio * vSpeed.y;
-  pvResult->fZ  = orxFLOAT_0;
+    /* Updates result */
+    pvResult      = _pvSpeed;
+    pvResult->fX  = sstPhysics.fRecDimensionRatio * vSpeed.x;
+    pvResult->fY  = sstPhysics.fRecDimensionRatio * vSpeed.y;
+    pvResult->fZ  = orxFLOAT_0;
+  }
 
   /* Done! */
   return pvResult;
@@ -2399,6 +2841,9 @@ extern "C" orxVECTOR *orxFASTCALL orxPhysics_LiquidFun_GetSpeedAtWorldPosition(c
   orxASSERT(_pvPosition != orxNULL);
   orxASSERT(_pvSpeed != orxNULL);
 
+  /* Syncs world */
+  orxPhysics_LiquidFun_Sync();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -2424,11 +2869,20 @@ extern "C" orxFLOAT orxFASTCALL orxPhysics_LiquidFun_GetAngularVelocity(const or
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBody != orxNULL);
 
-  /* Gets body */
-  poBody = (b2Body *)_pstBody->poBody;
+  /* Is world being stepped? */
+  if(orxPhysics_LiquidFun_IsStepping() != orxFALSE)
+  {
+    /* Uses its snapshot */
+    fResult = _pstBody->fSnapshotAngularVelocity;
+  }
+  else
+  {
+    /* Gets body */
+    poBody = (b2Body *)_pstBody->poBody;
 
-  /* Gets its angular velocity */
-  fResult = poBody->GetAngularVelocity();
+    /* Gets its angular velocity */
+    fResult = poBody->GetAngularVelocity();
+  }
 
   /* Done! */
   return fResult;
@@ -2477,6 +2931,9 @@ extern "C" orxBOOL orxFASTCALL orxPhysics_LiquidFun_IsFixedRotation(const orxPHY
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBody != orxNULL);
 
+  /* Syncs world */
+  orxPhysics_LiquidFun_Sync();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -2544,6 +3001,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetLinearDamping(orxPHYSIC
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBody != orxNULL);
 
+  /* Syncs world */
+  orxPhysics_LiquidFun_Sync();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -2563,6 +3023,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetAngularDamping(orxPHYSI
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBody != orxNULL);
 
+  /* Syncs world */
+  orxPhysics_LiquidFun_Sync();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -2622,6 +3085,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_ApplyTorque(orxPHYSICS_BOD
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBody != orxNULL);
 
+  /* Syncs world */
+  orxPhysics_LiquidFun_Sync();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -2672,6 +3138,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_ApplyForce(orxPHYSICS_BODY
   orxASSERT(_pstBody != orxNULL);
   orxASSERT(_pvForce != orxNULL);
 
+  /* Syncs world */
+  orxPhysics_LiquidFun_Sync();
+
   /* Sets force */
   vForce.Set(_pvForce->fX, _pvForce->fY);
 
@@ -2737,6 +3206,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_ApplyImpulse(orxPHYSICS_BO
   orxASSERT(_pstBody != orxNULL);
   orxASSERT(_pvImpulse != orxNULL);
 
+  /* Syncs world */
+  orxPhysics_LiquidFun_Sync();
+
   /* Sets impulse */
   vImpulse.Set(sstPhysics.fDimensionRatio * _pvImpulse->fX, sstPhysics.fDimensionRatio * _pvImpulse->fY);
 
@@ -2800,6 +3272,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetPartSelfFlags(orxPHYSIC
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBodyPart != orxNULL);
 
+  /* Syncs world */
+  orxPhysics_LiquidFun_Sync();
+
   /* Gets fixture */
   poFixture = (b2Fixture *)_pstBodyPart;
 
@@ -2826,6 +3301,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetPartCheckMask(orxPHYSIC
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBodyPart != orxNULL);
 
+  /* Syncs world */
+  orxPhysics_LiquidFun_Sync();
+
   /* Gets fixture */
   poFixture = (b2Fixture *)_pstBodyPart;
 
@@ -2908,6 +3386,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetPartSolid(orxPHYSICS_BO
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBodyPart != orxNULL);
 
+  /* Syncs world */
+  orxPhysics_LiquidFun_Sync();
+
   /* Gets fixture */
   poFixture = (b2Fixture *)_pstBodyPart;
 
@@ -2918,6 +3399,21 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetPartSolid(orxPHYSICS_BO
   return eResult;
 }
 
+extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_EnablePartContactEvent(orxPHYSICS_BODY_PART *_pstBodyPart, orxBOOL _bEnable)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBodyPart != orxNULL);
+
+  /* Syncs world: the contact listener reads the part's definition from the step thread, which is about to be modified */
+  orxPhysics_LiquidFun_Sync();
+
+  /* Done! */
+  return eResult;
+}
+
 extern "C" orxHANDLE orxFASTCALL orxPhysics_LiquidFun_Raycast(const orxVECTOR *_pvBegin, const orxVECTOR *_pvEnd, orxU16 _u16SelfFlags, orxU16 _u16CheckMask, orxBOOL _bEarlyExit, orxVECTOR *_pvContact, orxVECTOR *_pvNormal)
 {
   b2Vec2          vBegin, vEnd;
@@ -2929,6 +3425,9 @@ extern "C" orxHANDLE orxFASTCALL orxPhysics_LiquidFun_Raycast(const orxVECTOR *_
   orxASSERT(_pvBegin != orxNULL);
   orxASSERT(_pvEnd != orxNULL);
 
+  /* Syncs world */
+  orxPhysics_LiquidFun_Sync();
+
   /* Gets extremities */
   vBegin.Set(sstPhysics.fDimensionRatio * _pvBegin->fX, sstPhysics.fDimensionRatio * _pvBegin->fY);
   vEnd.Set(sstPhysics.fDimensionRatio * _pvEnd->fX, sstPhysics.fDimensionRatio * _pvEnd->fY);
@@ -3005,11 +3504,167 @@ extern "C" orxHANDLE orxFASTCALL orxPhysics_LiquidFun_Raycast(const orxVECTOR *_
   return hResult;
 }
 
+extern "C" orxU32 orxFASTCALL orxPhysics_LiquidFun_RaycastBatch(orxPHYSICS_RAYCAST *_astRaycastList, orxU32 _u32Number)
+{
+  RayCastCallback oRaycastCallback;
+  orxU32          i, u32Result = 0;
+
+  /* Checks */
+  orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
+  orxASSERT((_astRaycastList != orxNULL) || (_u32Number == 0));
+
+  /* Syncs world */
+  orxPhysics_LiquidFun_Sync();
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxPhysics_RaycastBatch");
+
+  /* For all queries (no debug rays are recorded for batches) */
+  for(i = 0; i < _u32Number; i++)
+  {
+    orxPHYSICS_RAYCAST *pstRaycast;
+    b2Vec2              vBegin, vEnd;
+
+    /* Gets query */
+    pstRaycast = &(_astRaycastList[i]);
+
+    /* Gets extremities */
+    vBegin.Set(sstPhysics.fDimensionRatio * pstRaycast->vBegin.fX, sstPhysics.fDimensionRatio * pstRaycast->vBegin.fY);
+    vEnd.Set(sstPhysics.fDimensionRatio * pstRaycast->vEnd.fX, sstPhysics.fDimensionRatio * pstRaycast->vEnd.fY);
+
+    /* Inits callback */
+    oRaycastCallback.hResult      = orxHANDLE_UNDEFINED;
+    oRaycastCallback.u16SelfFlags = pstRaycast->u16SelfFlags;
+    oRaycastCallback.u16CheckMask = pstRaycast->u16CheckMask;
+    oRaycastCallback.bEarlyExit   = pstRaycast->bEarlyExit;
+
+    /* Issues Raycast */
+    sstPhysics.poWorld->RayCast(&oRaycastCallback, vBegin, vEnd);
+
+    /* Stores result */
+    pstRaycast->hResult = oRaycastCallback.hResult;
+
+    /* Found? */
+    if(oRaycastCallback.hResult != orxHANDLE_UNDEFINED)
+    {
+      /* Stores contact & normal */
+      orxVector_Set(&(pstRaycast->vContact), oRaycastCallback.vContact.fX, oRaycastCallback.vContact.fY, pstRaycast->vBegin.fZ);
+      orxVector_Copy(&(pstRaycast->vNormal), &(oRaycastCallback.vNormal));
+
+      /* Updates result */
+      u32Result++;
+    }
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return u32Result;
+}
+
+extern "C" orxU32 orxFASTCALL orxPhysics_LiquidFun_OverlapBatch(orxPHYSICS_OVERLAP *_astOverlapList, orxU32 _u32Number)
+{
+  OverlapCallback oOverlapCallback;
+  orxU32          i, u32Result = 0;
+
+  /* Checks */
+  orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
+  orxASSERT((_astOverlapList != orxNULL) || (_u32Number == 0));
+
+  /* Syncs world */
+  orxPhysics_LiquidFun_Sync();
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxPhysics_OverlapBatch");
+
+  /* For all queries */
+  for(i = 0; i < _u32Number; i++)
+  {
+    orxPHYSICS_OVERLAP *pstOverlap;
+
+    /* Gets query */
+    pstOverlap = &(_astOverlapList[i]);
+
+    /* Clears its results */
+    pstOverlap->u32Count = 0;
+
+    /* Has room for results? */
+    if(pstOverlap->u32Size != 0)
+    {
+      b2Vec2  avCornerList[4];
+      b2AABB  stAABB;
+      orxU32  j;
+
+      /* Checks */
+      orxASSERT(pstOverlap->ahResultList != orxNULL);
+
+      /* Gets box corners */
+      avCornerList[0].Set(sstPhysics.fDimensionRatio * (pstOverlap->stBox.vPosition.fX - pstOverlap->stBox.vPivot.fX), sstPhysics.fDimensionRatio * (pstOverlap->stBox.vPosition.fY - pstOverlap->stBox.vPivot.fY));
+      avCornerList[1].Set(avCornerList[0].x + sstPhysics.fDimensionRatio * pstOverlap->stBox.vX.fX, avCornerList[0].y + sstPhysics.fDimensionRatio * pstOverlap->stBox.vX.fY);
+      avCornerList[2].Set(avCornerList[1].x + sstPhysics.fDimensionRatio * pstOverlap->stBox.vY.fX, avCornerList[1].y + sstPhysics.fDimensionRatio * pstOverlap->stBox.vY.fY);
+      avCornerList[3].Set(avCornerList[0].x + sstPhysics.fDimensionRatio * pstOverlap->stBox.vY.fX, avCornerList[0].y + sstPhysics.fDimensionRatio * pstOverlap->stBox.vY.fY);
+
+      /* Gets its bounding box */
+      stAABB.lowerBound = avCornerList[0];
+      stAABB.upperBound = avCornerList[0];
+      for(j = 1; j < 4; j++)
+      {
+        stAABB.lowerBound = b2Min(stAABB.lowerBound, avCornerList[j]);
+        stAABB.upperBound = b2Max(stAABB.upperBound, avCornerList[j]);
+      }
+
+      /* Degenerate box? */
+      if(orxMath_Abs(b2Cross(avCornerList[1] - avCornerList[0], avCornerList[3] - avCornerList[0])) <= b2_epsilon)
+      {
+        /* Uses its origin as a point */
+        oOverlapCallback.bPoint = true;
+        oOverlapCallback.vPoint = avCornerList[0];
+      }
+      else
+      {
+        /* Uses box as a polygon (counter-clockwise) */
+        oOverlapCallback.bPoint = false;
+        if(b2Cross(avCornerList[1] - avCornerList[0], avCornerList[3] - avCornerList[0]) > 0.0f)
+        {
+          oOverlapCallback.oShape.Set(avCornerList, 4);
+        }
+        else
+        {
+          b2Vec2 avReverseList[4];
+
+          avReverseList[0] = avCornerList[3];
+          avReverseList[1] = avCornerList[2];
+          avReverseList[2] = avCornerList[1];
+          avReverseList[3] = avCornerList[0];
+          oOverlapCallback.oShape.Set(avReverseList, 4);
+        }
+      }
+
+      /* Issues query */
+      oOverlapCallback.pstOverlap = pstOverlap;
+      sstPhysics.poWorld->QueryAABB(&oOverlapCallback, stAABB);
+
+      /* Updates result */
+      u32Result += pstOverlap->u32Count;
+    }
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return u32Result;
+}
+
 extern "C" void orxFASTCALL orxPhysics_LiquidFun_EnableSimulation(orxBOOL _bEnable)
 {
   /* Checks */
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
 
+  /* Syncs world */
+  orxPhysics_LiquidFun_Sync();
+
   /* Enabled? */
   if(_bEnable != orxFALSE)
   {
@@ -3035,6 +3690,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetGravity(const orxVECTOR
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pvGravity != orxNULL);
 
+  /* Syncs world */
+  orxPhysics_LiquidFun_Sync();
+
   /* Sets gravity vector */
   vGravity.Set(sstPhysics.fDimensionRatio * _pvGravity->fX, sstPhysics.fDimensionRatio * _pvGravity->fY);
 
@@ -3217,6 +3875,56 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_Init()
 
 #endif /* orxPHYSICS_ENABLE_DEBUG_DRAW */
 
+            /* Batched contact events? */
+            if(orxConfig_GetBool(orxPHYSICS_KZ_CONFIG_CONTACT_BATCH) != orxFALSE)
+            {
+              /* Updates status */
+              orxFLAG_SET(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_BATCH, orxPHYSICS_KU32_STATIC_FLAG_NONE);
+            }
+
+            /* Clears step thread */
+            sstPhysics.u32StepThread = orxU32_UNDEFINED;
+
+            /* Threaded? */
+            if(orxConfig_GetBool(orxPHYSICS_KZ_CONFIG_THREADED) != orxFALSE)
+            {
+              /* Creates semaphores */
+              sstPhysics.pstStepSemaphore = orxThread_CreateSemaphore(0);
+              sstPhysics.pstSyncSemaphore = orxThread_CreateSemaphore(0);
+
+              /* Success? */
+              if((sstPhysics.pstStepSemaphore != orxNULL)
+              && (sstPhysics.pstSyncSemaphore != orxNULL))
+              {
+                /* Starts step thread */
+                sstPhysics.u32StepThread = orxThread_Start(&orxPhysics_LiquidFun_Step, orxPHYSICS_KZ_THREAD_NAME, orxNULL);
+              }
+
+              /* Success? */
+              if(sstPhysics.u32StepThread != orxU32_UNDEFINED)
+              {
+                /* Updates status */
+                orxFLAG_SET(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_THREADED, orxPHYSICS_KU32_STATIC_FLAG_NONE);
+              }
+              else
+              {
+                /* Deletes semaphores */
+                if(sstPhysics.pstStepSemaphore != orxNULL)
+                {
+                  orxThread_DeleteSemaphore(sstPhysics.pstStepSemaphore);
+                  sstPhysics.pstStepSemaphore = orxNULL;
+                }
+                if(sstPhysics.pstSyncSemaphore != orxNULL)
+                {
+                  orxThread_DeleteSemaphore(sstPhysics.pstSyncSemaphore);
+                  sstPhysics.pstSyncSemaphore = orxNULL;
+                }
+
+                /* Logs message */
+                orxDEBUG_PRINT(orxDEBUG_LEVEL_PHYSICS, "Couldn't start physics step thread, simulation will run on main thread.");
+              }
+            }
+
             /* Updates status */
             sstPhysics.u32Flags |= orxPHYSICS_KU32_STATIC_FLAG_READY | orxPHYSICS_KU32_STATIC_FLAG_ENABLED;
           }
@@ -3285,6 +3993,31 @@ extern "C" void orxFASTCALL orxPhysics_LiquidFun_Exit()
   /* Was initialized? */
   if(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY)
   {
+    /* Threaded? */
+    if(orxFLAG_TEST(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_THREADED))
+    {
+      /* Waits for any ongoing step */
+      orxPhysics_LiquidFun_Sync();
+
+      /* Wakes up step thread without work so as to stop it */
+      orxMEMORY_BARRIER();
+      orxThread_SignalSemaphore(sstPhysics.pstStepSemaphore);
+
+      /* Joins it */
+      orxThread_Join(sstPhysics.u32StepThread);
+
+      /* Deletes semaphores */
+      orxThread_DeleteSemaphore(sstPhysics.pstStepSemaphore);
+      orxThread_DeleteSemaphore(sstPhysics.pstSyncSemaphore);
+    }
+
+    /* Has contact list? */
+    if(sstPhysics.astContactList != orxNULL)
+    {
+      /* Frees it */
+      orxMemory_Free(sstPhysics.astContactList);
+    }
+
     /* Deletes body bank */
     orxBank_Delete(sstPhysics.pstBodyBank);
 
@@ -3363,12 +4096,15 @@ orxPLUGIN_USER_CORE_FUNCTION_ADD(orxPhysics_LiquidFun_GetPartSelfFlags, PHYSICS,
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxPhysics_LiquidFun_GetPartCheckMask, PHYSICS, GET_PART_CHECK_MASK);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxPhysics_LiquidFun_IsPartSolid, PHYSICS, IS_PART_SOLID);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxPhysics_LiquidFun_SetPartSolid, PHYSICS, SET_PART_SOLID);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxPhysics_LiquidFun_EnablePartContactEvent, PHYSICS, ENABLE_PART_CONTACT_EVENT);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxPhysics_LiquidFun_EnableMotor, PHYSICS, ENABLE_MOTOR);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxPhysics_LiquidFun_SetJointMotorSpeed, PHYSICS, SET_JOINT_MOTOR_SPEED);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxPhysics_LiquidFun_SetJointMaxMotorTorque, PHYSICS, SET_JOINT_MAX_MOTOR_TORQUE);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxPhysics_LiquidFun_GetJointReactionForce, PHYSICS, GET_JOINT_REACTION_FORCE);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxPhysics_LiquidFun_GetJointReactionTorque, PHYSICS, GET_JOINT_REACTION_TORQUE);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxPhysics_LiquidFun_Raycast, PHYSICS, RAYCAST);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxPhysics_LiquidFun_RaycastBatch, PHYSICS, RAYCAST_BATCH);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxPhysics_LiquidFun_OverlapBatch, PHYSICS, OVERLAP_BATCH);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxPhysics_LiquidFun_EnableSimulation, PHYSICS, ENABLE_SIMULATION);
 orxPLUGIN_USER_CORE_FUNCTION_END();
 
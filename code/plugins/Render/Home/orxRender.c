@@ -55,6 +55,7 @@
 #define orxRENDER_KU32_STATIC_FLAG_PROFILER         0x00000010 /**< Profiler flag */
 #define orxRENDER_KU32_STATIC_FLAG_PROFILER_HISTORY 0x00000020 /**< Profiler history flag */
 #define orxRENDER_KU32_STATIC_FLAG_PRESENT_REQUEST  0x00000040 /**< Present request flag */
+#define orxRENDER_KU32_STATIC_FLAG_FRAME_GRAPH      0x00000080 /**< Frame graph flag */
 
 #define orxRENDER_KU32_STATIC_MASK_ALL              0xFFFFFFFF /**< All mask */
 
@@ -63,6 +64,11 @@
  */
 #define orxRENDER_KF_TICK_SIZE                      orx2F(1.0f / 10.0f)
 #define orxRENDER_KU32_ORDER_BANK_SIZE              1024
+#define orxRENDER_KU32_GRAPH_BANK_SIZE              32
+#define orxRENDER_KU32_GRAPH_TABLE_SIZE             64
+#define orxRENDER_KU32_CACHE_BANK_SIZE              16
+#define orxRENDER_KU64_CACHE_HASH_SEED              0xCBF29CE484222325ULL
+#define orxRENDER_KU64_CACHE_HASH_PRIME             0x00000100000001B3ULL
 #define orxRENDER_KST_DEFAULT_COLOR                 orx2RGBA(255, 0, 0, 255)
 #define orxRENDER_KZ_FPS_FORMAT                     "FPS: %d"
 #define orxRENDER_KF_CONSOLE_BLINK_DELAY            orx2F(0.5f)
@@ -109,6 +115,9 @@
 #define orxRENDER_KC_CONSOLE_INSERT_MARKER          '_'
 #define orxRENDER_KC_CONSOLE_OVERTYPE_MARKER        '#'
 
+#define orxRENDER_KU32_GRAPH_FLAG_NONE              0x00000000 /**< No flags */
+#define orxRENDER_KU32_GRAPH_FLAG_LIVE              0x00000001 /**< Live flag: pass needs to be rendered / texture content is consumed */
+
 
 /***************************************************************************
  * Structure declaration                                                   *
@@ -128,6 +137,70 @@ typedef struct __orxRENDER_RENDER_NODE_t
 
 } orxRENDER_NODE;
 
+/** Frame graph pass structure (one per enabled viewport)
+ */
+typedef struct __orxRENDER_GRAPH_PASS_t
+{
+  orxLINKLIST_NODE      stNode;                     /**< Linklist node : 12 */
+  const orxVIEWPORT    *pstViewport;                /**< Viewport : 16 */
+  orxU32                u32Flags;                   /**< Flags : 20 */
+
+} orxRENDER_GRAPH_PASS;
+
+/** Frame graph texture structure
+ */
+typedef struct __orxRENDER_GRAPH_TEXTURE_t
+{
+  const orxTEXTURE     *pstTexture;                 /**< Texture : 4 */
+  orxU32                u32InternalCount;           /**< Number of references held by viewports & their shaders : 8 */
+  orxU32                u32Flags;                   /**< Flags : 12 */
+
+} orxRENDER_GRAPH_TEXTURE;
+
+/** Frame graph shader structure
+ */
+typedef struct __orxRENDER_GRAPH_SHADER_t
+{
+  const orxSHADER      *pstShader;                  /**< Shader : 4 */
+  orxU32                u32UseCount;                /**< Number of viewports using it : 8 */
+
+} orxRENDER_GRAPH_SHADER;
+
+/** Viewport cache structure
+ */
+typedef struct __orxRENDER_CACHE_t
+{
+  orxU64                u64Signature;               /**< Content signature of the last render : 8 */
+  orxU64                u64ViewportGUID;            /**< Viewport GUID : 16 */
+  orxU32                u32Frame;                   /**< Last frame when used : 20 */
+
+} orxRENDER_CACHE;
+
+/** Viewport cache object state, hashed to detect content changes
+ */
+typedef struct __orxRENDER_CACHE_OBJECT_t
+{
+  orxU64                u64ObjectGUID;              /**< Object GUID : 8 */
+  orxU64                u64GraphicGUID;             /**< Graphic GUID : 16 */
+  orxU64                u64DataGUID;                /**< Graphic data GUID : 24 */
+  orxU64                u64FontGUID;                /**< Text font GUID : 32 */
+  orxSTRINGID           stStringID;                 /**< Text string ID : 40 */
+  orxVECTOR             vPosition;                  /**< World position : 52 */
+  orxVECTOR             vScale;                     /**< World scale : 64 */
+  orxVECTOR             vOrigin;                    /**< Graphic origin : 76 */
+  orxVECTOR             vSize;                      /**< Graphic size : 88 */
+  orxVECTOR             vPivot;                     /**< Graphic pivot : 100 */
+  orxCOLOR              stColor;                    /**< Color : 116 */
+  orxFLOAT              fRotation;                  /**< World rotation : 120 */
+  orxFLOAT              fRepeatX;                   /**< X repeat : 124 */
+  orxFLOAT              fRepeatY;                   /**< Y repeat : 128 */
+  orxU32                u32FrameFlags;              /**< Frame scroll / depth flags : 132 */
+  orxU32                u32FlipFlags;               /**< Object & graphic flips : 136 */
+  orxU32                u32BlendMode;               /**< Blend mode : 140 */
+  orxU32                u32Smoothing;               /**< Smoothing : 144 */
+
+} orxRENDER_CACHE_OBJECT;
+
 /** Static structure
  */
 typedef struct __orxRENDER_STATIC_t
@@ -143,6 +216,21 @@ typedef struct __orxRENDER_STATIC_t
   orxU32        u32SelectedThread;                  /**< Selected thread */
   orxU32        u32SelectedMarkerDepth;             /**< Selected marker depth */
   orxU32        u32MaxMarkerDepth;                  /**< Maximum marker depth */
+  orxBANK      *pstPassBank;                        /**< Frame graph pass bank */
+  orxBANK      *pstGraphTextureBank;                /**< Frame graph texture bank */
+  orxBANK      *pstGraphShaderBank;                 /**< Frame graph shader bank */
+  orxHASHTABLE *pstGraphTextureTable;               /**< Frame graph texture table */
+  orxHASHTABLE *pstGraphShaderTable;                /**< Frame graph shader table */
+  orxLINKLIST   stPassList;                         /**< Frame graph pass list */
+  const orxTEXTURE **apstGraphTextureBuffer;        /**< Frame graph texture buffer */
+  orxU32        u32GraphTextureBufferSize;          /**< Frame graph texture buffer size */
+  orxBANK      *pstCacheBank;                       /**< Viewport cache bank */
+  orxHASHTABLE *pstCacheTable;                      /**< Viewport cache table */
+  orxU32        u32CacheFrame;                      /**< Viewport cache frame */
+  orxBITMAP    *pstConsoleLogBitmap;                /**< Console log cache bitmap (one row per log line) */
+  orxU32       *au32ConsoleLogRowList;              /**< Console log cache rows (ID of the log line each one holds) */
+  orxU32        u32ConsoleLogRowCount;              /**< Console log cache row count */
+  const orxFONT *pstConsoleLogFont;                 /**< Console log cache font */
 
 } orxRENDER_STATIC;
 
@@ -160,6 +248,34 @@ static orxRENDER_STATIC sstRender;
  * Private functions                                                       *
  ***************************************************************************/
 
+/** Deletes console log cache
+ */
+static void orxFASTCALL orxRender_Home_DeleteConsoleLog()
+{
+  /* Has bitmap? */
+  if(sstRender.pstConsoleLogBitmap != orxNULL)
+  {
+    /* Deletes it */
+    orxDisplay_DeleteBitmap(sstRender.pstConsoleLogBitmap);
+    sstRender.pstConsoleLogBitmap = orxNULL;
+  }
+
+  /* Has row list? */
+  if(sstRender.au32ConsoleLogRowList != orxNULL)
+  {
+    /* Frees it */
+    orxMemory_Free(sstRender.au32ConsoleLogRowList);
+    sstRender.au32ConsoleLogRowList = orxNULL;
+  }
+
+  /* Clears its info */
+  sstRender.u32ConsoleLogRowCount = 0;
+  sstRender.pstConsoleLogFont     = orxNULL;
+
+  /* Done! */
+  return;
+}
+
 /** Inits console
  */
 static orxINLINE void orxRender_Home_InitConsole(orxFLOAT _fScreenWidth, orxFLOAT _fScreenHeight)
@@ -179,6 +295,9 @@ static orxINLINE void orxRender_Home_InitConsole(orxFLOAT _fScreenWidth, orxFLOA
   /* Sets default console offset */
   sstRender.fDefaultConsoleOffset = sstRender.fConsoleOffset = -_fScreenHeight;
 
+  /* Deletes log cache, it'll get recreated for the new size */
+  orxRender_Home_DeleteConsoleLog();
+
   /* Done! */
   return;
 }
@@ -1169,6 +1288,159 @@ static orxINLINE void orxRender_Home_RenderProfiler()
   return;
 }
 
+/** Renders console log, upward from the given position: each line is laid out once in a row of the log cache bitmap and only lines that weren't already cached (new or scrolled into view) get rendered again
+ * @param[in]   _pstFont          Console font
+ * @param[in]   _pstFontBitmap    Console font bitmap, with log color
+ * @param[in]   _fX               X position of the log
+ * @param[in]   _fY               Y position of the most recent visible line
+ * @param[in]   _fWidth           Width of the log
+ * @param[in]   _fScreenWidth     Screen width
+ * @param[in]   _fScreenHeight    Screen height
+ */
+static void orxFASTCALL orxRender_Home_RenderConsoleLog(const orxFONT *_pstFont, orxBITMAP *_pstFontBitmap, orxFLOAT _fX, orxFLOAT _fY, orxFLOAT _fWidth, orxFLOAT _fScreenWidth, orxFLOAT _fScreenHeight)
+{
+  orxDISPLAY_TRANSFORM    stTransform;
+  const orxCHARACTER_MAP *pstMap;
+  orxFLOAT                fCharacterHeight;
+  orxU32                  u32LineCount, u32RowCount, i;
+
+  /* Gets font's map & character height */
+  pstMap            = orxFont_GetMap(_pstFont);
+  fCharacterHeight  = orxFont_GetCharacterHeight(_pstFont);
+
+  /* Gets visible line count */
+  for(u32LineCount = 0;
+      (_fY - (orxU2F(u32LineCount) * fCharacterHeight) >= sstRender.fConsoleOffset - fCharacterHeight) && (orxConsole_GetTrailLogLineID(u32LineCount) != orxU32_UNDEFINED);
+      u32LineCount++)
+    ;
+
+  /* Gets needed row count (more than visible lines, so that a scrolled window never overlaps itself) */
+  u32RowCount = orxF2U(orxMath_Ceil(_fScreenHeight / fCharacterHeight)) + 2;
+
+  /* Obsolete cache? */
+  if((sstRender.pstConsoleLogBitmap != orxNULL)
+  && ((sstRender.pstConsoleLogFont != _pstFont) || (sstRender.u32ConsoleLogRowCount != u32RowCount)))
+  {
+    /* Deletes it */
+    orxRender_Home_DeleteConsoleLog();
+  }
+
+  /* No cache? */
+  if(sstRender.pstConsoleLogBitmap == orxNULL)
+  {
+    /* Creates bitmap & row list */
+    sstRender.pstConsoleLogBitmap   = orxDisplay_CreateBitmap(orxF2U(_fWidth), orxF2U(orxMath_Ceil(orxU2F(u32RowCount) * fCharacterHeight)));
+    sstRender.au32ConsoleLogRowList = (orxU32 *)orxMemory_Allocate(u32RowCount * sizeof(orxU32), orxMEMORY_TYPE_MAIN);
+
+    /* Success? */
+    if((sstRender.pstConsoleLogBitmap != orxNULL) && (sstRender.au32ConsoleLogRowList != orxNULL))
+    {
+      /* Stores its info */
+      sstRender.u32ConsoleLogRowCount = u32RowCount;
+      sstRender.pstConsoleLogFont     = _pstFont;
+
+      /* Marks all rows as empty */
+      orxMemory_Set(sstRender.au32ConsoleLogRowList, 0xFF, u32RowCount * sizeof(orxU32));
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_RENDER, "Couldn't create console log cache, rendering log lines directly.");
+
+      /* Cleans partial cache */
+      orxRender_Home_DeleteConsoleLog();
+    }
+  }
+
+  /* Inits transform */
+  stTransform.fSrcX     = stTransform.fSrcY     = orxFLOAT_0;
+  stTransform.fRepeatX  = stTransform.fRepeatY  = orxFLOAT_1;
+  stTransform.fScaleX   = stTransform.fScaleY   = orxFLOAT_1;
+  stTransform.fRotation = orxFLOAT_0;
+
+  /* Has cache? */
+  if(sstRender.pstConsoleLogBitmap != orxNULL)
+  {
+    orxBOOL bDestination = orxFALSE;
+
+    /* For all visible lines */
+    for(i = 0; i < u32LineCount; i++)
+    {
+      orxU32 u32ID, u32Row;
+
+      /* Gets its ID & row */
+      u32ID   = orxConsole_GetTrailLogLineID(i);
+      u32Row  = u32ID % u32RowCount;
+
+      /* Not cached? */
+      if(sstRender.au32ConsoleLogRowList[u32Row] != u32ID)
+      {
+        /* Cache isn't destination yet? */
+        if(bDestination == orxFALSE)
+        {
+          /* Sets it as destination */
+          orxDisplay_SetDestinationBitmaps(&(sstRender.pstConsoleLogBitmap), 1);
+          bDestination = orxTRUE;
+        }
+
+        /* Clears its row */
+        orxDisplay_SetBitmapClipping(sstRender.pstConsoleLogBitmap, 0, orxF2U(orxU2F(u32Row) * fCharacterHeight), orxF2U(_fWidth), orxF2U(orxU2F(u32Row + 1) * fCharacterHeight));
+        orxDisplay_ClearBitmap(orxNULL, orx2RGBA(0x00, 0x00, 0x00, 0x00));
+
+        /* Renders line in it (no blending: the row then holds the exact glyph texels, blended when the cache gets displayed) */
+        stTransform.fDstX = orxFLOAT_0;
+        stTransform.fDstY = orxU2F(u32Row) * fCharacterHeight;
+        orxDisplay_TransformText(orxConsole_GetTrailLogLine(i), _pstFontBitmap, pstMap, &stTransform, orxDISPLAY_SMOOTHING_NONE, orxDISPLAY_BLEND_MODE_NONE);
+
+        /* Stores its ID */
+        sstRender.au32ConsoleLogRowList[u32Row] = u32ID;
+      }
+    }
+
+    /* Has rendered lines? */
+    if(bDestination != orxFALSE)
+    {
+      orxBITMAP *pstScreen;
+
+      /* Restores screen as destination bitmap */
+      pstScreen = orxDisplay_GetScreenBitmap();
+      orxDisplay_SetDestinationBitmaps(&pstScreen, 1);
+      orxDisplay_SetBitmapClipping(pstScreen, 0, 0, orxF2U(_fScreenWidth), orxF2U(_fScreenHeight));
+    }
+
+    /* For all visible lines */
+    for(i = 0; i < u32LineCount;)
+    {
+      orxU32 u32FirstRow, u32Row;
+
+      /* Gets first row of the segment (bottom) */
+      u32FirstRow = u32Row = orxConsole_GetTrailLogLineID(i) % u32RowCount;
+
+      /* Extends segment upward while rows are contiguous in the cache */
+      for(i++; (i < u32LineCount) && (u32Row > 0) && (orxConsole_GetTrailLogLineID(i) % u32RowCount == u32Row - 1); i++, u32Row--)
+        ;
+
+      /* Displays segment */
+      orxDisplay_SetBitmapClipping(sstRender.pstConsoleLogBitmap, 0, orxF2U(orxU2F(u32Row) * fCharacterHeight), orxF2U(_fWidth), orxF2U(orxU2F(u32FirstRow + 1) * fCharacterHeight));
+      stTransform.fDstX = _fX;
+      stTransform.fDstY = _fY - (orxU2F(i - 1) * fCharacterHeight);
+      orxDisplay_TransformBitmap(sstRender.pstConsoleLogBitmap, &stTransform, orxDISPLAY_SMOOTHING_NONE, orxDISPLAY_BLEND_MODE_ALPHA);
+    }
+  }
+  else
+  {
+    /* For all visible lines */
+    for(i = 0, stTransform.fDstX = _fX, stTransform.fDstY = _fY; i < u32LineCount; i++, stTransform.fDstY -= fCharacterHeight)
+    {
+      /* Displays it */
+      orxDisplay_TransformText(orxConsole_GetTrailLogLine(i), _pstFontBitmap, pstMap, &stTransform, orxDISPLAY_SMOOTHING_NONE, orxDISPLAY_BLEND_MODE_ALPHA);
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
 /** Renders console
  */
 static orxINLINE void orxRender_Home_RenderConsole()
@@ -1322,15 +1594,10 @@ static orxINLINE void orxRender_Home_RenderConsole()
     ((orxCHAR*)zText)[u32CursorIndex + 1] = acBackup[1];
   }
 
-  /* While there are log lines to display */
+  /* Displays log lines */
   orxDisplay_SetBitmapColor(pstFontBitmap, orxRENDER_KST_CONSOLE_LOG_COLOR);
-  for(i = 0, stTransform.fDstY -= orx2F(2.0f) * fCharacterHeight, fBackupY = stTransform.fDstY;
-      (stTransform.fDstY >= sstRender.fConsoleOffset - fCharacterHeight) && ((zText = orxConsole_GetTrailLogLine(i)) != orxSTRING_EMPTY);
-      i++, stTransform.fDstY -= fCharacterHeight)
-  {
-    /* Displays it */
-    orxDisplay_TransformText(zText, pstFontBitmap, pstMap, &stTransform, orxDISPLAY_SMOOTHING_NONE, orxDISPLAY_BLEND_MODE_ALPHA);
-  }
+  fBackupY = stTransform.fDstY - orx2F(2.0f) * fCharacterHeight;
+  orxRender_Home_RenderConsoleLog(pstFont, pstFontBitmap, stTransform.fDstX, fBackupY, orxMath_Floor(fScreenWidth * (orxFLOAT_1 - orx2F(2.0f) * orxRENDER_KF_CONSOLE_MARGIN_WIDTH)), fScreenWidth, fScreenHeight);
 
   /* Gets log offset */
   u32Offset = orxConsole_GetTrailLogLineOffset();
@@ -1586,6 +1853,332 @@ static orxSTATUS orxFASTCALL orxRender_Home_RenderObject(const orxRENDER_NODE *_
   return eResult;
 }
 
+/** Is object part of one of the camera groups that precede the given one? Used to gather objects only once.
+ */
+static orxINLINE orxBOOL orxRender_Home_IsInPreviousGroup(const orxCAMERA *_pstCamera, const orxOBJECT *_pstObject, orxU32 _u32GroupIndex)
+{
+  orxU32  i;
+  orxBOOL bResult = orxFALSE;
+
+  /* For all previous groups */
+  for(i = 0; i < _u32GroupIndex; i++)
+  {
+    /* Is part of it? */
+    if(orxObject_IsInGroup(_pstObject, orxCamera_GetGroupID(_pstCamera, i)) != orxFALSE)
+    {
+      /* Updates result */
+      bResult = orxTRUE;
+      break;
+    }
+  }
+
+  /* Done! */
+  return bResult;
+}
+
+/** Continues a viewport cache signature
+ */
+static orxINLINE orxU64 orxRender_Home_ContinueSignature(orxU64 _u64Signature, const void *_pData, orxU32 _u32Size)
+{
+  const orxU8  *pu8;
+  orxU32        i;
+
+  /* For all bytes */
+  for(i = 0, pu8 = (const orxU8 *)_pData; i < _u32Size; i++)
+  {
+    /* Updates signature (FNV-1a) */
+    _u64Signature = (_u64Signature ^ (orxU64)pu8[i]) * orxRENDER_KU64_CACHE_HASH_PRIME;
+  }
+
+  /* Done! */
+  return _u64Signature;
+}
+
+/** Gets a viewport content signature, covering everything that affects what gets rendered in its textures
+ * @param[in]   _pstViewport      Concerned viewport
+ * @param[in]   _apstTextureList  Viewport's textures
+ * @param[in]   _u32TextureCount  Viewport's texture count
+ * @return      Signature / 0 if the viewport can't be cached this frame (screen rendering or active shaders)
+ */
+static orxU64 orxFASTCALL orxRender_Home_GetViewportSignature(const orxVIEWPORT *_pstViewport, orxTEXTURE **_apstTextureList, orxU32 _u32TextureCount)
+{
+  const orxSHADERPOINTER *pstShaderPointer;
+  const orxTEXTURE       *pstScreenTexture;
+  orxBOOL                 bCacheable;
+  orxU32                  i;
+  orxU64                  u64Result = orxRENDER_KU64_CACHE_HASH_SEED;
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxRender_GetViewportSignature");
+
+  /* Is cacheable if it doesn't have active shaders (their parameters can change at any time) */
+  bCacheable = (((pstShaderPointer = orxViewport_GetShaderPointer(_pstViewport)) == orxNULL) || (orxShaderPointer_IsEnabled(pstShaderPointer) == orxFALSE)) ? orxTRUE : orxFALSE;
+
+  /* Gets screen texture */
+  pstScreenTexture = orxTexture_GetScreenTexture();
+
+  /* For all textures */
+  for(i = 0; (i < _u32TextureCount) && (bCacheable != orxFALSE); i++)
+  {
+    /* Screen? */
+    if(_apstTextureList[i] == pstScreenTexture)
+    {
+      /* Can't be cached as the screen is cleared every frame */
+      bCacheable = orxFALSE;
+    }
+    else
+    {
+      orxU64  u64GUID;
+      orxFLOAT afSize[2];
+
+      /* Updates signature */
+      u64GUID = orxStructure_GetGUID(_apstTextureList[i]);
+      orxTexture_GetSize(_apstTextureList[i], &afSize[0], &afSize[1]);
+      u64Result = orxRender_Home_ContinueSignature(u64Result, &u64GUID, sizeof(orxU64));
+      u64Result = orxRender_Home_ContinueSignature(u64Result, afSize, sizeof(afSize));
+    }
+  }
+
+  /* Cacheable? */
+  if(bCacheable != orxFALSE)
+  {
+    orxAABOX    stBox;
+    orxCOLOR    stColor;
+    orxFLOAT    fCorrectionRatio;
+    orxCAMERA  *pstCamera;
+
+    /* Updates signature with viewport's box, correction ratio & background color */
+    orxViewport_GetBox(_pstViewport, &stBox);
+    fCorrectionRatio = orxViewport_GetCorrectionRatio(_pstViewport);
+    if(orxViewport_HasBackgroundColor(_pstViewport) != orxFALSE)
+    {
+      orxViewport_GetBackgroundColor(_pstViewport, &stColor);
+    }
+    else
+    {
+      orxMemory_Zero(&stColor, sizeof(orxCOLOR));
+    }
+    u64Result = orxRender_Home_ContinueSignature(u64Result, &stBox, sizeof(orxAABOX));
+    u64Result = orxRender_Home_ContinueSignature(u64Result, &fCorrectionRatio, sizeof(orxFLOAT));
+    u64Result = orxRender_Home_ContinueSignature(u64Result, &stColor, sizeof(orxCOLOR));
+
+    /* Gets camera */
+    pstCamera = orxViewport_GetCamera(_pstViewport);
+
+    /* Valid? */
+    if(pstCamera != orxNULL)
+    {
+      orxFRAME   *pstCameraFrame;
+      orxAABOX    stFrustum;
+      orxVECTOR   vPosition, vScale;
+      orxFLOAT    fRotation;
+      orxU64      u64GUID;
+      orxU32      u32Number;
+
+      /* Updates signature with camera's frustum & transform */
+      pstCameraFrame = orxCamera_GetFrame(pstCamera);
+      u64GUID = orxStructure_GetGUID(pstCamera);
+      orxCamera_GetFrustum(pstCamera, &stFrustum);
+      orxFrame_GetPosition(pstCameraFrame, orxFRAME_SPACE_GLOBAL, &vPosition);
+      orxFrame_GetScale(pstCameraFrame, orxFRAME_SPACE_GLOBAL, &vScale);
+      fRotation = orxFrame_GetRotation(pstCameraFrame, orxFRAME_SPACE_GLOBAL);
+      u64Result = orxRender_Home_ContinueSignature(u64Result, &u64GUID, sizeof(orxU64));
+      u64Result = orxRender_Home_ContinueSignature(u64Result, &stFrustum, sizeof(orxAABOX));
+      u64Result = orxRender_Home_ContinueSignature(u64Result, &vPosition, sizeof(orxVECTOR));
+      u64Result = orxRender_Home_ContinueSignature(u64Result, &vScale, sizeof(orxVECTOR));
+      u64Result = orxRender_Home_ContinueSignature(u64Result, &fRotation, sizeof(orxFLOAT));
+
+      /* For all camera group IDs */
+      for(i = 0, u32Number = orxCamera_GetGroupIDCount(pstCamera); (i < u32Number) && (bCacheable != orxFALSE); i++)
+      {
+        orxOBJECT  *pstObject;
+        orxSTRINGID stGroupID;
+
+        /* Gets it */
+        stGroupID = orxCamera_GetGroupID(pstCamera, i);
+
+        /* Updates signature */
+        u64Result = orxRender_Home_ContinueSignature(u64Result, &stGroupID, sizeof(orxSTRINGID));
+
+        /* For all objects in this group */
+        for(pstObject = orxObject_GetNext(orxNULL, stGroupID);
+            (pstObject != orxNULL) && (bCacheable != orxFALSE);
+            pstObject = orxObject_GetNext(pstObject, stGroupID))
+        {
+          orxGRAPHIC *pstGraphic;
+          orxFRAME   *pstFrame;
+
+          /* Not already gathered, enabled with a graphic and a frame? */
+          if((orxRender_Home_IsInPreviousGroup(pstCamera, pstObject, i) == orxFALSE)
+          && (orxObject_IsEnabled(pstObject) != orxFALSE)
+          && ((pstGraphic = orxObject_GetWorkingGraphic(pstObject)) != orxNULL)
+          && ((pstFrame = orxOBJECT_GET_STRUCTURE(pstObject, FRAME)) != orxNULL))
+          {
+            /* Has active shaders? */
+            if(((pstShaderPointer = orxOBJECT_GET_STRUCTURE(pstObject, SHADERPOINTER)) != orxNULL)
+            && (orxShaderPointer_IsEnabled(pstShaderPointer) != orxFALSE))
+            {
+              /* Can't be cached */
+              bCacheable = orxFALSE;
+            }
+            else
+            {
+              orxRENDER_CACHE_OBJECT  stObject;
+              orxSTRUCTURE           *pstData;
+              orxTEXT                *pstText;
+              orxBOOL                 bFlipX, bFlipY, bGraphicFlipX, bGraphicFlipY;
+              orxDISPLAY_SMOOTHING    eSmoothing;
+
+              /* Cleans it (padding included) */
+              orxMemory_Zero(&stObject, sizeof(orxRENDER_CACHE_OBJECT));
+
+              /* Stores its state */
+              stObject.u64ObjectGUID  = orxStructure_GetGUID(pstObject);
+              stObject.u64GraphicGUID = orxStructure_GetGUID(pstGraphic);
+              if((pstData = orxGraphic_GetData(pstGraphic)) != orxNULL)
+              {
+                stObject.u64DataGUID  = orxStructure_GetGUID(pstData);
+
+                /* Text? */
+                if((pstText = orxTEXT(pstData)) != orxNULL)
+                {
+                  const orxFONT *pstFont;
+
+                  /* Stores its string & font */
+                  stObject.stStringID = orxString_ToCRC(orxText_GetString(pstText));
+                  if((pstFont = orxText_GetFont(pstText)) != orxNULL)
+                  {
+                    stObject.u64FontGUID = orxStructure_GetGUID(pstFont);
+                  }
+                }
+              }
+              orxFrame_GetPosition(pstFrame, orxFRAME_SPACE_GLOBAL, &(stObject.vPosition));
+              orxFrame_GetScale(pstFrame, orxFRAME_SPACE_GLOBAL, &(stObject.vScale));
+              stObject.fRotation      = orxFrame_GetRotation(pstFrame, orxFRAME_SPACE_GLOBAL);
+              stObject.u32FrameFlags  = orxStructure_GetFlags(pstFrame, orxFRAME_KU32_MASK_SCROLL_BOTH | orxFRAME_KU32_FLAG_DEPTH_SCALE);
+              orxGraphic_GetOrigin(pstGraphic, &(stObject.vOrigin));
+              orxGraphic_GetSize(pstGraphic, &(stObject.vSize));
+              orxGraphic_GetPivot(pstGraphic, &(stObject.vPivot));
+              orxObject_GetRepeat(pstObject, &(stObject.fRepeatX), &(stObject.fRepeatY));
+              orxObject_GetFlip(pstObject, &bFlipX, &bFlipY);
+              orxGraphic_GetFlip(pstGraphic, &bGraphicFlipX, &bGraphicFlipY);
+              stObject.u32FlipFlags   = ((bFlipX != orxFALSE) ? 0x1 : 0) | ((bFlipY != orxFALSE) ? 0x2 : 0) | ((bGraphicFlipX != orxFALSE) ? 0x4 : 0) | ((bGraphicFlipY != orxFALSE) ? 0x8 : 0);
+              if(orxGraphic_HasColor(pstGraphic) != orxFALSE)
+              {
+                orxGraphic_GetColor(pstGraphic, &(stObject.stColor));
+              }
+              else if(orxObject_HasColor(pstObject) != orxFALSE)
+              {
+                orxObject_GetColor(pstObject, &(stObject.stColor));
+              }
+              else
+              {
+                orxVector_SetAll(&(stObject.stColor.vRGB), orxFLOAT_1);
+                stObject.stColor.fAlpha = orxFLOAT_1;
+              }
+              eSmoothing = orxGraphic_GetSmoothing(pstGraphic);
+              stObject.u32Smoothing   = (orxU32)((eSmoothing == orxDISPLAY_SMOOTHING_DEFAULT) ? orxObject_GetSmoothing(pstObject) : eSmoothing);
+              stObject.u32BlendMode   = (orxU32)((orxGraphic_HasBlendMode(pstGraphic) != orxFALSE) ? orxGraphic_GetBlendMode(pstGraphic) : (orxObject_HasBlendMode(pstObject) != orxFALSE) ? orxObject_GetBlendMode(pstObject) : orxDISPLAY_BLEND_MODE_ALPHA);
+
+              /* Updates signature */
+              u64Result = orxRender_Home_ContinueSignature(u64Result, &stObject, sizeof(orxRENDER_CACHE_OBJECT));
+            }
+          }
+        }
+      }
+    }
+  }
+
+  /* Updates result */
+  u64Result = (bCacheable != orxFALSE) ? ((u64Result != 0) ? u64Result : 1) : 0;
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return u64Result;
+}
+
+/** Updates a viewport's cache
+ * @param[in]   _pstViewport      Concerned viewport
+ * @param[in]   _apstTextureList  Viewport's textures
+ * @param[in]   _u32TextureCount  Viewport's texture count
+ * @return      orxTRUE if the viewport's textures already hold its current content, orxFALSE otherwise
+ */
+static orxBOOL orxFASTCALL orxRender_Home_UpdateViewportCache(const orxVIEWPORT *_pstViewport, orxTEXTURE **_apstTextureList, orxU32 _u32TextureCount)
+{
+  orxU64  u64Signature;
+  orxBOOL bResult = orxFALSE;
+
+  /* Gets viewport signature */
+  u64Signature = orxRender_Home_GetViewportSignature(_pstViewport, _apstTextureList, _u32TextureCount);
+
+  /* Cacheable? */
+  if(u64Signature != 0)
+  {
+    /* First use? */
+    if(sstRender.pstCacheBank == orxNULL)
+    {
+      /* Creates bank & table */
+      sstRender.pstCacheBank  = orxBank_Create(orxRENDER_KU32_CACHE_BANK_SIZE, sizeof(orxRENDER_CACHE), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+      sstRender.pstCacheTable = orxHashTable_Create(orxRENDER_KU32_CACHE_BANK_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+    }
+
+    /* Valid? */
+    if((sstRender.pstCacheBank != orxNULL)
+    && (sstRender.pstCacheTable != orxNULL))
+    {
+      orxRENDER_CACHE **ppstCache;
+      orxU64            u64GUID;
+
+      /* Gets viewport's bucket */
+      u64GUID   = orxStructure_GetGUID(_pstViewport);
+      ppstCache = (orxRENDER_CACHE **)orxHashTable_Retrieve(sstRender.pstCacheTable, u64GUID);
+
+      /* Valid? */
+      if(ppstCache != orxNULL)
+      {
+        /* New? */
+        if(*ppstCache == orxNULL)
+        {
+          /* Allocates it */
+          *ppstCache = (orxRENDER_CACHE *)orxBank_Allocate(sstRender.pstCacheBank);
+
+          /* Valid? */
+          if(*ppstCache != orxNULL)
+          {
+            /* Inits it */
+            (*ppstCache)->u64Signature    = 0;
+            (*ppstCache)->u64ViewportGUID = u64GUID;
+          }
+        }
+
+        /* Valid? */
+        if(*ppstCache != orxNULL)
+        {
+          /* Updates its frame */
+          (*ppstCache)->u32Frame = sstRender.u32CacheFrame;
+
+          /* Unchanged? */
+          if((*ppstCache)->u64Signature == u64Signature)
+          {
+            /* Updates result */
+            bResult = orxTRUE;
+          }
+          else
+          {
+            /* Stores new signature */
+            (*ppstCache)->u64Signature = u64Signature;
+          }
+        }
+      }
+    }
+  }
+
+  /* Done! */
+  return bResult;
+}
+
 /** Renders a viewport
  * @param[in]   _pstViewport    Viewport to render
  */
@@ -1604,7 +2197,7 @@ static orxINLINE void orxRender_Home_RenderViewport(const orxVIEWPORT *_pstViewp
     orxU32      u32TextureCount, i;
     orxTEXTURE *apstTextureList[orxVIEWPORT_KU32_MAX_TEXTURE_NUMBER];
     orxBITMAP  *apstBitmapList[orxVIEWPORT_KU32_MAX_TEXTURE_NUMBER];
-    orxBOOL     bSuccess = orxTRUE;
+    orxBOOL     bSuccess = orxTRUE, bUpToDate = orxFALSE;
 
     /* Gets viewport's texture count */
     u32TextureCount = orxViewport_GetTextureCount(_pstViewport);
@@ -1631,8 +2224,17 @@ static orxINLINE void orxRender_Home_RenderViewport(const orxVIEWPORT *_pstViewp
       }
     }
 
-    /* Valid? */
-    if(bSuccess != orxFALSE)
+    /* Valid and cached? */
+    if((bSuccess != orxFALSE)
+    && (orxViewport_IsCacheEnabled(_pstViewport) != orxFALSE))
+    {
+      /* Updates its cache */
+      bUpToDate = orxRender_Home_UpdateViewportCache(_pstViewport, apstTextureList, u32TextureCount);
+    }
+
+    /* Valid and needs to be rendered? */
+    if((bSuccess != orxFALSE)
+    && (bUpToDate == orxFALSE))
     {
       orxEVENT stEvent;
 
@@ -1797,8 +2399,9 @@ static orxINLINE void orxRender_Home_RenderViewport(const orxVIEWPORT *_pstViewp
                     pstObject != orxNULL;
                     pstObject = orxObject_GetNext(pstObject, stGroupID))
                 {
-                  /* Is object enabled? */
-                  if(orxObject_IsEnabled(pstObject) != orxFALSE)
+                  /* Is object enabled and not already gathered? */
+                  if((orxObject_IsEnabled(pstObject) != orxFALSE)
+                  && (orxRender_Home_IsInPreviousGroup(pstCamera, pstObject, i) == orxFALSE))
                   {
                     orxGRAPHIC *pstGraphic;
 
@@ -1842,91 +2445,114 @@ static orxINLINE void orxRender_Home_RenderViewport(const orxVIEWPORT *_pstViewp
                           orxFLOAT  fObjectBoundingRadius, fSqrDist, fDepthCoef, fObjectRotation;
                           orxVECTOR vSize, vOffset, vObjectScale, vDist;
 
-                          /* Gets its size */
-                          orxGraphic_GetSize(pstGraphic, &vSize);
-
-                          /* Gets object's scale & rotation */
-                          orxFrame_GetScale(pstFrame, orxFRAME_SPACE_GLOBAL, &vObjectScale);
-                          fObjectRotation = orxFrame_GetRotation(pstFrame, orxFRAME_SPACE_GLOBAL);
+                          /* Uses object's own graphic without differential scrolling nor depth scaling? */
+                          if((pstGraphic == orxOBJECT_GET_STRUCTURE(pstObject, GRAPHIC))
+                          && (orxStructure_TestFlags(pstFrame, orxFRAME_KU32_MASK_SCROLL_BOTH | orxFRAME_KU32_FLAG_DEPTH_SCALE) == orxFALSE))
+                          {
+                            orxOBOX stObjectBox;
 
-                          /* Updates its size with object scale */
-                          vSize.fX  *= vObjectScale.fX;
-                          vSize.fY  *= vObjectScale.fY;
+                            /* Gets its bounding box (cached by the object as long as it doesn't change) */
+                            orxObject_GetBoundingBox(pstObject, &stObjectBox);
 
-                          /* Gets offset based on pivot */
-                          orxGraphic_GetPivot(pstGraphic, &vOffset);
-                          vOffset.fX = orx2F(0.5f) * vSize.fX - vObjectScale.fX * vOffset.fX;
-                          vOffset.fY = orx2F(0.5f) * vSize.fY - vObjectScale.fY * vOffset.fY;
-                          orxVector_2DRotate(&vOffset, &vOffset, fObjectRotation);
+                            /* Gets 2D distance vector from its center */
+                            orxOBox_GetCenter(&stObjectBox, &vDist);
+                            orxVector_Sub(&vDist, &vDist, &vCameraCenter);
+                            vDist.fZ = orxFLOAT_0;
 
-                          /* Gets real 2D distance vector */
-                          orxVector_Sub(&vDist, &vObjectPos, &vCameraCenter);
-                          vDist.fZ = orxFLOAT_0;
+                            /* Gets object bounding radius (box axes are orthogonal) */
+                            fObjectBoundingRadius = orx2F(0.5f) * orxMath_Sqrt(orxVector_GetSquareSize(&(stObjectBox.vX)) + orxVector_GetSquareSize(&(stObjectBox.vY)));
 
-                          /* Uses differential scrolling or depth scaling? */
-                          if((orxStructure_TestFlags(pstFrame, orxFRAME_KU32_MASK_SCROLL_BOTH) != orxFALSE)
-                          || (orxStructure_TestFlags(pstFrame, orxFRAME_KU32_FLAG_DEPTH_SCALE) != orxFALSE))
+                            /* Clears depth coef */
+                            fDepthCoef = orxFLOAT_1;
+                          }
+                          else
                           {
-                            orxFLOAT fObjectRelativeDepth;
+                            /* Gets its size */
+                            orxGraphic_GetSize(pstGraphic, &vSize);
+
+                            /* Gets object's scale & rotation */
+                            orxFrame_GetScale(pstFrame, orxFRAME_SPACE_GLOBAL, &vObjectScale);
+                            fObjectRotation = orxFrame_GetRotation(pstFrame, orxFRAME_SPACE_GLOBAL);
+
+                            /* Updates its size with object scale */
+                            vSize.fX  *= vObjectScale.fX;
+                            vSize.fY  *= vObjectScale.fY;
+
+                            /* Gets offset based on pivot */
+                            orxGraphic_GetPivot(pstGraphic, &vOffset);
+                            vOffset.fX = orx2F(0.5f) * vSize.fX - vObjectScale.fX * vOffset.fX;
+                            vOffset.fY = orx2F(0.5f) * vSize.fY - vObjectScale.fY * vOffset.fY;
+                            orxVector_2DRotate(&vOffset, &vOffset, fObjectRotation);
+
+                            /* Gets real 2D distance vector */
+                            orxVector_Sub(&vDist, &vObjectPos, &vCameraCenter);
+                            vDist.fZ = orxFLOAT_0;
+
+                            /* Uses differential scrolling or depth scaling? */
+                            if((orxStructure_TestFlags(pstFrame, orxFRAME_KU32_MASK_SCROLL_BOTH) != orxFALSE)
+                            || (orxStructure_TestFlags(pstFrame, orxFRAME_KU32_FLAG_DEPTH_SCALE) != orxFALSE))
+                            {
+                              orxFLOAT fObjectRelativeDepth;
 
-                            /* Gets objects relative depth */
-                            fObjectRelativeDepth = vObjectPos.fZ - vCameraPosition.fZ;
+                              /* Gets objects relative depth */
+                              fObjectRelativeDepth = vObjectPos.fZ - vCameraPosition.fZ;
 
-                            /* On near plane? */
-                            if(fObjectRelativeDepth == orxFLOAT_0)
-                            {
-                              /* Prints error message */
-                              orxDEBUG_PRINT(orxDEBUG_LEVEL_RENDER, "[%s] is using AutoScroll/DepthScale and is on [%s]'s near plane: undefined results.", orxObject_GetName(pstObject), orxCamera_GetName(pstCamera));
-                            }
+                              /* On near plane? */
+                              if(fObjectRelativeDepth == orxFLOAT_0)
+                              {
+                                /* Prints error message */
+                                orxDEBUG_PRINT(orxDEBUG_LEVEL_RENDER, "[%s] is using AutoScroll/DepthScale and is on [%s]'s near plane: undefined results.", orxObject_GetName(pstObject), orxCamera_GetName(pstCamera));
+                              }
 
-                            /* Near space? */
-                            if(fObjectRelativeDepth < (orx2F(0.5f) * fCameraDepth))
-                            {
-                              /* Gets depth scale coef */
-                              fDepthCoef = (orx2F(0.5f) * fCameraDepth) / (fObjectRelativeDepth + orxMATH_KF_TINY_EPSILON);
-                            }
-                            /* Far space */
-                            else
-                            {
-                              /* Gets depth scale coef */
-                              fDepthCoef = (fCameraDepth - fObjectRelativeDepth) / (orx2F(0.5f) * fCameraDepth);
-                            }
+                              /* Near space? */
+                              if(fObjectRelativeDepth < (orx2F(0.5f) * fCameraDepth))
+                              {
+                                /* Gets depth scale coef */
+                                fDepthCoef = (orx2F(0.5f) * fCameraDepth) / (fObjectRelativeDepth + orxMATH_KF_TINY_EPSILON);
+                              }
+                              /* Far space */
+                              else
+                              {
+                                /* Gets depth scale coef */
+                                fDepthCoef = (fCameraDepth - fObjectRelativeDepth) / (orx2F(0.5f) * fCameraDepth);
+                              }
 
-                            /* X-axis scroll? */
-                            if(orxStructure_TestFlags(pstFrame, orxFRAME_KU32_FLAG_SCROLL_X) != orxFALSE)
-                            {
-                              /* Updates base distance vector */
-                              vDist.fX *= fDepthCoef;
-                            }
+                              /* X-axis scroll? */
+                              if(orxStructure_TestFlags(pstFrame, orxFRAME_KU32_FLAG_SCROLL_X) != orxFALSE)
+                              {
+                                /* Updates base distance vector */
+                                vDist.fX *= fDepthCoef;
+                              }
 
-                            /* Y-axis scroll? */
-                            if(orxStructure_TestFlags(pstFrame, orxFRAME_KU32_FLAG_SCROLL_Y) != orxFALSE)
-                            {
-                              /* Updates base distance vector */
-                              vDist.fY *= fDepthCoef;
-                            }
+                              /* Y-axis scroll? */
+                              if(orxStructure_TestFlags(pstFrame, orxFRAME_KU32_FLAG_SCROLL_Y) != orxFALSE)
+                              {
+                                /* Updates base distance vector */
+                                vDist.fY *= fDepthCoef;
+                              }
 
-                            /* Depth scale? */
-                            if(orxStructure_TestFlags(pstFrame, orxFRAME_KU32_FLAG_DEPTH_SCALE) != orxFALSE)
+                              /* Depth scale? */
+                              if(orxStructure_TestFlags(pstFrame, orxFRAME_KU32_FLAG_DEPTH_SCALE) != orxFALSE)
+                              {
+                                /* Updates size & offset */
+                                vSize.fX *= fDepthCoef;
+                                vSize.fY *= fDepthCoef;
+                                vOffset.fX *= fDepthCoef;
+                                vOffset.fY *= fDepthCoef;
+                              }
+                            }
+                            else
                             {
-                              /* Updates size & offset */
-                              vSize.fX *= fDepthCoef;
-                              vSize.fY *= fDepthCoef;
-                              vOffset.fX *= fDepthCoef;
-                              vOffset.fY *= fDepthCoef;
+                              /* Clears depth coef */
+                              fDepthCoef = orxFLOAT_1;
                             }
-                          }
-                          else
-                          {
-                            /* Clears depth coef */
-                            fDepthCoef = orxFLOAT_1;
-                          }
 
-                          /* Gets object square bounding radius */
-                          fObjectBoundingRadius = orx2F(0.5f) * orxMath_Sqrt((vSize.fX * vSize.fX) + (vSize.fY * vSize.fY));
+                            /* Gets object square bounding radius */
+                            fObjectBoundingRadius = orx2F(0.5f) * orxMath_Sqrt((vSize.fX * vSize.fX) + (vSize.fY * vSize.fY));
 
-                          /* Updates distance vector */
-                          orxVector_Add(&vDist, &vDist, &vOffset);
+                            /* Updates distance vector */
+                            orxVector_Add(&vDist, &vDist, &vOffset);
+                          }
 
                           /* Gets 2D square distance to camera */
                           fSqrDist = orxVector_GetSquareSize(&vDist);
@@ -2182,7 +2808,7 @@ static orxINLINE void orxRender_Home_RenderViewport(const orxVIEWPORT *_pstViewp
       /* Sends stop event */
       orxEVENT_SEND(orxEVENT_TYPE_RENDER, orxRENDER_EVENT_VIEWPORT_STOP, (orxHANDLE)_pstViewport, (orxHANDLE)_pstViewport, orxNULL);
     }
-    else
+    else if(bSuccess == orxFALSE)
     {
       /* Logs message */
       orxDEBUG_PRINT(orxDEBUG_LEVEL_RENDER, "Not a valid bitmap.");
@@ -2196,6 +2822,368 @@ static orxINLINE void orxRender_Home_RenderViewport(const orxVIEWPORT *_pstViewp
   return;
 }
 
+/** Gets a frame graph texture, creating it if needed
+ */
+static orxRENDER_GRAPH_TEXTURE *orxFASTCALL orxRender_Home_GetGraphTexture(const orxTEXTURE *_pstTexture)
+{
+  orxRENDER_GRAPH_TEXTURE **ppstGraphTexture;
+  orxRENDER_GRAPH_TEXTURE  *pstResult = orxNULL;
+
+  /* Gets its bucket */
+  ppstGraphTexture = (orxRENDER_GRAPH_TEXTURE **)orxHashTable_Retrieve(sstRender.pstGraphTextureTable, orxStructure_GetGUID(_pstTexture));
+
+  /* Valid? */
+  if(ppstGraphTexture != orxNULL)
+  {
+    /* New? */
+    if(*ppstGraphTexture == orxNULL)
+    {
+      /* Allocates it */
+      *ppstGraphTexture = (orxRENDER_GRAPH_TEXTURE *)orxBank_Allocate(sstRender.pstGraphTextureBank);
+
+      /* Valid? */
+      if(*ppstGraphTexture != orxNULL)
+      {
+        /* Inits it */
+        (*ppstGraphTexture)->pstTexture       = _pstTexture;
+        (*ppstGraphTexture)->u32InternalCount = 0;
+        (*ppstGraphTexture)->u32Flags         = orxRENDER_KU32_GRAPH_FLAG_NONE;
+      }
+    }
+
+    /* Updates result */
+    pstResult = *ppstGraphTexture;
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Gets all the textures bound to a shader, using the frame graph texture buffer as storage
+ */
+static orxU32 orxFASTCALL orxRender_Home_GetShaderTextures(const orxSHADER *_pstShader)
+{
+  orxU32 u32Result;
+
+  /* Gets shader's texture count */
+  u32Result = orxShader_GetTextureCount(_pstShader);
+
+  /* Any? */
+  if(u32Result != 0)
+  {
+    /* Needs a bigger buffer? */
+    if(u32Result > sstRender.u32GraphTextureBufferSize)
+    {
+      const orxTEXTURE **apstBuffer;
+
+      /* Reallocates it */
+      apstBuffer = (const orxTEXTURE **)orxMemory_Reallocate((void *)sstRender.apstGraphTextureBuffer, u32Result * sizeof(orxTEXTURE *));
+
+      /* Success? */
+      if(apstBuffer != orxNULL)
+      {
+        /* Stores it */
+        sstRender.apstGraphTextureBuffer    = apstBuffer;
+        sstRender.u32GraphTextureBufferSize = u32Result;
+      }
+      else
+      {
+        /* Updates result */
+        u32Result = 0;
+      }
+    }
+
+    /* Gets its textures */
+    if((u32Result != 0)
+    && (orxShader_GetTextureList(_pstShader, u32Result, sstRender.apstGraphTextureBuffer) == orxSTATUS_FAILURE))
+    {
+      /* Updates result */
+      u32Result = 0;
+    }
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Builds frame graph: finds out which viewports need to be rendered this frame
+ * A viewport is live when at least one of its textures is consumed: screen texture, texture referenced outside of viewports
+ * (objects, user code, caches) or texture bound to a shader of a live viewport. Everything that can't be proven unused is kept.
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxRender_Home_BuildFrameGraph()
+{
+  orxVIEWPORT              *pstViewport;
+  orxRENDER_GRAPH_PASS     *pstPass;
+  orxRENDER_GRAPH_TEXTURE  *pstGraphTexture;
+  orxRENDER_GRAPH_SHADER   *pstGraphShader;
+  const orxTEXTURE         *pstScreenTexture;
+  orxBOOL                   bUpdate;
+  orxSTATUS                 eResult = orxSTATUS_SUCCESS;
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxRender_BuildFrameGraph");
+
+  /* First use? */
+  if(sstRender.pstPassBank == orxNULL)
+  {
+    /* Creates banks & tables */
+    sstRender.pstPassBank           = orxBank_Create(orxRENDER_KU32_GRAPH_BANK_SIZE, sizeof(orxRENDER_GRAPH_PASS), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+    sstRender.pstGraphTextureBank   = orxBank_Create(orxRENDER_KU32_GRAPH_BANK_SIZE, sizeof(orxRENDER_GRAPH_TEXTURE), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+    sstRender.pstGraphShaderBank    = orxBank_Create(orxRENDER_KU32_GRAPH_BANK_SIZE, sizeof(orxRENDER_GRAPH_SHADER), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+    sstRender.pstGraphTextureTable  = orxHashTable_Create(orxRENDER_KU32_GRAPH_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+    sstRender.pstGraphShaderTable   = orxHashTable_Create(orxRENDER_KU32_GRAPH_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+  }
+  else
+  {
+    /* Clears all */
+    orxLinkList_Clean(&(sstRender.stPassList));
+    orxBank_Clear(sstRender.pstPassBank);
+    orxBank_Clear(sstRender.pstGraphTextureBank);
+    orxBank_Clear(sstRender.pstGraphShaderBank);
+    orxHashTable_Clear(sstRender.pstGraphTextureTable);
+    orxHashTable_Clear(sstRender.pstGraphShaderTable);
+  }
+
+  /* Valid? */
+  if((sstRender.pstPassBank != orxNULL)
+  && (sstRender.pstGraphTextureBank != orxNULL)
+  && (sstRender.pstGraphShaderBank != orxNULL)
+  && (sstRender.pstGraphTextureTable != orxNULL)
+  && (sstRender.pstGraphShaderTable != orxNULL))
+  {
+    /* For all viewports */
+    for(pstViewport = orxVIEWPORT(orxStructure_GetFirst(orxSTRUCTURE_ID_VIEWPORT));
+        (pstViewport != orxNULL) && (eResult != orxSTATUS_FAILURE);
+        pstViewport = orxVIEWPORT(orxStructure_GetNext(pstViewport)))
+    {
+      orxTEXTURE         *apstTextureList[orxVIEWPORT_KU32_MAX_TEXTURE_NUMBER];
+      const orxSHADERPOINTER *pstShaderPointer;
+      orxU32              u32TextureCount, i;
+
+      /* Enabled? */
+      if(orxViewport_IsEnabled(pstViewport) != orxFALSE)
+      {
+        /* Creates its pass */
+        pstPass = (orxRENDER_GRAPH_PASS *)orxBank_Allocate(sstRender.pstPassBank);
+
+        /* Valid? */
+        if(pstPass != orxNULL)
+        {
+          /* Inits it */
+          orxMemory_Zero(pstPass, sizeof(orxRENDER_GRAPH_PASS));
+          pstPass->pstViewport  = pstViewport;
+          pstPass->u32Flags     = orxRENDER_KU32_GRAPH_FLAG_NONE;
+
+          /* Adds it to the list, keeping viewport order */
+          orxLinkList_AddEnd(&(sstRender.stPassList), &(pstPass->stNode));
+        }
+        else
+        {
+          /* Updates result */
+          eResult = orxSTATUS_FAILURE;
+        }
+      }
+
+      /* Gets its textures */
+      u32TextureCount = orxViewport_GetTextureCount(pstViewport);
+      orxViewport_GetTextureList(pstViewport, u32TextureCount, apstTextureList);
+
+      /* For all textures */
+      for(i = 0; i < u32TextureCount; i++)
+      {
+        /* Valid? */
+        if((apstTextureList[i] != orxNULL)
+        && ((pstGraphTexture = orxRender_Home_GetGraphTexture(apstTextureList[i])) != orxNULL))
+        {
+          /* Updates its internal count: one for the viewport's list and one for its creation if owned by the viewport */
+          pstGraphTexture->u32InternalCount += (orxStructure_GetOwner(apstTextureList[i]) == orxSTRUCTURE(pstViewport)) ? 2 : 1;
+        }
+      }
+
+      /* Has shader pointer? */
+      if((pstShaderPointer = orxViewport_GetShaderPointer(pstViewport)) != orxNULL)
+      {
+        /* For all shaders */
+        for(i = 0; i < orxSHADERPOINTER_KU32_SHADER_NUMBER; i++)
+        {
+          const orxSHADER *pstShader;
+
+          /* Valid? */
+          if((pstShader = orxShaderPointer_GetShader(pstShaderPointer, i)) != orxNULL)
+          {
+            orxRENDER_GRAPH_SHADER **ppstGraphShader;
+
+            /* Gets its bucket */
+            ppstGraphShader = (orxRENDER_GRAPH_SHADER **)orxHashTable_Retrieve(sstRender.pstGraphShaderTable, orxStructure_GetGUID(pstShader));
+
+            /* Valid? */
+            if(ppstGraphShader != orxNULL)
+            {
+              /* New? */
+              if(*ppstGraphShader == orxNULL)
+              {
+                /* Allocates it */
+                *ppstGraphShader = (orxRENDER_GRAPH_SHADER *)orxBank_Allocate(sstRender.pstGraphShaderBank);
+
+                /* Valid? */
+                if(*ppstGraphShader != orxNULL)
+                {
+                  /* Inits it */
+                  (*ppstGraphShader)->pstShader   = pstShader;
+                  (*ppstGraphShader)->u32UseCount = 0;
+                }
+              }
+
+              /* Valid? */
+              if(*ppstGraphShader != orxNULL)
+              {
+                /* Updates its use count */
+                (*ppstGraphShader)->u32UseCount++;
+              }
+            }
+          }
+        }
+      }
+    }
+
+    /* Success? */
+    if(eResult != orxSTATUS_FAILURE)
+    {
+      /* For all shaders */
+      for(pstGraphShader = (orxRENDER_GRAPH_SHADER *)orxBank_GetNext(sstRender.pstGraphShaderBank, orxNULL);
+          pstGraphShader != orxNULL;
+          pstGraphShader = (orxRENDER_GRAPH_SHADER *)orxBank_GetNext(sstRender.pstGraphShaderBank, pstGraphShader))
+      {
+        /* Only held by viewports? (each shader pointer use holds two references) */
+        if(orxStructure_GetRefCount(pstGraphShader->pstShader) <= 2 * pstGraphShader->u32UseCount)
+        {
+          orxU32 u32TextureCount, i;
+
+          /* For all its textures */
+          for(i = 0, u32TextureCount = orxRender_Home_GetShaderTextures(pstGraphShader->pstShader); i < u32TextureCount; i++)
+          {
+            /* Valid? */
+            if((pstGraphTexture = orxRender_Home_GetGraphTexture(sstRender.apstGraphTextureBuffer[i])) != orxNULL)
+            {
+              /* Updates its internal count, once per shader use */
+              pstGraphTexture->u32InternalCount += pstGraphShader->u32UseCount;
+            }
+          }
+        }
+      }
+
+      /* Gets screen texture */
+      pstScreenTexture = orxTexture_GetScreenTexture();
+
+      /* For all textures */
+      for(pstGraphTexture = (orxRENDER_GRAPH_TEXTURE *)orxBank_GetNext(sstRender.pstGraphTextureBank, orxNULL);
+          pstGraphTexture != orxNULL;
+          pstGraphTexture = (orxRENDER_GRAPH_TEXTURE *)orxBank_GetNext(sstRender.pstGraphTextureBank, pstGraphTexture))
+      {
+        /* Screen or referenced outside of the viewports? */
+        if((pstGraphTexture->pstTexture == pstScreenTexture)
+        || (orxStructure_GetRefCount(pstGraphTexture->pstTexture) > pstGraphTexture->u32InternalCount))
+        {
+          /* Marks it as live */
+          orxFLAG_SET(pstGraphTexture->u32Flags, orxRENDER_KU32_GRAPH_FLAG_LIVE, orxRENDER_KU32_GRAPH_FLAG_NONE);
+        }
+      }
+
+      /* Propagates liveness till stable */
+      do
+      {
+        /* Clears update status */
+        bUpdate = orxFALSE;
+
+        /* For all passes, last to first */
+        for(pstPass = (orxRENDER_GRAPH_PASS *)orxLinkList_GetLast(&(sstRender.stPassList));
+            pstPass != orxNULL;
+            pstPass = (orxRENDER_GRAPH_PASS *)orxLinkList_GetPrevious(&(pstPass->stNode)))
+        {
+          /* Not live yet? */
+          if(!orxFLAG_TEST(pstPass->u32Flags, orxRENDER_KU32_GRAPH_FLAG_LIVE))
+          {
+            orxTEXTURE *apstTextureList[orxVIEWPORT_KU32_MAX_TEXTURE_NUMBER];
+            orxU32      u32TextureCount, i;
+
+            /* Gets its textures */
+            u32TextureCount = orxViewport_GetTextureCount(pstPass->pstViewport);
+            orxViewport_GetTextureList(pstPass->pstViewport, u32TextureCount, apstTextureList);
+
+            /* For all textures */
+            for(i = 0; i < u32TextureCount; i++)
+            {
+              /* Is consumed? */
+              if((apstTextureList[i] == orxNULL)
+              || ((pstGraphTexture = (orxRENDER_GRAPH_TEXTURE *)orxHashTable_Get(sstRender.pstGraphTextureTable, orxStructure_GetGUID(apstTextureList[i]))) == orxNULL)
+              || (orxFLAG_TEST(pstGraphTexture->u32Flags, orxRENDER_KU32_GRAPH_FLAG_LIVE)))
+              {
+                /* Marks pass as live */
+                orxFLAG_SET(pstPass->u32Flags, orxRENDER_KU32_GRAPH_FLAG_LIVE, orxRENDER_KU32_GRAPH_FLAG_NONE);
+                break;
+              }
+            }
+
+            /* Became live? */
+            if(orxFLAG_TEST(pstPass->u32Flags, orxRENDER_KU32_GRAPH_FLAG_LIVE))
+            {
+              const orxSHADERPOINTER *pstShaderPointer;
+
+              /* Has active shaders? */
+              if(((pstShaderPointer = orxViewport_GetShaderPointer(pstPass->pstViewport)) != orxNULL)
+              && (orxShaderPointer_IsEnabled(pstShaderPointer) != orxFALSE))
+              {
+                /* For all shaders */
+                for(i = 0; i < orxSHADERPOINTER_KU32_SHADER_NUMBER; i++)
+                {
+                  const orxSHADER *pstShader;
+
+                  /* Valid and enabled? */
+                  if(((pstShader = orxShaderPointer_GetShader(pstShaderPointer, i)) != orxNULL)
+                  && (orxShader_IsEnabled(pstShader) != orxFALSE))
+                  {
+                    orxU32 u32ShaderTextureCount, j;
+
+                    /* For all its textures */
+                    for(j = 0, u32ShaderTextureCount = orxRender_Home_GetShaderTextures(pstShader); j < u32ShaderTextureCount; j++)
+                    {
+                      /* Known and not live yet? */
+                      if(((pstGraphTexture = (orxRENDER_GRAPH_TEXTURE *)orxHashTable_Get(sstRender.pstGraphTextureTable, orxStructure_GetGUID(sstRender.apstGraphTextureBuffer[j]))) != orxNULL)
+                      && (!orxFLAG_TEST(pstGraphTexture->u32Flags, orxRENDER_KU32_GRAPH_FLAG_LIVE)))
+                      {
+                        /* Marks it as live */
+                        orxFLAG_SET(pstGraphTexture->u32Flags, orxRENDER_KU32_GRAPH_FLAG_LIVE, orxRENDER_KU32_GRAPH_FLAG_NONE);
+
+                        /* Asks for another pass */
+                        bUpdate = orxTRUE;
+                      }
+                    }
+                  }
+                }
+              }
+            }
+          }
+        }
+      } while(bUpdate != orxFALSE);
+    }
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_RENDER, "Couldn't allocate frame graph resources.");
+
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return eResult;
+}
+
 /** Renders all (callback to register on a clock)
  * @param[in]   _pstClockInfo   Clock info of the clock used upon registration
  * @param[in]   _pContext     Context sent when registering callback to the clock
@@ -2224,13 +3212,70 @@ static void orxFASTCALL orxRender_Home_RenderAll(const orxCLOCK_INFO *_pstClockI
     /* Profiles */
     orxPROFILER_PUSH_MARKER("orxRender_RenderAll");
 
-    /* For all viewports */
-    for(pstViewport = orxVIEWPORT(orxStructure_GetFirst(orxSTRUCTURE_ID_VIEWPORT));
-        pstViewport != orxNULL;
-        pstViewport = orxVIEWPORT(orxStructure_GetNext(pstViewport)))
+    /* Pushes render config section */
+    orxConfig_PushSection(orxRENDER_KZ_CONFIG_SECTION);
+
+    /* Updates frame graph status */
+    orxFLAG_SET(sstRender.u32Flags, (orxConfig_GetBool(orxRENDER_KZ_CONFIG_FRAME_GRAPH) != orxFALSE) ? orxRENDER_KU32_STATIC_FLAG_FRAME_GRAPH : orxRENDER_KU32_STATIC_FLAG_NONE, orxRENDER_KU32_STATIC_FLAG_FRAME_GRAPH);
+
+    /* Pops config section */
+    orxConfig_PopSection();
+
+    /* Uses frame graph? */
+    if(orxFLAG_TEST(sstRender.u32Flags, orxRENDER_KU32_STATIC_FLAG_FRAME_GRAPH)
+    && (orxRender_Home_BuildFrameGraph() != orxSTATUS_FAILURE))
     {
-      /* Renders it */
-      orxRender_Home_RenderViewport(pstViewport);
+      orxRENDER_GRAPH_PASS *pstPass;
+
+      /* For all passes */
+      for(pstPass = (orxRENDER_GRAPH_PASS *)orxLinkList_GetFirst(&(sstRender.stPassList));
+          pstPass != orxNULL;
+          pstPass = (orxRENDER_GRAPH_PASS *)orxLinkList_GetNext(&(pstPass->stNode)))
+      {
+        /* Is live? */
+        if(orxFLAG_TEST(pstPass->u32Flags, orxRENDER_KU32_GRAPH_FLAG_LIVE))
+        {
+          /* Renders it */
+          orxRender_Home_RenderViewport(pstPass->pstViewport);
+        }
+      }
+    }
+    else
+    {
+      /* For all viewports */
+      for(pstViewport = orxVIEWPORT(orxStructure_GetFirst(orxSTRUCTURE_ID_VIEWPORT));
+          pstViewport != orxNULL;
+          pstViewport = orxVIEWPORT(orxStructure_GetNext(pstViewport)))
+      {
+        /* Renders it */
+        orxRender_Home_RenderViewport(pstViewport);
+      }
+    }
+
+    /* Has viewport caches? */
+    if(sstRender.pstCacheBank != orxNULL)
+    {
+      orxRENDER_CACHE *pstCache, *pstNextCache;
+
+      /* For all caches */
+      for(pstCache = (orxRENDER_CACHE *)orxBank_GetNext(sstRender.pstCacheBank, orxNULL);
+          pstCache != orxNULL;
+          pstCache = pstNextCache)
+      {
+        /* Gets next cache */
+        pstNextCache = (orxRENDER_CACHE *)orxBank_GetNext(sstRender.pstCacheBank, pstCache);
+
+        /* Not used this frame (viewport deleted, disabled, culled or uncached)? */
+        if(pstCache->u32Frame != sstRender.u32CacheFrame)
+        {
+          /* Deletes it */
+          orxHashTable_Remove(sstRender.pstCacheTable, pstCache->u64ViewportGUID);
+          orxBank_Free(sstRender.pstCacheBank, pstCache);
+        }
+      }
+
+      /* Updates cache frame */
+      sstRender.u32CacheFrame++;
     }
 
     /* Increases FPS count */
@@ -3029,6 +4074,60 @@ void orxFASTCALL orxRender_Home_Exit()
     /* Deletes rendering bank */
     orxBank_Delete(sstRender.pstRenderBank);
 
+    /* Has frame graph? */
+    if(sstRender.pstPassBank != orxNULL)
+    {
+      /* Deletes its banks & tables */
+      orxBank_Delete(sstRender.pstPassBank);
+      if(sstRender.pstGraphTextureBank != orxNULL)
+      {
+        orxBank_Delete(sstRender.pstGraphTextureBank);
+      }
+      if(sstRender.pstGraphShaderBank != orxNULL)
+      {
+        orxBank_Delete(sstRender.pstGraphShaderBank);
+      }
+      if(sstRender.pstGraphTextureTable != orxNULL)
+      {
+        orxHashTable_Delete(sstRender.pstGraphTextureTable);
+      }
+      if(sstRender.pstGraphShaderTable != orxNULL)
+      {
+        orxHashTable_Delete(sstRender.pstGraphShaderTable);
+      }
+      sstRender.pstPassBank           = orxNULL;
+      sstRender.pstGraphTextureBank   = orxNULL;
+      sstRender.pstGraphShaderBank    = orxNULL;
+      sstRender.pstGraphTextureTable  = orxNULL;
+      sstRender.pstGraphShaderTable   = orxNULL;
+    }
+
+    /* Deletes console log cache */
+    orxRender_Home_DeleteConsoleLog();
+
+    /* Has viewport caches? */
+    if(sstRender.pstCacheBank != orxNULL)
+    {
+      /* Deletes bank */
+      orxBank_Delete(sstRender.pstCacheBank);
+      sstRender.pstCacheBank = orxNULL;
+    }
+    if(sstRender.pstCacheTable != orxNULL)
+    {
+      /* Deletes table */
+      orxHashTable_Delete(sstRender.pstCacheTable);
+      sstRender.pstCacheTable = orxNULL;
+    }
+
+    /* Has frame graph texture buffer? */
+    if(sstRender.apstGraphTextureBuffer != orxNULL)
+    {
+      /* Frees it */
+      orxMemory_Free((void *)sstRender.apstGraphTextureBuffer);
+      sstRender.apstGraphTextureBuffer    = orxNULL;
+      sstRender.u32GraphTextureBufferSize = 0;
+    }
+
     /* Updates flags */
     sstRender.u32Flags &= ~(orxRENDER_KU32_STATIC_FLAG_READY | orxRENDER_KU32_STATIC_FLAG_REGISTERED);
   }
@@ -208,6 +208,11 @@ orxVECTOR *orxFASTCALL orxSoundSystem_Dummy_GetListenerPosition(orxVECTOR *_pvPo
   return orxNULL;
 }
 
+orxU32 orxFASTCALL orxSoundSystem_Dummy_GetUnderrunCount()
+{
+  return 0;
+}
+
 orxSTATUS orxFASTCALL orxSoundSystem_Dummy_StartRecording(const orxSTRING _zName, orxBOOL _bWriteToFile, orxU32 _u32SampleRate, orxU32 _u32ChannelNumber)
 {
   return orxSTATUS_FAILURE;
@@ -261,6 +266,7 @@ orxPLUGIN_USER_CORE_FUNCTION_ADD( orxSoundSystem_Dummy_SetGlobalVolume, SOUNDSYS
 orxPLUGIN_USER_CORE_FUNCTION_ADD( orxSoundSystem_Dummy_GetGlobalVolume, SOUNDSYSTEM, GET_GLOBAL_VOLUME);
 orxPLUGIN_USER_CORE_FUNCTION_ADD( orxSoundSystem_Dummy_SetListenerPosition, SOUNDSYSTEM, SET_LISTENER_POSITION);
 orxPLUGIN_USER_CORE_FUNCTION_ADD( orxSoundSystem_Dummy_GetListenerPosition, SOUNDSYSTEM, GET_LISTENER_POSITION);
+orxPLUGIN_USER_CORE_FUNCTION_ADD( orxSoundSystem_Dummy_GetUnderrunCount, SOUNDSYSTEM, GET_UNDERRUN_COUNT);
 orxPLUGIN_USER_CORE_FUNCTION_ADD( orxSoundSystem_Dummy_StartRecording, SOUNDSYSTEM, START_RECORDING);
 orxPLUGIN_USER_CORE_FUNCTION_ADD( orxSoundSystem_Dummy_StopRecording, SOUNDSYSTEM, STOP_RECORDING);
 orxPLUGIN_USER_CORE_FUNCTION_ADD( orxSoundSystem_Dummy_HasRecordingSupport, SOUNDSYSTEM, HAS_RECORDING_SUPPORT);
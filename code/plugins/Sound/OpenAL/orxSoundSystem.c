@@ -79,11 +79,14 @@
  */
 #define orxSOUNDSYSTEM_KU32_BANK_SIZE                     128
 #define orxSOUNDSYSTEM_KS32_DEFAULT_STREAM_BUFFER_NUMBER  4
+#define orxSOUNDSYSTEM_KS32_DEFAULT_STREAM_MAX_BUFFER_NUMBER 16
 #define orxSOUNDSYSTEM_KS32_DEFAULT_STREAM_BUFFER_SIZE    4096
 #define orxSOUNDSYSTEM_KS32_DEFAULT_RECORDING_FREQUENCY   44100
+#define orxSOUNDSYSTEM_KU32_COMMAND_LIST_SIZE             1024 /**< Needs to be a power of two */
+#define orxSOUNDSYSTEM_KU32_RETURN_LIST_SIZE              256 /**< Needs to be a power of two */
 #define orxSOUNDSYSTEM_KF_DEFAULT_DIMENSION_RATIO         orx2F(0.01f)
 #define orxSOUNDSYSTEM_KF_DEFAULT_THREAD_SLEEP_TIME       orx2F(0.001f)
-#define orxSOUNDSYSTEM_KZ_THREAD_NAME                     "Sound Streaming"
+#define orxSOUNDSYSTEM_KZ_THREAD_NAME                     "Sound"
 
 #ifdef __orxDEBUG__
 
@@ -163,6 +166,17 @@ struct __orxSOUNDSYSTEM_SOUND_t
   ALuint    uiSource;
   orxFLOAT  fDuration;
 
+  /* Main thread copies of the source properties */
+  orxVECTOR             vPosition;
+  orxFLOAT              fVolume;
+  orxFLOAT              fPitch;
+  orxFLOAT              fAttenuation;
+  orxFLOAT              fReferenceDistance;
+  orxBOOL               bLoop;
+  orxSOUNDSYSTEM_STATUS eRequestedStatus;
+  volatile orxU32       u32RequestCount;
+  volatile orxU32       u32ProcessCount;
+
   union
   {
     /* Sample */
@@ -177,11 +191,11 @@ struct __orxSOUNDSYSTEM_SOUND_t
       orxLINKLIST_NODE        stNode;
       const orxSTRING         zReference;
       orxBOOL                 bDelete       : 1;
-      orxBOOL                 bLoop         : 1;
       orxBOOL                 bStop         : 1;
       orxBOOL                 bStopping     : 1;
       orxBOOL                 bPause        : 1;
       orxS32                  s32PacketID;
+      orxS32                  s32BufferNumber;
       orxFLOAT                fTime;
       orxFLOAT                fSetTime;
       orxSOUNDSYSTEM_DATA     stData;
@@ -195,6 +209,60 @@ struct __orxSOUNDSYSTEM_SOUND_t
   #pragma warning(default : 4200)
 #endif /* __orxMSVC__ */
 
+/** Internal command type enum
+ */
+typedef enum __orxSOUNDSYSTEM_COMMAND_TYPE_t
+{
+  orxSOUNDSYSTEM_COMMAND_TYPE_LINK = 0,
+  orxSOUNDSYSTEM_COMMAND_TYPE_DELETE,
+  orxSOUNDSYSTEM_COMMAND_TYPE_DELETE_SAMPLE,
+  orxSOUNDSYSTEM_COMMAND_TYPE_PLAY,
+  orxSOUNDSYSTEM_COMMAND_TYPE_PAUSE,
+  orxSOUNDSYSTEM_COMMAND_TYPE_STOP,
+  orxSOUNDSYSTEM_COMMAND_TYPE_SET_VOLUME,
+  orxSOUNDSYSTEM_COMMAND_TYPE_SET_PITCH,
+  orxSOUNDSYSTEM_COMMAND_TYPE_SET_TIME,
+  orxSOUNDSYSTEM_COMMAND_TYPE_SET_POSITION,
+  orxSOUNDSYSTEM_COMMAND_TYPE_SET_ATTENUATION,
+  orxSOUNDSYSTEM_COMMAND_TYPE_SET_REFERENCE_DISTANCE,
+  orxSOUNDSYSTEM_COMMAND_TYPE_LOOP,
+
+  orxSOUNDSYSTEM_COMMAND_TYPE_NUMBER,
+
+  orxSOUNDSYSTEM_COMMAND_TYPE_NONE = orxENUM_NONE
+
+} orxSOUNDSYSTEM_COMMAND_TYPE;
+
+/** Internal command structure
+ */
+typedef struct __orxSOUNDSYSTEM_COMMAND_t
+{
+  orxSOUNDSYSTEM_COMMAND_TYPE eType;
+
+  union
+  {
+    orxSOUNDSYSTEM_SOUND     *pstSound;
+    orxSOUNDSYSTEM_SAMPLE    *pstSample;
+  };
+
+  union
+  {
+    orxVECTOR                 vValue;
+    orxFLOAT                  fValue;
+    orxBOOL                   bValue;
+  };
+
+} orxSOUNDSYSTEM_COMMAND;
+
+/** Internal return structure: sound or sample to free from its bank on main thread
+ */
+typedef struct __orxSOUNDSYSTEM_RETURN_t
+{
+  orxSOUNDSYSTEM_SOUND       *pstSound;
+  orxSOUNDSYSTEM_SAMPLE      *pstSample;
+
+} orxSOUNDSYSTEM_RETURN;
+
 /** Static structure
  */
 typedef struct __orxSOUNDSYSTEM_STATIC_t
@@ -206,18 +274,26 @@ typedef struct __orxSOUNDSYSTEM_STATIC_t
   orxBANK                *pstSoundBank;       /**< Sound bank */
   orxFLOAT                fDimensionRatio;    /**< Dimension ratio */
   orxFLOAT                fRecDimensionRatio; /**< Reciprocal dimension ratio */
-  orxU32                  u32StreamingThread; /**< Streaming thread */
+  orxU32                  u32Thread;          /**< Audio thread */
   orxU32                  u32Flags;           /**< Status flags */
   SNDFILE                *pstRecordingFile;   /**< Recording file */
   orxLINKLIST             stStreamList;       /**< Stream list */
   orxSOUND_EVENT_PAYLOAD  stRecordingPayload; /**< Recording payload */
   orxS32                  s32StreamBufferSize;/**< Stream buffer size */
   orxS32                  s32StreamBufferNumber; /**< Stream buffer number */
+  orxS32                  s32StreamMaxBufferNumber; /**< Stream max buffer number */
+  volatile orxU32         u32UnderrunCount;   /**< Stream underrun count */
+  orxSOUNDSYSTEM_COMMAND *astCommandList;     /**< Command list, main thread -> audio thread */
+  volatile orxU32         u32CommandInIndex;  /**< Command list in index, written by main thread */
+  volatile orxU32         u32CommandOutIndex; /**< Command list out index, written by audio thread */
+  volatile orxU32         u32ReturnInIndex;   /**< Return list in index, written by audio thread */
+  volatile orxU32         u32ReturnOutIndex;  /**< Return list out index, written by main thread */
   orxS16                 *as16StreamBuffer;   /**< Stream buffer */
   orxS16                 *as16RecordingBuffer;/**< Recording buffer */
   ALuint                 *auiWorkBufferList;  /**< Buffer list */
   orxTHREAD_SEMAPHORE    *pstStreamSemaphore; /**< Stream semaphore */
   SF_VIRTUAL_IO           stVirtualIO;        /**< Virtual IO interface for libsndfile */
+  orxSOUNDSYSTEM_RETURN   astReturnList[orxSOUNDSYSTEM_KU32_RETURN_LIST_SIZE]; /**< Return list, audio thread -> main thread */
 
 } orxSOUNDSYSTEM_STATIC;
 
@@ -627,6 +703,360 @@ static orxSTATUS orxFASTCALL orxSoundSystem_OpenAL_FreeSample(void *_pContext)
   return eResult;
 }
 
+static orxINLINE orxSOUNDSYSTEM_RETURN *orxSoundSystem_OpenAL_GetReturn()
+{
+  orxU32                  u32NextIndex;
+  orxSOUNDSYSTEM_RETURN  *pstResult;
+
+  /* Gets next index */
+  u32NextIndex = (sstSoundSystem.u32ReturnInIndex + 1) & (orxSOUNDSYSTEM_KU32_RETURN_LIST_SIZE - 1);
+
+  /* Full? (never waits for the main thread) */
+  if(u32NextIndex == sstSoundSystem.u32ReturnOutIndex)
+  {
+    /* Updates result */
+    pstResult = orxNULL;
+  }
+  else
+  {
+    /* Updates result */
+    pstResult = &(sstSoundSystem.astReturnList[sstSoundSystem.u32ReturnInIndex]);
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+static orxINLINE void orxSoundSystem_OpenAL_PushReturn()
+{
+  /* Publishes return */
+  orxMEMORY_BARRIER();
+  sstSoundSystem.u32ReturnInIndex = (sstSoundSystem.u32ReturnInIndex + 1) & (orxSOUNDSYSTEM_KU32_RETURN_LIST_SIZE - 1);
+
+  /* Done! */
+  return;
+}
+
+static void orxFASTCALL orxSoundSystem_OpenAL_ProcessReturns()
+{
+  orxU32 u32Index;
+
+  /* For all pending returns */
+  for(u32Index = sstSoundSystem.u32ReturnOutIndex;
+      u32Index != sstSoundSystem.u32ReturnInIndex;
+      u32Index = (u32Index + 1) & (orxSOUNDSYSTEM_KU32_RETURN_LIST_SIZE - 1))
+  {
+    orxSOUNDSYSTEM_RETURN *pstReturn;
+
+    /* Gets return */
+    orxMEMORY_BARRIER();
+    pstReturn = &(sstSoundSystem.astReturnList[u32Index]);
+
+    /* Sound? */
+    if(pstReturn->pstSound != orxNULL)
+    {
+      /* Frees it */
+      orxSoundSystem_OpenAL_FreeSound(pstReturn->pstSound);
+    }
+    else
+    {
+      /* Frees sample */
+      orxSoundSystem_OpenAL_FreeSample(pstReturn->pstSample);
+    }
+
+    /* Frees slot */
+    orxMEMORY_BARRIER();
+    sstSoundSystem.u32ReturnOutIndex = (u32Index + 1) & (orxSOUNDSYSTEM_KU32_RETURN_LIST_SIZE - 1);
+  }
+
+  /* Done! */
+  return;
+}
+
+static void orxFASTCALL orxSoundSystem_OpenAL_UpdateReturns(const orxCLOCK_INFO *_pstClockInfo, void *_pContext)
+{
+  /* Frees sounds & samples deleted by the audio thread */
+  orxSoundSystem_OpenAL_ProcessReturns();
+
+  /* Done! */
+  return;
+}
+
+static orxINLINE void orxSoundSystem_OpenAL_InitSound(orxSOUNDSYSTEM_SOUND *_pstSound)
+{
+  /* Checks */
+  orxASSERT(_pstSound != orxNULL);
+
+  /* Inits main thread copies of source's properties with OpenAL's defaults */
+  orxVector_Copy(&(_pstSound->vPosition), &orxVECTOR_0);
+  _pstSound->fVolume            = orxFLOAT_1;
+  _pstSound->fPitch             = orxFLOAT_1;
+  _pstSound->fAttenuation       = sstSoundSystem.fRecDimensionRatio;
+  _pstSound->fReferenceDistance = sstSoundSystem.fRecDimensionRatio;
+  _pstSound->bLoop              = orxFALSE;
+  _pstSound->eRequestedStatus   = orxSOUNDSYSTEM_STATUS_STOP;
+  _pstSound->u32RequestCount    = 0;
+  _pstSound->u32ProcessCount    = 0;
+
+  /* Done! */
+  return;
+}
+
+static orxINLINE orxSOUNDSYSTEM_COMMAND *orxSoundSystem_OpenAL_GetCommand(orxSOUNDSYSTEM_COMMAND_TYPE _eType)
+{
+  orxU32                  u32NextIndex;
+  orxSOUNDSYSTEM_COMMAND *pstResult;
+
+  /* Gets next index */
+  u32NextIndex = (sstSoundSystem.u32CommandInIndex + 1) & (orxSOUNDSYSTEM_KU32_COMMAND_LIST_SIZE - 1);
+
+  /* Waits for the audio thread to free a slot */
+  while(u32NextIndex == sstSoundSystem.u32CommandOutIndex)
+  {
+    /* Drains return list, the audio thread might be waiting on it */
+    orxSoundSystem_OpenAL_ProcessReturns();
+
+    orxThread_Yield();
+  }
+
+  /* Updates result */
+  pstResult         = &(sstSoundSystem.astCommandList[sstSoundSystem.u32CommandInIndex]);
+  pstResult->eType  = _eType;
+
+  /* Done! */
+  return pstResult;
+}
+
+static orxINLINE void orxSoundSystem_OpenAL_PushCommand()
+{
+  /* Publishes command */
+  orxMEMORY_BARRIER();
+  sstSoundSystem.u32CommandInIndex = (sstSoundSystem.u32CommandInIndex + 1) & (orxSOUNDSYSTEM_KU32_COMMAND_LIST_SIZE - 1);
+
+  /* Done! */
+  return;
+}
+
+static void orxFASTCALL orxSoundSystem_OpenAL_ProcessCommands()
+{
+  orxU32 u32Index;
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxSoundSystem_ProcessCommands");
+
+  /* For all pending commands */
+  for(u32Index = sstSoundSystem.u32CommandOutIndex;
+      u32Index != sstSoundSystem.u32CommandInIndex;
+      u32Index = (u32Index + 1) & (orxSOUNDSYSTEM_KU32_COMMAND_LIST_SIZE - 1))
+  {
+    orxSOUNDSYSTEM_COMMAND *pstCommand;
+    orxSOUNDSYSTEM_SOUND   *pstSound;
+    orxSOUNDSYSTEM_RETURN  *pstReturn = orxNULL;
+
+    /* Gets command */
+    orxMEMORY_BARRIER();
+    pstCommand  = &(sstSoundSystem.astCommandList[u32Index]);
+    pstSound    = pstCommand->pstSound;
+
+    /* Sample still loading? */
+    if((pstCommand->eType == orxSOUNDSYSTEM_COMMAND_TYPE_DELETE_SAMPLE)
+     ? (pstCommand->pstSample->uiBuffer == 0)
+     : ((pstSound->bIsStream == orxFALSE) && (pstSound->pstSample->uiBuffer == 0)))
+    {
+      /* Keeps command order: resumes once loaded */
+      break;
+    }
+
+    /* Deletion? */
+    if((pstCommand->eType == orxSOUNDSYSTEM_COMMAND_TYPE_DELETE_SAMPLE)
+    || ((pstCommand->eType == orxSOUNDSYSTEM_COMMAND_TYPE_DELETE) && (pstSound->bIsStream == orxFALSE)))
+    {
+      /* Gets return slot */
+      pstReturn = orxSoundSystem_OpenAL_GetReturn();
+
+      /* Return list full? */
+      if(pstReturn == orxNULL)
+      {
+        /* Keeps command order: resumes once main thread has drained it */
+        break;
+      }
+    }
+
+    /* Depending on command type */
+    switch(pstCommand->eType)
+    {
+      case orxSOUNDSYSTEM_COMMAND_TYPE_LINK:
+      {
+        /* Updates duration */
+        pstSound->fDuration = pstSound->pstSample->fDuration;
+
+        /* Links buffer to source */
+        alSourcei(pstSound->uiSource, AL_BUFFER, pstSound->pstSample->uiBuffer);
+        alASSERT();
+
+        break;
+      }
+
+      case orxSOUNDSYSTEM_COMMAND_TYPE_DELETE:
+      {
+        /* Stream? */
+        if(pstSound->bIsStream != orxFALSE)
+        {
+          /* Marks it for deletion */
+          pstSound->bDelete = orxTRUE;
+        }
+        else
+        {
+          /* Deletes its source */
+          alDeleteSources(1, &(pstSound->uiSource));
+          alASSERT();
+
+          /* Returns it to main thread for deletion from bank */
+          pstReturn->pstSound   = pstSound;
+          pstReturn->pstSample  = orxNULL;
+          orxSoundSystem_OpenAL_PushReturn();
+        }
+
+        break;
+      }
+
+      case orxSOUNDSYSTEM_COMMAND_TYPE_DELETE_SAMPLE:
+      {
+        /* Deletes openAL buffer */
+        alDeleteBuffers(1, (const ALuint *)&(pstCommand->pstSample->uiBuffer));
+        alASSERT();
+
+        /* Returns it to main thread for deletion from bank */
+        pstReturn->pstSound   = orxNULL;
+        pstReturn->pstSample  = pstCommand->pstSample;
+        orxSoundSystem_OpenAL_PushReturn();
+
+        break;
+      }
+
+      case orxSOUNDSYSTEM_COMMAND_TYPE_PLAY:
+      {
+        /* Plays source */
+        alSourcePlay(pstSound->uiSource);
+        alASSERT();
+
+        /* Updates status */
+        orxMEMORY_BARRIER();
+        pstSound->u32ProcessCount++;
+
+        break;
+      }
+
+      case orxSOUNDSYSTEM_COMMAND_TYPE_PAUSE:
+      {
+        /* Pauses source */
+        alSourcePause(pstSound->uiSource);
+        alASSERT();
+
+        /* Updates status */
+        orxMEMORY_BARRIER();
+        pstSound->u32ProcessCount++;
+
+        break;
+      }
+
+      case orxSOUNDSYSTEM_COMMAND_TYPE_STOP:
+      {
+        /* Stops source */
+        alSourceStop(pstSound->uiSource);
+        alASSERT();
+
+        /* Updates status */
+        orxMEMORY_BARRIER();
+        pstSound->u32ProcessCount++;
+
+        break;
+      }
+
+      case orxSOUNDSYSTEM_COMMAND_TYPE_SET_VOLUME:
+      {
+        /* Sets source's gain */
+        alSourcef(pstSound->uiSource, AL_GAIN, pstCommand->fValue);
+        alASSERT();
+
+        break;
+      }
+
+      case orxSOUNDSYSTEM_COMMAND_TYPE_SET_PITCH:
+      {
+        /* Sets source's pitch */
+        alSourcef(pstSound->uiSource, AL_PITCH, pstCommand->fValue);
+        alASSERT();
+
+        break;
+      }
+
+      case orxSOUNDSYSTEM_COMMAND_TYPE_SET_TIME:
+      {
+        /* Sets source's time */
+        alSourcef(pstSound->uiSource, AL_SEC_OFFSET, pstCommand->fValue);
+        alASSERT();
+
+        break;
+      }
+
+      case orxSOUNDSYSTEM_COMMAND_TYPE_SET_POSITION:
+      {
+        /* Sets source position */
+        alSource3f(pstSound->uiSource, AL_POSITION, pstCommand->vValue.fX, pstCommand->vValue.fY, pstCommand->vValue.fZ);
+        alASSERT();
+
+        break;
+      }
+
+      case orxSOUNDSYSTEM_COMMAND_TYPE_SET_ATTENUATION:
+      {
+        /* Set source's roll off factor */
+        alSourcef(pstSound->uiSource, AL_ROLLOFF_FACTOR, pstCommand->fValue);
+        alASSERT();
+
+        break;
+      }
+
+      case orxSOUNDSYSTEM_COMMAND_TYPE_SET_REFERENCE_DISTANCE:
+      {
+        /* Sets source's reference distance */
+        alSourcef(pstSound->uiSource, AL_REFERENCE_DISTANCE, pstCommand->fValue);
+        alASSERT();
+
+        break;
+      }
+
+      case orxSOUNDSYSTEM_COMMAND_TYPE_LOOP:
+      {
+        /* Updates source */
+        alSourcei(pstSound->uiSource, AL_LOOPING, (pstCommand->bValue != orxFALSE) ? AL_TRUE : AL_FALSE);
+        alASSERT();
+
+        break;
+      }
+
+      default:
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_SOUND, "Invalid sound command type <%d>.", pstCommand->eType);
+
+        break;
+      }
+    }
+
+    /* Frees slot */
+    orxMEMORY_BARRIER();
+    sstSoundSystem.u32CommandOutIndex = (u32Index + 1) & (orxSOUNDSYSTEM_KU32_COMMAND_LIST_SIZE - 1);
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return;
+}
+
 static void orxFASTCALL orxSoundSystem_OpenAL_FillStream(orxSOUNDSYSTEM_SOUND *_pstSound)
 {
   /* Checks */
@@ -663,7 +1093,7 @@ static void orxFASTCALL orxSoundSystem_OpenAL_FillStream(orxSOUNDSYSTEM_SOUND *_
         puiBufferList = _pstSound->auiBufferList;
 
         /* Updates buffer number */
-        iBufferNumber = sstSoundSystem.s32StreamBufferNumber;
+        iBufferNumber = _pstSound->s32BufferNumber;
       }
       else
       {
@@ -690,19 +1120,48 @@ static void orxFASTCALL orxSoundSystem_OpenAL_FillStream(orxSOUNDSYSTEM_SOUND *_
         }
         else
         {
+          ALint iState;
+
           /* Updates buffer number */
           iBufferNumber = iProcessedBufferNumber;
 
+          /* Uses local list */
+          puiBufferList = sstSoundSystem.auiWorkBufferList;
+
           /* Found any? */
           if(iBufferNumber > 0)
           {
-            /* Uses local list */
-            puiBufferList = sstSoundSystem.auiWorkBufferList;
-
             /* Unqueues them all */
-            alSourceUnqueueBuffers(_pstSound->uiSource, orxMIN(iBufferNumber, sstSoundSystem.s32StreamBufferNumber), puiBufferList);
+            alSourceUnqueueBuffers(_pstSound->uiSource, orxMIN(iBufferNumber, _pstSound->s32BufferNumber), puiBufferList);
             alASSERT();
           }
+
+          /* Gets actual state */
+          alGetSourcei(_pstSound->uiSource, AL_SOURCE_STATE, &iState);
+          alASSERT();
+
+          /* Ran out of data while playing? */
+          if((iState == AL_STOPPED) && (_pstSound->bPause == orxFALSE))
+          {
+            /* Updates underrun count */
+            sstSoundSystem.u32UnderrunCount++;
+
+            /* Can decode further ahead? */
+            if(_pstSound->s32BufferNumber < sstSoundSystem.s32StreamMaxBufferNumber)
+            {
+              orxS32 s32BufferNumber;
+
+              /* Doubles its queue depth */
+              s32BufferNumber = orxMIN(_pstSound->s32BufferNumber << 1, sstSoundSystem.s32StreamMaxBufferNumber);
+
+              /* Adds the new buffers to the list */
+              orxMemory_Copy(puiBufferList + iBufferNumber, _pstSound->auiBufferList + _pstSound->s32BufferNumber, (s32BufferNumber - _pstSound->s32BufferNumber) * sizeof(ALuint));
+
+              /* Updates buffer numbers */
+              iBufferNumber              += (ALint)(s32BufferNumber - _pstSound->s32BufferNumber);
+              _pstSound->s32BufferNumber  = s32BufferNumber;
+            }
+          }
         }
       }
 
@@ -886,7 +1345,7 @@ static void orxFASTCALL orxSoundSystem_OpenAL_FillStream(orxSOUNDSYSTEM_SOUND *_
 
         /* Checks */
         orxASSERT(iProcessedBufferNumber <= iQueuedBufferNumber);
-        orxASSERT(iQueuedBufferNumber <= sstSoundSystem.s32StreamBufferNumber);
+        orxASSERT(iQueuedBufferNumber <= _pstSound->s32BufferNumber);
 
         /* Found any? */
         if(iQueuedBufferNumber > 0)
@@ -895,7 +1354,7 @@ static void orxFASTCALL orxSoundSystem_OpenAL_FillStream(orxSOUNDSYSTEM_SOUND *_
           _pstSound->s32PacketID -= (orxS32)(iQueuedBufferNumber - iProcessedBufferNumber);
 
           /* Unqueues them */
-          alSourceUnqueueBuffers(_pstSound->uiSource, orxMIN(iQueuedBufferNumber, sstSoundSystem.s32StreamBufferNumber), sstSoundSystem.auiWorkBufferList);
+          alSourceUnqueueBuffers(_pstSound->uiSource, orxMIN(iQueuedBufferNumber, _pstSound->s32BufferNumber), sstSoundSystem.auiWorkBufferList);
           alASSERT();
         }
       }
@@ -976,11 +1435,14 @@ static void orxFASTCALL orxSoundSystem_OpenAL_UpdateRecording(const orxCLOCK_INF
   return;
 }
 
-static orxSTATUS orxFASTCALL orxSoundSystem_OpenAL_UpdateStreaming(void *_pContext)
+static orxSTATUS orxFASTCALL orxSoundSystem_OpenAL_Update(void *_pContext)
 {
   orxLINKLIST_NODE *pstNode;
   orxSTATUS         eResult = orxSTATUS_SUCCESS;
 
+  /* Processes pending commands */
+  orxSoundSystem_OpenAL_ProcessCommands();
+
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxSoundSystem_UpdateStreaming");
 
@@ -997,27 +1459,38 @@ static orxSTATUS orxFASTCALL orxSoundSystem_OpenAL_UpdateStreaming(void *_pConte
     /* Marked for deletion? */
     if(pstSound->bDelete != orxFALSE)
     {
-      /* Deletes source */
-      alDeleteSources(1, &(pstSound->uiSource));
-      alASSERT();
-
-      /* Closes audio file */
-      orxSoundSystem_OpenAL_CloseFile(&(pstSound->stData));
+      orxSOUNDSYSTEM_RETURN *pstReturn;
 
-      /* Clears buffers */
-      alDeleteBuffers(sstSoundSystem.s32StreamBufferNumber, pstSound->auiBufferList);
-      alASSERT();
+      /* Gets return slot */
+      pstReturn = orxSoundSystem_OpenAL_GetReturn();
 
       /* Gets next node */
       pstNode = orxLinkList_GetNext(pstNode);
 
-      /* Removes it from list */
-      orxThread_WaitSemaphore(sstSoundSystem.pstStreamSemaphore);
-      orxLinkList_Remove(&(pstSound->stNode));
-      orxThread_SignalSemaphore(sstSoundSystem.pstStreamSemaphore);
+      /* Valid? (otherwise retries on next update, once main thread has drained the return list) */
+      if(pstReturn != orxNULL)
+      {
+        /* Deletes source */
+        alDeleteSources(1, &(pstSound->uiSource));
+        alASSERT();
+
+        /* Closes audio file */
+        orxSoundSystem_OpenAL_CloseFile(&(pstSound->stData));
+
+        /* Clears buffers */
+        alDeleteBuffers(sstSoundSystem.s32StreamMaxBufferNumber, pstSound->auiBufferList);
+        alASSERT();
 
-      /* Postpones sound deletion from bank on main thread */
-      orxThread_RunTask(orxNULL, orxSoundSystem_OpenAL_FreeSound, orxNULL, pstSound);
+        /* Removes it from list */
+        orxThread_WaitSemaphore(sstSoundSystem.pstStreamSemaphore);
+        orxLinkList_Remove(&(pstSound->stNode));
+        orxThread_SignalSemaphore(sstSoundSystem.pstStreamSemaphore);
+
+        /* Returns it to main thread for deletion from bank */
+        pstReturn->pstSound   = pstSound;
+        pstReturn->pstSample  = orxNULL;
+        orxSoundSystem_OpenAL_PushReturn();
+      }
     }
     else
     {
@@ -1168,105 +1641,6 @@ static orxSTATUS orxFASTCALL orxSoundSystem_OpenAL_LoadSampleTask(void *_pContex
   return eResult;
 }
 
-static orxSTATUS orxFASTCALL orxSoundSystem_OpenAL_LinkSampleTask(void *_pContext)
-{
-  orxSOUNDSYSTEM_SOUND *pstSound;
-  orxSTATUS             eResult = orxSTATUS_SUCCESS;
-
-  /* Gets sound */
-  pstSound = (orxSOUNDSYSTEM_SOUND *)_pContext;
-
-  /* Updates duration */
-  pstSound->fDuration = pstSound->pstSample->fDuration;
-
-  /* Links buffer to source */
-  alSourcei(pstSound->uiSource, AL_BUFFER, pstSound->pstSample->uiBuffer);
-  alASSERT();
-
-  /* Done! */
-  return eResult;
-}
-
-static orxSTATUS orxFASTCALL orxSoundSystem_OpenAL_DeleteSampleTask(void *_pContext)
-{
-  orxSOUNDSYSTEM_SAMPLE  *pstSample;
-  orxSTATUS               eResult = orxSTATUS_SUCCESS;
-
-  /* Gets sample */
-  pstSample = (orxSOUNDSYSTEM_SAMPLE *)_pContext;
-
-  /* Deletes openAL buffer */
-  alDeleteBuffers(1, (const ALuint *)&(pstSample->uiBuffer));
-  alASSERT();
-
-  /* Done! */
-  return eResult;
-}
-
-static orxSTATUS orxFASTCALL orxSoundSystem_OpenAL_DeleteTask(void *_pContext)
-{
-  orxSOUNDSYSTEM_SOUND *pstSound;
-  orxSTATUS             eResult = orxSTATUS_SUCCESS;
-
-  /* Gets sound */
-  pstSound = (orxSOUNDSYSTEM_SOUND *)_pContext;
-
-  /* Deletes its source */
-  alDeleteSources(1, &(pstSound->uiSource));
-  alASSERT();
-
-  /* Done! */
-  return eResult;
-}
-
-static orxSTATUS orxFASTCALL orxSoundSystem_OpenAL_PlayTask(void *_pContext)
-{
-  orxSOUNDSYSTEM_SOUND *pstSound;
-  orxSTATUS             eResult = orxSTATUS_SUCCESS;
-
-  /* Gets sound */
-  pstSound = (orxSOUNDSYSTEM_SOUND *)_pContext;
-
-  /* Plays source */
-  alSourcePlay(pstSound->uiSource);
-  alASSERT();
-
-  /* Done! */
-  return eResult;
-}
-
-static orxSTATUS orxFASTCALL orxSoundSystem_OpenAL_PauseTask(void *_pContext)
-{
-  orxSOUNDSYSTEM_SOUND *pstSound;
-  orxSTATUS             eResult = orxSTATUS_SUCCESS;
-
-  /* Gets sound */
-  pstSound = (orxSOUNDSYSTEM_SOUND *)_pContext;
-
-  /* Pauses source */
-  alSourcePause(pstSound->uiSource);
-  alASSERT();
-
-  /* Done! */
-  return eResult;
-}
-
-static orxSTATUS orxFASTCALL orxSoundSystem_OpenAL_StopTask(void *_pContext)
-{
-  orxSOUNDSYSTEM_SOUND *pstSound;
-  orxSTATUS             eResult = orxSTATUS_SUCCESS;
-
-  /* Gets sound */
-  pstSound = (orxSOUNDSYSTEM_SOUND *)_pContext;
-
-  /* Stops source */
-  alSourceStop(pstSound->uiSource);
-  alASSERT();
-
-  /* Done! */
-  return eResult;
-}
-
 orxSTATUS orxFASTCALL orxSoundSystem_OpenAL_Init()
 {
   orxSTATUS eResult = orxSTATUS_FAILURE;
@@ -1326,21 +1700,36 @@ orxSTATUS orxFASTCALL orxSoundSystem_OpenAL_Init()
           sstSoundSystem.s32StreamBufferNumber = orxSOUNDSYSTEM_KS32_DEFAULT_STREAM_BUFFER_NUMBER;
         }
 
+        /* Has stream max buffer number? */
+        if(orxConfig_HasValue(orxSOUNDSYSTEM_KZ_CONFIG_STREAM_MAX_BUFFER_NUMBER) != orxFALSE)
+        {
+          /* Gets it */
+          sstSoundSystem.s32StreamMaxBufferNumber = orxMAX(sstSoundSystem.s32StreamBufferNumber, (orxS32)orxConfig_GetU32(orxSOUNDSYSTEM_KZ_CONFIG_STREAM_MAX_BUFFER_NUMBER));
+        }
+        else
+        {
+          /* Uses default one */
+          sstSoundSystem.s32StreamMaxBufferNumber = orxMAX(sstSoundSystem.s32StreamBufferNumber, orxSOUNDSYSTEM_KS32_DEFAULT_STREAM_MAX_BUFFER_NUMBER);
+        }
+
         /* Valid? */
         if(sstSoundSystem.poContext != NULL)
         {
           /* Creates banks */
           sstSoundSystem.pstSampleBank  = orxBank_Create(orxSOUNDSYSTEM_KU32_BANK_SIZE, sizeof(orxSOUNDSYSTEM_SAMPLE), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_AUDIO);
-          sstSoundSystem.pstSoundBank   = orxBank_Create(orxSOUNDSYSTEM_KU32_BANK_SIZE, sizeof(orxSOUNDSYSTEM_SOUND) + sstSoundSystem.s32StreamBufferNumber * sizeof(ALuint), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_AUDIO);
+          sstSoundSystem.pstSoundBank   = orxBank_Create(orxSOUNDSYSTEM_KU32_BANK_SIZE, sizeof(orxSOUNDSYSTEM_SOUND) + sstSoundSystem.s32StreamMaxBufferNumber * sizeof(ALuint), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_AUDIO);
+
+          /* Allocates command list */
+          sstSoundSystem.astCommandList = (orxSOUNDSYSTEM_COMMAND *)orxMemory_Allocate(orxSOUNDSYSTEM_KU32_COMMAND_LIST_SIZE * sizeof(orxSOUNDSYSTEM_COMMAND), orxMEMORY_TYPE_AUDIO);
 
           /* Valid? */
-          if((sstSoundSystem.pstSampleBank != orxNULL) && (sstSoundSystem.pstSoundBank))
+          if((sstSoundSystem.pstSampleBank != orxNULL) && (sstSoundSystem.pstSoundBank) && (sstSoundSystem.astCommandList != orxNULL))
           {
-            /* Adds streaming thread */
-            sstSoundSystem.u32StreamingThread = orxThread_Start(&orxSoundSystem_OpenAL_UpdateStreaming, orxSOUNDSYSTEM_KZ_THREAD_NAME, orxNULL);
+            /* Adds audio thread */
+            sstSoundSystem.u32Thread = orxThread_Start(&orxSoundSystem_OpenAL_Update, orxSOUNDSYSTEM_KZ_THREAD_NAME, orxNULL);
 
             /* Success? */
-            if(sstSoundSystem.u32StreamingThread != orxU32_UNDEFINED)
+            if(sstSoundSystem.u32Thread != orxU32_UNDEFINED)
             {
               ALfloat   afOrientation[] = {0.0f, 0.0f, -1.0f, 0.0f, 1.0f, 0.0f};
               orxFLOAT  fRatio;
@@ -1357,7 +1746,7 @@ orxSTATUS orxFASTCALL orxSoundSystem_OpenAL_Init()
               sstSoundSystem.as16RecordingBuffer  = (orxS16 *)orxMemory_Allocate(sstSoundSystem.s32StreamBufferSize * sizeof(orxS16), orxMEMORY_TYPE_AUDIO);
 
               /* Allocates working buffer list */
-              sstSoundSystem.auiWorkBufferList    = (ALuint *)orxMemory_Allocate(sstSoundSystem.s32StreamBufferNumber * sizeof(ALuint), orxMEMORY_TYPE_AUDIO);
+              sstSoundSystem.auiWorkBufferList    = (ALuint *)orxMemory_Allocate(sstSoundSystem.s32StreamMaxBufferNumber * sizeof(ALuint), orxMEMORY_TYPE_AUDIO);
 
               /* Gets dimension ratio */
               fRatio = orxConfig_GetFloat(orxSOUNDSYSTEM_KZ_CONFIG_RATIO);
@@ -1380,6 +1769,13 @@ orxSTATUS orxFASTCALL orxSoundSystem_OpenAL_Init()
               /* Stores reciprocal dimension ratio */
               sstSoundSystem.fRecDimensionRatio = orxFLOAT_1 / sstSoundSystem.fDimensionRatio;
 
+              /* Registers return update */
+              if(orxClock_Register(orxClock_FindFirst(orx2F(-1.0f), orxCLOCK_TYPE_CORE), &orxSoundSystem_OpenAL_UpdateReturns, orxNULL, orxMODULE_ID_SOUNDSYSTEM, orxCLOCK_PRIORITY_LOW) == orxSTATUS_FAILURE)
+              {
+                /* Logs message */
+                orxDEBUG_PRINT(orxDEBUG_LEVEL_SOUND, "Couldn't register return update: deleted sounds & samples will only be freed upon next deletion.");
+              }
+
               /* Updates status */
               orxFLAG_SET(sstSoundSystem.u32Flags, orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY, orxSOUNDSYSTEM_KU32_STATIC_MASK_ALL);
 
@@ -1400,6 +1796,10 @@ orxSTATUS orxFASTCALL orxSoundSystem_OpenAL_Init()
                 sstSoundSystem.pstSoundBank = orxNULL;
               }
 
+              /* Deletes command list */
+              orxMemory_Free(sstSoundSystem.astCommandList);
+              sstSoundSystem.astCommandList = orxNULL;
+
               /* Destroys openAL context */
               alcDestroyContext(sstSoundSystem.poContext);
               sstSoundSystem.poContext = NULL;
@@ -1425,6 +1825,11 @@ orxSTATUS orxFASTCALL orxSoundSystem_OpenAL_Init()
               orxBank_Delete(sstSoundSystem.pstSoundBank);
               sstSoundSystem.pstSoundBank = orxNULL;
             }
+            if(sstSoundSystem.astCommandList != orxNULL)
+            {
+              orxMemory_Free(sstSoundSystem.astCommandList);
+              sstSoundSystem.astCommandList = orxNULL;
+            }
 
             /* Destroys openAL context */
             alcDestroyContext(sstSoundSystem.poContext);
@@ -1468,15 +1873,31 @@ void orxFASTCALL orxSoundSystem_OpenAL_Exit()
   /* Was initialized? */
   if(sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY)
   {
-    /* Joins streaming thread */
-    orxThread_Join(sstSoundSystem.u32StreamingThread);
+    /* Joins audio thread */
+    orxThread_Join(sstSoundSystem.u32Thread);
 
     /* Stops any recording */
     orxSoundSystem_StopRecording();
 
+    /* Unregisters return update */
+    orxClock_Unregister(orxClock_FindFirst(orx2F(-1.0f), orxCLOCK_TYPE_CORE), orxSoundSystem_OpenAL_UpdateReturns);
+
+    /* Processes remaining commands */
+    while(sstSoundSystem.u32CommandOutIndex != sstSoundSystem.u32CommandInIndex)
+    {
+      orxSoundSystem_OpenAL_ProcessCommands();
+      orxSoundSystem_OpenAL_ProcessReturns();
+    }
+
+    /* Processes remaining returns */
+    orxSoundSystem_OpenAL_ProcessReturns();
+
     /* Waits for all tasks to be finished */
     while(orxThread_GetTaskCount() != 0);
 
+    /* Deletes command list */
+    orxMemory_Free(sstSoundSystem.astCommandList);
+
     /* Deletes semaphore */
     orxThread_DeleteSemaphore(sstSoundSystem.pstStreamSemaphore);
 
@@ -1667,8 +2088,12 @@ orxSTATUS orxFASTCALL orxSoundSystem_OpenAL_DeleteSample(orxSOUNDSYSTEM_SAMPLE *
   orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstSample != orxNULL);
 
-  /* Runs delete sample task */
-  orxThread_RunTask(&orxSoundSystem_OpenAL_DeleteSampleTask, &orxSoundSystem_OpenAL_FreeSample, &orxSoundSystem_OpenAL_FreeSample, _pstSample);
+  /* Frees previously deleted sounds & samples */
+  orxSoundSystem_OpenAL_ProcessReturns();
+
+  /* Queues sample deletion */
+  orxSoundSystem_OpenAL_GetCommand(orxSOUNDSYSTEM_COMMAND_TYPE_DELETE_SAMPLE)->pstSample = _pstSample;
+  orxSoundSystem_OpenAL_PushCommand();
 
   /* Done! */
   return orxSTATUS_SUCCESS;
@@ -1676,6 +2101,8 @@ orxSTATUS orxFASTCALL orxSoundSystem_OpenAL_DeleteSample(orxSOUNDSYSTEM_SAMPLE *
 
 orxSTATUS orxFASTCALL orxSoundSystem_OpenAL_GetSampleInfo(const orxSOUNDSYSTEM_SAMPLE *_pstSample, orxU32 *_pu32ChannelNumber, orxU32 *_pu32FrameNumber, orxU32 *_pu32SampleRate)
 {
+  orxSTATUS eResult;
+
   /* Checks */
   orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstSample != orxNULL);
@@ -1683,13 +2110,28 @@ orxSTATUS orxFASTCALL orxSoundSystem_OpenAL_GetSampleInfo(const orxSOUNDSYSTEM_S
   orxASSERT(_pu32FrameNumber != orxNULL);
   orxASSERT(_pu32SampleRate != orxNULL);
 
-  /* Updates info */
-  *_pu32ChannelNumber = _pstSample->stData.stInfo.u32ChannelNumber;
-  *_pu32FrameNumber   = _pstSample->stData.stInfo.u32FrameNumber;
-  *_pu32SampleRate    = _pstSample->stData.stInfo.u32SampleRate;
+  /* Decoded? */
+  if(_pstSample->uiBuffer != 0)
+  {
+    /* Synchronizes with the load task */
+    orxMEMORY_BARRIER();
+
+    /* Updates info */
+    *_pu32ChannelNumber = _pstSample->stData.stInfo.u32ChannelNumber;
+    *_pu32FrameNumber   = _pstSample->stData.stInfo.u32FrameNumber;
+    *_pu32SampleRate    = _pstSample->stData.stInfo.u32SampleRate;
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
 
   /* Done! */
-  return orxSTATUS_SUCCESS;
+  return eResult;
 }
 
 orxSTATUS orxFASTCALL orxSoundSystem_OpenAL_SetSampleData(orxSOUNDSYSTEM_SAMPLE *_pstSample, const orxS16 *_as16Data, orxU32 _u32SampleNumber)
@@ -1738,40 +2180,28 @@ orxSOUNDSYSTEM_SOUND *orxFASTCALL orxSoundSystem_OpenAL_CreateFromSample(const o
   /* Valid? */
   if(pstResult != orxNULL)
   {
+    /* Clears it */
+    orxMemory_Zero(pstResult, sizeof(orxSOUNDSYSTEM_SOUND));
+
     /* Links sample */
     pstResult->pstSample = (orxSOUNDSYSTEM_SAMPLE *)_pstSample;
 
     /* Updates status */
     pstResult->bIsStream = orxFALSE;
 
+    /* Inits it */
+    orxSoundSystem_OpenAL_InitSound(pstResult);
+
     /* Creates source */
     alGenSources(1, &(pstResult->uiSource));
     alASSERT();
 
-    /* Inits it */
-    alSourcef(pstResult->uiSource, AL_PITCH, 1.0f);
-    alASSERT();
-    alSourcef(pstResult->uiSource, AL_GAIN, 1.0f);
-    alASSERT();
-
-    /* Not finished loading? */
-    if(_pstSample->uiBuffer == 0)
-    {
-      /* Clears duration */
-      pstResult->fDuration = orx2F(-1.0f);
+    /* Updates duration */
+    pstResult->fDuration = (_pstSample->uiBuffer != 0) ? _pstSample->fDuration : orx2F(-1.0f);
 
-      /* Runs link task */
-      orxThread_RunTask(&orxSoundSystem_OpenAL_LinkSampleTask, orxNULL, orxNULL, pstResult);
-    }
-    else
-    {
-      /* Updates duration */
-      pstResult->fDuration = _pstSample->fDuration;
-
-      /* Links it to data buffer */
-      alSourcei(pstResult->uiSource, AL_BUFFER, _pstSample->uiBuffer);
-      alASSERT();
-    }
+    /* Queues link to data buffer */
+    orxSoundSystem_OpenAL_GetCommand(orxSOUNDSYSTEM_COMMAND_TYPE_LINK)->pstSound = pstResult;
+    orxSoundSystem_OpenAL_PushCommand();
   }
   else
   {
@@ -1803,12 +2233,15 @@ orxSOUNDSYSTEM_SOUND *orxFASTCALL orxSoundSystem_OpenAL_CreateStream(orxU32 _u32
       /* Clears it */
       orxMemory_Zero(pstResult, sizeof(orxSOUNDSYSTEM_SOUND));
 
+      /* Inits it */
+      orxSoundSystem_OpenAL_InitSound(pstResult);
+
       /* Generates openAL source */
       alGenSources(1, &(pstResult->uiSource));
       alASSERT();
 
       /* Generates all openAL buffers */
-      alGenBuffers(sstSoundSystem.s32StreamBufferNumber, pstResult->auiBufferList);
+      alGenBuffers(sstSoundSystem.s32StreamMaxBufferNumber, pstResult->auiBufferList);
       alASSERT();
 
       /* Stores information */
@@ -1830,6 +2263,7 @@ orxSOUNDSYSTEM_SOUND *orxFASTCALL orxSoundSystem_OpenAL_CreateStream(orxU32 _u32
       pstResult->bStop      = orxTRUE;
       pstResult->bStopping  = orxFALSE;
       pstResult->s32PacketID= 0;
+      pstResult->s32BufferNumber = sstSoundSystem.s32StreamBufferNumber;
       pstResult->fTime      = orxFLOAT_0;
       pstResult->fSetTime   = orxFLOAT_0;
 
@@ -1896,15 +2330,19 @@ orxSOUNDSYSTEM_SOUND *orxFASTCALL orxSoundSystem_OpenAL_CreateStreamFromFile(con
         pstResult->bStop      = orxTRUE;
         pstResult->bStopping  = orxFALSE;
         pstResult->s32PacketID= 0;
+        pstResult->s32BufferNumber = sstSoundSystem.s32StreamBufferNumber;
         pstResult->fTime      = orxFLOAT_0;
         pstResult->fSetTime   = orxFLOAT_0;
 
+        /* Inits it */
+        orxSoundSystem_OpenAL_InitSound(pstResult);
+
         /* Generates openAL source */
         alGenSources(1, &(pstResult->uiSource));
         alASSERT();
 
         /* Generates all openAL buffers */
-        alGenBuffers(sstSoundSystem.s32StreamBufferNumber, pstResult->auiBufferList);
+        alGenBuffers(sstSoundSystem.s32StreamMaxBufferNumber, pstResult->auiBufferList);
         alASSERT();
 
         /* Runs stream create task */
@@ -1952,17 +2390,12 @@ orxSTATUS orxFASTCALL orxSoundSystem_OpenAL_Delete(orxSOUNDSYSTEM_SOUND *_pstSou
   orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstSound != orxNULL);
 
-  /* Stream? */
-  if(_pstSound->bIsStream != orxFALSE)
-  {
-    /* Marks it for deletion */
-    _pstSound->bDelete = orxTRUE;
-  }
-  else
-  {
-    /* Runs delete task */
-    orxThread_RunTask(&orxSoundSystem_OpenAL_DeleteTask, &orxSoundSystem_OpenAL_FreeSound, &orxSoundSystem_OpenAL_FreeSound, _pstSound);
-  }
+  /* Frees previously deleted sounds & samples */
+  orxSoundSystem_OpenAL_ProcessReturns();
+
+  /* Queues deletion */
+  orxSoundSystem_OpenAL_GetCommand(orxSOUNDSYSTEM_COMMAND_TYPE_DELETE)->pstSound = _pstSound;
+  orxSoundSystem_OpenAL_PushCommand();
 
   /* Done! */
   return eResult;
@@ -1991,18 +2424,13 @@ orxSTATUS orxFASTCALL orxSoundSystem_OpenAL_Play(orxSOUNDSYSTEM_SOUND *_pstSound
   }
   else
   {
-    /* Not finished loading? */
-    if(_pstSound->pstSample->uiBuffer == 0)
-    {
-      /* Runs play task */
-      orxThread_RunTask(&orxSoundSystem_OpenAL_PlayTask, orxNULL, orxNULL, _pstSound);
-    }
-    else
-    {
-      /* Plays source */
-      alSourcePlay(_pstSound->uiSource);
-      alASSERT();
-    }
+    /* Stores requested status */
+    _pstSound->eRequestedStatus = orxSOUNDSYSTEM_STATUS_PLAY;
+    _pstSound->u32RequestCount++;
+
+    /* Queues play */
+    orxSoundSystem_OpenAL_GetCommand(orxSOUNDSYSTEM_COMMAND_TYPE_PLAY)->pstSound = _pstSound;
+    orxSoundSystem_OpenAL_PushCommand();
   }
 
   /* Done! */
@@ -2025,18 +2453,13 @@ orxSTATUS orxFASTCALL orxSoundSystem_OpenAL_Pause(orxSOUNDSYSTEM_SOUND *_pstSoun
   }
   else
   {
-    /* Not finished loading? */
-    if(_pstSound->pstSample->uiBuffer == 0)
-    {
-      /* Runs pause task */
-      orxThread_RunTask(&orxSoundSystem_OpenAL_PauseTask, orxNULL, orxNULL, _pstSound);
-    }
-    else
-    {
-      /* Pauses source */
-      alSourcePause(_pstSound->uiSource);
-      alASSERT();
-    }
+    /* Stores requested status */
+    _pstSound->eRequestedStatus = orxSOUNDSYSTEM_STATUS_PAUSE;
+    _pstSound->u32RequestCount++;
+
+    /* Queues pause */
+    orxSoundSystem_OpenAL_GetCommand(orxSOUNDSYSTEM_COMMAND_TYPE_PAUSE)->pstSound = _pstSound;
+    orxSoundSystem_OpenAL_PushCommand();
   }
 
   /* Done! */
@@ -2061,18 +2484,13 @@ orxSTATUS orxFASTCALL orxSoundSystem_OpenAL_Stop(orxSOUNDSYSTEM_SOUND *_pstSound
   }
   else
   {
-    /* Not finished loading? */
-    if(_pstSound->pstSample->uiBuffer == 0)
-    {
-      /* Runs stop task */
-      orxThread_RunTask(&orxSoundSystem_OpenAL_StopTask, orxNULL, orxNULL, _pstSound);
-    }
-    else
-    {
-      /* Stops source */
-      alSourceStop(_pstSound->uiSource);
-      alASSERT();
-    }
+    /* Stores requested status */
+    _pstSound->eRequestedStatus = orxSOUNDSYSTEM_STATUS_STOP;
+    _pstSound->u32RequestCount++;
+
+    /* Queues stop */
+    orxSoundSystem_OpenAL_GetCommand(orxSOUNDSYSTEM_COMMAND_TYPE_STOP)->pstSound = _pstSound;
+    orxSoundSystem_OpenAL_PushCommand();
   }
 
   /* Done! */
@@ -2261,15 +2679,21 @@ orxBOOL orxFASTCALL orxSoundSystem_OpenAL_HasRecordingSupport()
 
 orxSTATUS orxFASTCALL orxSoundSystem_OpenAL_SetVolume(orxSOUNDSYSTEM_SOUND *_pstSound, orxFLOAT _fVolume)
 {
-  orxSTATUS eResult = orxSTATUS_SUCCESS;
+  orxSOUNDSYSTEM_COMMAND *pstCommand;
+  orxSTATUS               eResult = orxSTATUS_SUCCESS;
 
   /* Checks */
   orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstSound != orxNULL);
 
-  /* Sets source's gain */
-  alSourcef(_pstSound->uiSource, AL_GAIN, _fVolume);
-  alASSERT();
+  /* Stores volume */
+  _pstSound->fVolume = _fVolume;
+
+  /* Queues source's gain update */
+  pstCommand            = orxSoundSystem_OpenAL_GetCommand(orxSOUNDSYSTEM_COMMAND_TYPE_SET_VOLUME);
+  pstCommand->pstSound  = _pstSound;
+  pstCommand->fValue    = _fVolume;
+  orxSoundSystem_OpenAL_PushCommand();
 
   /* Done! */
   return eResult;
@@ -2277,15 +2701,21 @@ orxSTATUS orxFASTCALL orxSoundSystem_OpenAL_SetVolume(orxSOUNDSYSTEM_SOUND *_pst
 
 orxSTATUS orxFASTCALL orxSoundSystem_OpenAL_SetPitch(orxSOUNDSYSTEM_SOUND *_pstSound, orxFLOAT _fPitch)
 {
-  orxSTATUS eResult = orxSTATUS_SUCCESS;
+  orxSOUNDSYSTEM_COMMAND *pstCommand;
+  orxSTATUS               eResult = orxSTATUS_SUCCESS;
 
   /* Checks */
   orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstSound != orxNULL);
 
-  /* Sets source's pitch */
-  alSourcef(_pstSound->uiSource, AL_PITCH, _fPitch);
-  alASSERT();
+  /* Stores pitch */
+  _pstSound->fPitch = _fPitch;
+
+  /* Queues source's pitch update */
+  pstCommand            = orxSoundSystem_OpenAL_GetCommand(orxSOUNDSYSTEM_COMMAND_TYPE_SET_PITCH);
+  pstCommand->pstSound  = _pstSound;
+  pstCommand->fValue    = _fPitch;
+  orxSoundSystem_OpenAL_PushCommand();
 
   /* Done! */
   return eResult;
@@ -2307,9 +2737,13 @@ orxSTATUS orxFASTCALL orxSoundSystem_OpenAL_SetTime(orxSOUNDSYSTEM_SOUND *_pstSo
   }
   else
   {
-    /* Sets source's time */
-    alSourcef(_pstSound->uiSource, AL_SEC_OFFSET, _fTime);
-    alASSERT();
+    orxSOUNDSYSTEM_COMMAND *pstCommand;
+
+    /* Queues source's time update */
+    pstCommand            = orxSoundSystem_OpenAL_GetCommand(orxSOUNDSYSTEM_COMMAND_TYPE_SET_TIME);
+    pstCommand->pstSound  = _pstSound;
+    pstCommand->fValue    = _fTime;
+    orxSoundSystem_OpenAL_PushCommand();
   }
 
   /* Done! */
@@ -2318,16 +2752,22 @@ orxSTATUS orxFASTCALL orxSoundSystem_OpenAL_SetTime(orxSOUNDSYSTEM_SOUND *_pstSo
 
 orxSTATUS orxFASTCALL orxSoundSystem_OpenAL_SetPosition(orxSOUNDSYSTEM_SOUND *_pstSound, const orxVECTOR *_pvPosition)
 {
-  orxSTATUS eResult = orxSTATUS_SUCCESS;
+  orxSOUNDSYSTEM_COMMAND *pstCommand;
+  orxSTATUS               eResult = orxSTATUS_SUCCESS;
 
   /* Checks */
   orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstSound != orxNULL);
   orxASSERT(_pvPosition != orxNULL);
 
-  /* Sets source position */
-  alSource3f(_pstSound->uiSource, AL_POSITION, sstSoundSystem.fDimensionRatio * _pvPosition->fX, sstSoundSystem.fDimensionRatio * _pvPosition->fY, sstSoundSystem.fDimensionRatio * _pvPosition->fZ);
-  alASSERT();
+  /* Stores position */
+  orxVector_Copy(&(_pstSound->vPosition), _pvPosition);
+
+  /* Queues source's position update */
+  pstCommand            = orxSoundSystem_OpenAL_GetCommand(orxSOUNDSYSTEM_COMMAND_TYPE_SET_POSITION);
+  pstCommand->pstSound  = _pstSound;
+  orxVector_Mulf(&(pstCommand->vValue), _pvPosition, sstSoundSystem.fDimensionRatio);
+  orxSoundSystem_OpenAL_PushCommand();
 
   /* Done! */
   return eResult;
@@ -2335,15 +2775,21 @@ orxSTATUS orxFASTCALL orxSoundSystem_OpenAL_SetPosition(orxSOUNDSYSTEM_SOUND *_p
 
 orxSTATUS orxFASTCALL orxSoundSystem_OpenAL_SetAttenuation(orxSOUNDSYSTEM_SOUND *_pstSound, orxFLOAT _fAttenuation)
 {
-  orxSTATUS eResult = orxSTATUS_SUCCESS;
+  orxSOUNDSYSTEM_COMMAND *pstCommand;
+  orxSTATUS               eResult = orxSTATUS_SUCCESS;
 
   /* Checks */
   orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstSound != orxNULL);
 
-  /* Set source's roll off factor */
-  alSourcef(_pstSound->uiSource, AL_ROLLOFF_FACTOR, sstSoundSystem.fDimensionRatio * _fAttenuation);
-  alASSERT();
+  /* Stores attenuation */
+  _pstSound->fAttenuation = _fAttenuation;
+
+  /* Queues source's roll off factor update */
+  pstCommand            = orxSoundSystem_OpenAL_GetCommand(orxSOUNDSYSTEM_COMMAND_TYPE_SET_ATTENUATION);
+  pstCommand->pstSound  = _pstSound;
+  pstCommand->fValue    = sstSoundSystem.fDimensionRatio * _fAttenuation;
+  orxSoundSystem_OpenAL_PushCommand();
 
   /* Done! */
   return eResult;
@@ -2351,15 +2797,21 @@ orxSTATUS orxFASTCALL orxSoundSystem_OpenAL_SetAttenuation(orxSOUNDSYSTEM_SOUND
 
 orxSTATUS orxFASTCALL orxSoundSystem_OpenAL_SetReferenceDistance(orxSOUNDSYSTEM_SOUND *_pstSound, orxFLOAT _fDistance)
 {
-  orxSTATUS eResult = orxSTATUS_SUCCESS;
+  orxSOUNDSYSTEM_COMMAND *pstCommand;
+  orxSTATUS               eResult = orxSTATUS_SUCCESS;
 
   /* Checks */
   orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstSound != orxNULL);
 
-  /* Sets source's reference distance */
-  alSourcef(_pstSound->uiSource, AL_REFERENCE_DISTANCE, sstSoundSystem.fDimensionRatio * _fDistance);
-  alASSERT();
+  /* Stores reference distance */
+  _pstSound->fReferenceDistance = _fDistance;
+
+  /* Queues source's reference distance update */
+  pstCommand            = orxSoundSystem_OpenAL_GetCommand(orxSOUNDSYSTEM_COMMAND_TYPE_SET_REFERENCE_DISTANCE);
+  pstCommand->pstSound  = _pstSound;
+  pstCommand->fValue    = sstSoundSystem.fDimensionRatio * _fDistance;
+  orxSoundSystem_OpenAL_PushCommand();
 
   /* Done! */
   return eResult;
@@ -2373,17 +2825,19 @@ orxSTATUS orxFASTCALL orxSoundSystem_OpenAL_Loop(orxSOUNDSYSTEM_SOUND *_pstSound
   orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstSound != orxNULL);
 
-  /* Stream? */
-  if(_pstSound->bIsStream != orxFALSE)
-  {
-    /* Updates status */
-    _pstSound->bLoop = _bLoop;
-  }
-  else
+  /* Updates status */
+  _pstSound->bLoop = _bLoop;
+
+  /* Not a stream? */
+  if(_pstSound->bIsStream == orxFALSE)
   {
-    /* Updates source */
-    alSourcei(_pstSound->uiSource, AL_LOOPING, (_bLoop != orxFALSE) ? AL_TRUE : AL_FALSE);
-    alASSERT();
+    orxSOUNDSYSTEM_COMMAND *pstCommand;
+
+    /* Queues source's looping update */
+    pstCommand            = orxSoundSystem_OpenAL_GetCommand(orxSOUNDSYSTEM_COMMAND_TYPE_LOOP);
+    pstCommand->pstSound  = _pstSound;
+    pstCommand->bValue    = _bLoop;
+    orxSoundSystem_OpenAL_PushCommand();
   }
 
   /* Done! */
@@ -2392,15 +2846,14 @@ orxSTATUS orxFASTCALL orxSoundSystem_OpenAL_Loop(orxSOUNDSYSTEM_SOUND *_pstSound
 
 orxFLOAT orxFASTCALL orxSoundSystem_OpenAL_GetVolume(const orxSOUNDSYSTEM_SOUND *_pstSound)
 {
-  orxFLOAT fResult = orxFLOAT_0;
+  orxFLOAT fResult;
 
   /* Checks */
   orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstSound != orxNULL);
 
   /* Updates result */
-  alGetSourcef(_pstSound->uiSource, AL_GAIN, &fResult);
-  alASSERT();
+  fResult = _pstSound->fVolume;
 
   /* Done! */
   return fResult;
@@ -2408,15 +2861,14 @@ orxFLOAT orxFASTCALL orxSoundSystem_OpenAL_GetVolume(const orxSOUNDSYSTEM_SOUND
 
 orxFLOAT orxFASTCALL orxSoundSystem_OpenAL_GetPitch(const orxSOUNDSYSTEM_SOUND *_pstSound)
 {
-  orxFLOAT fResult = orxFLOAT_0;
+  orxFLOAT fResult;
 
   /* Checks */
   orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstSound != orxNULL);
 
   /* Updates result */
-  alGetSourcef(_pstSound->uiSource, AL_PITCH, &fResult);
-  alASSERT();
+  fResult = _pstSound->fPitch;
 
   /* Done! */
   return fResult;
@@ -2449,19 +2901,15 @@ orxFLOAT orxFASTCALL orxSoundSystem_OpenAL_GetTime(const orxSOUNDSYSTEM_SOUND *_
 
 orxVECTOR *orxFASTCALL orxSoundSystem_OpenAL_GetPosition(const orxSOUNDSYSTEM_SOUND *_pstSound, orxVECTOR *_pvPosition)
 {
-  orxVECTOR *pvResult = _pvPosition;
+  orxVECTOR *pvResult;
 
   /* Checks */
   orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstSound != orxNULL);
   orxASSERT(_pvPosition != orxNULL);
 
-  /* Gets source's position */
-  alGetSource3f(_pstSound->uiSource, AL_POSITION, &(pvResult->fX), &(pvResult->fY), &(pvResult->fZ));
-  alASSERT();
-
   /* Updates result */
-  orxVector_Mulf(pvResult, pvResult, sstSoundSystem.fRecDimensionRatio);
+  pvResult = orxVector_Copy(_pvPosition, &(_pstSound->vPosition));
 
   /* Done! */
   return pvResult;
@@ -2475,12 +2923,8 @@ orxFLOAT orxFASTCALL orxSoundSystem_OpenAL_GetAttenuation(const orxSOUNDSYSTEM_S
   orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstSound != orxNULL);
 
-  /* Get source's roll off factor */
-  alGetSourcef(_pstSound->uiSource, AL_ROLLOFF_FACTOR, &fResult);
-  alASSERT();
-
   /* Updates result */
-  fResult *= sstSoundSystem.fRecDimensionRatio;
+  fResult = _pstSound->fAttenuation;
 
   /* Done! */
   return fResult;
@@ -2494,12 +2938,8 @@ orxFLOAT orxFASTCALL orxSoundSystem_OpenAL_GetReferenceDistance(const orxSOUNDSY
   orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstSound != orxNULL);
 
-  /* Gets source's reference distance */
-  alGetSourcef(_pstSound->uiSource, AL_REFERENCE_DISTANCE, &fResult);
-  alASSERT();
-
   /* Updates result */
-  fResult *= sstSoundSystem.fRecDimensionRatio;
+  fResult = _pstSound->fReferenceDistance;
 
   /* Done! */
   return fResult;
@@ -2507,28 +2947,14 @@ orxFLOAT orxFASTCALL orxSoundSystem_OpenAL_GetReferenceDistance(const orxSOUNDSY
 
 orxBOOL orxFASTCALL orxSoundSystem_OpenAL_IsLooping(const orxSOUNDSYSTEM_SOUND *_pstSound)
 {
-  ALint   iLooping;
   orxBOOL bResult;
 
   /* Checks */
   orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstSound != orxNULL);
 
-  /* Stream? */
-  if(_pstSound->bIsStream != orxFALSE)
-  {
-    /* Updates result */
-    bResult = _pstSound->bLoop;
-  }
-  else
-  {
-    /* Gets looping property */
-    alGetSourcei(_pstSound->uiSource, AL_LOOPING, &iLooping);
-    alASSERT();
-
-    /* Updates result */
-    bResult = (iLooping == AL_FALSE) ? orxFALSE : orxTRUE;
-  }
+  /* Updates result */
+  bResult = _pstSound->bLoop;
 
   /* Done! */
   return bResult;
@@ -2558,50 +2984,59 @@ orxSOUNDSYSTEM_STATUS orxFASTCALL orxSoundSystem_OpenAL_GetStatus(const orxSOUND
   orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstSound != orxNULL);
 
-  /* Gets source's state */
-  alGetSourcei(_pstSound->uiSource, AL_SOURCE_STATE, &iState);
-  alASSERT();
-
-  /* Depending on it */
-  switch(iState)
+  /* Has pending request? */
+  if(_pstSound->u32RequestCount != _pstSound->u32ProcessCount)
+  {
+    /* Updates result */
+    eResult = _pstSound->eRequestedStatus;
+  }
+  else
   {
-    case AL_STOPPED:
+    /* Gets source's state */
+    alGetSourcei(_pstSound->uiSource, AL_SOURCE_STATE, &iState);
+    alASSERT();
+
+    /* Depending on it */
+    switch(iState)
     {
-      /* Is stream? */
-      if(_pstSound->bIsStream != orxFALSE)
+      case AL_STOPPED:
       {
-        /* Updates result */
-        eResult = (_pstSound->bStop != orxFALSE) ? orxSOUNDSYSTEM_STATUS_STOP : (_pstSound->bPause != orxFALSE) ? orxSOUNDSYSTEM_STATUS_PAUSE : orxSOUNDSYSTEM_STATUS_PLAY;
+        /* Is stream? */
+        if(_pstSound->bIsStream != orxFALSE)
+        {
+          /* Updates result */
+          eResult = (_pstSound->bStop != orxFALSE) ? orxSOUNDSYSTEM_STATUS_STOP : (_pstSound->bPause != orxFALSE) ? orxSOUNDSYSTEM_STATUS_PAUSE : orxSOUNDSYSTEM_STATUS_PLAY;
+        }
+        else
+        {
+          /* Updates result */
+          eResult = orxSOUNDSYSTEM_STATUS_STOP;
+        }
+
+        break;
       }
-      else
+
+      case AL_PAUSED:
       {
         /* Updates result */
-        eResult = orxSOUNDSYSTEM_STATUS_STOP;
-      }
+        eResult = orxSOUNDSYSTEM_STATUS_PAUSE;
 
-      break;
-    }
-
-    case AL_PAUSED:
-    {
-      /* Updates result */
-      eResult = orxSOUNDSYSTEM_STATUS_PAUSE;
-
-      break;
-    }
+        break;
+      }
 
-    case AL_INITIAL:
-    case AL_PLAYING:
-    {
-      /* Updates result */
-      eResult = orxSOUNDSYSTEM_STATUS_PLAY;
+      case AL_INITIAL:
+      case AL_PLAYING:
+      {
+        /* Updates result */
+        eResult = orxSOUNDSYSTEM_STATUS_PLAY;
 
-      break;
-    }
+        break;
+      }
 
-    default:
-    {
-      break;
+      default:
+      {
+        break;
+      }
     }
   }
 
@@ -2674,6 +3109,20 @@ orxVECTOR *orxFASTCALL orxSoundSystem_OpenAL_GetListenerPosition(orxVECTOR *_pvP
   return pvResult;
 }
 
+orxU32 orxFASTCALL orxSoundSystem_OpenAL_GetUnderrunCount()
+{
+  orxU32 u32Result;
+
+  /* Checks */
+  orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
+
+  /* Updates result */
+  u32Result = sstSoundSystem.u32UnderrunCount;
+
+  /* Done! */
+  return u32Result;
+}
+
 
 /***************************************************************************
  * Plugin related                                                          *
@@ -2717,6 +3166,7 @@ orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_OpenAL_SetGlobalVolume, SOUNDSYS
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_OpenAL_GetGlobalVolume, SOUNDSYSTEM, GET_GLOBAL_VOLUME);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_OpenAL_SetListenerPosition, SOUNDSYSTEM, SET_LISTENER_POSITION);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_OpenAL_GetListenerPosition, SOUNDSYSTEM, GET_LISTENER_POSITION);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_OpenAL_GetUnderrunCount, SOUNDSYSTEM, GET_UNDERRUN_COUNT);
 orxPLUGIN_USER_CORE_FUNCTION_END();
 
 #ifdef __orxMSVC__
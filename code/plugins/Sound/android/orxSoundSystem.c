@@ -1379,6 +1379,8 @@ orxSTATUS orxFASTCALL orxSoundSystem_Android_DeleteSample(orxSOUNDSYSTEM_SAMPLE
 
 orxSTATUS orxFASTCALL orxSoundSystem_Android_GetSampleInfo(const orxSOUNDSYSTEM_SAMPLE *_pstSample, orxU32 *_pu32ChannelNumber, orxU32 *_pu32FrameNumber, orxU32 *_pu32SampleRate)
 {
+  orxSTATUS eResult;
+
   /* Checks */
   orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstSample != orxNULL);
@@ -1386,13 +1388,28 @@ orxSTATUS orxFASTCALL orxSoundSystem_Android_GetSampleInfo(const orxSOUNDSYSTEM_
   orxASSERT(_pu32FrameNumber != orxNULL);
   orxASSERT(_pu32SampleRate != orxNULL);
 
-  /* Updates info */
-  *_pu32ChannelNumber = _pstSample->stData.stInfo.u32ChannelNumber;
-  *_pu32FrameNumber   = _pstSample->stData.stInfo.u32FrameNumber;
-  *_pu32SampleRate    = _pstSample->stData.stInfo.u32SampleRate;
+  /* Decoded? */
+  if(_pstSample->uiBuffer != 0)
+  {
+    /* Synchronizes with the load task */
+    orxMEMORY_BARRIER();
+
+    /* Updates info */
+    *_pu32ChannelNumber = _pstSample->stData.stInfo.u32ChannelNumber;
+    *_pu32FrameNumber   = _pstSample->stData.stInfo.u32FrameNumber;
+    *_pu32SampleRate    = _pstSample->stData.stInfo.u32SampleRate;
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
 
   /* Done! */
-  return orxSTATUS_SUCCESS;
+  return eResult;
 }
 
 orxSTATUS orxFASTCALL orxSoundSystem_Android_SetSampleData(orxSOUNDSYSTEM_SAMPLE *_pstSample, const orxS16 *_as16Data, orxU32 _u32SampleNumber)
@@ -2233,6 +2250,15 @@ orxVECTOR *orxFASTCALL orxSoundSystem_Android_GetListenerPosition(orxVECTOR *_pv
   return pvResult;
 }
 
+orxU32 orxFASTCALL orxSoundSystem_Android_GetUnderrunCount()
+{
+  /* Checks */
+  orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
+
+  /* Not tracked */
+  return 0;
+}
+
 
 /***************************************************************************
  * Plugin related                                                          *
@@ -2276,6 +2302,7 @@ orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_Android_SetGlobalVolume, SOUNDSY
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_Android_GetGlobalVolume, SOUNDSYSTEM, GET_GLOBAL_VOLUME);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_Android_SetListenerPosition, SOUNDSYSTEM, SET_LISTENER_POSITION);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_Android_GetListenerPosition, SOUNDSYSTEM, GET_LISTENER_POSITION);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_Android_GetUnderrunCount, SOUNDSYSTEM, GET_UNDERRUN_COUNT);
 orxPLUGIN_USER_CORE_FUNCTION_END();
 
 #ifdef __orxMSVC__
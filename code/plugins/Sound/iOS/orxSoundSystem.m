@@ -1681,6 +1681,8 @@ orxSTATUS orxFASTCALL orxSoundSystem_iOS_DeleteSample(orxSOUNDSYSTEM_SAMPLE *_ps
 
 orxSTATUS orxFASTCALL orxSoundSystem_iOS_GetSampleInfo(const orxSOUNDSYSTEM_SAMPLE *_pstSample, orxU32 *_pu32ChannelNumber, orxU32 *_pu32FrameNumber, orxU32 *_pu32SampleRate)
 {
+  orxSTATUS eResult;
+
   /* Checks */
   orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstSample != orxNULL);
@@ -1688,13 +1690,28 @@ orxSTATUS orxFASTCALL orxSoundSystem_iOS_GetSampleInfo(const orxSOUNDSYSTEM_SAMP
   orxASSERT(_pu32FrameNumber != orxNULL);
   orxASSERT(_pu32SampleRate != orxNULL);
 
-  /* Updates info */
-  *_pu32ChannelNumber = _pstSample->stData.stInfo.u32ChannelNumber;
-  *_pu32FrameNumber   = _pstSample->stData.stInfo.u32FrameNumber;
-  *_pu32SampleRate    = _pstSample->stData.stInfo.u32SampleRate;
+  /* Decoded? */
+  if(_pstSample->uiBuffer != 0)
+  {
+    /* Synchronizes with the load task */
+    orxMEMORY_BARRIER();
+
+    /* Updates info */
+    *_pu32ChannelNumber = _pstSample->stData.stInfo.u32ChannelNumber;
+    *_pu32FrameNumber   = _pstSample->stData.stInfo.u32FrameNumber;
+    *_pu32SampleRate    = _pstSample->stData.stInfo.u32SampleRate;
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
 
   /* Done! */
-  return orxSTATUS_SUCCESS;
+  return eResult;
 }
 
 orxSTATUS orxFASTCALL orxSoundSystem_iOS_SetSampleData(orxSOUNDSYSTEM_SAMPLE *_pstSample, const orxS16 *_as16Data, orxU32 _u32SampleNumber)
@@ -2679,6 +2696,15 @@ orxVECTOR *orxFASTCALL orxSoundSystem_iOS_GetListenerPosition(orxVECTOR *_pvPosi
   return pvResult;
 }
 
+orxU32 orxFASTCALL orxSoundSystem_iOS_GetUnderrunCount()
+{
+  /* Checks */
+  orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
+
+  /* Not tracked */
+  return 0;
+}
+
 
 /***************************************************************************
  * Plugin related                                                          *
@@ -2722,4 +2748,5 @@ orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_iOS_SetGlobalVolume, SOUNDSYSTEM
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_iOS_GetGlobalVolume, SOUNDSYSTEM, GET_GLOBAL_VOLUME);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_iOS_SetListenerPosition, SOUNDSYSTEM, SET_LISTENER_POSITION);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_iOS_GetListenerPosition, SOUNDSYSTEM, GET_LISTENER_POSITION);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_iOS_GetUnderrunCount, SOUNDSYSTEM, GET_UNDERRUN_COUNT);
 orxPLUGIN_USER_CORE_FUNCTION_END();
@@ -54,6 +54,7 @@
 #define orxANIMPOINTER_KU32_STATIC_FLAG_NONE          0x00000000  /**< No flags */
 
 #define orxANIMPOINTER_KU32_STATIC_FLAG_READY         0x00000001  /**< Ready flag */
+#define orxANIMPOINTER_KU32_STATIC_FLAG_UPDATE_BATCH  0x00000002  /**< Update batch flag */
 
 
 /** orxANIMPOINTER flags
@@ -75,6 +76,7 @@
 #define orxANIMPOINTER_KZ_CONFIG_FREQUENCY            "Frequency"
 #define orxANIMPOINTER_KU32_BANK_SIZE                 128         /**< Bank size */
 #define orxANIMPOINTER_KF_FREQUENCY_DEFAULT           1.0         /**< Default animation frequency */
+#define orxANIMPOINTER_KU32_UPDATE_BATCH_SIZE         256         /**< Initial update batch size */
 
 
 /***************************************************************************
@@ -102,7 +104,10 @@ struct __orxANIMPOINTER_t
  */
 typedef struct __orxANIMPOINTER_STATIC_t
 {
-  orxU32 u32Flags;                                    /**< Control flags : 4 */
+  orxU64 *au64UpdateBatch;                            /**< GUIDs of owners whose current key has changed this frame : 8 */
+  orxU32  u32UpdateBatchCount;                        /**< Update batch count : 12 */
+  orxU32  u32UpdateBatchSize;                         /**< Update batch size : 16 */
+  orxU32  u32Flags;                                   /**< Control flags : 20 */
 
 } orxANIMPOINTER_STATIC;
 
@@ -142,6 +147,79 @@ static orxINLINE void orxAnimPointer_DeleteAll()
   return;
 }
 
+/** Adds an owner to the current update batch
+ * @param[in]   _pstOwner       Owner whose current key has changed
+ */
+static orxINLINE void orxAnimPointer_AddToUpdateBatch(const orxSTRUCTURE *_pstOwner)
+{
+  /* Checks */
+  orxSTRUCTURE_ASSERT(_pstOwner);
+
+  /* Full? */
+  if(sstAnimPointer.u32UpdateBatchCount == sstAnimPointer.u32UpdateBatchSize)
+  {
+    orxU64 *au64NewBatch;
+    orxU32  u32NewSize;
+
+    /* Gets new size */
+    u32NewSize = (sstAnimPointer.u32UpdateBatchSize != 0) ? sstAnimPointer.u32UpdateBatchSize << 1 : orxANIMPOINTER_KU32_UPDATE_BATCH_SIZE;
+
+    /* Allocates / reallocates it */
+    au64NewBatch = (sstAnimPointer.au64UpdateBatch != orxNULL)
+                 ? (orxU64 *)orxMemory_Reallocate(sstAnimPointer.au64UpdateBatch, u32NewSize * sizeof(orxU64))
+                 : (orxU64 *)orxMemory_Allocate(u32NewSize * sizeof(orxU64), orxMEMORY_TYPE_MAIN);
+
+    /* Success? */
+    if(au64NewBatch != orxNULL)
+    {
+      /* Stores it */
+      sstAnimPointer.au64UpdateBatch    = au64NewBatch;
+      sstAnimPointer.u32UpdateBatchSize = u32NewSize;
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_ANIM, "Couldn't grow update batch to %u entries, dropping update.", u32NewSize);
+    }
+  }
+
+  /* Has room? */
+  if(sstAnimPointer.u32UpdateBatchCount < sstAnimPointer.u32UpdateBatchSize)
+  {
+    /* Stores owner's GUID */
+    sstAnimPointer.au64UpdateBatch[sstAnimPointer.u32UpdateBatchCount++] = orxStructure_GetGUID(_pstOwner);
+  }
+
+  return;
+}
+
+/** Sends the aggregated update event (clock callback)
+ * @param[in]   _pstClockInfo   Clock info of the clock used upon registration
+ * @param[in]   _pContext       Context sent when registering callback to the clock
+ */
+static void orxFASTCALL orxAnimPointer_SendUpdateBatch(const orxCLOCK_INFO *_pstClockInfo, void *_pContext)
+{
+  /* Has updates? */
+  if(sstAnimPointer.u32UpdateBatchCount != 0)
+  {
+    orxANIM_EVENT_PAYLOAD stPayload;
+
+    /* Inits event payload */
+    orxMemory_Zero(&stPayload, sizeof(orxANIM_EVENT_PAYLOAD));
+    stPayload.stUpdateBatch.au64GUIDList  = sstAnimPointer.au64UpdateBatch;
+    stPayload.stUpdateBatch.u32Count      = sstAnimPointer.u32UpdateBatchCount;
+
+    /* Clears count */
+    sstAnimPointer.u32UpdateBatchCount = 0;
+
+    /* Sends it */
+    orxEVENT_SEND(orxEVENT_TYPE_ANIM, orxANIM_EVENT_UPDATE_BATCH, orxNULL, orxNULL, &stPayload);
+  }
+
+  /* Done! */
+  return;
+}
+
 /** Sends custom events from an animation between two timestamps
  * @param[in]   _pstAnim        Concerned animation
  * @param[in]   _pstOwner       Event's owner
@@ -159,23 +237,27 @@ static orxINLINE void orxAnimPointer_SendCustomEvents(orxANIM *_pstAnim, const o
   orxSTRUCTURE_ASSERT(_pstOwner);
   orxASSERT(_fEndTime >= _fStartTime);
 
-  /* Inits event payload */
-  orxMemory_Zero(&stPayload, sizeof(orxANIM_EVENT_PAYLOAD));
-  stPayload.pstAnim   = _pstAnim;
-  stPayload.zAnimName = orxAnim_GetName(_pstAnim);
-
-  /* For all events to send */
-  for(pstCustomEvent = orxAnim_GetNextEvent(_pstAnim, _fStartTime);
-      (pstCustomEvent != orxNULL) && (pstCustomEvent->fTimeStamp <= _fEndTime);
-      pstCustomEvent = orxAnim_GetNextEvent(_pstAnim, pstCustomEvent->fTimeStamp))
+  /* Is anyone listening? */
+  if(orxEvent_HasHandler(orxEVENT_TYPE_ANIM, orxANIM_EVENT_CUSTOM_EVENT) != orxFALSE)
   {
-    /* Updates event payload */
-    stPayload.stCustom.zName  = pstCustomEvent->zName;
-    stPayload.stCustom.fValue = pstCustomEvent->fValue;
-    stPayload.stCustom.fTime  = pstCustomEvent->fTimeStamp;
+    /* Inits event payload */
+    orxMemory_Zero(&stPayload, sizeof(orxANIM_EVENT_PAYLOAD));
+    stPayload.pstAnim   = _pstAnim;
+    stPayload.zAnimName = orxAnim_GetName(_pstAnim);
+
+    /* For all events to send */
+    for(pstCustomEvent = orxAnim_GetNextEvent(_pstAnim, _fStartTime);
+        (pstCustomEvent != orxNULL) && (pstCustomEvent->fTimeStamp <= _fEndTime);
+        pstCustomEvent = orxAnim_GetNextEvent(_pstAnim, pstCustomEvent->fTimeStamp))
+    {
+      /* Updates event payload */
+      stPayload.stCustom.zName  = pstCustomEvent->zName;
+      stPayload.stCustom.fValue = pstCustomEvent->fValue;
+      stPayload.stCustom.fTime  = pstCustomEvent->fTimeStamp;
 
-    /* Sends event */
-    orxEVENT_SEND(orxEVENT_TYPE_ANIM, orxANIM_EVENT_CUSTOM_EVENT, _pstOwner, _pstOwner, &stPayload);
+      /* Sends event */
+      orxEVENT_SEND(orxEVENT_TYPE_ANIM, orxANIM_EVENT_CUSTOM_EVENT, _pstOwner, _pstOwner, &stPayload);
+    }
   }
 }
 
@@ -201,7 +283,7 @@ static orxINLINE orxSTATUS orxAnimPointer_Compute(orxANIMPOINTER *_pstAnimPointe
     u32BackupTargetAnim = _pstAnimPointer->u32TargetAnim;
 
     /* Sets its initial animation */
-    orxAnimPointer_SetCurrentAnim(_pstAnimPointer, 0);
+    orxAnimPointer_SetCurrentAnim(_pstAnimPointer, orxAnimSet_GetStartAnimID(_pstAnimPointer->pstAnimSet));
 
     /* Restores target anim */
     _pstAnimPointer->u32TargetAnim = u32BackupTargetAnim;
@@ -241,7 +323,15 @@ static orxINLINE orxSTATUS orxAnimPointer_Compute(orxANIMPOINTER *_pstAnimPointe
         fTimeBackup = _pstAnimPointer->fCurrentAnimTime;
 
         /* Computes & updates anim*/
-        u32NewAnim = orxAnimSet_ComputeAnim(_pstAnimPointer->pstAnimSet, _pstAnimPointer->u32CurrentAnim, _pstAnimPointer->u32TargetAnim, &(_pstAnimPointer->fCurrentAnimTime), _pstAnimPointer->pstLinkTable, &bCut, &bClearTarget);
+        u32NewAnim = orxAnimSet_ComputeAnim(_pstAnimPointer->pstAnimSet, _pstAnimPointer->u32CurrentAnim, _pstAnimPointer->u32TargetAnim, &(_pstAnimPointer->fCurrentAnimTime), &(_pstAnimPointer->pstLinkTable), &bCut, &bClearTarget);
+
+        /* Got a local copy of the link table? */
+        if((_pstAnimPointer->pstLinkTable != orxNULL)
+        && (orxStructure_TestFlags(_pstAnimPointer, orxANIMPOINTER_KU32_FLAG_LINK_TABLE) == orxFALSE))
+        {
+          /* Updates flags */
+          orxStructure_SetFlags(_pstAnimPointer, orxANIMPOINTER_KU32_FLAG_LINK_TABLE, orxANIMPOINTER_KU32_FLAG_NONE);
+        }
 
         /* Inits event payload */
         orxMemory_Zero(&stPayload, sizeof(orxANIM_EVENT_PAYLOAD));
@@ -365,11 +455,16 @@ static orxINLINE orxSTATUS orxAnimPointer_Compute(orxANIMPOINTER *_pstAnimPointe
             /* Updates loop count */
             _pstAnimPointer->u32LoopCount++;
 
-            /* Updates payload */
-            stPayload.stLoop.u32Count = _pstAnimPointer->u32LoopCount;
+            /* Should send loop event? */
+            if((orxStructure_TestFlags(_pstAnimPointer->pstAnimSet, orxANIMSET_KU32_FLAG_NO_LOOP_EVENT) == orxFALSE)
+            && (orxEvent_HasHandler(orxEVENT_TYPE_ANIM, orxANIM_EVENT_LOOP) != orxFALSE))
+            {
+              /* Updates payload */
+              stPayload.stLoop.u32Count = _pstAnimPointer->u32LoopCount;
 
-            /* Sends it */
-            orxEVENT_SEND(orxEVENT_TYPE_ANIM, orxANIM_EVENT_LOOP, pstOwner, pstOwner, &stPayload);
+              /* Sends it */
+              orxEVENT_SEND(orxEVENT_TYPE_ANIM, orxANIM_EVENT_LOOP, pstOwner, pstOwner, &stPayload);
+            }
 
             /* Not modified during event? */
             if((_pstAnimPointer->u32CurrentAnim == u32CurrentAnim)
@@ -420,13 +515,27 @@ static orxINLINE orxSTATUS orxAnimPointer_Compute(orxANIMPOINTER *_pstAnimPointe
           /* Stores it */
           _pstAnimPointer->u32CurrentKey = u32CurrentKey;
 
-          /* Inits event payload */
-          orxMemory_Zero(&stPayload, sizeof(orxANIM_EVENT_PAYLOAD));
-          stPayload.pstAnim   = pstAnim;
-          stPayload.zAnimName = orxAnim_GetName(pstAnim);
+          /* Should send update event? */
+          if((orxStructure_TestFlags(_pstAnimPointer->pstAnimSet, orxANIMSET_KU32_FLAG_NO_UPDATE_EVENT) == orxFALSE)
+          && (orxEvent_HasHandler(orxEVENT_TYPE_ANIM, orxANIM_EVENT_UPDATE) != orxFALSE))
+          {
+            /* Inits event payload */
+            orxMemory_Zero(&stPayload, sizeof(orxANIM_EVENT_PAYLOAD));
+            stPayload.pstAnim   = pstAnim;
+            stPayload.zAnimName = orxAnim_GetName(pstAnim);
+
+            /* Sends it */
+            orxEVENT_SEND(orxEVENT_TYPE_ANIM, orxANIM_EVENT_UPDATE, pstOwner, pstOwner, &stPayload);
+          }
 
-          /* Sends it */
-          orxEVENT_SEND(orxEVENT_TYPE_ANIM, orxANIM_EVENT_UPDATE, pstOwner, pstOwner, &stPayload);
+          /* Should aggregate it? */
+          if((pstOwner != orxNULL)
+          && (orxFLAG_TEST(sstAnimPointer.u32Flags, orxANIMPOINTER_KU32_STATIC_FLAG_UPDATE_BATCH))
+          && (orxEvent_HasHandler(orxEVENT_TYPE_ANIM, orxANIM_EVENT_UPDATE_BATCH) != orxFALSE))
+          {
+            /* Adds it to the update batch */
+            orxAnimPointer_AddToUpdateBatch(pstOwner);
+          }
         }
 
         /* Has current time not been modified during event? */
@@ -513,6 +622,22 @@ orxSTATUS orxFASTCALL orxAnimPointer_Init()
 
     /* Registers structure type */
     eResult = orxSTRUCTURE_REGISTER(ANIMPOINTER, orxSTRUCTURE_STORAGE_TYPE_LINKLIST, orxMEMORY_TYPE_MAIN, orxANIMPOINTER_KU32_BANK_SIZE, &orxAnimPointer_Update);
+
+    /* Success? */
+    if(eResult != orxSTATUS_FAILURE)
+    {
+      /* Registers update batch sending on core clock */
+      if(orxClock_Register(orxClock_FindFirst(orx2F(-1.0f), orxCLOCK_TYPE_CORE), orxAnimPointer_SendUpdateBatch, orxNULL, orxMODULE_ID_ANIMPOINTER, orxCLOCK_PRIORITY_LOWER) != orxSTATUS_FAILURE)
+      {
+        /* Updates flags */
+        sstAnimPointer.u32Flags = orxANIMPOINTER_KU32_STATIC_FLAG_UPDATE_BATCH;
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_ANIM, "Couldn't register update batch callback, update batch events won't be sent.");
+      }
+    }
   }
   else
   {
@@ -527,7 +652,7 @@ orxSTATUS orxFASTCALL orxAnimPointer_Init()
   if(eResult != orxSTATUS_FAILURE)
   {
     /* Inits Flags */
-    sstAnimPointer.u32Flags = orxANIMPOINTER_KU32_STATIC_FLAG_READY;
+    orxFLAG_SET(sstAnimPointer.u32Flags, orxANIMPOINTER_KU32_STATIC_FLAG_READY, orxANIMPOINTER_KU32_STATIC_FLAG_NONE);
   }
   else
   {
@@ -552,8 +677,22 @@ void orxFASTCALL orxAnimPointer_Exit()
     /* Unregisters structure type */
     orxStructure_Unregister(orxSTRUCTURE_ID_ANIMPOINTER);
 
+    /* Has update batch? */
+    if(orxFLAG_TEST(sstAnimPointer.u32Flags, orxANIMPOINTER_KU32_STATIC_FLAG_UPDATE_BATCH))
+    {
+      /* Unregisters update batch sending */
+      orxClock_Unregister(orxClock_FindFirst(orx2F(-1.0f), orxCLOCK_TYPE_CORE), orxAnimPointer_SendUpdateBatch);
+    }
+
+    /* Deletes update batch */
+    if(sstAnimPointer.au64UpdateBatch != orxNULL)
+    {
+      orxMemory_Free(sstAnimPointer.au64UpdateBatch);
+      sstAnimPointer.au64UpdateBatch = orxNULL;
+    }
+
     /* Updates flags */
-    sstAnimPointer.u32Flags &= ~orxANIMPOINTER_KU32_STATIC_FLAG_READY;
+    sstAnimPointer.u32Flags &= ~(orxANIMPOINTER_KU32_STATIC_FLAG_READY | orxANIMPOINTER_KU32_STATIC_FLAG_UPDATE_BATCH);
 
   }
 
@@ -596,15 +735,8 @@ orxANIMPOINTER *orxFASTCALL orxAnimPointer_Create(orxANIMSET *_pstAnimSet)
     pstAnimPointer->u32CurrentKey     = 0;
     pstAnimPointer->u32LoopCount      = 0;
 
-    /* Is animset link table non-static? */
-    if(orxStructure_TestFlags(_pstAnimSet, orxANIMSET_KU32_FLAG_LINK_STATIC) == orxFALSE)
-    {
-      /* Stores link table */
-      pstAnimPointer->pstLinkTable = orxAnimSet_CloneLinkTable(_pstAnimSet);
-
-      /* Updates flags */
-      orxStructure_SetFlags(pstAnimPointer, orxANIMPOINTER_KU32_FLAG_LINK_TABLE, orxANIMPOINTER_KU32_FLAG_NONE);
-    }
+    /* Shares animset link table until a local copy is needed */
+    pstAnimPointer->pstLinkTable      = orxNULL;
 
     /* Increases count */
     orxStructure_IncreaseCount(pstAnimPointer);
@@ -792,7 +924,7 @@ orxU32 orxFASTCALL orxAnimPointer_GetCurrentAnim(const orxANIMPOINTER *_pstAnimP
     if(!orxStructure_TestFlags(_pstAnimPointer, orxANIMPOINTER_KU32_FLAG_INIT))
     {
       /* Sets its initial animation */
-      orxAnimPointer_SetCurrentAnim((orxANIMPOINTER *)_pstAnimPointer, 0);
+      orxAnimPointer_SetCurrentAnim((orxANIMPOINTER *)_pstAnimPointer, orxAnimSet_GetStartAnimID(_pstAnimPointer->pstAnimSet));
     }
 
     u32Anim = _pstAnimPointer->u32CurrentAnim;
@@ -122,6 +122,7 @@
 
 #define orxANIMSET_KU32_LINK_TABLE_FLAG_READY         0x01000000  /**< Link table flag ready */
 #define orxANIMSET_KU32_LINK_TABLE_FLAG_DIRTY         0x02000000  /**< Link table flag dirty */
+#define orxANIMSET_KU32_LINK_TABLE_FLAG_REBUILD       0x04000000  /**< Link table flag rebuild (paths have to be cleaned before being computed again) */
 
 #define orxANIMSET_KU32_LINK_TABLE_MASK_FLAGS         0xFFFF0000  /**< Link table mask flags */
 
@@ -135,6 +136,8 @@
 #define orxANIMSET_KZ_CONFIG_LINK_PROPERTY            "Property"
 #define orxANIMSET_KZ_CONFIG_LINK_PRIORITY            "Priority"
 #define orxANIMSET_KZ_CONFIG_KEEP_IN_CACHE            "KeepInCache"
+#define orxANIMSET_KZ_CONFIG_UPDATE_EVENT             "UpdateEvent"
+#define orxANIMSET_KZ_CONFIG_LOOP_EVENT               "LoopEvent"
 
 #define orxANIMSET_KZ_CONFIG_START_ANIM               "StartAnim"
 #define orxANIMSET_KZ_CONFIG_START_ANIM_LIST          "StartAnimList"
@@ -215,6 +218,7 @@ struct __orxANIMSET_t
   orxANIMSET_LINK_TABLE  *pstLinkTable;               /**< Link table pointer : 24 */
   orxHASHTABLE           *pstIDTable;                 /**< ID hash table : 28 */
   const orxSTRING         zReference;                 /**< Reference : 32 */
+  orxU32                  u32StartAnim;               /**< Start animation ID : 36 */
 };
 
 /** Frame info structure
@@ -416,11 +420,12 @@ static orxINLINE orxSTATUS orxAnimSet_SetLinkTableLinkProperty(orxANIMSET_LINK_T
       }
     }
 
-    /* Valid? */
-    if(eResult != orxSTATUS_FAILURE)
+    /* Valid and routing changed? */
+    if((eResult != orxSTATUS_FAILURE)
+    && ((_u32Property & orxANIMSET_KU32_LINK_MASK_FLAGS) == orxANIMSET_KU32_LINK_FLAG_PRIORITY))
     {
-      /* Animset has to be computed again */
-      orxAnimSet_SetLinkTableFlag(_pstLinkTable, orxANIMSET_KU32_LINK_TABLE_FLAG_DIRTY, orxANIMSET_KU32_LINK_TABLE_FLAG_NONE);
+      /* Animset has to be fully computed again */
+      orxAnimSet_SetLinkTableFlag(_pstLinkTable, orxANIMSET_KU32_LINK_TABLE_FLAG_DIRTY | orxANIMSET_KU32_LINK_TABLE_FLAG_REBUILD, orxANIMSET_KU32_LINK_TABLE_FLAG_NONE);
     }
   }
   else
@@ -913,7 +918,7 @@ static void orxFASTCALL orxAnimSet_CleanLinkTable(orxANIMSET_LINK_TABLE *_pstLin
   }
 
   /* Updates flags */
-  orxAnimSet_SetLinkTableFlag(_pstLinkTable, orxANIMSET_KU32_LINK_TABLE_FLAG_DIRTY, orxANIMSET_KU32_LINK_TABLE_FLAG_NONE);
+  orxAnimSet_SetLinkTableFlag(_pstLinkTable, orxANIMSET_KU32_LINK_TABLE_FLAG_DIRTY | orxANIMSET_KU32_LINK_TABLE_FLAG_REBUILD, orxANIMSET_KU32_LINK_TABLE_FLAG_NONE);
 
   return;
 }
@@ -964,7 +969,7 @@ static orxANIMSET_LINK_TABLE *orxFASTCALL orxAnimSet_CreateLinkTable(orxU32 _u32
         pstLinkTable->u16LinkCount    = 0;
 
         /* Inits flags */
-        orxAnimSet_SetLinkTableFlag(pstLinkTable, orxANIMSET_KU32_LINK_TABLE_FLAG_READY | orxANIMSET_KU32_LINK_TABLE_FLAG_DIRTY, orxANIMSET_KU32_LINK_TABLE_MASK_FLAGS);
+        orxAnimSet_SetLinkTableFlag(pstLinkTable, orxANIMSET_KU32_LINK_TABLE_FLAG_READY | orxANIMSET_KU32_LINK_TABLE_FLAG_DIRTY | orxANIMSET_KU32_LINK_TABLE_FLAG_REBUILD, orxANIMSET_KU32_LINK_TABLE_MASK_FLAGS);
       }
       else
       {
@@ -1221,18 +1226,62 @@ static orxU32 orxFASTCALL orxAnimSet_ComputeNextAnim(orxANIMSET_LINK_TABLE *_pst
       /* Is loop count used? */
       if(u32Loop != orxU32_UNDEFINED)
       {
-        /* Updates loop count */
+        /* Updates loop count (paths don't depend on loop counts, no need to compute the link table again) */
         orxAnimSet_SetLinkTableLinkProperty(_pstLinkTable, u32LinkIndex, orxANIMSET_KU32_LINK_FLAG_LOOP_COUNT, u32Loop - 1);
+      }
+    }
+  }
 
-        /* Is link table dirty again? */
-        if(u32Loop <= 1)
-        {
-          /* Updates flags */
-          orxAnimSet_SetLinkTableFlag(_pstLinkTable, orxANIMSET_KU32_LINK_TABLE_FLAG_DIRTY, orxANIMSET_KU32_LINK_TABLE_FLAG_NONE);
-        }
+  /* Done! */
+  return u32Result;
+}
+
+/** Computes next Animation for an AnimSet, duplicating its shared LinkTable on first write (copy-on-write)
+ * @param[in]   _pstAnimSet                   Concerned AnimSet
+ * @param[in,out] _ppstWorkTable              Current work LinkTable, updated if a local copy had to be made
+ * @param[in,out] _ppstLinkTable              Local LinkTable storage, orxNULL as long as the shared one is used
+ * @param[in]   _u32SrcAnim                   Source Anim index
+ * @param[in]   _u32DstAnim                   Destination Anim index / orxU32_UNDEFINED
+ * @return      Next Anim index / orxU32_UNDEFINED
+ */
+static orxU32 orxFASTCALL orxAnimSet_ConsumeNextAnim(const orxANIMSET *_pstAnimSet, orxANIMSET_LINK_TABLE **_ppstWorkTable, orxANIMSET_LINK_TABLE **_ppstLinkTable, orxU32 _u32SrcAnim, orxU32 _u32DstAnim)
+{
+  orxU32 u32Result;
+
+  /* Checks */
+  orxASSERT(_ppstWorkTable != orxNULL);
+  orxASSERT(*_ppstWorkTable != orxNULL);
+
+  /* Is using the shared link table? */
+  if(*_ppstWorkTable == _pstAnimSet->pstLinkTable)
+  {
+    /* Gets next animation in simulation mode */
+    u32Result = orxAnimSet_ComputeNextAnim(*_ppstWorkTable, _u32SrcAnim, _u32DstAnim, orxTRUE);
+
+    /* Found and will its link loop count get updated? */
+    if((u32Result != orxU32_UNDEFINED)
+    && (_ppstLinkTable != orxNULL)
+    && (orxAnimSet_GetLinkTableLinkProperty(*_ppstWorkTable, ((orxU32)((*_ppstWorkTable)->u16TableSize) * _u32SrcAnim) + u32Result, orxANIMSET_KU32_LINK_FLAG_LOOP_COUNT) != orxU32_UNDEFINED))
+    {
+      /* Creates local copy */
+      *_ppstLinkTable = orxAnimSet_CloneLinkTable(_pstAnimSet);
+
+      /* Success? */
+      if(*_ppstLinkTable != orxNULL)
+      {
+        /* Uses it from now on */
+        *_ppstWorkTable = *_ppstLinkTable;
+
+        /* Updates its link status */
+        orxAnimSet_ComputeNextAnim(*_ppstWorkTable, _u32SrcAnim, _u32DstAnim, orxFALSE);
       }
     }
   }
+  else
+  {
+    /* Gets next animation, updating link status */
+    u32Result = orxAnimSet_ComputeNextAnim(*_ppstWorkTable, _u32SrcAnim, _u32DstAnim, orxFALSE);
+  }
 
   /* Done! */
   return u32Result;
@@ -1261,18 +1310,23 @@ static orxSTATUS orxFASTCALL orxAnimSet_ComputeLinkTable(orxANIMSET_LINK_TABLE *
       orxLINK_UPDATE_INFO  *pstUpdateInfo;
       orxU32                u32Size, i;
 
-      /* Gets storage size */
-      u32Size = (orxU32)(_pstLinkTable->u16TableSize * _pstLinkTable->u16TableSize);
-
-      /* Cleans link table */
-      for(i = 0; i < u32Size; i++)
+      /* Needs a full rebuild? */
+      if(orxAnimSet_TestLinkTableFlag(_pstLinkTable, orxANIMSET_KU32_LINK_TABLE_FLAG_REBUILD) != orxFALSE)
       {
-        /* No link found? */
-        if(!(_pstLinkTable->au32LinkArray[i] & orxANIMSET_KU32_LINK_FLAG_LINK))
+        /* Gets storage size */
+        u32Size = (orxU32)(_pstLinkTable->u16TableSize * _pstLinkTable->u16TableSize);
+
+        /* Cleans link table */
+        for(i = 0; i < u32Size; i++)
         {
-          _pstLinkTable->au32LinkArray[i] = orxANIMSET_KU32_LINK_DEFAULT_NONE;
+          /* No link found? */
+          if(!(_pstLinkTable->au32LinkArray[i] & orxANIMSET_KU32_LINK_FLAG_LINK))
+          {
+            _pstLinkTable->au32LinkArray[i] = orxANIMSET_KU32_LINK_DEFAULT_NONE;
+          }
         }
       }
+      /* Otherwise links have only been added since last computation: existing paths are still valid and will only be improved upon */
 
       /* Creates a link update info */
       pstUpdateInfo = orxAnimSet_CreateLinkUpdateInfo(_pstLinkTable);
@@ -1297,7 +1351,7 @@ static orxSTATUS orxFASTCALL orxAnimSet_ComputeLinkTable(orxANIMSET_LINK_TABLE *
         }
 
         /* Updates flags */
-        orxAnimSet_SetLinkTableFlag(_pstLinkTable, orxANIMSET_KU32_LINK_TABLE_FLAG_NONE, orxANIMSET_KU32_LINK_TABLE_FLAG_DIRTY);
+        orxAnimSet_SetLinkTableFlag(_pstLinkTable, orxANIMSET_KU32_LINK_TABLE_FLAG_NONE, orxANIMSET_KU32_LINK_TABLE_FLAG_DIRTY | orxANIMSET_KU32_LINK_TABLE_FLAG_REBUILD);
 
         /* Deletes the link update info */
         orxAnimSet_DeleteLinkUpdateInfo(pstUpdateInfo);
@@ -2254,6 +2308,9 @@ static orxANIMSET *orxFASTCALL orxAnimSet_CreateSimpleFromConfig(const orxSTRING
 
         /* Adds it to ID table */
         orxHashTable_Add(pstResult->pstIDTable, orxString_ToCRC(zStartAnim), (void *) orxANIMSET_CAST_HELPER (u32AnimID + 1));
+
+        /* Stores it as start anim */
+        pstResult->u32StartAnim = u32AnimID;
       }
 
       /* For all animations */
@@ -2599,6 +2656,9 @@ orxANIMSET *orxFASTCALL orxAnimSet_Create(orxU32 _u32Size)
       orxAnimSet_SetAnimStorageSize(pstAnimSet, _u32Size);
       orxAnimSet_SetAnimCount(pstAnimSet, 0);
 
+      /* Starts with the first added animation by default */
+      pstAnimSet->u32StartAnim = 0;
+
       /* Creates link table */
       pstAnimSet->pstLinkTable = orxAnimSet_CreateLinkTable(_u32Size);
 
@@ -2606,7 +2666,7 @@ orxANIMSET *orxFASTCALL orxAnimSet_Create(orxU32 _u32Size)
       if(pstAnimSet->pstLinkTable != orxNULL)
       {
         /* Updates flags */
-        orxAnimSet_SetLinkTableFlag(pstAnimSet->pstLinkTable, orxANIMSET_KU32_LINK_TABLE_FLAG_READY | orxANIMSET_KU32_LINK_TABLE_FLAG_DIRTY, orxANIMSET_KU32_LINK_TABLE_FLAG_NONE);
+        orxAnimSet_SetLinkTableFlag(pstAnimSet->pstLinkTable, orxANIMSET_KU32_LINK_TABLE_FLAG_READY | orxANIMSET_KU32_LINK_TABLE_FLAG_DIRTY | orxANIMSET_KU32_LINK_TABLE_FLAG_REBUILD, orxANIMSET_KU32_LINK_TABLE_FLAG_NONE);
 
         /* Inits flags */
         orxStructure_SetFlags(pstAnimSet, orxANIMSET_KU32_FLAG_LINK_STATIC, orxANIMSET_KU32_MASK_FLAGS);
@@ -2700,6 +2760,22 @@ orxANIMSET *orxFASTCALL orxAnimSet_CreateFromConfig(const orxSTRING _zConfigID)
           /* Updates its flags */
           orxStructure_SetFlags(pstResult, orxANIMSET_KU32_FLAG_CACHED, orxANIMSET_KU32_FLAG_NONE);
         }
+
+        /* Shouldn't send update events? */
+        if((orxConfig_HasValue(orxANIMSET_KZ_CONFIG_UPDATE_EVENT) != orxFALSE)
+        && (orxConfig_GetBool(orxANIMSET_KZ_CONFIG_UPDATE_EVENT) == orxFALSE))
+        {
+          /* Updates its flags */
+          orxStructure_SetFlags(pstResult, orxANIMSET_KU32_FLAG_NO_UPDATE_EVENT, orxANIMSET_KU32_FLAG_NONE);
+        }
+
+        /* Shouldn't send loop events? */
+        if((orxConfig_HasValue(orxANIMSET_KZ_CONFIG_LOOP_EVENT) != orxFALSE)
+        && (orxConfig_GetBool(orxANIMSET_KZ_CONFIG_LOOP_EVENT) == orxFALSE))
+        {
+          /* Updates its flags */
+          orxStructure_SetFlags(pstResult, orxANIMSET_KU32_FLAG_NO_LOOP_EVENT, orxANIMSET_KU32_FLAG_NONE);
+        }
       }
 
       /* Pops config section */
@@ -3194,8 +3270,8 @@ orxSTATUS orxFASTCALL orxAnimSet_RemoveLink(orxANIMSET *_pstAnimSet, orxU32 _u32
       orxAnimSet_SetLinkTableLink(pstLinkTable, _u32LinkID, orxANIMSET_KU32_LINK_DEFAULT_NONE);
       orxAnimSet_SetLinkTableLinkProperty(pstLinkTable, _u32LinkID, orxANIMSET_KU32_LINK_FLAG_PRIORITY, orxU32_UNDEFINED);
 
-      /* Animset has to be computed again */
-      orxAnimSet_SetLinkTableFlag(pstLinkTable, orxANIMSET_KU32_LINK_TABLE_FLAG_DIRTY, orxANIMSET_KU32_LINK_TABLE_FLAG_NONE);
+      /* Animset has to be fully computed again */
+      orxAnimSet_SetLinkTableFlag(pstLinkTable, orxANIMSET_KU32_LINK_TABLE_FLAG_DIRTY | orxANIMSET_KU32_LINK_TABLE_FLAG_REBUILD, orxANIMSET_KU32_LINK_TABLE_FLAG_NONE);
 
       /* Updates result */
       eResult = orxSTATUS_SUCCESS;
@@ -3295,7 +3371,7 @@ orxSTATUS orxFASTCALL orxAnimSet_SetLinkProperty(orxANIMSET *_pstAnimSet, orxU32
       /* Added loop count? */
       if(_u32Property == orxANIMSET_KU32_LINK_FLAG_LOOP_COUNT)
       {
-        /* Link table should be locally stored by animation pointers now */
+        /* Animation pointers will now get their own copy of the link table upon consuming a loop */
         orxStructure_SetFlags(_pstAnimSet, orxANIMSET_KU32_FLAG_NONE, orxANIMSET_KU32_FLAG_LINK_STATIC);
       }
     }
@@ -3331,12 +3407,12 @@ orxU32 orxFASTCALL orxAnimSet_GetLinkProperty(const orxANIMSET *_pstAnimSet, orx
  * @param[in]   _u32SrcAnim                         Source (current) Anim ID
  * @param[in]   _u32DstAnim                         Destination Anim ID, if none (auto mode) set it to orxU32_UNDEFINED
  * @param[in,out] _pfTime                           Pointer to the current timestamp relative to the source Anim (time elapsed since the beginning of this anim)
- * @param[in,out] _pstLinkTable                     Anim Pointer link table (updated if AnimSet link table isn't static, when using loop counts for example)
+ * @param[in,out] _ppstLinkTable                    Anim Pointer link table storage (orxNULL content while sharing the AnimSet one, a local copy is created when a loop count has to be updated), orxNULL to always use the shared one
  * @param[out] _pbCut                               Animation has been cut
  * @param[out] _pbClearTarget                       Animation has requested a target clearing
  * @return Current Anim ID. If it's not the source one, _pu32Time will contain the new timestamp, relative to the new Anim
 */
-orxU32 orxFASTCALL orxAnimSet_ComputeAnim(orxANIMSET *_pstAnimSet, orxU32 _u32SrcAnim, orxU32 _u32DstAnim, orxFLOAT *_pfTime, orxANIMSET_LINK_TABLE *_pstLinkTable, orxBOOL *_pbCut, orxBOOL *_pbClearTarget)
+orxU32 orxFASTCALL orxAnimSet_ComputeAnim(orxANIMSET *_pstAnimSet, orxU32 _u32SrcAnim, orxU32 _u32DstAnim, orxFLOAT *_pfTime, orxANIMSET_LINK_TABLE **_ppstLinkTable, orxBOOL *_pbCut, orxBOOL *_pbClearTarget)
 {
   orxANIMSET_LINK_TABLE  *pstWorkTable;
   orxU32                  u32Result = _u32SrcAnim;
@@ -3350,15 +3426,17 @@ orxU32 orxFASTCALL orxAnimSet_ComputeAnim(orxANIMSET *_pstAnimSet, orxU32 _u32Sr
   orxASSERT(_u32SrcAnim < orxAnimSet_GetAnimCount(_pstAnimSet));
   orxASSERT((_u32DstAnim < orxAnimSet_GetAnimCount(_pstAnimSet)) || (_u32DstAnim == orxU32_UNDEFINED));
 
-  /* Gets Link Table */
-  if(orxStructure_TestFlags(_pstAnimSet, orxANIMSET_KU32_FLAG_LINK_STATIC) == orxFALSE)
+  /* Has a local link table? */
+  if((_ppstLinkTable != orxNULL)
+  && (*_ppstLinkTable != orxNULL)
+  && (orxStructure_TestFlags(_pstAnimSet, orxANIMSET_KU32_FLAG_LINK_STATIC) == orxFALSE))
   {
-    /* Use animation pointer local one */
-    pstWorkTable = _pstLinkTable;
+    /* Uses animation pointer local one */
+    pstWorkTable = *_ppstLinkTable;
   }
   else
   {
-    /* Uses common static one */
+    /* Uses common shared one */
     pstWorkTable = _pstAnimSet->pstLinkTable;
   }
 
@@ -3396,7 +3474,7 @@ orxU32 orxFASTCALL orxAnimSet_ComputeAnim(orxANIMSET *_pstAnimSet, orxU32 _u32Sr
     if(*_pbCut != orxFALSE)
     {
       /* Get next animation according to destination aim */
-      u32TargetAnim = orxAnimSet_ComputeNextAnim(pstWorkTable, u32Anim, _u32DstAnim, orxFALSE);
+      u32TargetAnim = orxAnimSet_ConsumeNextAnim(_pstAnimSet, &pstWorkTable, _ppstLinkTable, u32Anim, _u32DstAnim);
 
       /* Resets time stamp */
       *_pfTime = orxFLOAT_0;
@@ -3427,7 +3505,7 @@ orxU32 orxFASTCALL orxAnimSet_ComputeAnim(orxANIMSET *_pstAnimSet, orxU32 _u32Sr
       if((fLength == orxFLOAT_0) || (*_pfTime > fLength))
       {
         /* Get next animation */
-        u32TargetAnim = orxAnimSet_ComputeNextAnim(pstWorkTable, u32Anim, _u32DstAnim, orxFALSE);
+        u32TargetAnim = orxAnimSet_ConsumeNextAnim(_pstAnimSet, &pstWorkTable, _ppstLinkTable, u32Anim, _u32DstAnim);
 
         /* Updates timestamp */
         *_pfTime -= fLength;
@@ -3553,6 +3631,20 @@ orxU32 orxFASTCALL orxAnimSet_GetAnimCount(const orxANIMSET *_pstAnimSet)
   return(orxStructure_GetFlags(_pstAnimSet, orxANIMSET_KU32_MASK_COUNT) >> orxANIMSET_KU32_ID_SHIFT_COUNT);
 }
 
+/** AnimSet start Anim ID get accessor
+ * @param[in]   _pstAnimSet                         Concerned AnimSet
+ * @return      Start Anim ID (StartAnim / first of StartAnimList when created from config, first added Anim otherwise)
+ */
+orxU32 orxFASTCALL orxAnimSet_GetStartAnimID(const orxANIMSET *_pstAnimSet)
+{
+  /* Checks */
+  orxASSERT(sstAnimSet.u32Flags & orxANIMSET_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstAnimSet);
+
+  /* Done! */
+  return _pstAnimSet->u32StartAnim;
+}
+
 /** Gets animation ID from name
  * @param[in]   _pstAnimSet                         Concerned AnimSet
  * @param[in]   _zAnimName                          Animation name (config's section)
@@ -49,6 +49,7 @@
 #define orxCLOCK_KU32_STATIC_FLAG_NONE          0x00000000  /**< No flags */
 
 #define orxCLOCK_KU32_STATIC_FLAG_READY         0x00000001  /**< Ready flag */
+#define orxCLOCK_KU32_STATIC_FLAG_FRAME_PACING  0x00000002  /**< Frame pacing flag */
 
 #define orxCLOCK_KU32_STATIC_FLAG_UPDATE_LOCK   0x10000000  /**< Lock update flag */
 
@@ -70,6 +71,9 @@
  */
 #define orxCLOCK_KZ_CONFIG_SECTION              "Clock"
 #define orxCLOCK_KZ_CONFIG_MAIN_CLOCK_FREQUENCY "MainClockFrequency"
+#define orxCLOCK_KZ_CONFIG_FRAME_PACING         "FramePacing"
+#define orxCLOCK_KZ_CONFIG_FIXED_DT             "FixedDT"
+#define orxCLOCK_KZ_CONFIG_RANDOM_SEED          "RandomSeed"
 #define orxCLOCK_KZ_CONFIG_FREQUENCY            "Frequency"
 #define orxCLOCK_KZ_CONFIG_MODIFIER_TYPE        "ModifierType"
 #define orxCLOCK_KZ_CONFIG_MODIFIER_VALUE       "ModifierValue"
@@ -82,8 +86,15 @@
 
 #define orxCLOCK_KU32_BANK_SIZE                 8           /**< Bank size */
 
+#define orxCLOCK_KU32_DEFAULT_RANDOM_SEED       0x2545F491  /**< Used instead of a null random seed */
+
 #define orxCLOCK_KF_DELAY_ADJUSTMENT            orx2F(-0.001f)
 
+#define orxCLOCK_KF_PACING_SPIN_MIN             orx2F(0.0002f)  /**< Minimum spin duration before a frame pacing deadline */
+#define orxCLOCK_KF_PACING_SPIN_MAX             orx2F(0.002f)   /**< Maximum spin duration before a frame pacing deadline */
+#define orxCLOCK_KF_PACING_SPIN_DECAY           orx2F(0.05f)    /**< Spin duration calibration decay */
+#define orxCLOCK_KF_PACING_TOLERANCE            orx2F(0.0005f)  /**< Tick tolerance when frame pacing */
+
 
 /***************************************************************************
  * Structure declaration                                                   *
@@ -133,10 +144,12 @@ typedef struct __orxCLOCK_STATIC_t
   orxBANK          *pstTimerBank;               /**< Timer bank : 4 */
   orxCLOCK_MOD_TYPE eModType;                   /**< Clock mod type : 8 */
   orxDOUBLE         dTime;                      /**< Current time : 16 */
-  orxFLOAT          fModValue;                  /**< Clock mod value : 20 */
-  orxFLOAT          fMainClockTickSize;         /**< Main clock tick size : 24 */
-  orxHASHTABLE     *pstReferenceTable;          /**< Table to avoid clock duplication when creating through config file : 28 */
-  orxU32            u32Flags;                   /**< Control flags : 32 */
+  orxDOUBLE         dFrameDeadline;             /**< Last frame pacing deadline : 24 */
+  orxFLOAT          fModValue;                  /**< Clock mod value : 28 */
+  orxFLOAT          fMainClockTickSize;         /**< Main clock tick size : 32 */
+  orxFLOAT          fSpinMargin;                /**< Frame pacing calibrated spin margin : 36 */
+  orxHASHTABLE     *pstReferenceTable;          /**< Table to avoid clock duplication when creating through config file : 40 */
+  orxU32            u32Flags;                   /**< Control flags : 44 */
 
 } orxCLOCK_STATIC;
 
@@ -286,6 +299,61 @@ static orxINLINE orxFLOAT orxClock_ComputeDT(orxFLOAT _fDT, const orxCLOCK_INFO
   return fResult;
 }
 
+/** Waits for the next frame, using absolute deadlines
+ * @param[in]   _fDelay                               Delay before next tick
+ */
+static orxINLINE void orxClock_WaitFrame(orxFLOAT _fDelay)
+{
+  orxDOUBLE dDeadline;
+
+  /* Following previous deadline closely enough? */
+  if((sstClock.dFrameDeadline > orxDOUBLE_0)
+  && (sstClock.dTime - sstClock.dFrameDeadline < orx2D(_fDelay)))
+  {
+    /* Chains from previous deadline to compensate for drift */
+    dDeadline = sstClock.dFrameDeadline + orx2D(_fDelay);
+  }
+  else
+  {
+    /* Resyncs on current frame */
+    dDeadline = sstClock.dTime + orx2D(_fDelay);
+  }
+
+  /* Ahead of deadline? */
+  if(dDeadline > orxSystem_GetTime())
+  {
+    orxDOUBLE dSleepTime;
+
+    /* Gets sleep target */
+    dSleepTime = dDeadline - orx2D(sstClock.fSpinMargin);
+
+    /* Should sleep? */
+    if(dSleepTime > orxSystem_GetTime())
+    {
+      orxFLOAT fOvershoot;
+
+      /* Sleeps */
+      orxSystem_DelayUntil(dSleepTime);
+
+      /* Gets wake up overshoot */
+      fOvershoot = orx2F(orxSystem_GetTime() - dSleepTime);
+
+      /* Calibrates spin margin: grows immediately, shrinks slowly */
+      sstClock.fSpinMargin = (fOvershoot > sstClock.fSpinMargin) ? fOvershoot : sstClock.fSpinMargin + orxCLOCK_KF_PACING_SPIN_DECAY * (fOvershoot - sstClock.fSpinMargin);
+      sstClock.fSpinMargin = orxCLAMP(sstClock.fSpinMargin, orxCLOCK_KF_PACING_SPIN_MIN, orxCLOCK_KF_PACING_SPIN_MAX);
+    }
+
+    /* Spins until deadline */
+    while(orxSystem_GetTime() < dDeadline);
+  }
+
+  /* Stores deadline */
+  sstClock.dFrameDeadline = dDeadline;
+
+  /* Done! */
+  return;
+}
+
 /** Deletes all the clocks
  */
 static orxINLINE void orxClock_DeleteAll()
@@ -499,6 +567,46 @@ orxSTATUS orxFASTCALL orxClock_Init()
           /* Gets main clock tick size */
           orxConfig_PushSection(orxCLOCK_KZ_CONFIG_SECTION);
           sstClock.fMainClockTickSize = (orxConfig_HasValue(orxCLOCK_KZ_CONFIG_MAIN_CLOCK_FREQUENCY) && orxConfig_GetFloat(orxCLOCK_KZ_CONFIG_MAIN_CLOCK_FREQUENCY) > orxFLOAT_0) ? (orxFLOAT_1 / orxConfig_GetFloat(orxCLOCK_KZ_CONFIG_MAIN_CLOCK_FREQUENCY)) : orxFLOAT_0;
+
+          /* Frame pacing? */
+          if(orxConfig_GetBool(orxCLOCK_KZ_CONFIG_FRAME_PACING) != orxFALSE)
+          {
+            /* Updates flags */
+            sstClock.u32Flags |= orxCLOCK_KU32_STATIC_FLAG_FRAME_PACING;
+
+            /* Inits spin margin */
+            sstClock.fSpinMargin = orxCLOCK_KF_PACING_SPIN_MAX;
+          }
+
+          /* Fixed DT? */
+          if(orxConfig_GetFloat(orxCLOCK_KZ_CONFIG_FIXED_DT) > orxFLOAT_0)
+          {
+            /* Uses it as global modifier: all clocks will then advance deterministically, regardless of real elapsed time */
+            sstClock.eModType   = orxCLOCK_MOD_TYPE_FIXED;
+            sstClock.fModValue  = orxConfig_GetFloat(orxCLOCK_KZ_CONFIG_FIXED_DT);
+          }
+
+          /* Has random seed? */
+          if(orxConfig_HasValue(orxCLOCK_KZ_CONFIG_RANDOM_SEED) != orxFALSE)
+          {
+            orxU32 u32Seed;
+
+            /* Gets it */
+            u32Seed = orxConfig_GetU32(orxCLOCK_KZ_CONFIG_RANDOM_SEED);
+
+            /* Null? */
+            if(u32Seed == 0)
+            {
+              /* Logs message */
+              orxDEBUG_PRINT(orxDEBUG_LEVEL_CLOCK, "[" orxCLOCK_KZ_CONFIG_SECTION "]: A null " orxCLOCK_KZ_CONFIG_RANDOM_SEED " would zero the whole random state, using <0x%08X> instead.", orxCLOCK_KU32_DEFAULT_RANDOM_SEED);
+
+              /* Uses default one */
+              u32Seed = orxCLOCK_KU32_DEFAULT_RANDOM_SEED;
+            }
+
+            /* Inits random */
+            orxMath_InitRandom(u32Seed);
+          }
           orxConfig_PopSection();
 
           /* Creates default full speed core clock */
@@ -596,7 +704,7 @@ void orxFASTCALL orxClock_Exit()
 orxSTATUS orxFASTCALL orxClock_Update()
 {
   orxDOUBLE dNewTime;
-  orxFLOAT  fDT, fDelay;
+  orxFLOAT  fDT, fDelay, fCoreTolerance;
   orxCLOCK *pstClock;
   orxSTATUS eResult = orxSTATUS_SUCCESS;
 
@@ -624,6 +732,9 @@ orxSTATUS orxFASTCALL orxClock_Update()
     /* Inits delay */
     fDelay = sstClock.fMainClockTickSize;
 
+    /* Gets core clock tick tolerance */
+    fCoreTolerance = (sstClock.u32Flags & orxCLOCK_KU32_STATIC_FLAG_FRAME_PACING) ? orxCLOCK_KF_PACING_TOLERANCE : orxFLOAT_0;
+
     /* For all clocks */
     for(pstClock = orxCLOCK(orxStructure_GetFirst(orxSTRUCTURE_ID_CLOCK));
         pstClock != orxNULL;
@@ -635,13 +746,16 @@ orxSTATUS orxFASTCALL orxClock_Update()
       /* Is clock not paused? */
       if(orxClock_IsPaused(pstClock) == orxFALSE)
       {
-        orxFLOAT fClockDelay;
+        orxFLOAT fClockDelay, fTolerance;
 
         /* Updates clock real time & partial DT */
         pstClock->fPartialDT += fDT;
 
+        /* Gets tick tolerance, only for core clock as frame pacing targets its ticks */
+        fTolerance = (pstClock->stClockInfo.eType == orxCLOCK_TYPE_CORE) ? fCoreTolerance : orxFLOAT_0;
+
         /* New tick happens? */
-        if(pstClock->fPartialDT >= pstClock->stClockInfo.fTickSize)
+        if(pstClock->fPartialDT + fTolerance >= pstClock->stClockInfo.fTickSize)
         {
           orxFLOAT                    fClockDT;
           orxCLOCK_TIMER_STORAGE     *pstTimerStorage;
@@ -731,14 +845,32 @@ orxSTATUS orxFASTCALL orxClock_Update()
     /* Unlocks clocks */
     sstClock.u32Flags &= ~orxCLOCK_KU32_STATIC_FLAG_UPDATE_LOCK;
 
-    /* Gets real remaining delay */
-    fDelay = fDelay + orxCLOCK_KF_DELAY_ADJUSTMENT - orx2F(orxSystem_GetTime() - sstClock.dTime);
-
-    /* Should delay? */
-    if(fDelay > orxFLOAT_0)
+    /* Frame pacing? */
+    if(sstClock.u32Flags & orxCLOCK_KU32_STATIC_FLAG_FRAME_PACING)
+    {
+      /* Should delay? */
+      if(fDelay > orxFLOAT_0)
+      {
+        /* Waits for next frame */
+        orxClock_WaitFrame(fDelay);
+      }
+      else
+      {
+        /* Clears deadline */
+        sstClock.dFrameDeadline = orxDOUBLE_0;
+      }
+    }
+    else
     {
-      /* Waits for next time slice */
-      orxSystem_Delay(fDelay);
+      /* Gets real remaining delay */
+      fDelay = fDelay + orxCLOCK_KF_DELAY_ADJUSTMENT - orx2F(orxSystem_GetTime() - sstClock.dTime);
+
+      /* Should delay? */
+      if(fDelay > orxFLOAT_0)
+      {
+        /* Waits for next time slice */
+        orxSystem_Delay(fDelay);
+      }
     }
   }
 
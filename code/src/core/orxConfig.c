@@ -36,6 +36,7 @@
 #include "core/orxCommand.h"
 #include "core/orxEvent.h"
 #include "core/orxResource.h"
+#include "core/orxSystem.h"
 #include "debug/orxDebug.h"
 #include "debug/orxProfiler.h"
 #include "memory/orxBank.h"
@@ -64,12 +65,24 @@
 #endif /* __orxGCC__ */
 
 
+#ifdef __orx64__
+
+  #define orxCONFIG_CAST_HELPER   (orxU64)
+
+#else /* __orx64__ */
+
+  #define orxCONFIG_CAST_HELPER
+
+#endif /* __orx64__ */
+
+
 /** Module flags
  */
 #define orxCONFIG_KU32_STATIC_FLAG_NONE           0x00000000  /**< No flags */
 
 #define orxCONFIG_KU32_STATIC_FLAG_READY          0x00000001  /**< Ready flag */
 #define orxCONFIG_KU32_STATIC_FLAG_HISTORY        0x00000002  /**< Keep history flag */
+#define orxCONFIG_KU32_STATIC_FLAG_PREFETCH       0x00000004  /**< Prefetch threads started flag */
 
 #define orxCONFIG_KU32_STATIC_MASK_ALL            0xFFFFFFFF  /**< All mask */
 
@@ -92,6 +105,13 @@
 #define orxCONFIG_KU32_STACK_BANK_SIZE            32          /**< Default stack bank size */
 #define orxCONFIG_KU32_ENTRY_BANK_SIZE            8192        /**< Default entry bank size */
 #define orxCONFIG_KU32_HISTORY_BANK_SIZE          32          /**< Default history bank size */
+#define orxCONFIG_KU32_PREFETCH_BANK_SIZE         32          /**< Default prefetch bank size */
+#define orxCONFIG_KU32_PREFETCH_LIST_SIZE         64          /**< Prefetch request list size (must be a power of two) */
+#define orxCONFIG_KU32_PREFETCH_THREAD_NUMBER     2           /**< Prefetch thread number, 0 to compile include prefetching out (see orxConfig_SetIncludePrefetch()) */
+
+#define orxCONFIG_KU32_PREFETCH_STATUS_PENDING    0           /**< Prefetch pending status */
+#define orxCONFIG_KU32_PREFETCH_STATUS_READY      1           /**< Prefetch ready status */
+#define orxCONFIG_KU32_PREFETCH_STATUS_FAILED     2           /**< Prefetch failed status */
 #define orxCONFIG_KU32_BASE_FILENAME_LENGTH       256         /**< Base file name length */
 
 #define orxCONFIG_KU32_BUFFER_SIZE                8192        /**< Buffer size */
@@ -121,8 +141,18 @@
 #define orxCONFIG_KZ_UTF8_BOM                     "\xEF\xBB\xBF" /**< UTF-8 BOM */
 #define orxCONFIG_KU32_UTF8_BOM_LENGTH            3           /**< UTF-8 BOM length */
 
+#define orxCONFIG_KZ_BINARY_TAG                   "OBCF"      /**< Binary file tag */
+#define orxCONFIG_KU32_BINARY_TAG_LENGTH          4           /**< Binary file tag length */
+#define orxCONFIG_KU32_BINARY_VERSION             1           /**< Binary file version */
+#define orxCONFIG_KU32_BINARY_BYTE_ORDER          0x01020304  /**< Binary file byte order marker */
+#define orxCONFIG_KU32_BINARY_PARENT_NONE         0xFFFFFFFF  /**< Binary section without parent */
+#define orxCONFIG_KU32_BINARY_PARENT_NO_DEFAULT   0xFFFFFFFE  /**< Binary section with forced 'no default' parent */
+#define orxCONFIG_KU32_BINARY_BUFFER_SIZE         16384       /**< Binary initial buffer size */
+
 #define orxCONFIG_KZ_CONFIG_MEMORY                "Memory"    /**< Memory buffer name */
 
+#define orxCONFIG_KZ_THREAD_NAME_PREFETCH         "Config Prefetch" /**< Prefetch thread name */
+
 #if defined(__orxDEBUG__)
 
   #define orxCONFIG_KZ_DEFAULT_FILE               "orxd.ini"  /**< Default config file name */
@@ -239,6 +269,74 @@ typedef struct __orxCONFIG_STACK_ENTRY_t
 
 } orxCONFIG_STACK_ENTRY;
 
+/** Config binary header structure
+ */
+typedef struct __orxCONFIG_BINARY_HEADER_t
+{
+  orxCHAR           acTag[orxCONFIG_KU32_BINARY_TAG_LENGTH]; /**< Tag : 4 */
+  orxU32            u32Version;             /**< Version : 8 */
+  orxU32            u32ByteOrder;           /**< Byte order marker : 12 */
+  orxU32            u32VectorSize;          /**< Vector size : 16 */
+  orxU32            u32StringCount;         /**< String count : 20 */
+  orxU32            u32SectionCount;        /**< Section count : 24 */
+  orxU32            u32EntryCount;          /**< Entry count : 28 */
+  orxU32            u32IndexCount;          /**< List index count : 32 */
+  orxU32            u32DataSize;            /**< String data size : 36 */
+
+} orxCONFIG_BINARY_HEADER;
+
+/** Config binary section structure
+ */
+typedef struct __orxCONFIG_BINARY_SECTION_t
+{
+  orxU32            u32NameIndex;           /**< Name string index : 4 */
+  orxU32            u32ParentIndex;         /**< Parent name string index : 8 */
+  orxU32            u32EntryCount;          /**< Entry count : 12 */
+
+} orxCONFIG_BINARY_SECTION;
+
+/** Config binary entry structure
+ */
+typedef struct __orxCONFIG_BINARY_ENTRY_t
+{
+  orxVECTOR         vValue;                 /**< Cached value : 12 */
+  orxVECTOR         vAltValue;              /**< Cached alternate value : 24 */
+  orxVECTOR         vStepValue;             /**< Cached step value : 36 */
+  orxU32            u32KeyIndex;            /**< Key string index : 40 */
+  orxU32            u32Value;               /**< Value string index, data offset for lists : 44 */
+  orxU32            u32ValueSize;           /**< Value data size for lists : 48 */
+  orxU32            u32IndexOffset;         /**< List index table offset : 52 */
+  orxU16            u16Type;                /**< Cached value type : 54 */
+  orxU16            u16Flags;               /**< Value flags : 56 */
+  orxU16            u16ListCount;           /**< List count : 58 */
+  orxU16            u16CacheIndex;          /**< Cache index : 60 */
+
+} orxCONFIG_BINARY_ENTRY;
+
+/** Config binary buffer structure
+ */
+typedef struct __orxCONFIG_BINARY_BUFFER_t
+{
+  orxU8            *pu8Data;                /**< Data : 4 */
+  orxU32            u32Size;                /**< Used size : 8 */
+  orxU32            u32Capacity;            /**< Capacity : 12 */
+
+} orxCONFIG_BINARY_BUFFER;
+
+/** Config prefetch structure
+ */
+typedef struct __orxCONFIG_PREFETCH_t
+{
+  orxHANDLE         hResource;              /**< Opened resource : 4 */
+  orxCHAR          *acBuffer;               /**< Content : 8 */
+  orxS64            s64Size;                /**< Content size : 16 */
+  orxS64            s64Cursor;              /**< Read cursor : 24 */
+  orxSTRINGID       stFileID;               /**< File name ID : 28 */
+  orxTHREAD_SEMAPHORE *pstSemaphore;        /**< Completion semaphore : 32 */
+  volatile orxU32   u32Status;              /**< Status : 36 */
+
+} orxCONFIG_PREFETCH;
+
 /** Static structure
  */
 typedef struct __orxCONFIG_STATIC_t
@@ -252,6 +350,9 @@ typedef struct __orxCONFIG_STATIC_t
   orxU32              u32Flags;             /**< Control flags */
   orxSTRINGID         stResourceGroupID;    /**< Resource group ID */
   orxU32              u32LoadCount;         /**< Load count */
+  orxDOUBLE           dLoadStartTime;       /**< External load start time */
+  orxU32              u32PrefetchUseCount;  /**< Prefetched files used by current external load */
+  orxBOOL             bIncludePrefetch;     /**< Include prefetch status */
   orxSTRING           zEncryptionKey;       /**< Encryption key */
   orxCONFIG_BOOTSTRAP_FUNCTION pfnBootstrap;/**< Bootstrap */
   orxSTRINGID         stLoadFileID;         /**< Loading file ID */
@@ -261,6 +362,16 @@ typedef struct __orxCONFIG_STATIC_t
   orxLINKLIST         stSectionList;        /**< Section list */
   orxHASHTABLE       *pstSectionTable;      /**< Section table */
   orxCONFIG_SECTION  *pstDefaultSection;    /**< Default parent section */
+  orxBANK            *pstPrefetchBank;      /**< Prefetch bank */
+  orxHASHTABLE       *pstPrefetchTable;     /**< Prefetch table */
+  orxTHREAD_SEMAPHORE *pstPrefetchSemaphore;/**< Prefetch request list semaphore */
+  orxTHREAD_SEMAPHORE *pstPrefetchWorkerSemaphore; /**< Prefetch worker semaphore */
+  volatile orxSTATUS  ePrefetchResult;      /**< Prefetch threads result */
+  volatile orxU32     u32PrefetchInIndex;   /**< Prefetch request in index */
+  volatile orxU32     u32PrefetchOutIndex;  /**< Prefetch request out index */
+  orxU32              u32PrefetchThreadCount; /**< Prefetch thread count */
+  orxU32              au32PrefetchThreadList[orxCONFIG_KU32_PREFETCH_THREAD_NUMBER + 1]; /**< Prefetch thread list */
+  orxCONFIG_PREFETCH *volatile apstPrefetchList[orxCONFIG_KU32_PREFETCH_LIST_SIZE]; /**< Prefetch request list */
   orxCHAR             acCommandBuffer[orxCONFIG_KU32_COMMAND_BUFFER_SIZE]; /**< Command buffer */
   orxCHAR             zBaseFile[orxCONFIG_KU32_BASE_FILENAME_LENGTH]; /**< Base file name */
   orxCHAR             acValueBuffer[orxCONFIG_KU32_LARGE_BUFFER_SIZE]; /**< Value buffer */
@@ -3018,220 +3129,1132 @@ static orxU32 orxFASTCALL orxConfig_ProcessBuffer(const orxSTRING _zName, orxCHA
 
 /** Select section (internal)
  */
-static orxSTATUS orxConfig_SelectSectionInternal(const orxSTRING _zSectionName)
+/** Reserves space at the end of a binary buffer
+ * @param[in] _pstBuffer        Concerned buffer
+ * @param[in] _u32Size          Size to reserve
+ * @return                      Reserved space
+ */
+static void *orxFASTCALL orxConfig_ReserveBinaryBuffer(orxCONFIG_BINARY_BUFFER *_pstBuffer, orxU32 _u32Size)
 {
-  orxSTATUS eResult = orxSTATUS_SUCCESS;
+  void *pResult;
 
-  /* Valid? */
-  if(_zSectionName != orxSTRING_EMPTY)
+  /* Not enough room? */
+  if(_pstBuffer->u32Size + _u32Size > _pstBuffer->u32Capacity)
   {
-    const orxSTRING     zSectionName;
-    orxCONFIG_SECTION  *pstSection, *pstParent = orxNULL;
-    orxCHAR            *pcNameEnd;
-    orxBOOL             bNewParent = orxFALSE;
-    orxS32              s32MarkerIndex;
+    orxU32 u32Capacity;
 
-    /* Looks for inheritance index */
-    s32MarkerIndex = orxString_SearchCharIndex(_zSectionName, orxCONFIG_KC_INHERITANCE_MARKER, 0);
+    /* Gets new capacity */
+    for(u32Capacity = (_pstBuffer->u32Capacity != 0) ? _pstBuffer->u32Capacity : orxCONFIG_KU32_BINARY_BUFFER_SIZE;
+        u32Capacity < _pstBuffer->u32Size + _u32Size;
+        u32Capacity <<= 1);
 
-    /* Found? */
-    if(s32MarkerIndex >= 0)
-    {
-      /* Cuts the name */
-      *((orxSTRING)_zSectionName + s32MarkerIndex) = orxCHAR_NULL;
+    /* Grows buffer */
+    _pstBuffer->pu8Data = (orxU8 *)((_pstBuffer->pu8Data != orxNULL) ? orxMemory_Reallocate(_pstBuffer->pu8Data, u32Capacity) : orxMemory_Allocate(u32Capacity, orxMEMORY_TYPE_TEMP));
 
-      /* Gets end of name */
-      for(pcNameEnd = (orxSTRING)_zSectionName + s32MarkerIndex - 1; (pcNameEnd > _zSectionName) && (*pcNameEnd == ' '); pcNameEnd--);
+    /* Checks */
+    orxASSERT(_pstBuffer->pu8Data != orxNULL);
 
-      /* Should trim? */
-      if(((++pcNameEnd) < _zSectionName + s32MarkerIndex) && (pcNameEnd > _zSectionName))
-      {
-        /* Ends name here */
-        *pcNameEnd = orxCHAR_NULL;
-      }
-      else
-      {
-        /* Clears name end pointer */
-        pcNameEnd = orxNULL;
-      }
+    /* Stores new capacity */
+    _pstBuffer->u32Capacity = u32Capacity;
+  }
 
-      if(_zSectionName[s32MarkerIndex + 1] == orxCONFIG_KC_INHERITANCE_MARKER)
-      {
-        /* Forces 'no default' parent ID */
-        pstParent = (orxCONFIG_SECTION *)orxHANDLE_UNDEFINED;
+  /* Updates result */
+  pResult = _pstBuffer->pu8Data + _pstBuffer->u32Size;
 
-        /* Asks for new parent to be set */
-        bNewParent = orxTRUE;
-      }
-      else
-      {
-        const orxSTRING     zParent;
-        orxCONFIG_SECTION  *pstPreviousSection;
+  /* Updates size */
+  _pstBuffer->u32Size += _u32Size;
 
-        /* Backups current section */
-        pstPreviousSection = sstConfig.pstCurrentSection;
+  /* Done! */
+  return pResult;
+}
 
-        /* Gets parent name */
-        for(zParent = _zSectionName + s32MarkerIndex + 1; *zParent == ' '; zParent++);
+/** Adds a string to a binary string table, if not already present
+ * @param[in] _pstTable         String index table
+ * @param[in] _pstOffsetBuffer  String offset buffer
+ * @param[in] _pstDataBuffer    String data buffer
+ * @param[in] _zString          String to add
+ * @return                      String index
+ */
+static orxU32 orxFASTCALL orxConfig_AddBinaryString(orxHASHTABLE *_pstTable, orxCONFIG_BINARY_BUFFER *_pstOffsetBuffer, orxCONFIG_BINARY_BUFFER *_pstDataBuffer, const orxSTRING _zString)
+{
+  void  **ppIndex;
+  orxU32  u32Result;
 
-        /* Selects it */
-        if(orxConfig_SelectSectionInternal(zParent) != orxSTATUS_FAILURE)
-        {
-          /* Protects it */
-          sstConfig.pstCurrentSection->s32ProtectionCount++;
+  /* Gets its bucket */
+  ppIndex = orxHashTable_Retrieve(_pstTable, orxString_ToCRC(_zString));
 
-          /* Checks */
-          orxASSERT(sstConfig.pstCurrentSection->s32ProtectionCount >= 0);
+  /* Checks */
+  orxASSERT(ppIndex != orxNULL);
 
-          /* Stores it */
-          pstParent = sstConfig.pstCurrentSection;
+  /* Already present? */
+  if(*ppIndex != orxNULL)
+  {
+    /* Updates result */
+    u32Result = (orxU32) orxCONFIG_CAST_HELPER *ppIndex - 1;
+  }
+  else
+  {
+    orxU32 *pu32Offset, u32Size;
 
-          /* Asks for new parent to be set */
-          bNewParent = orxTRUE;
-        }
+    /* Gets its size */
+    u32Size = orxString_GetLength(_zString) + 1;
 
-        /* Restores previous section */
-        sstConfig.pstCurrentSection = pstPreviousSection;
-      }
-    }
-    else
-    {
-      /* Clears end of name */
-      pcNameEnd = orxNULL;
-    }
+    /* Stores its offset */
+    pu32Offset  = (orxU32 *)orxConfig_ReserveBinaryBuffer(_pstOffsetBuffer, sizeof(orxU32));
+    *pu32Offset = _pstDataBuffer->u32Size;
 
-    /* Stores its name */
-    zSectionName = orxString_Store(_zSectionName);
+    /* Stores its content */
+    orxMemory_Copy(orxConfig_ReserveBinaryBuffer(_pstDataBuffer, u32Size), _zString, u32Size);
 
-    /* Not already selected? */
-    if((sstConfig.pstCurrentSection == orxNULL)
-    || (sstConfig.pstCurrentSection->zName != zSectionName))
-    {
-      /* Gets it from table */
-      pstSection = (orxCONFIG_SECTION *)orxHashTable_Get(sstConfig.pstSectionTable, orxString_ToCRC(_zSectionName));
+    /* Updates result */
+    u32Result = (_pstOffsetBuffer->u32Size / sizeof(orxU32)) - 1;
 
-      /* Valid? */
-      if(pstSection != orxNULL)
-      {
-        /* Selects it */
-        sstConfig.pstCurrentSection = pstSection;
-      }
-    }
-    else
-    {
-      /* Updates selection */
-      pstSection = sstConfig.pstCurrentSection;
-    }
+    /* Stores its index */
+    *ppIndex = (void *) orxCONFIG_CAST_HELPER (u32Result + 1);
+  }
 
-    /* Not found? */
-    if(pstSection == orxNULL)
-    {
-      /* Creates it */
-      pstSection = orxConfig_CreateSection(zSectionName, pstParent);
+  /* Done! */
+  return u32Result;
+}
 
-      /* Success? */
-      if(pstSection != orxNULL)
-      {
-        /* Selects it */
-        sstConfig.pstCurrentSection = pstSection;
-      }
-      else
-      {
-        /* Logs message */
-        orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "Failed to create config section [%s].", _zSectionName);
+/** Gets a section from its name, creates it if needed
+ * @param[in] _zSectionName     Section name (already stored)
+ * @return                      orxCONFIG_SECTION / orxNULL
+ */
+static orxINLINE orxCONFIG_SECTION *orxConfig_GetBinarySection(const orxSTRING _zSectionName)
+{
+  orxCONFIG_SECTION *pstResult;
 
-        /* Updates result */
-        eResult = orxSTATUS_FAILURE;
-      }
-    }
-    else
+  /* Gets it from table */
+  pstResult = (orxCONFIG_SECTION *)orxHashTable_Get(sstConfig.pstSectionTable, orxString_ToCRC(_zSectionName));
+
+  /* Not found? */
+  if(pstResult == orxNULL)
+  {
+    /* Creates it */
+    pstResult = orxConfig_CreateSection(_zSectionName, orxNULL);
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Checks a binary list entry: its data has to be null-terminated and its index table has to be strictly increasing, within its data
+ * @param[in] _pstBinaryEntry   Concerned binary entry
+ * @param[in] _au32IndexList    Binary index list
+ * @param[in] _acData           Binary string data
+ * @return                      orxTRUE if valid, orxFALSE otherwise
+ */
+static orxINLINE orxBOOL orxConfig_IsBinaryListValid(const orxCONFIG_BINARY_ENTRY *_pstBinaryEntry, const orxU32 *_au32IndexList, const orxCHAR *_acData)
+{
+  orxBOOL bResult;
+
+  /* Has null-terminated data? */
+  if((_pstBinaryEntry->u32ValueSize != 0)
+  && (_acData[_pstBinaryEntry->u32Value + _pstBinaryEntry->u32ValueSize - 1] == orxCHAR_NULL))
+  {
+    const orxU32 *pu32Index, *pu32LastIndex;
+    orxU32        u32PreviousIndex;
+
+    /* For all indices */
+    for(pu32Index = _au32IndexList + _pstBinaryEntry->u32IndexOffset, pu32LastIndex = pu32Index + _pstBinaryEntry->u16ListCount - 1, u32PreviousIndex = 0;
+        pu32Index < pu32LastIndex;
+        u32PreviousIndex = *pu32Index++)
     {
-      /* Loading? */
-      if(sstConfig.u32LoadCount != 0)
+      /* Not increasing, out of bounds or not following a previous item's end? */
+      if((*pu32Index <= u32PreviousIndex)
+      || (*pu32Index >= _pstBinaryEntry->u32ValueSize)
+      || (_acData[_pstBinaryEntry->u32Value + *pu32Index - 1] != orxCHAR_NULL))
       {
-        /* Has new parent ID? */
-        if(bNewParent != orxFALSE)
-        {
-          /* Updates parent ID */
-          pstSection->pstParent = pstParent;
-        }
+        break;
       }
     }
 
-    /* Had trimmed name */
-    if(pcNameEnd != orxNULL)
-    {
-      /* Restores space */
-      *pcNameEnd = ' ';
-    }
-
-    /* Had inheritance marker? */
-    if(s32MarkerIndex >= 0)
-    {
-      /* Restores it */
-      *((orxSTRING)_zSectionName + s32MarkerIndex) = orxCONFIG_KC_INHERITANCE_MARKER;
-    }
+    /* Updates result */
+    bResult = (pu32Index == pu32LastIndex) ? orxTRUE : orxFALSE;
   }
   else
   {
-    /* Logs message */
-    orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "Failed to select config section (%s), invalid name.", _zSectionName);
-
     /* Updates result */
-    eResult = orxSTATUS_FAILURE;
+    bResult = orxFALSE;
   }
 
   /* Done! */
-  return eResult;
+  return bResult;
 }
-/** Origin save callback
+
+/** Processes a binary config buffer
+ * @param[in] _zName            Name of the buffer origin
+ * @param[in] _pu8Buffer        Buffer to process
+ * @param[in] _u32Size          Size of the buffer
+ * @return                      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
  */
-orxBOOL orxFASTCALL orxConfig_OriginSaveCallback(const orxSTRING _zSectionName, const orxSTRING _zKeyName, const orxSTRING _zFileName, orxBOOL _bUseEncryption)
+static orxSTATUS orxFASTCALL orxConfig_ProcessBinaryBuffer(const orxSTRING _zName, const orxU8 *_pu8Buffer, orxU32 _u32Size)
 {
-  orxBOOL bResult;
+  orxCONFIG_BINARY_HEADER         stHeader;
+  const orxCONFIG_BINARY_HEADER  *pstHeader = &stHeader;
+  orxSTATUS                       eResult = orxSTATUS_FAILURE;
 
-#ifdef __orxWINDOWS__
+  /* Checks */
+  orxASSERT(orxALIGN(_pu8Buffer, sizeof(orxU32)) == (size_t)_pu8Buffer);
 
-  /* Updates result */
-  bResult = ((_zKeyName != orxNULL) || (orxString_ICompare(_zFileName, orxConfig_GetOrigin(_zSectionName)) == 0)) ? orxTRUE : orxFALSE;
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxConfig_ProcessBinaryBuffer");
+
+  /* Gets header, the size is checked below */
+  orxMemory_Copy(&stHeader, _pu8Buffer, orxMIN(_u32Size, (orxU32)sizeof(orxCONFIG_BINARY_HEADER)));
+
+  /* Valid header? */
+  if((_u32Size >= sizeof(orxCONFIG_BINARY_HEADER))
+  && (pstHeader->u32Version == orxCONFIG_KU32_BINARY_VERSION)
+  && (pstHeader->u32ByteOrder == orxCONFIG_KU32_BINARY_BYTE_ORDER)
+  && (pstHeader->u32VectorSize == sizeof(orxVECTOR))
+  && ((orxU64)sizeof(orxCONFIG_BINARY_HEADER)
+    + ((orxU64)pstHeader->u32StringCount * sizeof(orxU32))
+    + ((orxU64)pstHeader->u32SectionCount * sizeof(orxCONFIG_BINARY_SECTION))
+    + ((orxU64)pstHeader->u32EntryCount * sizeof(orxCONFIG_BINARY_ENTRY))
+    + ((orxU64)pstHeader->u32IndexCount * sizeof(orxU32))
+    + (orxU64)pstHeader->u32DataSize == (orxU64)_u32Size)
+  && ((pstHeader->u32DataSize == 0) || (_pu8Buffer[_u32Size - 1] == orxCHAR_NULL)))
+  {
+    const orxU32                   *au32StringOffsetList, *au32IndexList;
+    const orxCONFIG_BINARY_SECTION *astSectionList;
+    const orxCONFIG_BINARY_ENTRY   *pstBinaryEntry, *pstLastEntry;
+    const orxCHAR                  *acData;
+    orxSTRINGID                    *astStringIDList;
+    orxCONFIG_SECTION              *pstPreviousSection;
+    orxU32                          i;
+
+    /* Gets all blocks */
+    au32StringOffsetList  = (const orxU32 *)(_pu8Buffer + sizeof(orxCONFIG_BINARY_HEADER));
+    astSectionList        = (const orxCONFIG_BINARY_SECTION *)(au32StringOffsetList + pstHeader->u32StringCount);
+    pstBinaryEntry        = (const orxCONFIG_BINARY_ENTRY *)(astSectionList + pstHeader->u32SectionCount);
+    pstLastEntry          = pstBinaryEntry + pstHeader->u32EntryCount;
+    au32IndexList         = (const orxU32 *)pstLastEntry;
+    acData                = (const orxCHAR *)(au32IndexList + pstHeader->u32IndexCount);
+
+    /* Allocates string ID list */
+    astStringIDList = (orxSTRINGID *)orxMemory_Allocate(orxMAX(pstHeader->u32StringCount, 1) * sizeof(orxSTRINGID), orxMEMORY_TYPE_TEMP);
 
-#else /* __orxWINDOWS__ */
+    /* Checks */
+    orxASSERT(astStringIDList != orxNULL);
 
-  /* Updates result */
-  bResult = ((_zKeyName != orxNULL) || (orxString_Compare(_zFileName, orxConfig_GetOrigin(_zSectionName)) == 0)) ? orxTRUE : orxFALSE;
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
 
-#endif /* __orxWINDOWS__ */
+    /* For all strings */
+    for(i = 0; i < pstHeader->u32StringCount; i++)
+    {
+      /* Valid? */
+      if(au32StringOffsetList[i] < pstHeader->u32DataSize)
+      {
+        /* Interns it */
+        astStringIDList[i] = orxString_GetID(acData + au32StringOffsetList[i]);
+      }
+      else
+      {
+        /* Updates result */
+        eResult = orxSTATUS_FAILURE;
 
-  /* Done! */
-  return bResult;
-}
+        break;
+      }
+    }
 
-/** Command: Load
- */
-void orxFASTCALL orxConfig_CommandLoad(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
-{
-  /* Updates result */
-  _pstResult->bValue = (orxConfig_Load(_astArgList[0].zValue) != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
+    /* Backups current section */
+    pstPreviousSection = sstConfig.pstCurrentSection;
 
-  /* Done! */
-  return;
-}
+    /* For all sections */
+    for(i = 0; (i < pstHeader->u32SectionCount) && (eResult != orxSTATUS_FAILURE); i++)
+    {
+      const orxCONFIG_BINARY_SECTION *pstBinarySection;
+      orxCONFIG_SECTION              *pstSection;
+      orxU32                          j;
 
-/** Command: Save
- */
-void orxFASTCALL orxConfig_CommandSave(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
-{
-  /* Updates result */
-  _pstResult->bValue = (orxConfig_Save(_astArgList[0].zValue, (_u32ArgNumber > 2) ? _astArgList[2].bValue : orxFALSE, ((_u32ArgNumber > 1) && (_astArgList[1].bValue != orxFALSE)) ? orxConfig_OriginSaveCallback : orxNULL) != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
+      /* Gets it */
+      pstBinarySection = &astSectionList[i];
 
-  /* Done! */
-  return;
-}
+      /* Invalid? */
+      if((pstBinarySection->u32NameIndex >= pstHeader->u32StringCount)
+      || ((pstBinarySection->u32ParentIndex >= pstHeader->u32StringCount)
+       && (pstBinarySection->u32ParentIndex != orxCONFIG_KU32_BINARY_PARENT_NONE)
+       && (pstBinarySection->u32ParentIndex != orxCONFIG_KU32_BINARY_PARENT_NO_DEFAULT))
+      || (pstBinarySection->u32EntryCount > (orxU32)(pstLastEntry - pstBinaryEntry))
+      || ((pstSection = orxConfig_GetBinarySection(orxString_GetFromID(astStringIDList[pstBinarySection->u32NameIndex]))) == orxNULL))
+      {
+        /* Updates result */
+        eResult = orxSTATUS_FAILURE;
 
-/** Command: Reload
- */
-void orxFASTCALL orxConfig_CommandReload(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
-{
+        break;
+      }
+
+      /* Forces 'no default' parent? */
+      if(pstBinarySection->u32ParentIndex == orxCONFIG_KU32_BINARY_PARENT_NO_DEFAULT)
+      {
+        /* Had a parent? */
+        if((pstSection->pstParent != orxNULL) && (pstSection->pstParent != orxHANDLE_UNDEFINED))
+        {
+          /* Unprotects it */
+          pstSection->pstParent->s32ProtectionCount--;
+
+          /* Checks */
+          orxASSERT(pstSection->pstParent->s32ProtectionCount >= 0);
+        }
+
+        /* Updates it */
+        pstSection->pstParent = (orxCONFIG_SECTION *)orxHANDLE_UNDEFINED;
+      }
+      /* Has parent? */
+      else if(pstBinarySection->u32ParentIndex != orxCONFIG_KU32_BINARY_PARENT_NONE)
+      {
+        orxCONFIG_SECTION *pstParent;
+
+        /* Gets it */
+        pstParent = orxConfig_GetBinarySection(orxString_GetFromID(astStringIDList[pstBinarySection->u32ParentIndex]));
+
+        /* Valid? */
+        if(pstParent != orxNULL)
+        {
+          /* Protects it */
+          pstParent->s32ProtectionCount++;
+
+          /* Checks */
+          orxASSERT(pstParent->s32ProtectionCount >= 0);
+
+          /* Had a parent? */
+          if((pstSection->pstParent != orxNULL) && (pstSection->pstParent != orxHANDLE_UNDEFINED))
+          {
+            /* Unprotects it */
+            pstSection->pstParent->s32ProtectionCount--;
+
+            /* Checks */
+            orxASSERT(pstSection->pstParent->s32ProtectionCount >= 0);
+          }
+
+          /* Updates it */
+          pstSection->pstParent = pstParent;
+        }
+      }
+
+      /* Selects section */
+      sstConfig.pstCurrentSection = pstSection;
+
+      /* For all its entries */
+      for(j = 0; j < pstBinarySection->u32EntryCount; j++, pstBinaryEntry++)
+      {
+        orxCONFIG_ENTRY  *pstEntry;
+        orxCONFIG_VALUE  *pstValue;
+        orxBOOL           bList;
+
+        /* Is a list? */
+        bList = (orxFLAG_GET(pstBinaryEntry->u16Flags, orxCONFIG_VALUE_KU16_FLAG_LIST | orxCONFIG_VALUE_KU16_FLAG_BLOCK_MODE) == orxCONFIG_VALUE_KU16_FLAG_LIST) ? orxTRUE : orxFALSE;
+
+        /* Invalid? */
+        if((pstBinaryEntry->u32KeyIndex >= pstHeader->u32StringCount)
+        || ((bList == orxFALSE)
+         && (pstBinaryEntry->u32Value >= pstHeader->u32StringCount))
+        || ((bList != orxFALSE)
+         && ((pstBinaryEntry->u16ListCount < 2)
+          || ((orxU64)pstBinaryEntry->u32Value + (orxU64)pstBinaryEntry->u32ValueSize > (orxU64)pstHeader->u32DataSize)
+          || ((orxU64)pstBinaryEntry->u32IndexOffset + (orxU64)(pstBinaryEntry->u16ListCount - 1) > (orxU64)pstHeader->u32IndexCount)
+          || (orxConfig_IsBinaryListValid(pstBinaryEntry, au32IndexList, acData) == orxFALSE))))
+        {
+          /* Updates result */
+          eResult = orxSTATUS_FAILURE;
+
+          break;
+        }
+
+        /* Gets existing entry */
+        pstEntry = orxConfig_GetEntry(astStringIDList[pstBinaryEntry->u32KeyIndex]);
+
+        /* Found? */
+        if(pstEntry != orxNULL)
+        {
+          /* Deletes its value */
+          orxConfig_CleanValue(&(pstEntry->stValue));
+        }
+        else
+        {
+          /* Creates entry */
+          pstEntry = (orxCONFIG_ENTRY *)orxBank_Allocate(sstConfig.pstEntryBank);
+
+          /* Checks */
+          orxASSERT(pstEntry != orxNULL);
+
+          /* Adds it to list */
+          orxMemory_Zero(&(pstEntry->stNode), sizeof(orxLINKLIST_NODE));
+          orxLinkList_AddEnd(&(sstConfig.pstCurrentSection->stEntryList), &(pstEntry->stNode));
+
+          /* Sets its ID */
+          pstEntry->stID = astStringIDList[pstBinaryEntry->u32KeyIndex];
+        }
+
+        /* Gets its value */
+        pstValue = &(pstEntry->stValue);
+
+        /* Is a list? */
+        if(bList != orxFALSE)
+        {
+          /* Duplicates its content */
+          pstValue->zValue = (orxSTRING)orxMemory_Allocate(pstBinaryEntry->u32ValueSize, orxMEMORY_TYPE_TEXT);
+          orxASSERT(pstValue->zValue != orxNULL);
+          orxMemory_Copy(pstValue->zValue, acData + pstBinaryEntry->u32Value, pstBinaryEntry->u32ValueSize);
+
+          /* Duplicates its index table */
+          pstValue->au32ListIndexTable = (orxU32 *)orxMemory_Allocate((pstBinaryEntry->u16ListCount - 1) * sizeof(orxU32), orxMEMORY_TYPE_CONFIG);
+          orxASSERT(pstValue->au32ListIndexTable != orxNULL);
+          orxMemory_Copy(pstValue->au32ListIndexTable, au32IndexList + pstBinaryEntry->u32IndexOffset, (pstBinaryEntry->u16ListCount - 1) * sizeof(orxU32));
+        }
+        else
+        {
+          /* Stores its interned content */
+          pstValue->zValue = (acData[au32StringOffsetList[pstBinaryEntry->u32Value]] != orxCHAR_NULL) ? (orxSTRING)orxString_GetFromID(astStringIDList[pstBinaryEntry->u32Value]) : (orxSTRING)orxSTRING_EMPTY;
+
+          /* Clears index table */
+          pstValue->au32ListIndexTable = orxNULL;
+        }
+
+        /* Stores its parsed state */
+        pstValue->u16Type       = pstBinaryEntry->u16Type;
+        pstValue->u16Flags      = pstBinaryEntry->u16Flags;
+        pstValue->u16ListCount  = pstBinaryEntry->u16ListCount;
+        pstValue->u16CacheIndex = pstBinaryEntry->u16CacheIndex;
+        orxMemory_Copy(&(pstValue->vValue), &(pstBinaryEntry->vValue), sizeof(orxVECTOR));
+        orxMemory_Copy(&(pstValue->vAltValue), &(pstBinaryEntry->vAltValue), sizeof(orxVECTOR));
+        orxMemory_Copy(&(pstValue->vStepValue), &(pstBinaryEntry->vStepValue), sizeof(orxVECTOR));
+
+        /* Stores origin */
+        pstEntry->stOriginID = sstConfig.stLoadFileID;
+      }
+    }
+
+    /* Restores previous section */
+    sstConfig.pstCurrentSection = pstPreviousSection;
+
+    /* Frees string ID list */
+    orxMemory_Free(astStringIDList);
+
+    /* Failure? */
+    if(eResult == orxSTATUS_FAILURE)
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "[%s]: Binary config data is corrupted, loading has been interrupted.", _zName);
+    }
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "[%s]: Can't load binary config data: invalid or incompatible format.", _zName);
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return eResult;
+}
+
+/** Loads a binary config file
+ * @param[in] _zFileName        File name
+ * @param[in] _hResource        Opened resource
+ * @param[in] _acBuffer         Already read content
+ * @param[in] _u32Size          Size of the already read content
+ * @return                      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxConfig_LoadBinary(const orxSTRING _zFileName, orxHANDLE _hResource, const orxCHAR *_acBuffer, orxU32 _u32Size)
+{
+  orxS64    s64Size;
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Gets full size */
+  s64Size = orxResource_GetSize(_hResource);
+
+  /* Valid? */
+  if((s64Size >= (orxS64)_u32Size) && (s64Size <= (orxS64)orxU32_UNDEFINED))
+  {
+    orxU8 *pu8Buffer;
+
+    /* Allocates buffer */
+    pu8Buffer = (orxU8 *)orxMemory_Allocate((orxU32)s64Size, orxMEMORY_TYPE_TEMP);
+
+    /* Valid? */
+    if(pu8Buffer != orxNULL)
+    {
+      /* Copies already read content */
+      orxMemory_Copy(pu8Buffer, _acBuffer, _u32Size);
+
+      /* Reads remaining content */
+      if((s64Size == (orxS64)_u32Size)
+      || (orxResource_Read(_hResource, s64Size - (orxS64)_u32Size, pu8Buffer + _u32Size, orxNULL, orxNULL) == s64Size - (orxS64)_u32Size))
+      {
+        /* Processes it */
+        eResult = orxConfig_ProcessBinaryBuffer(_zFileName, pu8Buffer, (orxU32)s64Size);
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "[%s]: Can't read binary config file.", _zFileName);
+      }
+
+      /* Frees buffer */
+      orxMemory_Free(pu8Buffer);
+    }
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "[%s]: Can't load binary config file: invalid size.", _zFileName);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Processes prefetch requests, on prefetch threads
+ * @param[in] _pContext         Unused
+ * @return                      orxSTATUS_SUCCESS to keep running / orxSTATUS_FAILURE to stop
+ */
+static orxSTATUS orxFASTCALL orxConfig_ProcessPrefetchRequests(void *_pContext)
+{
+  orxSTATUS eResult;
+
+  /* Waits for a request */
+  orxThread_WaitSemaphore(sstConfig.pstPrefetchWorkerSemaphore);
+
+  /* Still running? */
+  if(sstConfig.ePrefetchResult != orxSTATUS_FAILURE)
+  {
+    orxCONFIG_PREFETCH *pstPrefetch = orxNULL;
+
+    /* Waits for request list */
+    orxThread_WaitSemaphore(sstConfig.pstPrefetchSemaphore);
+
+    /* Has pending request? */
+    if(sstConfig.u32PrefetchOutIndex != sstConfig.u32PrefetchInIndex)
+    {
+      /* Gets it */
+      pstPrefetch = sstConfig.apstPrefetchList[sstConfig.u32PrefetchOutIndex];
+
+      /* Updates out index */
+      orxMEMORY_BARRIER();
+      sstConfig.u32PrefetchOutIndex = (sstConfig.u32PrefetchOutIndex + 1) & (orxCONFIG_KU32_PREFETCH_LIST_SIZE - 1);
+    }
+
+    /* Signals request list */
+    orxThread_SignalSemaphore(sstConfig.pstPrefetchSemaphore);
+
+    /* Valid? */
+    if(pstPrefetch != orxNULL)
+    {
+      orxU32 u32Status = orxCONFIG_KU32_PREFETCH_STATUS_FAILED;
+
+      /* Gets its size */
+      pstPrefetch->s64Size = orxResource_GetSize(pstPrefetch->hResource);
+
+      /* Valid? */
+      if((pstPrefetch->s64Size > 0) && (pstPrefetch->s64Size < (orxS64)orxU32_UNDEFINED))
+      {
+        /* Allocates its buffer */
+        pstPrefetch->acBuffer = (orxCHAR *)orxMemory_Allocate((orxU32)pstPrefetch->s64Size, orxMEMORY_TYPE_TEMP);
+
+        /* Reads it in one go */
+        if((pstPrefetch->acBuffer != orxNULL)
+        && (orxResource_Read(pstPrefetch->hResource, pstPrefetch->s64Size, pstPrefetch->acBuffer, orxNULL, orxNULL) == pstPrefetch->s64Size))
+        {
+          /* Updates status */
+          u32Status = orxCONFIG_KU32_PREFETCH_STATUS_READY;
+        }
+      }
+
+      /* Publishes status */
+      orxMEMORY_BARRIER();
+      pstPrefetch->u32Status = u32Status;
+
+      /* Signals completion */
+      orxThread_SignalSemaphore(pstPrefetch->pstSemaphore);
+    }
+  }
+
+  /* Updates result */
+  eResult = sstConfig.ePrefetchResult;
+
+  /* Done! */
+  return eResult;
+}
+
+/** Waits for a prefetch completion, if needed
+ * @param[in] _pstPrefetch      Concerned prefetch
+ */
+static orxINLINE void orxConfig_WaitPrefetch(orxCONFIG_PREFETCH *_pstPrefetch)
+{
+  /* Pending? */
+  if(_pstPrefetch->u32Status == orxCONFIG_KU32_PREFETCH_STATUS_PENDING)
+  {
+    /* Profiles */
+    orxPROFILER_PUSH_MARKER("orxConfig_WaitPrefetch");
+
+    /* Waits for its completion */
+    orxThread_WaitSemaphore(_pstPrefetch->pstSemaphore);
+
+    /* Profiles */
+    orxPROFILER_POP_MARKER();
+  }
+  orxMEMORY_BARRIER();
+
+  /* Done! */
+  return;
+}
+
+/** Deletes a prefetch, waiting for its completion if needed
+ * @param[in] _pstPrefetch      Concerned prefetch
+ */
+static void orxFASTCALL orxConfig_DeletePrefetch(orxCONFIG_PREFETCH *_pstPrefetch)
+{
+  /* Waits for completion */
+  orxConfig_WaitPrefetch(_pstPrefetch);
+
+  /* Deletes its semaphore */
+  orxThread_DeleteSemaphore(_pstPrefetch->pstSemaphore);
+
+  /* Closes resource */
+  orxResource_Close(_pstPrefetch->hResource);
+
+  /* Has buffer? */
+  if(_pstPrefetch->acBuffer != orxNULL)
+  {
+    /* Frees it */
+    orxMemory_Free(_pstPrefetch->acBuffer);
+  }
+
+  /* Frees it */
+  orxBank_Free(sstConfig.pstPrefetchBank, _pstPrefetch);
+
+  /* Done! */
+  return;
+}
+
+/** Deletes all remaining prefetches
+ */
+static void orxFASTCALL orxConfig_ClearPrefetches()
+{
+  orxCONFIG_PREFETCH *pstPrefetch;
+
+  /* For all prefetches */
+  while((pstPrefetch = (orxCONFIG_PREFETCH *)orxBank_GetNext(sstConfig.pstPrefetchBank, orxNULL)) != orxNULL)
+  {
+    /* Deletes it */
+    orxConfig_DeletePrefetch(pstPrefetch);
+  }
+
+  /* Clears table */
+  orxHashTable_Clear(sstConfig.pstPrefetchTable);
+
+  /* Done! */
+  return;
+}
+
+/** Gets the prefetched content of a file, waiting for its completion if needed
+ * @param[in] _stFileID         File name ID
+ * @return                      orxCONFIG_PREFETCH / orxNULL if not prefetched or failed
+ */
+static orxCONFIG_PREFETCH *orxFASTCALL orxConfig_GetPrefetch(orxSTRINGID _stFileID)
+{
+  orxCONFIG_PREFETCH *pstResult = orxNULL;
+
+  /* Has prefetch table? */
+  if(sstConfig.pstPrefetchTable != orxNULL)
+  {
+    /* Gets it */
+    pstResult = (orxCONFIG_PREFETCH *)orxHashTable_Get(sstConfig.pstPrefetchTable, _stFileID);
+
+    /* Found? */
+    if(pstResult != orxNULL)
+    {
+      /* Removes it from table */
+      orxHashTable_Remove(sstConfig.pstPrefetchTable, _stFileID);
+
+      /* Waits for completion */
+      orxConfig_WaitPrefetch(pstResult);
+
+      /* Failed? */
+      if(pstResult->u32Status != orxCONFIG_KU32_PREFETCH_STATUS_READY)
+      {
+        /* Deletes it, the file will be read the regular way */
+        orxConfig_DeletePrefetch(pstResult);
+        pstResult = orxNULL;
+      }
+    }
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Requests the prefetch of a file
+ * @param[in] _zFileName        File name
+ */
+static void orxFASTCALL orxConfig_PrefetchFile(const orxSTRING _zFileName)
+{
+  /* Threads not started yet? */
+  if(!orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_PREFETCH))
+  {
+    orxU32 i;
+
+    /* Updates status */
+    orxFLAG_SET(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_PREFETCH, orxCONFIG_KU32_STATIC_FLAG_NONE);
+    sstConfig.ePrefetchResult = orxSTATUS_SUCCESS;
+
+    /* For all threads */
+    for(i = 0; (i < orxCONFIG_KU32_PREFETCH_THREAD_NUMBER) && (sstConfig.pstPrefetchTable != orxNULL); i++)
+    {
+      orxU32 u32ThreadID;
+
+      /* Starts it */
+      u32ThreadID = orxThread_Start(&orxConfig_ProcessPrefetchRequests, orxCONFIG_KZ_THREAD_NAME_PREFETCH, orxNULL);
+
+      /* Failure? */
+      if(u32ThreadID == orxU32_UNDEFINED)
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "Couldn't start config prefetch thread #%u, using %u thread(s).", i + 1, i);
+
+        break;
+      }
+
+      /* Stores it */
+      sstConfig.au32PrefetchThreadList[sstConfig.u32PrefetchThreadCount++] = u32ThreadID;
+    }
+  }
+
+  /* Has threads and room for a new request? */
+  if((sstConfig.u32PrefetchThreadCount != 0)
+  && (((sstConfig.u32PrefetchInIndex + 1) & (orxCONFIG_KU32_PREFETCH_LIST_SIZE - 1)) != sstConfig.u32PrefetchOutIndex))
+  {
+    orxSTRINGID stFileID;
+
+    /* Gets file ID */
+    stFileID = orxString_GetID(_zFileName);
+
+    /* Not already prefetched? */
+    if(orxHashTable_Get(sstConfig.pstPrefetchTable, stFileID) == orxNULL)
+    {
+      const orxSTRING zResourceLocation;
+      orxHANDLE       hResource;
+
+      /* Opens it */
+      if(((zResourceLocation = orxResource_Locate(orxCONFIG_KZ_RESOURCE_GROUP, _zFileName)) != orxNULL)
+      && ((hResource = orxResource_Open(zResourceLocation, orxFALSE)) != orxHANDLE_UNDEFINED))
+      {
+        orxCONFIG_PREFETCH *pstPrefetch;
+
+        /* Allocates prefetch */
+        pstPrefetch = (orxCONFIG_PREFETCH *)orxBank_Allocate(sstConfig.pstPrefetchBank);
+
+        /* Valid? */
+        if((pstPrefetch != orxNULL)
+        && ((pstPrefetch->pstSemaphore = orxThread_CreateSemaphore(0)) != orxNULL))
+        {
+          /* Inits it */
+          pstPrefetch->hResource  = hResource;
+          pstPrefetch->acBuffer   = orxNULL;
+          pstPrefetch->s64Size    = 0;
+          pstPrefetch->s64Cursor  = 0;
+          pstPrefetch->stFileID   = stFileID;
+          pstPrefetch->u32Status  = orxCONFIG_KU32_PREFETCH_STATUS_PENDING;
+
+          /* Stores it */
+          orxHashTable_Add(sstConfig.pstPrefetchTable, stFileID, pstPrefetch);
+
+          /* Waits for request list */
+          orxThread_WaitSemaphore(sstConfig.pstPrefetchSemaphore);
+
+          /* Adds request */
+          sstConfig.apstPrefetchList[sstConfig.u32PrefetchInIndex] = pstPrefetch;
+          orxMEMORY_BARRIER();
+          sstConfig.u32PrefetchInIndex = (sstConfig.u32PrefetchInIndex + 1) & (orxCONFIG_KU32_PREFETCH_LIST_SIZE - 1);
+
+          /* Signals request list */
+          orxThread_SignalSemaphore(sstConfig.pstPrefetchSemaphore);
+
+          /* Wakes up a worker */
+          orxThread_SignalSemaphore(sstConfig.pstPrefetchWorkerSemaphore);
+        }
+        else
+        {
+          /* Has prefetch? */
+          if(pstPrefetch != orxNULL)
+          {
+            /* Frees it */
+            orxBank_Free(sstConfig.pstPrefetchBank, pstPrefetch);
+          }
+
+          /* Closes resource */
+          orxResource_Close(hResource);
+        }
+      }
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Requests the prefetch of all the complete include lines found in a buffer, the buffer has to start at the beginning of a line.
+ * Only lines starting with an include marker are considered: comments and block values are skipped, as done when parsing.
+ * @param[in] _acBuffer         Buffer to scan, include names will be temporarily cut in place
+ * @param[in] _u32Size          Size of the buffer
+ */
+static void orxFASTCALL orxConfig_PrefetchIncludes(orxCHAR *_acBuffer, orxU32 _u32Size)
+{
+  orxCHAR *pc, *pcEnd;
+
+  /* For all lines */
+  for(pc = _acBuffer, pcEnd = _acBuffer + _u32Size; pc < pcEnd;)
+  {
+    /* Skips leading spaces */
+    while((pc < pcEnd) && ((*pc == orxCHAR_CR) || (*pc == orxCHAR_LF) || (*pc == ' ') || (*pc == '\t')))
+    {
+      pc++;
+    }
+
+    /* Include? */
+    if((pc < pcEnd) && (*pc == orxCONFIG_KC_INHERITANCE_MARKER))
+    {
+      orxCHAR *pcNameStart;
+
+      /* Finds name end */
+      for(pcNameStart = ++pc; (pc < pcEnd) && (*pc != orxCONFIG_KC_INHERITANCE_MARKER) && (*pc != orxCHAR_CR) && (*pc != orxCHAR_LF); pc++);
+
+      /* Complete and not empty? */
+      if((pc < pcEnd) && (*pc == orxCONFIG_KC_INHERITANCE_MARKER) && (pc != pcNameStart))
+      {
+        /* Cuts name */
+        *pc = orxCHAR_NULL;
+
+        /* Prefetches it */
+        orxConfig_PrefetchFile(pcNameStart);
+
+        /* Restores marker */
+        *pc = orxCONFIG_KC_INHERITANCE_MARKER;
+      }
+    }
+    else
+    {
+      orxBOOL bValue, bBlockMode;
+
+      /* For all characters till the end of line, out of block mode */
+      for(bValue = bBlockMode = orxFALSE; pc < pcEnd; pc++)
+      {
+        /* Block mode? */
+        if(bBlockMode != orxFALSE)
+        {
+          /* Block character? */
+          if(*pc == orxCONFIG_KC_BLOCK)
+          {
+            /* Double block character? */
+            if((pc + 1 < pcEnd) && (*(pc + 1) == orxCONFIG_KC_BLOCK))
+            {
+              /* Skips it */
+              pc++;
+            }
+            else
+            {
+              /* Ends block */
+              bBlockMode = orxFALSE;
+            }
+          }
+        }
+        /* End of line or comment? */
+        else if((*pc == orxCHAR_CR) || (*pc == orxCHAR_LF) || (*pc == orxCONFIG_KC_COMMENT))
+        {
+          break;
+        }
+        /* First assign character? */
+        else if((*pc == orxCONFIG_KC_ASSIGN) && (bValue == orxFALSE))
+        {
+          /* Updates status */
+          bValue = orxTRUE;
+
+          /* Finds start of value */
+          for(pc++; (pc < pcEnd) && ((*pc == ' ') || (*pc == '\t')); pc++);
+
+          /* Block start (and not an empty value)? */
+          if((pc < pcEnd)
+          && (*pc == orxCONFIG_KC_BLOCK)
+          && ((pc + 1 >= pcEnd)
+           || (*(pc + 1) != orxCONFIG_KC_BLOCK)
+           || ((pc + 2 < pcEnd) && (*(pc + 2) == orxCONFIG_KC_BLOCK))))
+          {
+            /* Starts block */
+            bBlockMode = orxTRUE;
+          }
+          else
+          {
+            /* Checks value start as a regular character */
+            pc--;
+          }
+        }
+      }
+    }
+
+    /* Skips the rest of the line */
+    while((pc < pcEnd) && (*pc != orxCHAR_CR) && (*pc != orxCHAR_LF))
+    {
+      pc++;
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Reads a config file chunk, from its prefetched content if available
+ * @param[in] _hResource        Opened resource, used if no prefetched content
+ * @param[in] _pstPrefetch      Prefetched content, orxNULL for none
+ * @param[in] _s64Size          Size to read
+ * @param[out] _acBuffer        Output buffer
+ * @return                      Read size
+ */
+static orxINLINE orxS64 orxConfig_ReadChunk(orxHANDLE _hResource, orxCONFIG_PREFETCH *_pstPrefetch, orxS64 _s64Size, orxCHAR *_acBuffer)
+{
+  orxS64 s64Result;
+
+  /* Prefetched? */
+  if(_pstPrefetch != orxNULL)
+  {
+    /* Gets size */
+    s64Result = orxMIN(_s64Size, _pstPrefetch->s64Size - _pstPrefetch->s64Cursor);
+
+    /* Copies content */
+    orxMemory_Copy(_acBuffer, _pstPrefetch->acBuffer + _pstPrefetch->s64Cursor, (orxU32)s64Result);
+
+    /* Updates cursor */
+    _pstPrefetch->s64Cursor += s64Result;
+  }
+  else
+  {
+    /* Reads it */
+    s64Result = orxResource_Read(_hResource, _s64Size, _acBuffer, orxNULL, orxNULL);
+  }
+
+  /* Done! */
+  return s64Result;
+}
+
+static orxSTATUS orxConfig_SelectSectionInternal(const orxSTRING _zSectionName)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Valid? */
+  if(_zSectionName != orxSTRING_EMPTY)
+  {
+    const orxSTRING     zSectionName;
+    orxCONFIG_SECTION  *pstSection, *pstParent = orxNULL;
+    orxCHAR            *pcNameEnd;
+    orxBOOL             bNewParent = orxFALSE;
+    orxS32              s32MarkerIndex;
+
+    /* Looks for inheritance index */
+    s32MarkerIndex = orxString_SearchCharIndex(_zSectionName, orxCONFIG_KC_INHERITANCE_MARKER, 0);
+
+    /* Found? */
+    if(s32MarkerIndex >= 0)
+    {
+      /* Cuts the name */
+      *((orxSTRING)_zSectionName + s32MarkerIndex) = orxCHAR_NULL;
+
+      /* Gets end of name */
+      for(pcNameEnd = (orxSTRING)_zSectionName + s32MarkerIndex - 1; (pcNameEnd > _zSectionName) && (*pcNameEnd == ' '); pcNameEnd--);
+
+      /* Should trim? */
+      if(((++pcNameEnd) < _zSectionName + s32MarkerIndex) && (pcNameEnd > _zSectionName))
+      {
+        /* Ends name here */
+        *pcNameEnd = orxCHAR_NULL;
+      }
+      else
+      {
+        /* Clears name end pointer */
+        pcNameEnd = orxNULL;
+      }
+
+      if(_zSectionName[s32MarkerIndex + 1] == orxCONFIG_KC_INHERITANCE_MARKER)
+      {
+        /* Forces 'no default' parent ID */
+        pstParent = (orxCONFIG_SECTION *)orxHANDLE_UNDEFINED;
+
+        /* Asks for new parent to be set */
+        bNewParent = orxTRUE;
+      }
+      else
+      {
+        const orxSTRING     zParent;
+        orxCONFIG_SECTION  *pstPreviousSection;
+
+        /* Backups current section */
+        pstPreviousSection = sstConfig.pstCurrentSection;
+
+        /* Gets parent name */
+        for(zParent = _zSectionName + s32MarkerIndex + 1; *zParent == ' '; zParent++);
+
+        /* Selects it */
+        if(orxConfig_SelectSectionInternal(zParent) != orxSTATUS_FAILURE)
+        {
+          /* Protects it */
+          sstConfig.pstCurrentSection->s32ProtectionCount++;
+
+          /* Checks */
+          orxASSERT(sstConfig.pstCurrentSection->s32ProtectionCount >= 0);
+
+          /* Stores it */
+          pstParent = sstConfig.pstCurrentSection;
+
+          /* Asks for new parent to be set */
+          bNewParent = orxTRUE;
+        }
+
+        /* Restores previous section */
+        sstConfig.pstCurrentSection = pstPreviousSection;
+      }
+    }
+    else
+    {
+      /* Clears end of name */
+      pcNameEnd = orxNULL;
+    }
+
+    /* Stores its name */
+    zSectionName = orxString_Store(_zSectionName);
+
+    /* Not already selected? */
+    if((sstConfig.pstCurrentSection == orxNULL)
+    || (sstConfig.pstCurrentSection->zName != zSectionName))
+    {
+      /* Gets it from table */
+      pstSection = (orxCONFIG_SECTION *)orxHashTable_Get(sstConfig.pstSectionTable, orxString_ToCRC(_zSectionName));
+
+      /* Valid? */
+      if(pstSection != orxNULL)
+      {
+        /* Selects it */
+        sstConfig.pstCurrentSection = pstSection;
+      }
+    }
+    else
+    {
+      /* Updates selection */
+      pstSection = sstConfig.pstCurrentSection;
+    }
+
+    /* Not found? */
+    if(pstSection == orxNULL)
+    {
+      /* Creates it */
+      pstSection = orxConfig_CreateSection(zSectionName, pstParent);
+
+      /* Success? */
+      if(pstSection != orxNULL)
+      {
+        /* Selects it */
+        sstConfig.pstCurrentSection = pstSection;
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "Failed to create config section [%s].", _zSectionName);
+
+        /* Updates result */
+        eResult = orxSTATUS_FAILURE;
+      }
+    }
+    else
+    {
+      /* Loading? */
+      if(sstConfig.u32LoadCount != 0)
+      {
+        /* Has new parent ID? */
+        if(bNewParent != orxFALSE)
+        {
+          /* Updates parent ID */
+          pstSection->pstParent = pstParent;
+        }
+      }
+    }
+
+    /* Had trimmed name */
+    if(pcNameEnd != orxNULL)
+    {
+      /* Restores space */
+      *pcNameEnd = ' ';
+    }
+
+    /* Had inheritance marker? */
+    if(s32MarkerIndex >= 0)
+    {
+      /* Restores it */
+      *((orxSTRING)_zSectionName + s32MarkerIndex) = orxCONFIG_KC_INHERITANCE_MARKER;
+    }
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "Failed to select config section (%s), invalid name.", _zSectionName);
+
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  /* Done! */
+  return eResult;
+}
+/** Origin save callback
+ */
+orxBOOL orxFASTCALL orxConfig_OriginSaveCallback(const orxSTRING _zSectionName, const orxSTRING _zKeyName, const orxSTRING _zFileName, orxBOOL _bUseEncryption)
+{
+  orxBOOL bResult;
+
+#ifdef __orxWINDOWS__
+
+  /* Updates result */
+  bResult = ((_zKeyName != orxNULL) || (orxString_ICompare(_zFileName, orxConfig_GetOrigin(_zSectionName)) == 0)) ? orxTRUE : orxFALSE;
+
+#else /* __orxWINDOWS__ */
+
+  /* Updates result */
+  bResult = ((_zKeyName != orxNULL) || (orxString_Compare(_zFileName, orxConfig_GetOrigin(_zSectionName)) == 0)) ? orxTRUE : orxFALSE;
+
+#endif /* __orxWINDOWS__ */
+
+  /* Done! */
+  return bResult;
+}
+
+/** Command: Load
+ */
+void orxFASTCALL orxConfig_CommandLoad(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Updates result */
+  _pstResult->bValue = (orxConfig_Load(_astArgList[0].zValue) != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
+
+  /* Done! */
+  return;
+}
+
+/** Command: Save
+ */
+void orxFASTCALL orxConfig_CommandSave(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Updates result */
+  _pstResult->bValue = (orxConfig_Save(_astArgList[0].zValue, (_u32ArgNumber > 2) ? _astArgList[2].bValue : orxFALSE, ((_u32ArgNumber > 1) && (_astArgList[1].bValue != orxFALSE)) ? orxConfig_OriginSaveCallback : orxNULL) != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
+
+  /* Done! */
+  return;
+}
+
+/** Command: Reload
+ */
+void orxFASTCALL orxConfig_CommandReload(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
   /* Updates result */
   _pstResult->bValue = (orxConfig_ReloadHistory() != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
 
@@ -3728,6 +4751,8 @@ void orxFASTCALL orxConfig_Setup()
   orxModule_AddDependency(orxMODULE_ID_CONFIG, orxMODULE_ID_EVENT);
   orxModule_AddDependency(orxMODULE_ID_CONFIG, orxMODULE_ID_COMMAND);
   orxModule_AddDependency(orxMODULE_ID_CONFIG, orxMODULE_ID_RESOURCE);
+  orxModule_AddDependency(orxMODULE_ID_CONFIG, orxMODULE_ID_THREAD);
+  orxModule_AddDependency(orxMODULE_ID_CONFIG, orxMODULE_ID_SYSTEM);
 
   return;
 }
@@ -3745,6 +4770,7 @@ orxSTATUS orxFASTCALL orxConfig_Init()
     orxCHAR                       zBackupBaseFile[orxCONFIG_KU32_BASE_FILENAME_LENGTH];
     orxSTRING                     zBackupEncryptionKey;
     orxCONFIG_BOOTSTRAP_FUNCTION  pfnBackupBootstrap;
+    orxBOOL                       bBackupIncludePrefetch;
 
     /* Backups base file name */
     orxMemory_Copy(zBackupBaseFile, sstConfig.zBaseFile, orxCONFIG_KU32_BASE_FILENAME_LENGTH);
@@ -3755,6 +4781,9 @@ orxSTATUS orxFASTCALL orxConfig_Init()
     /* Backups bootstrap */
     pfnBackupBootstrap = sstConfig.pfnBootstrap;
 
+    /* Backups include prefetch status */
+    bBackupIncludePrefetch = sstConfig.bIncludePrefetch;
+
     /* Cleans control structure */
     orxMemory_Zero(&sstConfig, sizeof(orxCONFIG_STATIC));
 
@@ -3787,6 +4816,9 @@ orxSTATUS orxFASTCALL orxConfig_Init()
     /* Restores bootstrap */
     sstConfig.pfnBootstrap = pfnBackupBootstrap;
 
+    /* Restores include prefetch status */
+    sstConfig.bIncludePrefetch = bBackupIncludePrefetch;
+
     /* Creates stack bank, history bank & section bank/table */
     sstConfig.pstStackBank    = orxBank_Create(orxCONFIG_KU32_STACK_BANK_SIZE, sizeof(orxCONFIG_STACK_ENTRY), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_CONFIG);
     sstConfig.pstHistoryBank  = orxBank_Create(orxCONFIG_KU32_HISTORY_BANK_SIZE, sizeof(orxU32), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_CONFIG);
@@ -3795,6 +4827,45 @@ orxSTATUS orxFASTCALL orxConfig_Init()
 
     sstConfig.pstSectionTable = orxHashTable_Create(orxCONFIG_KU32_SECTION_BANK_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_CONFIG);
 
+    /* Prefetch enabled? */
+    if(orxCONFIG_KU32_PREFETCH_THREAD_NUMBER != 0)
+    {
+      /* Creates prefetch bank, table & semaphores */
+      sstConfig.pstPrefetchBank             = orxBank_Create(orxCONFIG_KU32_PREFETCH_BANK_SIZE, sizeof(orxCONFIG_PREFETCH), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_CONFIG);
+      sstConfig.pstPrefetchTable            = orxHashTable_Create(orxCONFIG_KU32_PREFETCH_BANK_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_CONFIG);
+      sstConfig.pstPrefetchSemaphore        = orxThread_CreateSemaphore(1);
+      sstConfig.pstPrefetchWorkerSemaphore  = orxThread_CreateSemaphore(0);
+
+      /* Failure? */
+      if((sstConfig.pstPrefetchBank == orxNULL) || (sstConfig.pstPrefetchTable == orxNULL) || (sstConfig.pstPrefetchSemaphore == orxNULL) || (sstConfig.pstPrefetchWorkerSemaphore == orxNULL))
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "Can't allocate prefetch data, includes will be read on the main thread only.");
+
+        /* Deletes all */
+        if(sstConfig.pstPrefetchBank != orxNULL)
+        {
+          orxBank_Delete(sstConfig.pstPrefetchBank);
+          sstConfig.pstPrefetchBank = orxNULL;
+        }
+        if(sstConfig.pstPrefetchTable != orxNULL)
+        {
+          orxHashTable_Delete(sstConfig.pstPrefetchTable);
+          sstConfig.pstPrefetchTable = orxNULL;
+        }
+        if(sstConfig.pstPrefetchSemaphore != orxNULL)
+        {
+          orxThread_DeleteSemaphore(sstConfig.pstPrefetchSemaphore);
+          sstConfig.pstPrefetchSemaphore = orxNULL;
+        }
+        if(sstConfig.pstPrefetchWorkerSemaphore != orxNULL)
+        {
+          orxThread_DeleteSemaphore(sstConfig.pstPrefetchWorkerSemaphore);
+          sstConfig.pstPrefetchWorkerSemaphore = orxNULL;
+        }
+      }
+    }
+
     /* Valid? */
     if((sstConfig.pstStackBank != orxNULL) && (sstConfig.pstHistoryBank != orxNULL) && (sstConfig.pstSectionBank != orxNULL) && (sstConfig.pstEntryBank != orxNULL) && (sstConfig.pstSectionTable != orxNULL))
     {
@@ -3908,6 +4979,33 @@ void orxFASTCALL orxConfig_Exit()
     /* Removes default parent section */
     orxConfig_SetDefaultParent(orxNULL);
 
+    /* Has prefetch data? */
+    if(sstConfig.pstPrefetchTable != orxNULL)
+    {
+      orxU32 i;
+
+      /* Deletes remaining prefetches */
+      orxConfig_ClearPrefetches();
+
+      /* Stops prefetch threads */
+      sstConfig.ePrefetchResult = orxSTATUS_FAILURE;
+      orxMEMORY_BARRIER();
+      for(i = 0; i < sstConfig.u32PrefetchThreadCount; i++)
+      {
+        orxThread_SignalSemaphore(sstConfig.pstPrefetchWorkerSemaphore);
+      }
+      for(i = 0; i < sstConfig.u32PrefetchThreadCount; i++)
+      {
+        orxThread_Join(sstConfig.au32PrefetchThreadList[i]);
+      }
+
+      /* Deletes prefetch bank, table & semaphores */
+      orxBank_Delete(sstConfig.pstPrefetchBank);
+      orxHashTable_Delete(sstConfig.pstPrefetchTable);
+      orxThread_DeleteSemaphore(sstConfig.pstPrefetchSemaphore);
+      orxThread_DeleteSemaphore(sstConfig.pstPrefetchWorkerSemaphore);
+    }
+
     /* Clears all data */
     orxConfig_Clear();
 
@@ -4006,6 +5104,22 @@ orxSTATUS orxFASTCALL orxConfig_SetBootstrap(const orxCONFIG_BOOTSTRAP_FUNCTION
   return eResult;
 }
 
+/** Sets include prefetch status: when enabled, included files are read ahead on worker threads while their parent file is being parsed (disabled by default).
+ *  Can be called before the config module is initialized or from the bootstrap function, in order to apply to the default config file.
+ * @param[in] _bEnable          Enable / disable
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxConfig_SetIncludePrefetch(orxBOOL _bEnable)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Stores it */
+  sstConfig.bIncludePrefetch = _bEnable;
+
+  /* Done! */
+  return eResult;
+}
+
 /** Sets config base name
  * @param[in] _zBaseName        Base name used for default config file
  * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
@@ -4110,10 +5224,11 @@ const orxSTRING orxFASTCALL orxConfig_GetMainFileName()
  */
 orxSTATUS orxFASTCALL orxConfig_Load(const orxSTRING _zFileName)
 {
-  orxSTRINGID     stPreviousLoadFileID;
-  const orxSTRING zResourceLocation;
-  orxHANDLE       hResource;
-  orxSTATUS       eResult = orxSTATUS_SUCCESS;
+  orxSTRINGID         stPreviousLoadFileID;
+  const orxSTRING     zResourceLocation;
+  orxHANDLE           hResource = orxHANDLE_UNDEFINED;
+  orxCONFIG_PREFETCH *pstPrefetch;
+  orxSTATUS           eResult = orxSTATUS_SUCCESS;
 
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
@@ -4125,6 +5240,10 @@ orxSTATUS orxFASTCALL orxConfig_Load(const orxSTRING _zFileName)
     /* Profiles */
     orxPROFILER_PUSH_MARKER("orxConfig_Load");
 
+    /* Stores start time */
+    sstConfig.dLoadStartTime      = orxSystem_GetSystemTime();
+    sstConfig.u32PrefetchUseCount = 0;
+
     /* Should keep history? */
     if(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_HISTORY))
     {
@@ -4151,10 +5270,21 @@ orxSTATUS orxFASTCALL orxConfig_Load(const orxSTRING _zFileName)
   /* Sets current loaded file */
   sstConfig.stLoadFileID = orxString_GetID(_zFileName);
 
-  /* Valid file to open? */
-  if((_zFileName != orxSTRING_EMPTY)
-  && ((zResourceLocation = orxResource_Locate(orxCONFIG_KZ_RESOURCE_GROUP, _zFileName)) != orxNULL)
-  && ((hResource = orxResource_Open(zResourceLocation, orxFALSE)) != orxHANDLE_UNDEFINED))
+  /* Gets its prefetched content, if any */
+  pstPrefetch = (_zFileName != orxSTRING_EMPTY) ? orxConfig_GetPrefetch(sstConfig.stLoadFileID) : orxNULL;
+
+  /* Prefetched? */
+  if(pstPrefetch != orxNULL)
+  {
+    /* Updates count */
+    sstConfig.u32PrefetchUseCount++;
+  }
+
+  /* Prefetched or valid file to open? */
+  if((pstPrefetch != orxNULL)
+  || ((_zFileName != orxSTRING_EMPTY)
+   && ((zResourceLocation = orxResource_Locate(orxCONFIG_KZ_RESOURCE_GROUP, _zFileName)) != orxNULL)
+   && ((hResource = orxResource_Open(zResourceLocation, orxFALSE)) != orxHANDLE_UNDEFINED)))
   {
     orxCHAR             acBuffer[orxCONFIG_KU32_BUFFER_SIZE], *pcPreviousEncryptionChar;
     orxU32              u32Size, u32Offset;
@@ -4171,13 +5301,23 @@ orxSTATUS orxFASTCALL orxConfig_Load(const orxSTRING _zFileName)
     sstConfig.pcEncryptionChar = sstConfig.zEncryptionKey;
 
     /* While file isn't empty */
-    for(u32Size = (orxU32)orxResource_Read(hResource, orxCONFIG_KU32_BUFFER_SIZE, acBuffer, orxNULL, orxNULL), u32Offset = 0, bFirstTime = orxTRUE;
+    for(u32Size = (orxU32)orxConfig_ReadChunk(hResource, pstPrefetch, orxCONFIG_KU32_BUFFER_SIZE, acBuffer), u32Offset = 0, bFirstTime = orxTRUE;
         u32Size > 0;
-        u32Size = (orxU32)orxResource_Read(hResource, (orxS64)(orxCONFIG_KU32_BUFFER_SIZE - u32Offset), acBuffer + u32Offset, orxNULL, orxNULL) + u32Offset, bFirstTime = orxFALSE)
+        u32Size = (orxU32)orxConfig_ReadChunk(hResource, pstPrefetch, (orxS64)(orxCONFIG_KU32_BUFFER_SIZE - u32Offset), acBuffer + u32Offset) + u32Offset, bFirstTime = orxFALSE)
     {
       /* First time? */
       if(bFirstTime != orxFALSE)
       {
+        /* Has binary tag? */
+        if((u32Size >= orxCONFIG_KU32_BINARY_TAG_LENGTH)
+        && (orxMemory_Compare(acBuffer, orxCONFIG_KZ_BINARY_TAG, orxCONFIG_KU32_BINARY_TAG_LENGTH) == 0))
+        {
+          /* Loads it */
+          eResult = (pstPrefetch != orxNULL) ? orxConfig_ProcessBinaryBuffer(_zFileName, (const orxU8 *)pstPrefetch->acBuffer, (orxU32)pstPrefetch->s64Size) : orxConfig_LoadBinary(_zFileName, hResource, acBuffer, u32Size);
+
+          break;
+        }
+
         /* Has encryption tag? */
         if(orxString_NCompare(acBuffer, orxCONFIG_KZ_ENCRYPTION_TAG, orxCONFIG_KU32_ENCRYPTION_TAG_LENGTH) == 0)
         {
@@ -4248,6 +5388,13 @@ orxSTATUS orxFASTCALL orxConfig_Load(const orxSTRING _zFileName)
           acBuffer[u32Size++] = orxCHAR_LF;
         }
 
+        /* Prefetch enabled? */
+        if((orxCONFIG_KU32_PREFETCH_THREAD_NUMBER != 0) && (sstConfig.bIncludePrefetch != orxFALSE))
+        {
+          /* Starts reading upcoming includes on prefetch threads while this chunk gets processed */
+          orxConfig_PrefetchIncludes(acBuffer + u32Offset, u32Size - u32Offset);
+        }
+
         /* Processes buffer */
         u32Offset = orxConfig_ProcessBuffer(_zFileName, acBuffer, u32Size, u32Offset);
 
@@ -4267,8 +5414,17 @@ orxSTATUS orxFASTCALL orxConfig_Load(const orxSTRING _zFileName)
     /* Restores previous encryption character */
     sstConfig.pcEncryptionChar = pcPreviousEncryptionChar;
 
-    /* Closes file */
-    orxResource_Close(hResource);
+    /* Was prefetched? */
+    if(pstPrefetch != orxNULL)
+    {
+      /* Deletes prefetch */
+      orxConfig_DeletePrefetch(pstPrefetch);
+    }
+    else
+    {
+      /* Closes file */
+      orxResource_Close(hResource);
+    }
   }
   else
   {
@@ -4288,9 +5444,19 @@ orxSTATUS orxFASTCALL orxConfig_Load(const orxSTRING _zFileName)
   /* External call? */
   if(sstConfig.u32LoadCount == 0)
   {
+    /* Has unused prefetches? */
+    if((sstConfig.pstPrefetchBank != orxNULL) && (orxBank_GetCount(sstConfig.pstPrefetchBank) != 0))
+    {
+      /* Deletes them */
+      orxConfig_ClearPrefetches();
+    }
+
     /* Optimizes the section table */
     orxHashTable_Optimize(sstConfig.pstSectionTable);
 
+    /* Logs load time, to compare cold boots with and without include prefetch */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "[%s]: Loaded in %.3fms, include prefetch %s (%u file(s) prefetched).", _zFileName, orx2D(1000.0) * (orxSystem_GetSystemTime() - sstConfig.dLoadStartTime), (sstConfig.bIncludePrefetch != orxFALSE) ? "on" : "off", sstConfig.u32PrefetchUseCount);
+
     /* Profiles */
     orxPROFILER_POP_MARKER();
   }
@@ -4313,9 +5479,40 @@ orxSTATUS orxFASTCALL orxConfig_LoadFromMemory(orxCHAR *_acBuffer, orxU32 _u32Bu
   orxASSERT(_acBuffer != orxNULL);
   orxASSERT(_u32BufferSize > 0);
 
-  /* Valid? */
+  /* Binary data? */
   if((_acBuffer != orxNULL)
-  && (_u32BufferSize > 0))
+  && (_u32BufferSize >= orxCONFIG_KU32_BINARY_TAG_LENGTH)
+  && (orxMemory_Compare(_acBuffer, orxCONFIG_KZ_BINARY_TAG, orxCONFIG_KU32_BINARY_TAG_LENGTH) == 0))
+  {
+    /* Aligned? */
+    if(orxALIGN(_acBuffer, sizeof(orxU32)) == (size_t)_acBuffer)
+    {
+      /* Loads it */
+      eResult = orxConfig_ProcessBinaryBuffer(orxCONFIG_KZ_CONFIG_MEMORY, (const orxU8 *)_acBuffer, _u32BufferSize);
+    }
+    else
+    {
+      orxU8 *pu8Buffer;
+
+      /* Allocates aligned buffer */
+      pu8Buffer = (orxU8 *)orxMemory_Allocate(_u32BufferSize, orxMEMORY_TYPE_TEMP);
+
+      /* Checks */
+      orxASSERT(pu8Buffer != orxNULL);
+
+      /* Copies content */
+      orxMemory_Copy(pu8Buffer, _acBuffer, _u32BufferSize);
+
+      /* Loads it */
+      eResult = orxConfig_ProcessBinaryBuffer(orxCONFIG_KZ_CONFIG_MEMORY, pu8Buffer, _u32BufferSize);
+
+      /* Frees buffer */
+      orxMemory_Free(pu8Buffer);
+    }
+  }
+  /* Valid? */
+  else if((_acBuffer != orxNULL)
+       && (_u32BufferSize > 0))
   {
     orxBOOL bProcess = orxTRUE;
 
@@ -4685,6 +5882,213 @@ orxSTATUS orxFASTCALL orxConfig_Save(const orxSTRING _zFileName, orxBOOL _bUseEn
   return eResult;
 }
 
+/** Writes config to given file using the binary format, which is loaded without any parsing. Will overwrite any existing file.
+ * @param[in] _zFileName        File name, if null or empty the default file name will be used
+ * @param[in] _pfnSaveCallback  Callback used to filter section/key to save. If NULL is passed, all section/keys will be saved
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxConfig_SaveBinary(const orxSTRING _zFileName, const orxCONFIG_SAVE_FUNCTION _pfnSaveCallback)
+{
+  const orxSTRING zResourceLocation;
+  const orxSTRING zFileName;
+  orxHANDLE       hResource;
+  orxSTATUS       eResult = orxSTATUS_FAILURE;
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxConfig_SaveBinary");
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
+
+  /* Is given an invalid file name? */
+  if((_zFileName == orxNULL) || (_zFileName == orxSTRING_EMPTY))
+  {
+    /* Uses default file */
+    zFileName = sstConfig.zBaseFile;
+  }
+  else
+  {
+    /* Uses given one */
+    zFileName = _zFileName;
+  }
+
+  /* Valid file to open? */
+  if(((zResourceLocation = orxResource_LocateInStorage(orxCONFIG_KZ_RESOURCE_GROUP, orxNULL, zFileName)) != orxNULL)
+  && ((hResource = orxResource_Open(zResourceLocation, orxTRUE)) != orxHANDLE_UNDEFINED))
+  {
+    orxCONFIG_BINARY_HEADER stHeader;
+    orxCONFIG_BINARY_BUFFER stStringBuffer, stSectionBuffer, stEntryBuffer, stIndexBuffer, stDataBuffer;
+    orxCONFIG_SECTION      *pstSection;
+    orxHASHTABLE           *pstStringTable;
+
+    /* Inits buffers */
+    orxMemory_Zero(&stStringBuffer, sizeof(orxCONFIG_BINARY_BUFFER));
+    orxMemory_Zero(&stSectionBuffer, sizeof(orxCONFIG_BINARY_BUFFER));
+    orxMemory_Zero(&stEntryBuffer, sizeof(orxCONFIG_BINARY_BUFFER));
+    orxMemory_Zero(&stIndexBuffer, sizeof(orxCONFIG_BINARY_BUFFER));
+    orxMemory_Zero(&stDataBuffer, sizeof(orxCONFIG_BINARY_BUFFER));
+
+    /* Creates string table */
+    pstStringTable = orxHashTable_Create(orxCONFIG_KU32_SECTION_BANK_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_TEMP);
+
+    /* Checks */
+    orxASSERT(pstStringTable != orxNULL);
+
+    /* For all sections */
+    for(pstSection = (orxCONFIG_SECTION *)orxLinkList_GetFirst(&(sstConfig.stSectionList));
+        pstSection != orxNULL;
+        pstSection = (orxCONFIG_SECTION *)orxLinkList_GetNext(&(pstSection->stNode)))
+    {
+      /* No callback or should save it? */
+      if((_pfnSaveCallback == orxNULL) || (_pfnSaveCallback(pstSection->zName, orxNULL, zFileName, orxFALSE) != orxFALSE))
+      {
+        orxCONFIG_BINARY_SECTION *pstBinarySection;
+        orxCONFIG_ENTRY          *pstEntry;
+        orxU32                    u32SectionOffset, u32EntryCount = 0;
+
+        /* Adds its record */
+        u32SectionOffset                  = stSectionBuffer.u32Size;
+        pstBinarySection                  = (orxCONFIG_BINARY_SECTION *)orxConfig_ReserveBinaryBuffer(&stSectionBuffer, sizeof(orxCONFIG_BINARY_SECTION));
+        pstBinarySection->u32NameIndex    = orxConfig_AddBinaryString(pstStringTable, &stStringBuffer, &stDataBuffer, pstSection->zName);
+        pstBinarySection->u32ParentIndex  = (pstSection->pstParent == orxHANDLE_UNDEFINED)
+                                            ? orxCONFIG_KU32_BINARY_PARENT_NO_DEFAULT
+                                            : (pstSection->pstParent != orxNULL)
+                                              ? orxConfig_AddBinaryString(pstStringTable, &stStringBuffer, &stDataBuffer, pstSection->pstParent->zName)
+                                              : orxCONFIG_KU32_BINARY_PARENT_NONE;
+
+        /* For all entries */
+        for(pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetFirst(&(pstSection->stEntryList));
+            pstEntry != orxNULL;
+            pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode)))
+        {
+          const orxSTRING zKey;
+
+          /* Gets key */
+          zKey = orxString_GetFromID(pstEntry->stID);
+
+          /* No callback or should save it? */
+          if((_pfnSaveCallback == orxNULL) || (_pfnSaveCallback(pstSection->zName, zKey, zFileName, orxFALSE) != orxFALSE))
+          {
+            orxCONFIG_BINARY_ENTRY *pstBinaryEntry;
+            const orxCONFIG_VALUE  *pstValue;
+
+            /* Gets its value */
+            pstValue = &(pstEntry->stValue);
+
+            /* Adds its record */
+            pstBinaryEntry                = (orxCONFIG_BINARY_ENTRY *)orxConfig_ReserveBinaryBuffer(&stEntryBuffer, sizeof(orxCONFIG_BINARY_ENTRY));
+            orxMemory_Zero(pstBinaryEntry, sizeof(orxCONFIG_BINARY_ENTRY));
+            pstBinaryEntry->u32KeyIndex   = orxConfig_AddBinaryString(pstStringTable, &stStringBuffer, &stDataBuffer, zKey);
+            pstBinaryEntry->u16Type       = pstValue->u16Type;
+            pstBinaryEntry->u16Flags      = pstValue->u16Flags;
+            pstBinaryEntry->u16ListCount  = pstValue->u16ListCount;
+            pstBinaryEntry->u16CacheIndex = pstValue->u16CacheIndex;
+            orxMemory_Copy(&(pstBinaryEntry->vValue), &(pstValue->vValue), sizeof(orxVECTOR));
+            orxMemory_Copy(&(pstBinaryEntry->vAltValue), &(pstValue->vAltValue), sizeof(orxVECTOR));
+            orxMemory_Copy(&(pstBinaryEntry->vStepValue), &(pstValue->vStepValue), sizeof(orxVECTOR));
+
+            /* Is a list? */
+            if(orxFLAG_GET(pstValue->u16Flags, orxCONFIG_VALUE_KU16_FLAG_LIST | orxCONFIG_VALUE_KU16_FLAG_BLOCK_MODE) == orxCONFIG_VALUE_KU16_FLAG_LIST)
+            {
+              orxU32 u32LastOffset;
+
+              /* Gets its last item offset */
+              u32LastOffset = pstValue->au32ListIndexTable[pstValue->u16ListCount - 2];
+
+              /* Stores its content as is, hidden separators included */
+              pstBinaryEntry->u32Value      = stDataBuffer.u32Size;
+              pstBinaryEntry->u32ValueSize  = u32LastOffset + orxString_GetLength(pstValue->zValue + u32LastOffset) + 1;
+              pstBinaryEntry->u32IndexOffset= stIndexBuffer.u32Size / sizeof(orxU32);
+              orxMemory_Copy(orxConfig_ReserveBinaryBuffer(&stDataBuffer, pstBinaryEntry->u32ValueSize), pstValue->zValue, pstBinaryEntry->u32ValueSize);
+
+              /* Stores its index table */
+              orxMemory_Copy(orxConfig_ReserveBinaryBuffer(&stIndexBuffer, (pstValue->u16ListCount - 1) * sizeof(orxU32)), pstValue->au32ListIndexTable, (pstValue->u16ListCount - 1) * sizeof(orxU32));
+            }
+            else
+            {
+              /* Stores its content */
+              pstBinaryEntry->u32Value      = orxConfig_AddBinaryString(pstStringTable, &stStringBuffer, &stDataBuffer, pstValue->zValue);
+            }
+
+            /* Updates entry count */
+            u32EntryCount++;
+          }
+        }
+
+        /* Updates section record (buffer might have been moved) */
+        ((orxCONFIG_BINARY_SECTION *)(stSectionBuffer.pu8Data + u32SectionOffset))->u32EntryCount = u32EntryCount;
+      }
+    }
+
+    /* Inits header */
+    orxMemory_Copy(stHeader.acTag, orxCONFIG_KZ_BINARY_TAG, orxCONFIG_KU32_BINARY_TAG_LENGTH);
+    stHeader.u32Version       = orxCONFIG_KU32_BINARY_VERSION;
+    stHeader.u32ByteOrder     = orxCONFIG_KU32_BINARY_BYTE_ORDER;
+    stHeader.u32VectorSize    = sizeof(orxVECTOR);
+    stHeader.u32StringCount   = stStringBuffer.u32Size / sizeof(orxU32);
+    stHeader.u32SectionCount  = stSectionBuffer.u32Size / sizeof(orxCONFIG_BINARY_SECTION);
+    stHeader.u32EntryCount    = stEntryBuffer.u32Size / sizeof(orxCONFIG_BINARY_ENTRY);
+    stHeader.u32IndexCount    = stIndexBuffer.u32Size / sizeof(orxU32);
+    stHeader.u32DataSize      = stDataBuffer.u32Size;
+
+    /* Writes all blocks */
+    if((orxResource_Write(hResource, sizeof(orxCONFIG_BINARY_HEADER), &stHeader, orxNULL, orxNULL) == (orxS64)sizeof(orxCONFIG_BINARY_HEADER))
+    && (orxResource_Write(hResource, (orxS64)stStringBuffer.u32Size, stStringBuffer.pu8Data, orxNULL, orxNULL) == (orxS64)stStringBuffer.u32Size)
+    && (orxResource_Write(hResource, (orxS64)stSectionBuffer.u32Size, stSectionBuffer.pu8Data, orxNULL, orxNULL) == (orxS64)stSectionBuffer.u32Size)
+    && (orxResource_Write(hResource, (orxS64)stEntryBuffer.u32Size, stEntryBuffer.pu8Data, orxNULL, orxNULL) == (orxS64)stEntryBuffer.u32Size)
+    && (orxResource_Write(hResource, (orxS64)stIndexBuffer.u32Size, stIndexBuffer.pu8Data, orxNULL, orxNULL) == (orxS64)stIndexBuffer.u32Size)
+    && (orxResource_Write(hResource, (orxS64)stDataBuffer.u32Size, stDataBuffer.pu8Data, orxNULL, orxNULL) == (orxS64)stDataBuffer.u32Size))
+    {
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "[%s]: Can't save binary file, write error!", zFileName);
+    }
+
+    /* Flushes & closes the resource */
+    orxResource_Close(hResource);
+
+    /* Deletes string table */
+    orxHashTable_Delete(pstStringTable);
+
+    /* Frees buffers */
+    if(stStringBuffer.pu8Data != orxNULL)
+    {
+      orxMemory_Free(stStringBuffer.pu8Data);
+    }
+    if(stSectionBuffer.pu8Data != orxNULL)
+    {
+      orxMemory_Free(stSectionBuffer.pu8Data);
+    }
+    if(stEntryBuffer.pu8Data != orxNULL)
+    {
+      orxMemory_Free(stEntryBuffer.pu8Data);
+    }
+    if(stIndexBuffer.pu8Data != orxNULL)
+    {
+      orxMemory_Free(stIndexBuffer.pu8Data);
+    }
+    if(stDataBuffer.pu8Data != orxNULL)
+    {
+      orxMemory_Free(stDataBuffer.pu8Data);
+    }
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "[%s]: Can't save binary file, can't open file on disk!", zFileName);
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return eResult;
+}
+
 /** Copies a file with optional encryption
  * @param[in] _zDstFileName     Name of the destination file
  * @param[in] _zSrcFileName     Name of the source file
@@ -60,7 +60,8 @@
 
 /** Misc
  */
-#define orxCONSOLE_KU32_LOG_BUFFER_SIZE               65536                           /**< Log buffer size */
+#define orxCONSOLE_KU32_LOG_BUFFER_SIZE               65536                           /**< Log buffer size, has to be a power of two */
+#define orxCONSOLE_KU32_LOG_LINE_NUMBER               4096                            /**< Log line number, has to be a power of two */
 #define orxCONSOLE_KU32_DEFAULT_LOG_LINE_LENGTH       128                             /**< Default log line length */
 
 #define orxCONSOLE_KU32_INPUT_ENTRY_SIZE              256                             /**< Input entry size */
@@ -123,8 +124,11 @@ typedef struct __orxCONSOLE_STATIC_t
 {
   orxCHAR                   acLogBuffer[orxCONSOLE_KU32_LOG_BUFFER_SIZE];             /**< Log buffer */
   orxCONSOLE_INPUT_ENTRY    astInputEntryList[orxCONSOLE_KU32_INPUT_ENTRY_NUMBER];    /**< Input entry number */
+  orxU32                    au32LogLineList[orxCONSOLE_KU32_LOG_LINE_NUMBER];         /**< Log line list (absolute start positions) */
   orxU32                    u32LogIndex;                                              /**< Log buffer index */
-  orxU32                    u32LogEndIndex;                                           /**< Log end index */
+  orxU32                    u32LogBase;                                               /**< Log buffer base (absolute position of its start) */
+  orxU32                    u32LogLineCount;                                          /**< Log line count */
+  orxU32                    u32LogFirstLine;                                          /**< Log first available line */
   orxU32                    u32LogLineLength;                                         /**< Log line length */
   orxU32                    u32LogLineOffset;                                         /**< Log line offset */
   orxU32                    u32InputIndex;                                            /**< Input index */
@@ -326,6 +330,52 @@ static orxINLINE orxU32 orxConsole_PrintLastResult(orxCHAR *_acBuffer, orxU32 _u
   return u32Result;
 }
 
+/** Adds a log line
+ * @param[in]   _u32Start     Index of the line start in the log buffer
+ */
+static orxINLINE void orxConsole_AddLogLine(orxU32 _u32Start)
+{
+  /* Stores its absolute start position */
+  sstConsole.au32LogLineList[sstConsole.u32LogLineCount & (orxCONSOLE_KU32_LOG_LINE_NUMBER - 1)] = sstConsole.u32LogBase + _u32Start;
+
+  /* Updates line count */
+  sstConsole.u32LogLineCount++;
+
+  /* Done! */
+  return;
+}
+
+/** Discards log lines that were either evicted from the line list or overwritten in the log buffer
+ */
+static orxINLINE void orxConsole_DiscardLogLines()
+{
+  orxU32 u32End;
+
+  /* Gets absolute end position */
+  u32End = sstConsole.u32LogBase + sstConsole.u32LogIndex;
+
+  /* While oldest line is no longer available */
+  while((sstConsole.u32LogFirstLine != sstConsole.u32LogLineCount)
+     && ((sstConsole.u32LogLineCount - sstConsole.u32LogFirstLine > orxCONSOLE_KU32_LOG_LINE_NUMBER)
+      || (u32End - sstConsole.au32LogLineList[sstConsole.u32LogFirstLine & (orxCONSOLE_KU32_LOG_LINE_NUMBER - 1)] > orxCONSOLE_KU32_LOG_BUFFER_SIZE)))
+  {
+    /* Discards it */
+    sstConsole.u32LogFirstLine++;
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Gets number of available log lines
+ * @return Available log line count
+ */
+static orxINLINE orxU32 orxConsole_GetLogLineCount()
+{
+  /* Done! */
+  return sstConsole.u32LogLineCount - sstConsole.u32LogFirstLine;
+}
+
 /** Update callback
  */
 static void orxFASTCALL orxConsole_Update(const orxCLOCK_INFO *_pstClockInfo, void *_pContext)
@@ -856,8 +906,9 @@ static void orxFASTCALL orxConsole_Update(const orxCLOCK_INFO *_pstClockInfo, vo
       u32ScrollSize = orxMAX(u32ScrollSize, 1);
       orxConfig_PopSection();
 
-      /* Updates offset */
+      /* Updates offset, keeping at least one line visible */
       sstConsole.u32LogLineOffset = (sstConsole.u32LogLineOffset <= 0xFFFFFFFF - u32ScrollSize) ? sstConsole.u32LogLineOffset + u32ScrollSize : 0xFFFFFFFF;
+      sstConsole.u32LogLineOffset = orxMIN(sstConsole.u32LogLineOffset, orxMAX(orxConsole_GetLogLineCount(), 1) - 1);
 
       /* Sets input repeat */
       orxConsole_RepeatInput(orxCONSOLE_KZ_INPUT_SCROLL_UP);
@@ -1271,9 +1322,6 @@ orxSTATUS orxFASTCALL orxConsole_Init()
           orxU32  i, u32Count;
           orxBOOL bDebugLevelBackup;
 
-          /* Inits log end index */
-          sstConsole.u32LogEndIndex = orxU32_UNDEFINED;
-
           /* Pushes config section */
           orxConfig_PushSection(orxCONSOLE_KZ_CONFIG_SECTION);
 
@@ -1541,7 +1589,7 @@ orxSTATUS orxFASTCALL orxConsole_SetToggle(orxINPUT_TYPE _eInputType, orxENUM _e
 orxSTATUS orxFASTCALL orxConsole_Log(const orxSTRING _zText)
 {
   const orxCHAR  *pc;
-  orxU32          u32LineLength, u32TextLength;
+  orxU32          u32LineLength, u32TextLength, u32LineStart;
   orxSTATUS       eResult = orxSTATUS_SUCCESS;
 
   /* Profiles */
@@ -1556,15 +1604,15 @@ orxSTATUS orxFASTCALL orxConsole_Log(const orxSTRING _zText)
   /* End of buffer? */
   if(sstConsole.u32LogIndex + u32TextLength + (u32TextLength / sstConsole.u32LogLineLength) + 1 > orxCONSOLE_KU32_LOG_BUFFER_SIZE)
   {
-    /* Stores log end index */
-    sstConsole.u32LogEndIndex = sstConsole.u32LogIndex;
+    /* Updates log base */
+    sstConsole.u32LogBase += orxCONSOLE_KU32_LOG_BUFFER_SIZE;
 
     /* Resets log index */
     sstConsole.u32LogIndex = 0;
   }
 
   /* For all characters */
-  for(u32LineLength = 0, pc = _zText; *pc != orxCHAR_NULL;)
+  for(u32LineLength = 0, u32LineStart = sstConsole.u32LogIndex, pc = _zText; *pc != orxCHAR_NULL;)
   {
     orxU32 u32CharacterCodePoint, u32CharacterLength;
 
@@ -1580,6 +1628,10 @@ orxSTATUS orxFASTCALL orxConsole_Log(const orxSTRING _zText)
       /* Ends string */
       sstConsole.acLogBuffer[sstConsole.u32LogIndex++] = orxCHAR_NULL;
 
+      /* Adds line */
+      orxConsole_AddLogLine(u32LineStart);
+      u32LineStart = sstConsole.u32LogIndex;
+
       /* Resets line length */
       u32LineLength = 0;
     }
@@ -1597,6 +1649,10 @@ orxSTATUS orxFASTCALL orxConsole_Log(const orxSTRING _zText)
         /* Ends string */
         sstConsole.acLogBuffer[sstConsole.u32LogIndex++] = orxCHAR_NULL;
 
+        /* Adds line */
+        orxConsole_AddLogLine(u32LineStart);
+        u32LineStart = sstConsole.u32LogIndex;
+
         /* Updates line length */
         u32LineLength = 0;
       }
@@ -1613,8 +1669,14 @@ orxSTATUS orxFASTCALL orxConsole_Log(const orxSTRING _zText)
   {
     /* Ends string */
     sstConsole.acLogBuffer[sstConsole.u32LogIndex++] = orxCHAR_NULL;
+
+    /* Adds line */
+    orxConsole_AddLogLine(u32LineStart);
   }
 
+  /* Discards unavailable lines */
+  orxConsole_DiscardLogLines();
+
   /* Profiles */
   orxPROFILER_POP_MARKER();
 
@@ -1852,74 +1914,49 @@ const orxSTRING orxFASTCALL orxConsole_GetCompletion(orxU32 _u32Index, orxBOOL *
  */
 const orxSTRING orxFASTCALL orxConsole_GetTrailLogLine(orxU32 _u32TrailLineIndex)
 {
-  orxU32          i, u32LogIndex;
-  orxBOOL         bWrapped;
+  orxU32          u32Index;
   const orxSTRING zResult = orxSTRING_EMPTY;
 
   /* Checks */
   orxASSERT(sstConsole.u32Flags & orxCONSOLE_KU32_STATIC_FLAG_READY);
 
-  /* For all lines */
-  for(i = 0, u32LogIndex = (sstConsole.u32LogIndex != 0) ? sstConsole.u32LogIndex - 1 : 0, bWrapped = orxFALSE; i <= _u32TrailLineIndex + sstConsole.u32LogLineOffset; i++)
+  /* Gets line index from the end */
+  u32Index = _u32TrailLineIndex + sstConsole.u32LogLineOffset;
+
+  /* Valid? */
+  if((u32Index >= _u32TrailLineIndex) && (u32Index < orxConsole_GetLogLineCount()))
   {
-    /* Not wrapped yet? */
-    if(bWrapped == orxFALSE)
-    {
-      /* End of buffer? */
-      if(u32LogIndex == 0)
-      {
-        /* Valid? */
-        if(sstConsole.u32LogEndIndex != orxU32_UNDEFINED)
-        {
-          /* Wraps around */
-          u32LogIndex = sstConsole.u32LogEndIndex;
+    /* Updates result */
+    zResult = &sstConsole.acLogBuffer[sstConsole.au32LogLineList[(sstConsole.u32LogLineCount - 1 - u32Index) & (orxCONSOLE_KU32_LOG_LINE_NUMBER - 1)] & (orxCONSOLE_KU32_LOG_BUFFER_SIZE - 1)];
+  }
 
-          /* Updates wrap status */
-          bWrapped = orxTRUE;
-        }
-        else
-        {
-          /* Stops */
-          break;
-        }
-      }
-      else
-      {
-        /* Updates index */
-        u32LogIndex = u32LogIndex - 1;
-      }
-    }
-    else
-    {
-      /* End of buffer? */
-      if(u32LogIndex <= sstConsole.u32LogIndex)
-      {
-        /* Stops */
-        break;
-      }
-      else
-      {
-        /* Updates index */
-        u32LogIndex = u32LogIndex - 1;
-      }
-    }
+  /* Done! */
+  return zResult;
+}
 
-    /* Finds start of current log line */
-    while((u32LogIndex != 0) && (sstConsole.acLogBuffer[u32LogIndex] != orxCHAR_NULL))
-    {
-      u32LogIndex--;
-    }
-  }
+/** Gets log line ID from the end (trail), using internal offset: a line keeps its ID, and its content, for as long as it remains in the log
+ * @param[in]   _u32TrailLineIndex Index of the line starting from end
+ * @return Line ID / orxU32_UNDEFINED
+ */
+orxU32 orxFASTCALL orxConsole_GetTrailLogLineID(orxU32 _u32TrailLineIndex)
+{
+  orxU32 u32Index, u32Result = orxU32_UNDEFINED;
+
+  /* Checks */
+  orxASSERT(sstConsole.u32Flags & orxCONSOLE_KU32_STATIC_FLAG_READY);
 
-  /* Found? */
-  if(i > _u32TrailLineIndex + sstConsole.u32LogLineOffset)
+  /* Gets line index from the end */
+  u32Index = _u32TrailLineIndex + sstConsole.u32LogLineOffset;
+
+  /* Valid? */
+  if((u32Index >= _u32TrailLineIndex) && (u32Index < orxConsole_GetLogLineCount()))
   {
     /* Updates result */
-    zResult = &sstConsole.acLogBuffer[(u32LogIndex != 0) ? u32LogIndex + 1 : u32LogIndex];
+    u32Result = sstConsole.u32LogLineCount - 1 - u32Index;
   }
 
   /* Done! */
-  return zResult;
+  return u32Result;
 }
 
 /** Gets log line offset from the end
@@ -555,6 +555,52 @@ orxSTATUS orxFASTCALL orxEvent_SendShort(orxEVENT_TYPE _eEventType, orxENUM _eEv
   return eResult;
 }
 
+/** Has a handler for the given event type & ID?
+ * @param[in] _eEventType           Event type
+ * @param[in] _eEventID             Event ID
+ * @return orxTRUE if at least one handler would be called for this event, orxFALSE otherwise
+ */
+orxBOOL orxFASTCALL orxEvent_HasHandler(orxEVENT_TYPE _eEventType, orxENUM _eEventID)
+{
+  orxEVENT_HANDLER_STORAGE *pstStorage;
+  orxBOOL                   bResult = orxFALSE;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_READY));
+  orxASSERT((_eEventID >= 0) && (_eEventID < 32));
+
+  /* Gets corresponding storage */
+  pstStorage = (_eEventType < orxEVENT_TYPE_CORE_NUMBER) ? sstEvent.astCoreHandlerStorageList[_eEventType] : (orxEVENT_HANDLER_STORAGE *)orxHashTable_Get(sstEvent.pstHandlerStorageTable, _eEventType);
+
+  /* Valid? */
+  if(pstStorage != orxNULL)
+  {
+    orxEVENT_HANDLER_INFO  *pstInfo;
+    orxU32                  u32IDFlag;
+
+    /* Get its ID flag */
+    u32IDFlag = orxEVENT_GET_FLAG(_eEventID);
+
+    /* For all handlers */
+    for(pstInfo = (orxEVENT_HANDLER_INFO *)orxLinkList_GetFirst(&(pstStorage->stList));
+        pstInfo != orxNULL;
+        pstInfo = (orxEVENT_HANDLER_INFO *)orxLinkList_GetNext(&(pstInfo->stNode)))
+    {
+      /* Listens to this ID? */
+      if(orxFLAG_TEST(pstInfo->u32IDFlags, u32IDFlag))
+      {
+        /* Updates result */
+        bResult = orxTRUE;
+
+        break;
+      }
+    }
+  }
+
+  /* Done! */
+  return bResult;
+}
+
 /** Is currently sending an event?
  * @return orxTRUE / orxFALSE
  */
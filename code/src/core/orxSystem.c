@@ -46,6 +46,7 @@
 
   #endif /* __orxMAC__ || __orxIOS__ */
 
+  #include <errno.h>
   #include <unistd.h>
   #include <sys/time.h>
 
@@ -370,6 +371,81 @@ void orxFASTCALL orxSystem_Delay(orxFLOAT _fSeconds)
   return;
 }
 
+/** Delays the program until given time
+ * @param[in] _dTime                Time to wait for, expressed as returned by orxSystem_GetTime()
+ */
+void orxFASTCALL orxSystem_DelayUntil(orxDOUBLE _dTime)
+{
+  /* Checks */
+  orxASSERT((sstSystem.u32Flags & orxSYSTEM_KU32_STATIC_FLAG_READY) == orxSYSTEM_KU32_STATIC_FLAG_READY);
+
+#ifdef __orxWINDOWS__
+
+  {
+    orxDOUBLE dDelay;
+
+    /* Gets remaining delay */
+    dDelay = _dTime - orxSystem_GetTime();
+
+    /* Should wait? */
+    if(dDelay > orxDOUBLE_0)
+    {
+      /* Sleeps */
+      Sleep((DWORD)(dDelay * orx2D(1000.0)));
+    }
+  }
+
+#else /* __orxWINDOWS__ */
+
+  #if defined(__orxMAC__) || defined(__orxIOS__)
+
+  /* Waits until absolute deadline */
+  mach_wait_until((uint64_t)((_dTime + sstSystem.dStartTime) / sstSystem.dResolution));
+
+  #else /* __orxMAC__ || __orxIOS__ */
+
+    #if defined(CLOCK_MONOTONIC) && defined(TIMER_ABSTIME)
+
+  /* Use monotonic clock? */
+  if(sstSystem.bUseMonotonic != orxFALSE)
+  {
+    struct timespec stDeadline;
+    orxDOUBLE       dDeadline;
+
+    /* Gets absolute deadline */
+    dDeadline           = _dTime + sstSystem.dStartTime;
+    stDeadline.tv_sec   = (time_t)dDeadline;
+    stDeadline.tv_nsec  = (long)((dDeadline - orx2D(stDeadline.tv_sec)) * orx2D(1000000000.0));
+
+    /* Waits until deadline, restarting after signal interruptions */
+    while(clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &stDeadline, NULL) == EINTR);
+  }
+  else
+
+    #endif /* CLOCK_MONOTONIC && TIMER_ABSTIME */
+
+  {
+    orxDOUBLE dDelay;
+
+    /* Gets remaining delay */
+    dDelay = _dTime - orxSystem_GetTime();
+
+    /* Should wait? */
+    if(dDelay > orxDOUBLE_0)
+    {
+      /* Sleeps */
+      usleep((useconds_t)(dDelay * orx2D(1000000.0)));
+    }
+  }
+
+  #endif /* __orxMAC__ || __orxIOS__ */
+
+#endif /* __orxWINDOWS__ */
+
+  /* Done! */
+  return;
+}
+
 /** Gets orx version (compiled)
  * @param[out] _pstVersion          Structure to fill with current version
  * @return Compiled version
@@ -85,6 +85,9 @@
 
 #define orxTHREAD_KZ_THREAD_NAME_MAIN                 "Main"
 #define orxTHREAD_KZ_THREAD_NAME_WORKER               "Task Runner"
+#define orxTHREAD_KZ_THREAD_NAME_LOG_WRITER           "Log Writer"
+
+#define orxTHREAD_KF_LOG_WRITER_DELAY                 orx2F(0.005f)
 
 
 /***************************************************************************
@@ -135,6 +138,7 @@ typedef struct __orxTHREAD_STATIC_t
   orxTHREAD_SEMAPHORE    *pstTaskSemaphore;
   orxTHREAD_SEMAPHORE    *pstWorkerSemaphore;
   orxU32                  u32WorkerID;
+  orxU32                  u32LogWriterID;
   volatile orxU32         u32TaskInIndex;
   volatile orxU32         u32TaskProcessIndex;
   volatile orxU32         u32TaskOutIndex;
@@ -278,6 +282,19 @@ static orxSTATUS orxFASTCALL orxThread_Work(void *_pContext)
 }
 
 
+static orxSTATUS orxFASTCALL orxThread_WriteLog(void *_pContext)
+{
+  /* Writes pending logs */
+  _orxDebug_Flush();
+
+  /* Waits for the next batch */
+  orxSystem_Delay(orxTHREAD_KF_LOG_WRITER_DELAY);
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+
 /***************************************************************************
  * Public functions                                                        *
  ***************************************************************************/
@@ -368,6 +385,21 @@ orxSTATUS orxFASTCALL orxThread_Init()
       /* Success? */
       if(sstThread.u32WorkerID != orxU32_UNDEFINED)
       {
+        /* Creates log writer thread */
+        sstThread.u32LogWriterID = orxThread_Start(orxThread_WriteLog, orxTHREAD_KZ_THREAD_NAME_LOG_WRITER, orxNULL);
+
+        /* Success? */
+        if(sstThread.u32LogWriterID != orxU32_UNDEFINED)
+        {
+          /* Hands terminal & file logs over to it */
+          _orxDebug_EnableAsyncWriting(orxTRUE);
+        }
+        else
+        {
+          /* Logs message */
+          orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Couldn't start log writer thread, logs will be written synchronously.");
+        }
+
         /* Updates result */
         eResult = orxSTATUS_SUCCESS;
       }
@@ -429,6 +461,13 @@ void orxFASTCALL orxThread_Exit()
   {
     /* Updates worker thread stop flag */
     orxFLAG_SET(sstThread.astThreadInfoList[sstThread.u32WorkerID].u32Flags, orxTHREAD_KU32_INFO_FLAG_STOP, orxTHREAD_KU32_INFO_FLAG_NONE);
+
+    /* Has log writer thread? */
+    if(sstThread.u32LogWriterID != orxU32_UNDEFINED)
+    {
+      /* Updates its stop flag */
+      orxFLAG_SET(sstThread.astThreadInfoList[sstThread.u32LogWriterID].u32Flags, orxTHREAD_KU32_INFO_FLAG_STOP, orxTHREAD_KU32_INFO_FLAG_NONE);
+    }
     orxMEMORY_BARRIER();
 
     /* Re-enables all threads */
@@ -440,6 +479,9 @@ void orxFASTCALL orxThread_Exit()
     /* Joins all remaining threads */
     orxThread_JoinAll();
 
+    /* Writes remaining logs synchronously */
+    _orxDebug_EnableAsyncWriting(orxFALSE);
+
 #ifdef __orxWINDOWS__
 
     /* Resets time slices */
@@ -32,6 +32,7 @@
 
 #include "debug/orxDebug.h"
 #include "core/orxConsole.h"
+#include "memory/orxMemory.h"
 
 #include <stdlib.h>
 
@@ -61,7 +62,7 @@
 
 #define orxDEBUG_KU32_STATIC_FLAG_READY         0x10000000
 #define orxDEBUG_KU32_STATIC_FLAG_ANSI          0x20000000
-#define orxDEBUG_KU32_STATIC_FLAG_LOGGING       0x40000000
+#define orxDEBUG_KU32_STATIC_FLAG_ASYNC         0x80000000
 
 #define orxDEBUG_KU32_STATIC_MASK_ALL           0xFFFFFFFF
 
@@ -75,10 +76,41 @@
 
 #endif /* __orxDEBUG__ */
 
+#ifndef orxDEBUG_KU32_RECORD_NUMBER
+  #define orxDEBUG_KU32_RECORD_NUMBER           64          /**< Record ring size, has to be a power of two, can be overridden at build time */
+#endif /* !orxDEBUG_KU32_RECORD_NUMBER */
+
+#ifdef __orxMSVC__
+  #define orxDEBUG_THREAD_LOCAL                 __declspec(thread)
+#else /* __orxMSVC__ */
+  #define orxDEBUG_THREAD_LOCAL                 __thread
+#endif /* __orxMSVC__ */
+
+#define orxDEBUG_KZ_BACKUP_SUFFIX               ".1"
+#define orxDEBUG_KZ_DROP_FORMAT                 "[DROPPED] %u log record(s) lost, log ring buffer was full."
+
 /***************************************************************************
  * Structure declaration                                                   *
  ***************************************************************************/
 
+/** Log record
+ */
+typedef struct __orxDEBUG_RECORD_t
+{
+  /* Sequence */
+  volatile orxU32 u32Sequence;
+
+  /* Debug level */
+  orxDEBUG_LEVEL eLevel;
+
+  /* Output flags */
+  orxU32 u32DebugFlags;
+
+  /* Formatted log */
+  orxCHAR zBuffer[orxDEBUG_KS32_BUFFER_OUTPUT_SIZE];
+
+} orxDEBUG_RECORD;
+
 /** Static structure
  */
 typedef struct __orxDEBUG_STATIC_t
@@ -107,6 +139,33 @@ typedef struct __orxDEBUG_STATIC_t
   /* Log callback function */
   orxDEBUG_CALLBACK_FUNCTION pfnLogCallback;
 
+  /* Debug file size */
+  orxU32 u32DebugFileSize;
+
+  /* Log file size */
+  orxU32 u32LogFileSize;
+
+  /* File max size */
+  orxU32 u32FileMaxSize;
+
+  /* Record write index, shared by all producers */
+  volatile orxU32 u32WriteIndex;
+
+  /* Record read index, only used by the writer */
+  orxU32 u32ReadIndex;
+
+  /* Writer lock */
+  volatile orxU32 u32WriterLock;
+
+  /* Dropped record count */
+  volatile orxU32 u32DropCount;
+
+  /* Reported dropped record count */
+  orxU32 u32ReportedDropCount;
+
+  /* Record ring */
+  orxDEBUG_RECORD astRecordList[orxDEBUG_KU32_RECORD_NUMBER];
+
 } orxDEBUG_STATIC;
 
 
@@ -118,6 +177,10 @@ typedef struct __orxDEBUG_STATIC_t
  */
 static orxDEBUG_STATIC sstDebug;
 
+/** Re-entrance guard, per thread
+ */
+static orxDEBUG_THREAD_LOCAL orxBOOL sbLogging;
+
 
 /***************************************************************************
  * Private functions                                                       *
@@ -303,6 +366,331 @@ static orxINLINE orxBOOL orxDebug_HasANSICodes(orxSTRING _zBuffer)
   return bResult;
 }
 
+/** Acquires the writer lock, spins until available
+ */
+static orxINLINE void orxDebug_LockWriter()
+{
+  /* Spins until acquired */
+  while(orxMEMORY_COMPARE_AND_SWAP(&(sstDebug.u32WriterLock), 0, 1) == orxFALSE)
+    ;
+
+  /* Done! */
+  return;
+}
+
+/** Releases the writer lock
+ */
+static orxINLINE void orxDebug_UnlockWriter()
+{
+  /* Releases it */
+  orxMEMORY_BARRIER();
+  sstDebug.u32WriterLock = 0;
+
+  /* Done! */
+  return;
+}
+
+/** Gets output file for a given level, opens or rotates it if needed (writer lock has to be held)
+ * @param[in]   _eLevel                       Concerned debug level
+ * @param[out]  _ppu32Size                    Corresponding file size storage
+ * @return      FILE / orxNULL
+ */
+static orxINLINE FILE *orxDebug_GetFile(orxDEBUG_LEVEL _eLevel, orxU32 **_ppu32Size)
+{
+  FILE    **ppstFile;
+  orxSTRING zFileName;
+  orxU32   *pu32Size;
+
+  /* Log? */
+  if(_eLevel == orxDEBUG_LEVEL_LOG)
+  {
+    ppstFile  = &(sstDebug.pstLogFile);
+    zFileName = sstDebug.zLogFile;
+    pu32Size  = &(sstDebug.u32LogFileSize);
+  }
+  else
+  {
+    ppstFile  = &(sstDebug.pstDebugFile);
+    zFileName = sstDebug.zDebugFile;
+    pu32Size  = &(sstDebug.u32DebugFileSize);
+  }
+
+#if !defined(__orxANDROID__) && !defined(__orxANDROID_NATIVE__)
+
+  /* Should rotate? */
+  if((*ppstFile != orxNULL) && (sstDebug.u32FileMaxSize != 0) && (*pu32Size >= sstDebug.u32FileMaxSize))
+  {
+    orxCHAR acBackupName[256];
+
+    /* Closes current file */
+    fclose(*ppstFile);
+    *ppstFile = orxNULL;
+
+    /* Gets backup name */
+    acBackupName[255] = orxCHAR_NULL;
+    strncpy(acBackupName, zFileName, 255);
+    strncat(acBackupName, orxDEBUG_KZ_BACKUP_SUFFIX, 255 - strlen(acBackupName));
+
+    /* Replaces previous backup */
+    remove(acBackupName);
+    rename(zFileName, acBackupName);
+  }
+
+  /* Needs to open the file? */
+  if(*ppstFile == orxNULL)
+  {
+    /* Opens it */
+    *ppstFile = fopen(zFileName, "ab+");
+
+    /* Success? */
+    if(*ppstFile != orxNULL)
+    {
+      /* Gets its current size */
+      fseek(*ppstFile, 0, SEEK_END);
+      *pu32Size = (orxU32)ftell(*ppstFile);
+    }
+  }
+
+#endif /* !__orxANDROID__ && !__orxANDROID_NATIVE__ */
+
+  /* Stores size */
+  *_ppu32Size = pu32Size;
+
+  /* Done! */
+  return *ppstFile;
+}
+
+/** Writes a record to terminal & file (writer lock has to be held)
+ * @param[in]   _eLevel                       Debug level associated with this output
+ * @param[in]   _u32DebugFlags                Debug flags to use for this output
+ * @param[in]   _zBuffer                      Formatted log, ANSI codes will get cleared
+ */
+static void orxFASTCALL orxDebug_WriteRecord(orxDEBUG_LEVEL _eLevel, orxU32 _u32DebugFlags, orxSTRING _zBuffer)
+{
+  /* Terminal display? */
+  if(_u32DebugFlags & orxDEBUG_KU32_STATIC_FLAG_TERMINAL)
+  {
+#if defined(__orxANDROID__) || defined(__orxANDROID_NATIVE__)
+
+#define  LOG_TAG    "orxDebug"
+#define  LOGI(...)  __android_log_write(ANDROID_LOG_INFO,LOG_TAG,__VA_ARGS__)
+#define  LOGD(...)  __android_log_write(ANDROID_LOG_DEBUG,LOG_TAG,__VA_ARGS__)
+
+    if(_eLevel == orxDEBUG_LEVEL_LOG)
+    {
+      LOGI(_zBuffer);
+    }
+    else
+    {
+      LOGD(_zBuffer);
+    }
+
+#else /* __orxANDROID__ || __orxANDROID_NATIVE__ */
+
+    fprintf((_eLevel == orxDEBUG_LEVEL_LOG) ? stdout : stderr, "%s", _zBuffer);
+
+#endif /* __orxANDROID__ || __orxANDROID_NATIVE__ */
+  }
+
+  /* Has ANSI support? */
+  if(orxFLAG_TEST(sstDebug.u32Flags, orxDEBUG_KU32_STATIC_FLAG_ANSI))
+  {
+    /* Clears ANSI codes */
+    orxDebug_ClearANSICodes(_zBuffer);
+  }
+
+#ifdef __orxWINDOWS__
+
+  /* Terminal display? */
+  if(_u32DebugFlags & orxDEBUG_KU32_STATIC_FLAG_TERMINAL)
+  {
+    OutputDebugString(_zBuffer);
+  }
+
+#endif /* __orxWINDOWS__ */
+
+  /* File print? */
+  if(_u32DebugFlags & orxDEBUG_KU32_STATIC_FLAG_FILE)
+  {
+    FILE   *pstFile;
+    orxU32 *pu32Size;
+
+    /* Gets file */
+    pstFile = orxDebug_GetFile(_eLevel, &pu32Size);
+
+    /* Valid? */
+    if(pstFile != orxNULL)
+    {
+      int iWritten;
+
+      /* Writes log */
+      iWritten = fprintf(pstFile, "%s", _zBuffer);
+
+      /* Updates file size */
+      if(iWritten > 0)
+      {
+        *pu32Size += (orxU32)iWritten;
+      }
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Writes all published records and reports dropped ones (writer lock has to be held)
+ * @return      Number of written records
+ */
+static orxU32 orxFASTCALL orxDebug_WritePendingRecords()
+{
+  orxU32 u32DropCount, u32Result = 0;
+
+  /* For all published records */
+  for(;;)
+  {
+    orxDEBUG_RECORD *pstRecord;
+
+    /* Gets next record */
+    pstRecord = &(sstDebug.astRecordList[sstDebug.u32ReadIndex & (orxDEBUG_KU32_RECORD_NUMBER - 1)]);
+
+    /* Not published yet? */
+    if(pstRecord->u32Sequence != sstDebug.u32ReadIndex + 1)
+    {
+      break;
+    }
+
+    /* Writes it */
+    orxMEMORY_BARRIER();
+    orxDebug_WriteRecord(pstRecord->eLevel, pstRecord->u32DebugFlags, pstRecord->zBuffer);
+
+    /* Releases it */
+    orxMEMORY_BARRIER();
+    pstRecord->u32Sequence = sstDebug.u32ReadIndex + orxDEBUG_KU32_RECORD_NUMBER;
+    sstDebug.u32ReadIndex++;
+
+    /* Updates result */
+    u32Result++;
+  }
+
+  /* Were records dropped? */
+  if((u32DropCount = sstDebug.u32DropCount) != sstDebug.u32ReportedDropCount)
+  {
+    orxCHAR acBuffer[128];
+
+    /* Reports them */
+#ifdef __orxMSVC__
+
+    _snprintf(acBuffer, sizeof(acBuffer) - 1, orxDEBUG_KZ_DROP_FORMAT "%s", (unsigned int)(u32DropCount - sstDebug.u32ReportedDropCount), orxSTRING_EOL);
+
+#else /* __orxMSVC__ */
+
+    snprintf(acBuffer, sizeof(acBuffer) - 1, orxDEBUG_KZ_DROP_FORMAT "%s", (unsigned int)(u32DropCount - sstDebug.u32ReportedDropCount), orxSTRING_EOL);
+
+#endif /* __orxMSVC__ */
+    acBuffer[sizeof(acBuffer) - 1] = orxCHAR_NULL;
+    orxDebug_WriteRecord(orxDEBUG_LEVEL_LOG, sstDebug.u32DebugFlags, acBuffer);
+    sstDebug.u32ReportedDropCount = u32DropCount;
+
+    /* Updates result */
+    u32Result++;
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Flushes terminal & file outputs (writer lock has to be held)
+ */
+static orxINLINE void orxDebug_FlushOutputs()
+{
+  /* Flushes all outputs */
+  fflush(stdout);
+  fflush(stderr);
+  if(sstDebug.pstLogFile != orxNULL)
+  {
+    fflush(sstDebug.pstLogFile);
+  }
+  if(sstDebug.pstDebugFile != orxNULL)
+  {
+    fflush(sstDebug.pstDebugFile);
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Pushes a record in the ring, never blocks (any thread)
+ * @param[in]   _eLevel                       Debug level associated with this output
+ * @param[in]   _u32DebugFlags                Debug flags to use for this output
+ * @param[in]   _zBuffer                      Formatted log
+ * @return      orxTRUE if pushed, orxFALSE if dropped
+ */
+static orxBOOL orxFASTCALL orxDebug_PushRecord(orxDEBUG_LEVEL _eLevel, orxU32 _u32DebugFlags, const orxSTRING _zBuffer)
+{
+  orxDEBUG_RECORD  *pstRecord = orxNULL;
+  orxU32            u32Index;
+  orxBOOL           bResult = orxFALSE;
+
+  /* Reserves a record */
+  for(u32Index = sstDebug.u32WriteIndex;; u32Index = sstDebug.u32WriteIndex)
+  {
+    orxDEBUG_RECORD  *pstCandidate;
+    orxS32            s32Delta;
+
+    /* Gets candidate */
+    pstCandidate  = &(sstDebug.astRecordList[u32Index & (orxDEBUG_KU32_RECORD_NUMBER - 1)]);
+    s32Delta      = (orxS32)(pstCandidate->u32Sequence - u32Index);
+
+    /* Free? */
+    if(s32Delta == 0)
+    {
+      /* Claims it */
+      if(orxMEMORY_COMPARE_AND_SWAP(&(sstDebug.u32WriteIndex), u32Index, u32Index + 1) != orxFALSE)
+      {
+        /* Selects it */
+        pstRecord = pstCandidate;
+        break;
+      }
+    }
+    /* Full? */
+    else if(s32Delta < 0)
+    {
+      /* Updates drop count */
+      orxMEMORY_INCREMENT(&(sstDebug.u32DropCount));
+      break;
+    }
+  }
+
+  /* Valid? */
+  if(pstRecord != orxNULL)
+  {
+    size_t sLength;
+
+    /* Gets log length */
+    sLength = strlen(_zBuffer);
+    if(sLength > orxDEBUG_KS32_BUFFER_OUTPUT_SIZE - 1)
+    {
+      sLength = orxDEBUG_KS32_BUFFER_OUTPUT_SIZE - 1;
+    }
+
+    /* Stores log (only copies its content, not the whole record buffer) */
+    pstRecord->eLevel         = _eLevel;
+    pstRecord->u32DebugFlags  = _u32DebugFlags;
+    memcpy(pstRecord->zBuffer, _zBuffer, sLength);
+    pstRecord->zBuffer[sLength] = orxCHAR_NULL;
+
+    /* Publishes it */
+    orxMEMORY_BARRIER();
+    pstRecord->u32Sequence    = u32Index + 1;
+
+    /* Updates result */
+    bResult = orxTRUE;
+  }
+
+  /* Done! */
+  return bResult;
+}
+
 
 /***************************************************************************
  * Public functions                                                        *
@@ -347,6 +735,13 @@ orxSTATUS orxFASTCALL _orxDebug_Init()
     /* Inits default debug & level flags */
     sstDebug.u32DebugFlags  = orxDEBUG_KU32_STATIC_MASK_DEFAULT;
     sstDebug.u32LevelFlags  = orxDEBUG_KU32_STATIC_LEVEL_MASK_DEFAULT;
+    sstDebug.u32FileMaxSize = orxDEBUG_KU32_DEFAULT_FILE_MAX_SIZE;
+
+    /* Inits record sequences */
+    for(i = 0; i < orxDEBUG_KU32_RECORD_NUMBER; i++)
+    {
+      sstDebug.astRecordList[i].u32Sequence = i;
+    }
 
 #if defined(__orxANDROID__) || defined(__orxANDROID_NATIVE__)
 
@@ -389,6 +784,9 @@ void orxFASTCALL _orxDebug_Exit()
   /* Initialized? */
   if(sstDebug.u32Flags & orxDEBUG_KU32_STATIC_FLAG_READY)
   {
+    /* Stops asynchronous writing */
+    _orxDebug_EnableAsyncWriting(orxFALSE);
+
 #if !defined(__orxANDROID__) && !defined(__orxANDROID_NATIVE__)
 
     /* Closes files */
@@ -506,7 +904,7 @@ orxU32 orxFASTCALL _orxDebug_GetFlags()
 void orxCDECL _orxDebug_Log(orxDEBUG_LEVEL _eLevel, const orxSTRING _zFunction, const orxSTRING _zFile, orxU32 _u32Line, const orxSTRING _zFormat, ...)
 {
   /* Is level enabled and not re-entrant? */
-  if(orxFLAG_TEST(sstDebug.u32LevelFlags, (1 << _eLevel)) && !orxFLAG_TEST(sstDebug.u32Flags, orxDEBUG_KU32_STATIC_FLAG_LOGGING))
+  if(orxFLAG_TEST(sstDebug.u32LevelFlags, (1 << _eLevel)) && (sbLogging == orxFALSE))
   {
     orxCHAR   zBuffer[orxDEBUG_KS32_BUFFER_OUTPUT_SIZE], zLog[orxDEBUG_KS32_BUFFER_OUTPUT_SIZE], *pcBuffer = zBuffer;
     orxBOOL   bUseANSICodes = orxFALSE;
@@ -514,7 +912,7 @@ void orxCDECL _orxDebug_Log(orxDEBUG_LEVEL _eLevel, const orxSTRING _zFunction,
     va_list   stArgs;
 
     /* Updates status */
-    orxFLAG_SET(sstDebug.u32Flags, orxDEBUG_KU32_STATIC_FLAG_LOGGING, orxDEBUG_KU32_STATIC_FLAG_NONE);
+    sbLogging = orxTRUE;
 
     /* Empties current buffer */
     pcBuffer[0] = orxCHAR_NULL;
@@ -634,104 +1032,29 @@ void orxCDECL _orxDebug_Log(orxDEBUG_LEVEL _eLevel, const orxSTRING _zFunction,
     /* Should continue? */
     if(eStatus != orxSTATUS_FAILURE)
     {
-      /* Terminal display? */
-      if(sstDebug.u32DebugFlags & orxDEBUG_KU32_STATIC_FLAG_TERMINAL)
+      /* Terminal or file output? */
+      if(sstDebug.u32DebugFlags & (orxDEBUG_KU32_STATIC_FLAG_TERMINAL | orxDEBUG_KU32_STATIC_FLAG_FILE))
       {
-#if defined(__orxANDROID__) || defined(__orxANDROID_NATIVE__)
-
-#define  LOG_TAG    "orxDebug"
-#define  LOGI(...)  __android_log_write(ANDROID_LOG_INFO,LOG_TAG,__VA_ARGS__)
-#define  LOGD(...)  __android_log_write(ANDROID_LOG_DEBUG,LOG_TAG,__VA_ARGS__)
-
-        if(_eLevel == orxDEBUG_LEVEL_LOG)
-        {
-          LOGI(zBuffer);
-        }
-        else
+        /* No asynchronous writer or assertion? */
+        if(!orxFLAG_TEST(sstDebug.u32Flags, orxDEBUG_KU32_STATIC_FLAG_ASYNC) || (_eLevel == orxDEBUG_LEVEL_ASSERT))
         {
-          LOGD(zBuffer);
-        }
+          /* Waits for the writer */
+          orxDebug_LockWriter();
 
-#else /* __orxANDROID__ || __orxANDROID_NATIVE__ */
+          /* Writes pending records first, to keep ordering */
+          orxDebug_WritePendingRecords();
 
-        FILE *pstFile;
+          /* Writes it right away, bypassing the ring so that it can't be dropped */
+          orxDebug_WriteRecord(_eLevel, sstDebug.u32DebugFlags, zBuffer);
+          orxDebug_FlushOutputs();
 
-        if(_eLevel == orxDEBUG_LEVEL_LOG)
-        {
-          pstFile = stdout;
+          /* Releases the writer */
+          orxDebug_UnlockWriter();
         }
         else
         {
-          pstFile = stderr;
-        }
-
-        fprintf(pstFile, "%s", zBuffer);
-        fflush(pstFile);
-
-#endif /* __orxANDROID__ || __orxANDROID_NATIVE__ */
-
-      }
-
-      /* Has ANSI support? */
-      if(orxFLAG_TEST(sstDebug.u32Flags, orxDEBUG_KU32_STATIC_FLAG_ANSI))
-      {
-        /* Clears ANSI codes */
-        orxDebug_ClearANSICodes(zBuffer);
-      }
-
-#ifdef __orxWINDOWS__
-
-      /* Terminal display? */
-      if(sstDebug.u32DebugFlags & orxDEBUG_KU32_STATIC_FLAG_TERMINAL)
-      {
-        OutputDebugString(zBuffer);
-      }
-
-#endif /* __orxWINDOWS__ */
-
-      /* File print? */
-      if(sstDebug.u32DebugFlags & orxDEBUG_KU32_STATIC_FLAG_FILE)
-      {
-        FILE *pstFile;
-
-        if(_eLevel == orxDEBUG_LEVEL_LOG)
-        {
-
-#if !defined(__orxANDROID__) && !defined(__orxANDROID_ANDROID__)
-
-          /* Needs to open the file? */
-          if(sstDebug.pstLogFile == orxNULL)
-          {
-            /* Opens it */
-            sstDebug.pstLogFile = fopen(sstDebug.zLogFile, "ab+");
-          }
-
-#endif /* !__orxANDROID__ && !__orxANDROID_NATIVE__ */
-
-          pstFile = sstDebug.pstLogFile;
-        }
-        else
-        {
-
-#if !defined(__orxANDROID__) && !defined(__orxANDROID_ANDROID__)
-
-          /* Needs to open the file? */
-          if(sstDebug.pstDebugFile == orxNULL)
-          {
-            /* Opens it */
-            sstDebug.pstDebugFile = fopen(sstDebug.zDebugFile, "ab+");
-          }
-
-#endif /* !__orxANDROID__ && !__orxANDROID_NATIVE__ */
-
-          pstFile = sstDebug.pstDebugFile;
-        }
-
-        /* Valid? */
-        if(pstFile != orxNULL)
-        {
-          fprintf(pstFile, "%s", zBuffer);
-          fflush(pstFile);
+          /* Pushes it to the writer */
+          orxDebug_PushRecord(_eLevel, sstDebug.u32DebugFlags, zBuffer);
         }
       }
 
@@ -741,6 +1064,13 @@ void orxCDECL _orxDebug_Log(orxDEBUG_LEVEL _eLevel, const orxSTRING _zFunction,
         /* Is console initialized? */
         if(orxModule_IsInitialized(orxMODULE_ID_CONSOLE) != orxFALSE)
         {
+          /* Has ANSI support? */
+          if(orxFLAG_TEST(sstDebug.u32Flags, orxDEBUG_KU32_STATIC_FLAG_ANSI))
+          {
+            /* Clears ANSI codes */
+            orxDebug_ClearANSICodes(zBuffer);
+          }
+
           /* Logs it */
           orxConsole_Log(zBuffer);
         }
@@ -748,7 +1078,7 @@ void orxCDECL _orxDebug_Log(orxDEBUG_LEVEL _eLevel, const orxSTRING _zFunction,
     }
 
     /* Updates status */
-    orxFLAG_SET(sstDebug.u32Flags, orxDEBUG_KU32_STATIC_FLAG_NONE, orxDEBUG_KU32_STATIC_FLAG_LOGGING);
+    sbLogging = orxFALSE;
   }
 
   /* Done */
@@ -838,12 +1168,16 @@ void orxFASTCALL _orxDebug_SetDebugFile(const orxSTRING _zFileName)
   /* Checks */
   orxASSERT(sstDebug.u32Flags & orxDEBUG_KU32_STATIC_FLAG_READY);
 
+  /* Locks writer */
+  orxDebug_LockWriter();
+
   /* Was open? */
   if(sstDebug.pstDebugFile != orxNULL)
   {
     /* Closes it */
     fclose(sstDebug.pstDebugFile);
     sstDebug.pstDebugFile = orxNULL;
+    sstDebug.u32DebugFileSize = 0;
   }
 
   /* Had a previous external name? */
@@ -873,6 +1207,9 @@ void orxFASTCALL _orxDebug_SetDebugFile(const orxSTRING _zFileName)
     sstDebug.zDebugFile = (orxSTRING)orxDEBUG_KZ_DEFAULT_DEBUG_FILE;
   }
 
+  /* Unlocks writer */
+  orxDebug_UnlockWriter();
+
   /* Done! */
   return;
 }
@@ -885,12 +1222,16 @@ void orxFASTCALL _orxDebug_SetLogFile(const orxSTRING _zFileName)
   /* Checks */
   orxASSERT(sstDebug.u32Flags & orxDEBUG_KU32_STATIC_FLAG_READY);
 
+  /* Locks writer */
+  orxDebug_LockWriter();
+
   /* Was open? */
   if(sstDebug.pstLogFile != orxNULL)
   {
     /* Closes it */
     fclose(sstDebug.pstLogFile);
     sstDebug.pstLogFile = orxNULL;
+    sstDebug.u32LogFileSize = 0;
   }
 
   /* Had a previous external name? */
@@ -920,6 +1261,9 @@ void orxFASTCALL _orxDebug_SetLogFile(const orxSTRING _zFileName)
     sstDebug.zLogFile = (orxSTRING)orxDEBUG_KZ_DEFAULT_LOG_FILE;
   }
 
+  /* Unlocks writer */
+  orxDebug_UnlockWriter();
+
   /* Done! */
   return;
 }
@@ -939,6 +1283,97 @@ void orxFASTCALL _orxDebug_SetLogCallback(const orxDEBUG_CALLBACK_FUNCTION _pfnL
   return;
 }
 
+/** Sets max size of debug & log files, once reached they get rotated
+ * @param[in]   _u32MaxSize                   Max size in bytes, 0 to disable rotation
+ */
+void orxFASTCALL _orxDebug_SetFileMaxSize(orxU32 _u32MaxSize)
+{
+  /* Checks */
+  orxASSERT(sstDebug.u32Flags & orxDEBUG_KU32_STATIC_FLAG_READY);
+
+  /* Stores it */
+  sstDebug.u32FileMaxSize = _u32MaxSize;
+
+  /* Done! */
+  return;
+}
+
+/** Enables/disables asynchronous writing: when enabled, terminal & file outputs are only written by _orxDebug_Flush()
+ * @param[in]   _bEnable                      Enable / disable
+ */
+void orxFASTCALL _orxDebug_EnableAsyncWriting(orxBOOL _bEnable)
+{
+  /* Checks */
+  orxASSERT(sstDebug.u32Flags & orxDEBUG_KU32_STATIC_FLAG_READY);
+
+  /* Enable? */
+  if(_bEnable != orxFALSE)
+  {
+    /* Updates status */
+    orxFLAG_SET(sstDebug.u32Flags, orxDEBUG_KU32_STATIC_FLAG_ASYNC, orxDEBUG_KU32_STATIC_FLAG_NONE);
+  }
+  else
+  {
+    /* Updates status */
+    orxFLAG_SET(sstDebug.u32Flags, orxDEBUG_KU32_STATIC_FLAG_NONE, orxDEBUG_KU32_STATIC_FLAG_ASYNC);
+
+    /* Waits for any ongoing write */
+    orxDebug_LockWriter();
+
+    /* Writes all pending records */
+    if(orxDebug_WritePendingRecords() != 0)
+    {
+      orxDebug_FlushOutputs();
+    }
+
+    /* Releases the writer */
+    orxDebug_UnlockWriter();
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Writes all pending records to terminal & files, in a single batch. Never blocks: returns right away if another thread is already writing
+ * @return      Number of written records
+ */
+orxU32 orxFASTCALL _orxDebug_Flush()
+{
+  orxU32 u32Result = 0;
+
+  /* Acquires writer lock */
+  if(orxMEMORY_COMPARE_AND_SWAP(&(sstDebug.u32WriterLock), 0, 1) != orxFALSE)
+  {
+    /* Writes all pending records */
+    u32Result = orxDebug_WritePendingRecords();
+
+    /* Anything written? */
+    if(u32Result != 0)
+    {
+      /* Flushes batch */
+      orxDebug_FlushOutputs();
+    }
+
+    /* Releases writer lock */
+    orxDebug_UnlockWriter();
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Gets the number of records dropped since init because the ring was full
+ * @return      Dropped record count
+ */
+orxU32 orxFASTCALL _orxDebug_GetDropCount()
+{
+  /* Checks */
+  orxASSERT(sstDebug.u32Flags & orxDEBUG_KU32_STATIC_FLAG_READY);
+
+  /* Done! */
+  return sstDebug.u32DropCount;
+}
+
 #ifdef __orxMSVC__
 
   #pragma warning(default : 4996)
@@ -34,6 +34,8 @@
 
 #include "debug/orxDebug.h"
 #include "core/orxClock.h"
+#include "core/orxSystem.h"
+#include "math/orxMath.h"
 #include "memory/orxMemory.h"
 #include "object/orxStructure.h"
 
@@ -69,6 +71,21 @@ typedef struct __orxFPS_STATIC_t
   /* FPS */
   orxU32 u32FPS;
 
+  /* Last frame time stamp */
+  orxDOUBLE dFrameTime;
+
+  /* Frame time accumulators */
+  orxDOUBLE dFrameTimeSum, dFrameTimeSquareSum;
+
+  /* Frame time extrema */
+  orxFLOAT fFrameTimeMin, fFrameTimeMax;
+
+  /* Frame time count */
+  orxU32 u32FrameTimeCount;
+
+  /* Frame time stats */
+  orxFPS_FRAME_TIME stFrameTime;
+
   /* Control flags */
   orxU32 u32Flags;
 
@@ -103,6 +120,33 @@ static void orxFASTCALL orxFPS_Update(const orxCLOCK_INFO *_pstClockInfo, void *
   /* Resets frame count */
   sstFPS.u32FrameCount = 0;
 
+  /* Has frame times? */
+  if(sstFPS.u32FrameTimeCount != 0)
+  {
+    orxDOUBLE dAverage, dVariance;
+
+    /* Computes average & variance */
+    dAverage  = sstFPS.dFrameTimeSum / orx2D(sstFPS.u32FrameTimeCount);
+    dVariance = (sstFPS.dFrameTimeSquareSum / orx2D(sstFPS.u32FrameTimeCount)) - (dAverage * dAverage);
+
+    /* Stores stats */
+    sstFPS.stFrameTime.fAverage   = orx2F(dAverage);
+    sstFPS.stFrameTime.fDeviation = (dVariance > orxDOUBLE_0) ? orxMath_Sqrt(orx2F(dVariance)) : orxFLOAT_0;
+    sstFPS.stFrameTime.fMin       = sstFPS.fFrameTimeMin;
+    sstFPS.stFrameTime.fMax       = sstFPS.fFrameTimeMax;
+  }
+  else
+  {
+    /* Clears stats */
+    orxMemory_Zero(&(sstFPS.stFrameTime), sizeof(orxFPS_FRAME_TIME));
+  }
+
+  /* Resets frame time accumulators */
+  sstFPS.dFrameTimeSum        = sstFPS.dFrameTimeSquareSum = orxDOUBLE_0;
+  sstFPS.fFrameTimeMin        = orxFLOAT_MAX;
+  sstFPS.fFrameTimeMax        = orxFLOAT_0;
+  sstFPS.u32FrameTimeCount    = 0;
+
   return;
 }
 
@@ -117,6 +161,7 @@ void orxFASTCALL orxFPS_Setup()
   /* Adds module dependencies */
   orxModule_AddDependency(orxMODULE_ID_FPS, orxMODULE_ID_MEMORY);
   orxModule_AddDependency(orxMODULE_ID_FPS, orxMODULE_ID_CLOCK);
+  orxModule_AddDependency(orxMODULE_ID_FPS, orxMODULE_ID_SYSTEM);
 
   return;
 }
@@ -133,6 +178,7 @@ orxSTATUS orxFASTCALL orxFPS_Init()
   {
     /* Cleans control structure */
     orxMemory_Zero(&sstFPS, sizeof(orxFPS_STATIC));
+    sstFPS.fFrameTimeMin = orxFLOAT_MAX;
 
     /* Creates clock */
     sstFPS.pstClock = orxClock_Create(orxFPS_KU32_CLOCK_TICKSIZE, orxCLOCK_TYPE_SECOND);
@@ -210,12 +256,36 @@ void orxFASTCALL orxFPS_Exit()
 /** Increases internal frame count */
 void orxFASTCALL orxFPS_IncreaseFrameCount()
 {
+  orxDOUBLE dTime;
+
   /* Checks */
   orxASSERT(sstFPS.u32Flags & orxFPS_KU32_STATIC_FLAG_READY);
 
   /* Updates frame count */
   sstFPS.u32FrameCount++;
 
+  /* Gets current time */
+  dTime = orxSystem_GetTime();
+
+  /* Not first frame? */
+  if(sstFPS.dFrameTime > orxDOUBLE_0)
+  {
+    orxDOUBLE dFrameTime;
+
+    /* Gets frame time */
+    dFrameTime = dTime - sstFPS.dFrameTime;
+
+    /* Updates accumulators */
+    sstFPS.dFrameTimeSum       += dFrameTime;
+    sstFPS.dFrameTimeSquareSum += dFrameTime * dFrameTime;
+    sstFPS.fFrameTimeMin        = orxMIN(sstFPS.fFrameTimeMin, orx2F(dFrameTime));
+    sstFPS.fFrameTimeMax        = orxMAX(sstFPS.fFrameTimeMax, orx2F(dFrameTime));
+    sstFPS.u32FrameTimeCount++;
+  }
+
+  /* Stores time stamp */
+  sstFPS.dFrameTime = dTime;
+
   return;
 }
 
@@ -230,3 +300,20 @@ orxU32 orxFASTCALL orxFPS_GetFPS()
   /* Returns it */
   return sstFPS.u32FPS;
 }
+
+/** Gets frame time stats, computed over the last second
+ * @param[out] _pstFrameTime      Frame time stats
+ * @return orxFPS_FRAME_TIME
+ */
+orxFPS_FRAME_TIME *orxFASTCALL orxFPS_GetFrameTime(orxFPS_FRAME_TIME *_pstFrameTime)
+{
+  /* Checks */
+  orxASSERT(sstFPS.u32Flags & orxFPS_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstFrameTime != orxNULL);
+
+  /* Copies stats */
+  orxMemory_Copy(_pstFrameTime, &(sstFPS.stFrameTime), sizeof(orxFPS_FRAME_TIME));
+
+  /* Done! */
+  return _pstFrameTime;
+}
@@ -111,6 +111,7 @@ struct __orxGRAPHIC_t
   orxFLOAT        fRepeatX;                 /**< X-axis repeat count : 68 */
   orxFLOAT        fRepeatY;                 /**< Y-axis repeat count : 72 */
   const orxSTRING zReference;               /**< Reference : 76 */
+  orxU32          u32Version;               /**< Size & pivot version : 80 */
 };
 
 /** Static structure
@@ -243,6 +244,9 @@ static orxINLINE orxSTATUS orxGraphic_SetDataInternal(orxGRAPHIC *_pstGraphic, o
     orxStructure_SetFlags(_pstGraphic, orxGRAPHIC_KU32_FLAG_NONE, orxGRAPHIC_KU32_MASK_TYPE);
   }
 
+  /* Updates version */
+  _pstGraphic->u32Version++;
+
   /* Done! */
   return eResult;
 }
@@ -1010,6 +1014,9 @@ orxSTATUS orxFASTCALL orxGraphic_SetPivot(orxGRAPHIC *_pstGraphic, const orxVECT
     orxStructure_SetFlags(_pstGraphic, orxGRAPHIC_KU32_FLAG_NONE, orxGRAPHIC_KU32_FLAG_HAS_PIVOT | orxGRAPHIC_KU32_FLAG_RELATIVE_PIVOT);
   }
 
+  /* Updates version */
+  _pstGraphic->u32Version++;
+
   /* Done! */
   return eResult;
 }
@@ -1106,6 +1113,9 @@ orxSTATUS orxFASTCALL orxGraphic_SetRelativePivot(orxGRAPHIC *_pstGraphic, orxU3
     eResult = orxSTATUS_FAILURE;
   }
 
+  /* Updates version */
+  _pstGraphic->u32Version++;
+
   /* Done! */
   return eResult;
 }
@@ -1187,6 +1197,9 @@ orxSTATUS orxFASTCALL orxGraphic_SetSize(orxGRAPHIC *_pstGraphic, const orxVECTO
     _pstGraphic->fHeight  = _pvSize->fY;
   }
 
+  /* Updates version */
+  _pstGraphic->u32Version++;
+
   /* Done! */
   return eResult;
 }
@@ -1469,10 +1482,32 @@ orxSTATUS orxFASTCALL orxGraphic_UpdateSize(orxGRAPHIC *_pstGraphic)
     orxGraphic_SetRelativePivot(_pstGraphic, orxStructure_GetFlags(_pstGraphic, orxGRAPHIC_KU32_MASK_ALIGN));
   }
 
+  /* Updates version */
+  _pstGraphic->u32Version++;
+
   /* Done! */
   return eResult;
 }
 
+/** Gets graphic version, incremented every time its data, size or pivot changes
+ * @param[in]   _pstGraphic     Concerned graphic
+ * @return      Graphic version
+ */
+orxU32 orxFASTCALL orxGraphic_GetVersion(const orxGRAPHIC *_pstGraphic)
+{
+  orxU32 u32Result;
+
+  /* Checks */
+  orxASSERT(sstGraphic.u32Flags & orxGRAPHIC_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstGraphic);
+
+  /* Updates result */
+  u32Result = _pstGraphic->u32Version;
+
+  /* Done! */
+  return u32Result;
+}
+
 /** Sets graphic smoothing
  * @param[in]   _pstGraphic     Concerned graphic
  * @param[in]   _eSmoothing     Smoothing type (enabled, default or none)
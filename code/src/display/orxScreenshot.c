@@ -35,7 +35,9 @@
 #include "debug/orxDebug.h"
 #include "core/orxCommand.h"
 #include "core/orxConfig.h"
+#include "core/orxEvent.h"
 #include "display/orxDisplay.h"
+#include "render/orxRender.h"
 #include "io/orxFile.h"
 #include "utils/orxString.h"
 #include "memory/orxMemory.h"
@@ -46,6 +48,7 @@
 #define orxSCREENSHOT_KU32_STATIC_FLAG_NONE                     0x00000000
 
 #define orxSCREENSHOT_KU32_STATIC_FLAG_READY                    0x00000001
+#define orxSCREENSHOT_KU32_STATIC_FLAG_HANDLER                  0x00000002
 
 #define orxSCREENSHOT_KU32_STATIC_MASK_ALL                      0xFFFFFFFF
 
@@ -59,16 +62,65 @@
 #define orxSCREENSHOT_KZ_CONFIG_BASE_NAME                       "BaseName"
 #define orxSCREENSHOT_KZ_CONFIG_EXTENSION                       "Extension"
 #define orxSCREENSHOT_KZ_CONFIG_DIGITS                          "Digits"
+#define orxSCREENSHOT_KZ_CONFIG_RECORD_FORMAT                   "RecordFormat"
+#define orxSCREENSHOT_KZ_CONFIG_RECORD_FRAME_RATE               "RecordFrameRate"
+#define orxSCREENSHOT_KZ_CONFIG_RECORD_MAX_PENDING              "RecordMaxPending"
+
+#define orxSCREENSHOT_KZ_RECORD_FORMAT_Y4M                      "y4m"
+#define orxSCREENSHOT_KZ_RECORD_FORMAT_RAW                      "raw"
+#define orxSCREENSHOT_KZ_RECORD_FORMAT_TGA                      "tga"
+
+#define orxSCREENSHOT_KZ_RECORD_EXTENSION_RAW                   "rgba"
+#define orxSCREENSHOT_KZ_RECORD_SEQUENCE_SUFFIX                 "-000001"
+#define orxSCREENSHOT_KU32_RECORD_SEQUENCE_DIGITS               6
+
+#define orxSCREENSHOT_KU32_TGA_HEADER_SIZE                      18
 
 
 /***************************************************************************
  * Structure declaration                                                   *
  ***************************************************************************/
 
+/** Record format enum
+ */
+typedef enum __orxSCREENSHOT_RECORD_FORMAT_t
+{
+  orxSCREENSHOT_RECORD_FORMAT_Y4M = 0,
+  orxSCREENSHOT_RECORD_FORMAT_RAW,
+  orxSCREENSHOT_RECORD_FORMAT_TGA,
+
+  orxSCREENSHOT_RECORD_FORMAT_NUMBER,
+
+  orxSCREENSHOT_RECORD_FORMAT_NONE = orxENUM_NONE
+
+} orxSCREENSHOT_RECORD_FORMAT;
+
+/** Recorder structure, only accessed by the task thread once recording has started, except for request/delivery counters
+ */
+typedef struct __orxSCREENSHOT_RECORDER_t
+{
+  orxFILE                    *pstFile;                          /**< Stream file (Y4M / raw) */
+  orxU8                      *pu8Buffer;                        /**< Conversion buffer */
+  orxU32                      u32BufferSize;                    /**< Conversion buffer size */
+  orxSCREENSHOT_RECORD_FORMAT eFormat;                          /**< Format */
+  orxU32                      u32Width;                         /**< Frame width */
+  orxU32                      u32Height;                        /**< Frame height */
+  orxU32                      u32MaxPending;                    /**< Max pending frame count */
+  orxU32                      u32DropCount;                     /**< Dropped frame count (main thread) */
+  orxU32                      u32SkipCount;                     /**< Skipped frame count (task thread) */
+  volatile orxU32             u32RequestCount;                  /**< Requested frame count (main thread) */
+  volatile orxU32             u32DeliveredCount;                /**< Delivered frame count (task thread) */
+  struct __orxSCREENSHOT_RECORDER_t *pstNext;                   /**< Next recorder waiting for its closure (main thread) */
+  orxCHAR                     acName[orxSCREENSHOT_KU32_BUFFER_SIZE]; /**< Stream file name / sequence prefix */
+
+} orxSCREENSHOT_RECORDER;
+
 /** Static structure
  */
 typedef struct __orxSCREENSHOT_STATIC_t
 {
+  orxSCREENSHOT_RECORDER *pstRecorder;                          /**< Current recorder */
+  orxSCREENSHOT_RECORDER *pstClosingList;                       /**< Stopped recorders whose closure couldn't be queued yet */
   orxU32    u32ScreenshotIndex;                                 /**< Screenshot index */
   orxU32    u32Flags;                                           /**< Control flags */
   orxCHAR   acScreenshotBuffer[orxSCREENSHOT_KU32_BUFFER_SIZE]; /**< Screenshot file name buffer */
@@ -103,10 +155,34 @@ void orxFASTCALL orxScreenshot_CommandCapture(orxU32 _u32ArgNumber, const orxCOM
   return;
 }
 
+/** Command: StartRecording
+ */
+void orxFASTCALL orxScreenshot_CommandStartRecording(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Updates result */
+  _pstResult->zValue = (orxScreenshot_StartRecording() != orxSTATUS_FAILURE) ? sstScreenshot.pstRecorder->acName : orxSTRING_EMPTY;
+
+  /* Done! */
+  return;
+}
+
+/** Command: StopRecording
+ */
+void orxFASTCALL orxScreenshot_CommandStopRecording(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Updates result */
+  _pstResult->zValue = (orxScreenshot_StopRecording() != orxSTATUS_FAILURE) ? sstScreenshot.acScreenshotBuffer : orxSTRING_EMPTY;
+
+  /* Done! */
+  return;
+}
+
 /** Computes next screenshot index
+ * @param[in] _zExtension       Extension to use instead of the configured one, orxNULL to use the configured one
+ * @param[in] _zSuffix          Suffix to append to the name when looking for an available one
  * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
  */
-static orxINLINE orxSTATUS orxScreenshot_ComputeIndex()
+static orxINLINE orxSTATUS orxScreenshot_ComputeIndex(const orxSTRING _zExtension, const orxSTRING _zSuffix)
 {
   const orxSTRING zDirectory;
   const orxSTRING zBaseName;
@@ -171,13 +247,20 @@ static orxINLINE orxSTATUS orxScreenshot_ComputeIndex()
     orxConfig_PopSection();
   }
 
+  /* Has extension override? */
+  if(_zExtension != orxNULL)
+  {
+    /* Uses it */
+    zExtension = _zExtension;
+  }
+
   /* Valid? */
   if(orxFile_Exists(zDirectory) != orxFALSE)
   {
     do
     {
       /* Gets file to find name */
-      orxString_NPrint(sstScreenshot.acScreenshotBuffer, orxSCREENSHOT_KU32_BUFFER_SIZE - 1, "%s/%s%0*u.%s", zDirectory, zBaseName, u32Digits, sstScreenshot.u32ScreenshotIndex + 1, zExtension);
+      orxString_NPrint(sstScreenshot.acScreenshotBuffer, orxSCREENSHOT_KU32_BUFFER_SIZE - 1, "%s/%s%0*u%s.%s", zDirectory, zBaseName, u32Digits, sstScreenshot.u32ScreenshotIndex + 1, _zSuffix, zExtension);
 
       /* Updates screenshot index */
       sstScreenshot.u32ScreenshotIndex++;
@@ -198,12 +281,308 @@ static orxINLINE orxSTATUS orxScreenshot_ComputeIndex()
   return eResult;
 }
 
+/** Writes a recorded frame (task thread)
+ */
+static void orxFASTCALL orxScreenshot_WriteFrame(const orxU8 *_au8Data, orxU32 _u32Width, orxU32 _u32Height, void *_pContext)
+{
+  orxSCREENSHOT_RECORDER *pstRecorder;
+  orxU32                  u32PixelNumber, u32Size, i;
+
+  /* Gets recorder */
+  pstRecorder = (orxSCREENSHOT_RECORDER *)_pContext;
+
+  /* Gets pixel number */
+  u32PixelNumber = _u32Width * _u32Height;
+
+  /* Gets needed buffer size */
+  u32Size = (pstRecorder->eFormat == orxSCREENSHOT_RECORD_FORMAT_Y4M)
+          ? u32PixelNumber * 3 * sizeof(orxU8)
+          : (pstRecorder->eFormat == orxSCREENSHOT_RECORD_FORMAT_TGA)
+            ? orxSCREENSHOT_KU32_TGA_HEADER_SIZE + u32PixelNumber * 4 * sizeof(orxU8)
+            : 0;
+
+  /* Buffer too small? */
+  if(u32Size > pstRecorder->u32BufferSize)
+  {
+    /* Frees previous one */
+    if(pstRecorder->pu8Buffer != orxNULL)
+    {
+      orxMemory_Free(pstRecorder->pu8Buffer);
+    }
+
+    /* Allocates new one */
+    pstRecorder->pu8Buffer      = (orxU8 *)orxMemory_Allocate(u32Size, orxMEMORY_TYPE_MAIN);
+    pstRecorder->u32BufferSize  = (pstRecorder->pu8Buffer != orxNULL) ? u32Size : 0;
+  }
+
+  /* Size mismatch or no buffer? */
+  if((_u32Width != pstRecorder->u32Width)
+  || (_u32Height != pstRecorder->u32Height)
+  || (u32Size > pstRecorder->u32BufferSize))
+  {
+    /* Skips frame */
+    pstRecorder->u32SkipCount++;
+  }
+  else
+  {
+    /* Depending on format */
+    switch(pstRecorder->eFormat)
+    {
+      case orxSCREENSHOT_RECORD_FORMAT_Y4M:
+      {
+        orxU8 *pu8Y, *pu8U, *pu8V;
+
+        /* Gets planes */
+        pu8Y = pstRecorder->pu8Buffer;
+        pu8U = pu8Y + u32PixelNumber;
+        pu8V = pu8U + u32PixelNumber;
+
+        /* For all pixels */
+        for(i = 0; i < u32PixelNumber; i++)
+        {
+          orxS32 s32R, s32G, s32B;
+
+          /* Gets components */
+          s32R = (orxS32)_au8Data[4 * i];
+          s32G = (orxS32)_au8Data[4 * i + 1];
+          s32B = (orxS32)_au8Data[4 * i + 2];
+
+          /* Converts to YCbCr (BT.601, studio range) */
+          pu8Y[i] = (orxU8)(((66 * s32R + 129 * s32G + 25 * s32B + 128) >> 8) + 16);
+          pu8U[i] = (orxU8)(((-38 * s32R - 74 * s32G + 112 * s32B + 128) >> 8) + 128);
+          pu8V[i] = (orxU8)(((112 * s32R - 94 * s32G - 18 * s32B + 128) >> 8) + 128);
+        }
+
+        /* Writes frame */
+        orxFile_Write("FRAME\n", sizeof(orxCHAR), 6, pstRecorder->pstFile);
+        orxFile_Write(pstRecorder->pu8Buffer, sizeof(orxU8), u32Size, pstRecorder->pstFile);
+
+        break;
+      }
+
+      case orxSCREENSHOT_RECORD_FORMAT_RAW:
+      {
+        /* Writes frame */
+        orxFile_Write(_au8Data, sizeof(orxU8), u32PixelNumber * 4, pstRecorder->pstFile);
+
+        break;
+      }
+
+      case orxSCREENSHOT_RECORD_FORMAT_TGA:
+      {
+        orxCHAR   acFileName[orxSCREENSHOT_KU32_BUFFER_SIZE];
+        orxFILE  *pstFile;
+        orxU8    *pu8Pixel;
+
+        /* Inits header (uncompressed true color, 32bpp, top-left origin) */
+        orxMemory_Zero(pstRecorder->pu8Buffer, orxSCREENSHOT_KU32_TGA_HEADER_SIZE);
+        pstRecorder->pu8Buffer[2]   = 2;
+        pstRecorder->pu8Buffer[12]  = (orxU8)(_u32Width & 0xFF);
+        pstRecorder->pu8Buffer[13]  = (orxU8)(_u32Width >> 8);
+        pstRecorder->pu8Buffer[14]  = (orxU8)(_u32Height & 0xFF);
+        pstRecorder->pu8Buffer[15]  = (orxU8)(_u32Height >> 8);
+        pstRecorder->pu8Buffer[16]  = 32;
+        pstRecorder->pu8Buffer[17]  = 0x28;
+
+        /* For all pixels */
+        for(i = 0, pu8Pixel = pstRecorder->pu8Buffer + orxSCREENSHOT_KU32_TGA_HEADER_SIZE; i < u32PixelNumber; i++, pu8Pixel += 4)
+        {
+          /* Stores it as BGRA */
+          pu8Pixel[0] = _au8Data[4 * i + 2];
+          pu8Pixel[1] = _au8Data[4 * i + 1];
+          pu8Pixel[2] = _au8Data[4 * i];
+          pu8Pixel[3] = _au8Data[4 * i + 3];
+        }
+
+        /* Gets file name */
+        orxString_NPrint(acFileName, orxSCREENSHOT_KU32_BUFFER_SIZE - 1, "%s-%0*u.%s", pstRecorder->acName, orxSCREENSHOT_KU32_RECORD_SEQUENCE_DIGITS, pstRecorder->u32DeliveredCount - pstRecorder->u32SkipCount + 1, orxSCREENSHOT_KZ_RECORD_FORMAT_TGA);
+        acFileName[orxSCREENSHOT_KU32_BUFFER_SIZE - 1] = orxCHAR_NULL;
+
+        /* Opens it */
+        pstFile = orxFile_Open(acFileName, orxFILE_KU32_FLAG_OPEN_WRITE | orxFILE_KU32_FLAG_OPEN_BINARY);
+
+        /* Success? */
+        if(pstFile != orxNULL)
+        {
+          /* Writes frame */
+          orxFile_Write(pstRecorder->pu8Buffer, sizeof(orxU8), u32Size, pstFile);
+
+          /* Closes it */
+          orxFile_Close(pstFile);
+        }
+        else
+        {
+          /* Skips frame */
+          pstRecorder->u32SkipCount++;
+        }
+
+        break;
+      }
+
+      default:
+      {
+        break;
+      }
+    }
+  }
+
+  /* Updates delivered count */
+  pstRecorder->u32DeliveredCount++;
+
+  /* Done! */
+  return;
+}
+
+/** Closes a recording, once all its frames have been written (task thread)
+ */
+static void orxFASTCALL orxScreenshot_CloseRecording(const orxU8 *_au8Data, orxU32 _u32Width, orxU32 _u32Height, void *_pContext)
+{
+  orxSCREENSHOT_RECORDER *pstRecorder;
+
+  /* Gets recorder */
+  pstRecorder = (orxSCREENSHOT_RECORDER *)_pContext;
+
+  /* Has file? */
+  if(pstRecorder->pstFile != orxNULL)
+  {
+    /* Closes it */
+    orxFile_Close(pstRecorder->pstFile);
+  }
+
+  /* Has buffer? */
+  if(pstRecorder->pu8Buffer != orxNULL)
+  {
+    /* Frees it */
+    orxMemory_Free(pstRecorder->pu8Buffer);
+  }
+
+  /* Deletes recorder */
+  orxMemory_Free(pstRecorder);
+
+  /* Done! */
+  return;
+}
+
+/** Queues a recording closure after all its pending frames (read backs are delivered in order)
+ * @param[in]   _pstRecorder                  Concerned recorder
+ * @return      orxSTATUS_SUCCESS if queued or closed / orxSTATUS_FAILURE otherwise
+ */
+static orxSTATUS orxFASTCALL orxScreenshot_QueueClosure(orxSCREENSHOT_RECORDER *_pstRecorder)
+{
+  orxSTATUS eResult;
+
+  /* Queues its closure */
+  eResult = orxDisplay_ReadBackBitmapData(orxDisplay_GetScreenBitmap(), &orxScreenshot_CloseRecording, (void *)_pstRecorder);
+
+  /* Failure and no pending frames? */
+  if((eResult == orxSTATUS_FAILURE) && (_pstRecorder->u32DeliveredCount == _pstRecorder->u32RequestCount))
+  {
+    /* Closes it now */
+    orxScreenshot_CloseRecording(orxNULL, 0, 0, _pstRecorder);
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Retries queuing the closure of stopped recorders
+ */
+static void orxFASTCALL orxScreenshot_UpdateClosingList()
+{
+  orxSCREENSHOT_RECORDER **ppstRecorder;
+
+  /* For all closing recorders */
+  for(ppstRecorder = &(sstScreenshot.pstClosingList); *ppstRecorder != orxNULL;)
+  {
+    orxSCREENSHOT_RECORDER *pstRecorder;
+
+    /* Gets it */
+    pstRecorder = *ppstRecorder;
+
+    /* Queued its closure? */
+    if(orxScreenshot_QueueClosure(pstRecorder) != orxSTATUS_FAILURE)
+    {
+      /* Removes it from list */
+      *ppstRecorder = pstRecorder->pstNext;
+    }
+    else
+    {
+      /* Goes to next */
+      ppstRecorder = &(pstRecorder->pstNext);
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Event handler
+ * @param[in]   _pstEvent                     Sent event
+ * @return      orxSTATUS_SUCCESS if handled / orxSTATUS_FAILURE otherwise
+ */
+static orxSTATUS orxFASTCALL orxScreenshot_EventHandler(const orxEVENT *_pstEvent)
+{
+  /* Checks */
+  orxASSERT(_pstEvent->eType == orxEVENT_TYPE_RENDER);
+
+  /* Render stop with closing recorders? */
+  if((_pstEvent->eID == orxRENDER_EVENT_STOP) && (sstScreenshot.pstClosingList != orxNULL))
+  {
+    /* Retries their closure */
+    orxScreenshot_UpdateClosingList();
+
+    /* All closed and not recording anymore? */
+    if((sstScreenshot.pstClosingList == orxNULL) && (sstScreenshot.pstRecorder == orxNULL))
+    {
+      /* Stops listening (a handler can't be removed while its event is being sent): re-enabled by next recording, removed upon exit */
+      orxEvent_SetHandlerIDFlags(orxScreenshot_EventHandler, orxEVENT_TYPE_RENDER, orxNULL, orxEVENT_KU32_FLAG_ID_NONE, orxEVENT_KU32_MASK_ID_ALL);
+    }
+  }
+
+  /* Render stop while recording? */
+  if((_pstEvent->eID == orxRENDER_EVENT_STOP) && (sstScreenshot.pstRecorder != orxNULL))
+  {
+    orxSCREENSHOT_RECORDER *pstRecorder;
+
+    /* Gets recorder */
+    pstRecorder = sstScreenshot.pstRecorder;
+
+    /* Is task thread lagging behind? */
+    if(pstRecorder->u32RequestCount - pstRecorder->u32DeliveredCount >= pstRecorder->u32MaxPending)
+    {
+      /* Drops frame to keep the frame rate */
+      pstRecorder->u32DropCount++;
+    }
+    /* Reads screen back */
+    else if(orxDisplay_ReadBackBitmapData(orxDisplay_GetScreenBitmap(), &orxScreenshot_WriteFrame, (void *)pstRecorder) != orxSTATUS_FAILURE)
+    {
+      /* Updates request count */
+      pstRecorder->u32RequestCount++;
+    }
+    else
+    {
+      /* Drops frame */
+      pstRecorder->u32DropCount++;
+    }
+  }
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
 /** Registers all the screenshot commands
  */
 static orxINLINE void orxScreenshot_RegisterCommands()
 {
   /* Command: Capture */
   orxCOMMAND_REGISTER_CORE_COMMAND(Screenshot, Capture, "File", orxCOMMAND_VAR_TYPE_STRING, 0, 0);
+  /* Command: StartRecording */
+  orxCOMMAND_REGISTER_CORE_COMMAND(Screenshot, StartRecording, "File", orxCOMMAND_VAR_TYPE_STRING, 0, 0);
+  /* Command: StopRecording */
+  orxCOMMAND_REGISTER_CORE_COMMAND(Screenshot, StopRecording, "File", orxCOMMAND_VAR_TYPE_STRING, 0, 0);
 }
 
 /** Unregisters all the screenshot commands
@@ -212,6 +591,10 @@ static orxINLINE void orxScreenshot_UnregisterCommands()
 {
   /* Command: Capture */
   orxCOMMAND_UNREGISTER_CORE_COMMAND(Screenshot, Capture);
+  /* Command: StartRecording */
+  orxCOMMAND_UNREGISTER_CORE_COMMAND(Screenshot, StartRecording);
+  /* Command: StopRecording */
+  orxCOMMAND_UNREGISTER_CORE_COMMAND(Screenshot, StopRecording);
 }
 
 /***************************************************************************
@@ -227,6 +610,7 @@ void orxFASTCALL orxScreenshot_Setup()
   orxModule_AddDependency(orxMODULE_ID_SCREENSHOT, orxMODULE_ID_STRING);
   orxModule_AddDependency(orxMODULE_ID_SCREENSHOT, orxMODULE_ID_CONFIG);
   orxModule_AddDependency(orxMODULE_ID_SCREENSHOT, orxMODULE_ID_COMMAND);
+  orxModule_AddDependency(orxMODULE_ID_SCREENSHOT, orxMODULE_ID_EVENT);
   orxModule_AddDependency(orxMODULE_ID_SCREENSHOT, orxMODULE_ID_FILE);
   orxModule_AddDependency(orxMODULE_ID_SCREENSHOT, orxMODULE_ID_DISPLAY);
 
@@ -269,11 +653,41 @@ void orxFASTCALL orxScreenshot_Exit()
   /* Initialized? */
   if(sstScreenshot.u32Flags & orxSCREENSHOT_KU32_STATIC_FLAG_READY)
   {
+    /* Is recording? */
+    if(sstScreenshot.pstRecorder != orxNULL)
+    {
+      /* Stops it */
+      orxScreenshot_StopRecording();
+    }
+
+    /* Has closing recorders? */
+    if(sstScreenshot.pstClosingList != orxNULL)
+    {
+      orxSCREENSHOT_RECORDER *pstRecorder;
+
+      /* Retries their closure */
+      orxScreenshot_UpdateClosingList();
+
+      /* For all remaining recorders */
+      for(pstRecorder = sstScreenshot.pstClosingList; pstRecorder != orxNULL; pstRecorder = pstRecorder->pstNext)
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_SCREENSHOT, "Couldn't close recording [%s]: %u frames are still pending.", pstRecorder->acName, pstRecorder->u32RequestCount - pstRecorder->u32DeliveredCount);
+      }
+    }
+
+    /* Has event handler? */
+    if(sstScreenshot.u32Flags & orxSCREENSHOT_KU32_STATIC_FLAG_HANDLER)
+    {
+      /* Removes it */
+      orxEvent_RemoveHandler(orxEVENT_TYPE_RENDER, orxScreenshot_EventHandler);
+    }
+
     /* Unregisters commands */
     orxScreenshot_UnregisterCommands();
 
     /* Updates flags */
-    sstScreenshot.u32Flags &= ~orxSCREENSHOT_KU32_STATIC_FLAG_READY;
+    sstScreenshot.u32Flags &= ~(orxSCREENSHOT_KU32_STATIC_FLAG_READY | orxSCREENSHOT_KU32_STATIC_FLAG_HANDLER);
   }
   else
   {
@@ -295,7 +709,7 @@ orxSTATUS orxFASTCALL orxScreenshot_Capture()
   orxASSERT(sstScreenshot.u32Flags & orxSCREENSHOT_KU32_STATIC_FLAG_READY);
 
   /* Computes screenshot index */
-  eResult = orxScreenshot_ComputeIndex();
+  eResult = orxScreenshot_ComputeIndex(orxNULL, orxSTRING_EMPTY);
 
   /* Valid? */
   if(eResult != orxSTATUS_FAILURE)
@@ -314,3 +728,258 @@ orxSTATUS orxFASTCALL orxScreenshot_Capture()
   /* Done! */
   return eResult;
 }
+
+/** Starts recording every rendered frame to disk (Y4M / raw RGBA stream or TGA sequence), frames are read back asynchronously and written on the task thread
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxScreenshot_StartRecording()
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(sstScreenshot.u32Flags & orxSCREENSHOT_KU32_STATIC_FLAG_READY);
+
+  /* Not already recording? */
+  if(sstScreenshot.pstRecorder == orxNULL)
+  {
+    orxSCREENSHOT_RECORD_FORMAT eFormat;
+    const orxSTRING             zFormat;
+    const orxSTRING             zExtension;
+    orxU32                      u32FrameRate, u32MaxPending;
+
+    /* Uses default format, frame rate & max pending frame count */
+    zFormat       = orxSCREENSHOT_KZ_DEFAULT_RECORD_FORMAT;
+    u32FrameRate  = orxSCREENSHOT_KU32_DEFAULT_RECORD_FRAME_RATE;
+    u32MaxPending = orxSCREENSHOT_KU32_DEFAULT_RECORD_MAX_PENDING;
+
+    /* Pushes section */
+    if((orxConfig_HasSection(orxSCREENSHOT_KZ_CONFIG_SECTION) != orxFALSE)
+    && (orxConfig_PushSection(orxSCREENSHOT_KZ_CONFIG_SECTION) != orxSTATUS_FAILURE))
+    {
+      /* Has format? */
+      if(orxConfig_HasValue(orxSCREENSHOT_KZ_CONFIG_RECORD_FORMAT) != orxFALSE)
+      {
+        /* Stores it */
+        zFormat = orxConfig_GetString(orxSCREENSHOT_KZ_CONFIG_RECORD_FORMAT);
+      }
+
+      /* Has frame rate? */
+      if(orxConfig_GetU32(orxSCREENSHOT_KZ_CONFIG_RECORD_FRAME_RATE) > 0)
+      {
+        /* Stores it */
+        u32FrameRate = orxConfig_GetU32(orxSCREENSHOT_KZ_CONFIG_RECORD_FRAME_RATE);
+      }
+
+      /* Has max pending frame count? */
+      if(orxConfig_GetU32(orxSCREENSHOT_KZ_CONFIG_RECORD_MAX_PENDING) > 0)
+      {
+        /* Stores it */
+        u32MaxPending = orxConfig_GetU32(orxSCREENSHOT_KZ_CONFIG_RECORD_MAX_PENDING);
+      }
+
+      /* Pops previous section */
+      orxConfig_PopSection();
+    }
+
+    /* Raw? */
+    if(orxString_ICompare(zFormat, orxSCREENSHOT_KZ_RECORD_FORMAT_RAW) == 0)
+    {
+      /* Updates format */
+      eFormat     = orxSCREENSHOT_RECORD_FORMAT_RAW;
+      zExtension  = orxSCREENSHOT_KZ_RECORD_EXTENSION_RAW;
+    }
+    /* TGA? */
+    else if(orxString_ICompare(zFormat, orxSCREENSHOT_KZ_RECORD_FORMAT_TGA) == 0)
+    {
+      /* Updates format */
+      eFormat     = orxSCREENSHOT_RECORD_FORMAT_TGA;
+      zExtension  = orxSCREENSHOT_KZ_RECORD_FORMAT_TGA;
+    }
+    else
+    {
+      /* Not Y4M? */
+      if(orxString_ICompare(zFormat, orxSCREENSHOT_KZ_RECORD_FORMAT_Y4M) != 0)
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_SCREENSHOT, "Unknown record format [%s], using [%s] instead.", zFormat, orxSCREENSHOT_KZ_RECORD_FORMAT_Y4M);
+      }
+
+      /* Updates format */
+      eFormat     = orxSCREENSHOT_RECORD_FORMAT_Y4M;
+      zExtension  = orxSCREENSHOT_KZ_RECORD_FORMAT_Y4M;
+    }
+
+    /* Computes recording index */
+    if(orxScreenshot_ComputeIndex(zExtension, (eFormat == orxSCREENSHOT_RECORD_FORMAT_TGA) ? orxSCREENSHOT_KZ_RECORD_SEQUENCE_SUFFIX : orxSTRING_EMPTY) != orxSTATUS_FAILURE)
+    {
+      orxSCREENSHOT_RECORDER *pstRecorder;
+
+      /* Allocates recorder */
+      pstRecorder = (orxSCREENSHOT_RECORDER *)orxMemory_Allocate(sizeof(orxSCREENSHOT_RECORDER), orxMEMORY_TYPE_MAIN);
+
+      /* Success? */
+      if(pstRecorder != orxNULL)
+      {
+        orxFLOAT fWidth, fHeight;
+
+        /* Inits it */
+        orxMemory_Zero(pstRecorder, sizeof(orxSCREENSHOT_RECORDER));
+        orxDisplay_GetScreenSize(&fWidth, &fHeight);
+        pstRecorder->eFormat        = eFormat;
+        pstRecorder->u32Width       = orxF2U(fWidth);
+        pstRecorder->u32Height      = orxF2U(fHeight);
+        pstRecorder->u32MaxPending  = u32MaxPending;
+        orxString_NCopy(pstRecorder->acName, sstScreenshot.acScreenshotBuffer, orxSCREENSHOT_KU32_BUFFER_SIZE - 1);
+
+        /* Sequence? */
+        if(eFormat == orxSCREENSHOT_RECORD_FORMAT_TGA)
+        {
+          /* Only keeps its prefix */
+          pstRecorder->acName[orxString_GetLength(pstRecorder->acName) - orxString_GetLength(orxSCREENSHOT_KZ_RECORD_SEQUENCE_SUFFIX) - orxString_GetLength(zExtension) - 1] = orxCHAR_NULL;
+
+          /* Updates result */
+          eResult = orxSTATUS_SUCCESS;
+        }
+        else
+        {
+          /* Opens stream file */
+          pstRecorder->pstFile = orxFile_Open(pstRecorder->acName, orxFILE_KU32_FLAG_OPEN_WRITE | orxFILE_KU32_FLAG_OPEN_BINARY);
+
+          /* Success? */
+          if(pstRecorder->pstFile != orxNULL)
+          {
+            /* Y4M? */
+            if(eFormat == orxSCREENSHOT_RECORD_FORMAT_Y4M)
+            {
+              orxCHAR acHeader[128];
+              orxS32  s32Length;
+
+              /* Writes stream header */
+              s32Length = orxString_NPrint(acHeader, sizeof(acHeader) - 1, "YUV4MPEG2 W%u H%u F%u:1 Ip A1:1 C444\n", pstRecorder->u32Width, pstRecorder->u32Height, u32FrameRate);
+              orxFile_Write(acHeader, sizeof(orxCHAR), (orxS64)s32Length, pstRecorder->pstFile);
+            }
+
+            /* Updates result */
+            eResult = orxSTATUS_SUCCESS;
+          }
+        }
+
+        /* Success? */
+        if(eResult != orxSTATUS_FAILURE)
+        {
+          /* No event handler yet (kept while stopped recorders are closing)? */
+          if(!(sstScreenshot.u32Flags & orxSCREENSHOT_KU32_STATIC_FLAG_HANDLER))
+          {
+            /* Adds event handler */
+            eResult = orxEvent_AddHandler(orxEVENT_TYPE_RENDER, orxScreenshot_EventHandler);
+
+            /* Success? */
+            if(eResult != orxSTATUS_FAILURE)
+            {
+              /* Updates flags */
+              sstScreenshot.u32Flags |= orxSCREENSHOT_KU32_STATIC_FLAG_HANDLER;
+            }
+          }
+
+          /* Success? */
+          if(eResult != orxSTATUS_FAILURE)
+          {
+            /* Only listens to render stop (re-enables it if it got muted) */
+            orxEvent_SetHandlerIDFlags(orxScreenshot_EventHandler, orxEVENT_TYPE_RENDER, orxNULL, orxEVENT_GET_FLAG(orxRENDER_EVENT_STOP), orxEVENT_KU32_MASK_ID_ALL);
+          }
+        }
+
+        /* Success? */
+        if(eResult != orxSTATUS_FAILURE)
+        {
+          /* Stores recorder */
+          sstScreenshot.pstRecorder = pstRecorder;
+
+          /* Logs */
+          orxDEBUG_PRINT(orxDEBUG_LEVEL_SCREENSHOT, "Recording %ux%u frames to [%s].", pstRecorder->u32Width, pstRecorder->u32Height, pstRecorder->acName);
+        }
+        else
+        {
+          /* Logs message */
+          orxDEBUG_PRINT(orxDEBUG_LEVEL_SCREENSHOT, "Couldn't start recording to [%s].", pstRecorder->acName);
+
+          /* Deletes recorder */
+          orxScreenshot_CloseRecording(orxNULL, 0, 0, pstRecorder);
+        }
+      }
+    }
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_SCREENSHOT, "Already recording to [%s].", sstScreenshot.pstRecorder->acName);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Stops recording, pending frames will still be written
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxScreenshot_StopRecording()
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(sstScreenshot.u32Flags & orxSCREENSHOT_KU32_STATIC_FLAG_READY);
+
+  /* Is recording? */
+  if(sstScreenshot.pstRecorder != orxNULL)
+  {
+    orxSCREENSHOT_RECORDER *pstRecorder;
+
+    /* Gets recorder */
+    pstRecorder = sstScreenshot.pstRecorder;
+
+    /* Stores its name */
+    orxString_NCopy(sstScreenshot.acScreenshotBuffer, pstRecorder->acName, orxSCREENSHOT_KU32_BUFFER_SIZE - 1);
+
+    /* Logs */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_SCREENSHOT, "Recording to [%s] stopped: %u frames requested, %u dropped.", pstRecorder->acName, pstRecorder->u32RequestCount, pstRecorder->u32DropCount);
+
+    /* Couldn't queue its closure? */
+    if(orxScreenshot_QueueClosure(pstRecorder) == orxSTATUS_FAILURE)
+    {
+      /* Retries on a later update */
+      pstRecorder->pstNext          = sstScreenshot.pstClosingList;
+      sstScreenshot.pstClosingList  = pstRecorder;
+    }
+
+    /* Clears recorder */
+    sstScreenshot.pstRecorder = orxNULL;
+
+    /* No more closing recorders? */
+    if(sstScreenshot.pstClosingList == orxNULL)
+    {
+      /* Removes event handler */
+      orxEvent_RemoveHandler(orxEVENT_TYPE_RENDER, orxScreenshot_EventHandler);
+
+      /* Updates flags */
+      sstScreenshot.u32Flags &= ~orxSCREENSHOT_KU32_STATIC_FLAG_HANDLER;
+    }
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Is recording?
+ * @return orxTRUE / orxFALSE
+ */
+orxBOOL orxFASTCALL orxScreenshot_IsRecording()
+{
+  /* Checks */
+  orxASSERT(sstScreenshot.u32Flags & orxSCREENSHOT_KU32_STATIC_FLAG_READY);
+
+  /* Done! */
+  return (sstScreenshot.pstRecorder != orxNULL) ? orxTRUE : orxFALSE;
+}
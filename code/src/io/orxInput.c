@@ -40,7 +40,10 @@
 #include "core/orxResource.h"
 #include "debug/orxDebug.h"
 #include "debug/orxProfiler.h"
+#include "io/orxFile.h"
+#include "math/orxMath.h"
 #include "memory/orxBank.h"
+#include "utils/orxHashTable.h"
 #include "utils/orxLinkList.h"
 #include "utils/orxString.h"
 
@@ -56,6 +59,8 @@
 #define orxINPUT_KU32_STATIC_FLAG_NONE                0x00000000  /**< No flags */
 
 #define orxINPUT_KU32_STATIC_FLAG_READY               0x00000001  /**< Ready flag */
+#define orxINPUT_KU32_STATIC_FLAG_RECORD              0x00000002  /**< Record flag */
+#define orxINPUT_KU32_STATIC_FLAG_REPLAY              0x00000004  /**< Replay flag */
 
 #define orxINPUT_KU32_STATIC_MASK_ALL                 0xFFFFFFFF  /**< All mask */
 
@@ -69,10 +74,14 @@
 
 #define orxINPUT_KU32_SET_BANK_SIZE                   8
 #define orxINPUT_KU32_ENTRY_BANK_SIZE                 32
+#define orxINPUT_KU32_SOURCE_BANK_SIZE                32
+#define orxINPUT_KU32_SOURCE_TABLE_SIZE               64
 
 #define orxINPUT_KU32_SET_FLAG_NONE                   0x00000000  /**< No flags */
 
 #define orxINPUT_KU32_SET_FLAG_ENABLED                0x00000001  /**< Enabled flag */
+#define orxINPUT_KU32_SET_FLAG_PENDING                0x00000002  /**< Pending flag: some entries need to be updated */
+#define orxINPUT_KU32_SET_FLAG_DIRTY                  0x00000004  /**< Dirty flag: all entries need to be updated */
 
 #define orxINPUT_KU32_SET_MASK_ALL                    0xFFFFFFFF  /**< All mask */
 
@@ -87,6 +96,9 @@
 #define orxINPUT_KU32_ENTRY_FLAG_EXTERNAL             0x02000000  /**< External flag */
 #define orxINPUT_KU32_ENTRY_FLAG_RESET_EXTERNAL       0x04000000  /**< Reset external flag */
 #define orxINPUT_KU32_ENTRY_FLAG_LAST_EXTERNAL        0x08000000  /**< Last external flag */
+#define orxINPUT_KU32_ENTRY_FLAG_DIRTY                0x00000100  /**< Dirty flag */
+
+#define orxINPUT_KU32_ENTRY_MASK_UPDATE               (orxINPUT_KU32_ENTRY_FLAG_NEW_STATUS | orxINPUT_KU32_ENTRY_FLAG_EXTERNAL | orxINPUT_KU32_ENTRY_FLAG_RESET_EXTERNAL | orxINPUT_KU32_ENTRY_FLAG_LAST_EXTERNAL) /**< Update mask: entries that need to be updated on next frame */
 
 #define orxINPUT_KU32_ENTRY_MASK_OLDEST_BINDING       0x0000000F  /**< Oldest binding mask */
 #define orxINPUT_KU32_ENTRY_MASK_LAST_ACTIVE_BINDING  0x000000F0  /**< Last active binding mask */
@@ -102,22 +114,45 @@
 
 #define orxINPUT_KZ_MODE_FORMAT                       "%c%s"      /**< Mode format */
 
+#define orxINPUT_KU32_RECORD_MAGIC                    0x4958524F  /**< Record magic: "ORXI" */
+#define orxINPUT_KU32_RECORD_VERSION                  2           /**< Record version */
+#define orxINPUT_KU32_RECORD_END_OF_FRAME             0xFFFFFFFF  /**< Record end of frame marker */
+#define orxINPUT_KU32_RECORD_SHIFT_TYPE               24          /**< Record type shift */
+#define orxINPUT_KU32_RECORD_MASK_ID                  0x00FFFFFF  /**< Record ID mask */
+#define orxINPUT_KU32_REPLAY_PENDING_NUMBER           32          /**< Replay pending value number */
+
 
 /***************************************************************************
  * Structure declaration                                                   *
  ***************************************************************************/
 
+/** Input source structure: one per bound peripheral input, shared by all its bindings
+ */
+typedef struct __orxINPUT_SOURCE_t
+{
+  orxLINKLIST_NODE  stNode;                                       /**< List node : 12 */
+  orxLINKLIST       stBindingList;                                /**< Binding list : 24 */
+  orxINPUT_TYPE     eType;                                        /**< Input type : 28 */
+  orxENUM           eID;                                          /**< Input ID : 32 */
+  orxFLOAT          fValue;                                       /**< Last polled value : 36 */
+
+} orxINPUT_SOURCE;
+
 /** Input binding structure
  */
 typedef struct __orxINPUT_BINDING_t
 {
-  orxINPUT_TYPE   eType;                                          /**< Input type : 4 */
-  orxENUM         eID;                                            /**< Input ID : 8 */
-  orxINPUT_MODE   eMode;                                          /**< Input Mode : 12 */
-  orxFLOAT        fValue;                                         /**< Value : 16 */
+  orxLINKLIST_NODE  stNode;                                       /**< Source list node : 12 */
+  orxINPUT_TYPE     eType;                                        /**< Input type : 16 */
+  orxENUM           eID;                                          /**< Input ID : 20 */
+  orxINPUT_MODE     eMode;                                        /**< Input Mode : 24 */
+  orxFLOAT          fValue;                                       /**< Value : 28 */
+  orxINPUT_SOURCE  *pstSource;                                    /**< Source : 32 */
+  struct __orxINPUT_ENTRY_t *pstEntry;                            /**< Owner entry : 36 */
 
 } orxINPUT_BINDING;
 
+
 /** Input entry structure
  */
 typedef struct __orxINPUT_ENTRY_t
@@ -129,11 +164,31 @@ typedef struct __orxINPUT_ENTRY_t
   orxFLOAT          fThreshold;                                   /**< Threshold : 28 */
   orxFLOAT          fMultiplier;                                  /**< Multiplier: 32 */
   orxFLOAT          fExternalValue;                               /**< External value : 36 */
+  struct __orxINPUT_SET_t *pstSet;                                /**< Owner set : 40 */
 
-  orxINPUT_BINDING  astBindingList[orxINPUT_KU32_BINDING_NUMBER]; /**< Entry binding list : 116 */
+  orxINPUT_BINDING  astBindingList[orxINPUT_KU32_BINDING_NUMBER]; /**< Entry binding list : 200 */
 
 } orxINPUT_ENTRY;
 
+/** Input record header structure
+ */
+typedef struct __orxINPUT_RECORD_HEADER_t
+{
+  orxU32            u32Magic;                                     /**< Magic : 4 */
+  orxU32            u32Version;                                   /**< Version : 8 */
+  orxU32            au32Seeds[4];                                 /**< Random seeds : 24 */
+
+} orxINPUT_RECORD_HEADER;
+
+/** Input replay pending value structure
+ */
+typedef struct __orxINPUT_REPLAY_PENDING_t
+{
+  orxU32            u32Key;                                       /**< Source record key : 4 */
+  orxFLOAT          fValue;                                       /**< Value : 8 */
+
+} orxINPUT_REPLAY_PENDING;
+
 /** Input set structure
  */
 typedef struct __orxINPUT_SET_t
@@ -152,11 +207,18 @@ typedef struct __orxINPUT_SET_t
 typedef struct __orxINPUT_STATIC_t
 {
   orxBANK      *pstSetBank;                                       /**< Set bank */
+  orxBANK      *pstSourceBank;                                    /**< Source bank */
+  orxHASHTABLE *pstSourceTable;                                   /**< Source table */
   orxINPUT_SET *pstCurrentSet;                                    /**< Current set */
   orxFLOAT      fDefaultThreshold;                                /**< Default threshold */
   orxFLOAT      fDefaultMultiplier;                               /**< Default multiplier */
   orxU32        u32Flags;                                         /**< Control flags */
   orxLINKLIST   stSetList;                                        /**< Set list */
+  orxLINKLIST   stSourceList;                                     /**< Source list */
+  orxFILE      *pstRecordFile;                                    /**< Record file */
+  orxFILE      *pstReplayFile;                                    /**< Replay file */
+  orxU32        u32ReplayPendingCount;                            /**< Replay pending value count */
+  orxINPUT_REPLAY_PENDING astReplayPendingList[orxINPUT_KU32_REPLAY_PENDING_NUMBER]; /**< Replay values of sources not attached yet */
   orxVECTOR     vMouseMove;                                       /**< Mouse move */
   orxCHAR       acResultBuffer[orxINPUT_KU32_RESULT_BUFFER_SIZE]; /**< Result buffer */
 
@@ -296,6 +358,50 @@ void orxFASTCALL orxInput_CommandHasNewStatus(orxU32 _u32ArgNumber, const orxCOM
   return;
 }
 
+/** Command: StartRecording
+ */
+void orxFASTCALL orxInput_CommandStartRecording(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Updates result */
+  _pstResult->bValue = (orxInput_StartRecording(_astArgList[0].zValue) != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
+
+  /* Done! */
+  return;
+}
+
+/** Command: StopRecording
+ */
+void orxFASTCALL orxInput_CommandStopRecording(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Updates result */
+  _pstResult->bValue = (orxInput_StopRecording() != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
+
+  /* Done! */
+  return;
+}
+
+/** Command: StartReplay
+ */
+void orxFASTCALL orxInput_CommandStartReplay(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Updates result */
+  _pstResult->bValue = (orxInput_StartReplay(_astArgList[0].zValue) != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
+
+  /* Done! */
+  return;
+}
+
+/** Command: StopReplay
+ */
+void orxFASTCALL orxInput_CommandStopReplay(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Updates result */
+  _pstResult->bValue = (orxInput_StopReplay() != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
+
+  /* Done! */
+  return;
+}
+
 /** Registers all the input commands
  */
 static orxINLINE void orxInput_RegisterCommands()
@@ -321,6 +427,15 @@ static orxINLINE void orxInput_RegisterCommands()
   orxCOMMAND_REGISTER_CORE_COMMAND(Input, IsActive, "Active?", orxCOMMAND_VAR_TYPE_BOOL, 1, 0, {"Input", orxCOMMAND_VAR_TYPE_STRING});
   /* Command: HasNewStatus */
   orxCOMMAND_REGISTER_CORE_COMMAND(Input, HasNewStatus, "NewStatus?", orxCOMMAND_VAR_TYPE_BOOL, 1, 0, {"Input", orxCOMMAND_VAR_TYPE_STRING});
+
+  /* Command: StartRecording */
+  orxCOMMAND_REGISTER_CORE_COMMAND(Input, StartRecording, "Success?", orxCOMMAND_VAR_TYPE_BOOL, 1, 0, {"File", orxCOMMAND_VAR_TYPE_STRING});
+  /* Command: StopRecording */
+  orxCOMMAND_REGISTER_CORE_COMMAND(Input, StopRecording, "Success?", orxCOMMAND_VAR_TYPE_BOOL, 0, 0);
+  /* Command: StartReplay */
+  orxCOMMAND_REGISTER_CORE_COMMAND(Input, StartReplay, "Success?", orxCOMMAND_VAR_TYPE_BOOL, 1, 0, {"File", orxCOMMAND_VAR_TYPE_STRING});
+  /* Command: StopReplay */
+  orxCOMMAND_REGISTER_CORE_COMMAND(Input, StopReplay, "Success?", orxCOMMAND_VAR_TYPE_BOOL, 0, 0);
 }
 
 /** Unregisters all the input commands
@@ -348,6 +463,15 @@ static orxINLINE void orxInput_UnregisterCommands()
   orxCOMMAND_UNREGISTER_CORE_COMMAND(Input, IsActive);
   /* Command: HasNewStatus */
   orxCOMMAND_UNREGISTER_CORE_COMMAND(Input, HasNewStatus);
+
+  /* Command: StartRecording */
+  orxCOMMAND_UNREGISTER_CORE_COMMAND(Input, StartRecording);
+  /* Command: StopRecording */
+  orxCOMMAND_UNREGISTER_CORE_COMMAND(Input, StopRecording);
+  /* Command: StartReplay */
+  orxCOMMAND_UNREGISTER_CORE_COMMAND(Input, StartReplay);
+  /* Command: StopReplay */
+  orxCOMMAND_UNREGISTER_CORE_COMMAND(Input, StopReplay);
 }
 
 static orxINLINE orxFLOAT orxInput_ScaleValue(orxFLOAT _fValue, orxFLOAT _fThreshold, orxFLOAT _fMultiplier)
@@ -464,6 +588,363 @@ static orxINLINE orxFLOAT orxInput_GetBindingValue(orxINPUT_TYPE _eType, orxENUM
   return fResult;
 }
 
+/** Marks an entry as needing an update
+ * @param[in] _pstEntry         Concerned entry
+ */
+static orxINLINE void orxInput_InvalidateEntry(orxINPUT_ENTRY *_pstEntry)
+{
+  /* Checks */
+  orxASSERT(_pstEntry != orxNULL);
+  orxASSERT(_pstEntry->pstSet != orxNULL);
+
+  /* Updates entry & set status */
+  orxFLAG_SET(_pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_DIRTY, orxINPUT_KU32_ENTRY_FLAG_NONE);
+  orxFLAG_SET(_pstEntry->pstSet->u32Flags, orxINPUT_KU32_SET_FLAG_PENDING, orxINPUT_KU32_SET_FLAG_NONE);
+
+  /* Done! */
+  return;
+}
+
+/** Sets a source value and invalidates the entries bound to it
+ * @param[in] _pstSource        Concerned source
+ * @param[in] _fValue           Value to set
+ */
+static orxINLINE void orxInput_SetSourceValue(orxINPUT_SOURCE *_pstSource, orxFLOAT _fValue)
+{
+  /* Changed? */
+  if(_fValue != _pstSource->fValue)
+  {
+    orxINPUT_BINDING *pstBinding;
+
+    /* Stores it */
+    _pstSource->fValue = _fValue;
+
+    /* For all its bindings */
+    for(pstBinding = (orxINPUT_BINDING *)orxLinkList_GetFirst(&(_pstSource->stBindingList));
+        pstBinding != orxNULL;
+        pstBinding = (orxINPUT_BINDING *)orxLinkList_GetNext(&(pstBinding->stNode)))
+    {
+      /* Invalidates its entry */
+      orxInput_InvalidateEntry(pstBinding->pstEntry);
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Writes a source value to the record file
+ * @param[in] _pstSource        Concerned source
+ */
+static orxINLINE void orxInput_RecordSource(const orxINPUT_SOURCE *_pstSource)
+{
+  orxU32 au32Record[2];
+
+  /* Checks */
+  orxASSERT(sstInput.pstRecordFile != orxNULL);
+
+  /* Packs type, ID & value */
+  au32Record[0] = ((orxU32)_pstSource->eType << orxINPUT_KU32_RECORD_SHIFT_TYPE) | ((orxU32)_pstSource->eID & orxINPUT_KU32_RECORD_MASK_ID);
+  orxMemory_Copy(&au32Record[1], &(_pstSource->fValue), sizeof(orxU32));
+
+  /* Writes it */
+  orxFile_Write(au32Record, sizeof(orxU32), 2, sstInput.pstRecordFile);
+
+  /* Done! */
+  return;
+}
+
+/** Gets a source initial value from the current replay frame, for sources attached while replaying
+ * @param[in] _u32Key           Source record key
+ * @return Source value / orxFLOAT_0 if not found in the current replay frame
+ */
+static orxINLINE orxFLOAT orxInput_GetReplayInitialValue(orxU32 _u32Key)
+{
+  orxU32    i;
+  orxFLOAT  fResult = orxFLOAT_0;
+
+  /* For all pending values */
+  for(i = 0; i < sstInput.u32ReplayPendingCount; i++)
+  {
+    /* Found? */
+    if(sstInput.astReplayPendingList[i].u32Key == _u32Key)
+    {
+      /* Updates result */
+      fResult = sstInput.astReplayPendingList[i].fValue;
+
+      /* Removes it */
+      sstInput.astReplayPendingList[i] = sstInput.astReplayPendingList[--sstInput.u32ReplayPendingCount];
+
+      break;
+    }
+  }
+
+  /* Done! */
+  return fResult;
+}
+
+/** Attaches a binding to its source, creating the source if needed
+ * @param[in] _pstBinding       Concerned binding
+ */
+static orxINLINE void orxInput_AttachSource(orxINPUT_BINDING *_pstBinding)
+{
+  orxINPUT_SOURCE  *pstSource;
+  orxU64            u64Key;
+  orxBOOL           bNew = orxFALSE;
+
+  /* Checks */
+  orxASSERT(_pstBinding != orxNULL);
+  orxASSERT(_pstBinding->pstSource == orxNULL);
+  orxASSERT(_pstBinding->eType < orxINPUT_TYPE_NUMBER);
+
+  /* Gets source key */
+  u64Key = ((orxU64)_pstBinding->eType << 32) | (orxU64)_pstBinding->eID;
+
+  /* Gets source */
+  pstSource = (orxINPUT_SOURCE *)orxHashTable_Get(sstInput.pstSourceTable, u64Key);
+
+  /* Not found? */
+  if(pstSource == orxNULL)
+  {
+    /* Allocates it */
+    pstSource = (orxINPUT_SOURCE *)orxBank_Allocate(sstInput.pstSourceBank);
+
+    /* Valid? */
+    if(pstSource != orxNULL)
+    {
+      /* Inits it */
+      orxMemory_Zero(pstSource, sizeof(orxINPUT_SOURCE));
+      pstSource->eType  = _pstBinding->eType;
+      pstSource->eID    = _pstBinding->eID;
+      pstSource->fValue = orxFLOAT_0;
+
+      /* Adds it to list & table */
+      orxLinkList_AddEnd(&(sstInput.stSourceList), &(pstSource->stNode));
+      orxHashTable_Add(sstInput.pstSourceTable, u64Key, pstSource);
+
+      /* Updates status */
+      bNew = orxTRUE;
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_INPUT, "Couldn't allocate source for <%s>.", orxInput_GetBindingName(_pstBinding->eType, _pstBinding->eID, _pstBinding->eMode));
+    }
+  }
+
+  /* Valid? */
+  if(pstSource != orxNULL)
+  {
+    /* Links binding to it */
+    orxMemory_Zero(&(_pstBinding->stNode), sizeof(orxLINKLIST_NODE));
+    orxLinkList_AddEnd(&(pstSource->stBindingList), &(_pstBinding->stNode));
+    _pstBinding->pstSource = pstSource;
+
+    /* New source? */
+    if(bNew != orxFALSE)
+    {
+      /* Replaying? */
+      if(orxFLAG_TEST(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_REPLAY))
+      {
+        /* Gets its initial value from the replay stream */
+        orxInput_SetSourceValue(pstSource, orxInput_GetReplayInitialValue(((orxU32)pstSource->eType << orxINPUT_KU32_RECORD_SHIFT_TYPE) | ((orxU32)pstSource->eID & orxINPUT_KU32_RECORD_MASK_ID)));
+      }
+      else
+      {
+        /* Gets its initial value from its peripheral */
+        orxInput_SetSourceValue(pstSource, orxInput_GetBindingValue(pstSource->eType, pstSource->eID));
+
+        /* Recording and active? */
+        if((orxFLAG_TEST(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_RECORD))
+        && (pstSource->fValue != orxFLOAT_0))
+        {
+          /* Records its initial value in the current frame */
+          orxInput_RecordSource(pstSource);
+        }
+      }
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Detaches a binding from its source, deleting the source when not used anymore
+ * @param[in] _pstBinding       Concerned binding
+ */
+static orxINLINE void orxInput_DetachSource(orxINPUT_BINDING *_pstBinding)
+{
+  orxINPUT_SOURCE *pstSource;
+
+  /* Checks */
+  orxASSERT(_pstBinding != orxNULL);
+
+  /* Gets source */
+  pstSource = _pstBinding->pstSource;
+
+  /* Valid? */
+  if(pstSource != orxNULL)
+  {
+    /* Unlinks binding */
+    orxLinkList_Remove(&(_pstBinding->stNode));
+    _pstBinding->pstSource = orxNULL;
+
+    /* Not used anymore? */
+    if(orxLinkList_GetCount(&(pstSource->stBindingList)) == 0)
+    {
+      /* Removes it from table & list */
+      orxHashTable_Remove(sstInput.pstSourceTable, ((orxU64)pstSource->eType << 32) | (orxU64)pstSource->eID);
+      orxLinkList_Remove(&(pstSource->stNode));
+
+      /* Deletes it */
+      orxBank_Free(sstInput.pstSourceBank, pstSource);
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Writes an end of frame marker to the record file
+ */
+static orxINLINE void orxInput_RecordEndOfFrame()
+{
+  orxU32 u32Marker = orxINPUT_KU32_RECORD_END_OF_FRAME;
+
+  /* Checks */
+  orxASSERT(sstInput.pstRecordFile != orxNULL);
+
+  /* Writes it */
+  orxFile_Write(&u32Marker, sizeof(orxU32), 1, sstInput.pstRecordFile);
+
+  /* Done! */
+  return;
+}
+
+/** Reads the next frame from the replay file and applies it to the sources
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE if the end of the replay has been reached
+ */
+static orxINLINE orxSTATUS orxInput_ReplayFrame()
+{
+  orxU32    u32Key;
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(sstInput.pstReplayFile != orxNULL);
+
+  /* Clears values left from previous frame */
+  sstInput.u32ReplayPendingCount = 0;
+
+  /* For all records */
+  while(orxFile_Read(&u32Key, sizeof(orxU32), 1, sstInput.pstReplayFile) == 1)
+  {
+    orxFLOAT fValue;
+
+    /* End of frame? */
+    if(u32Key == orxINPUT_KU32_RECORD_END_OF_FRAME)
+    {
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+
+      break;
+    }
+
+    /* Gets value */
+    if(orxFile_Read(&fValue, sizeof(orxFLOAT), 1, sstInput.pstReplayFile) == 1)
+    {
+      orxINPUT_SOURCE *pstSource;
+
+      /* Gets matching source */
+      pstSource = (orxINPUT_SOURCE *)orxHashTable_Get(sstInput.pstSourceTable, ((orxU64)(u32Key >> orxINPUT_KU32_RECORD_SHIFT_TYPE) << 32) | (orxU64)(u32Key & orxINPUT_KU32_RECORD_MASK_ID));
+
+      /* Found? */
+      if(pstSource != orxNULL)
+      {
+        /* Updates it */
+        orxInput_SetSourceValue(pstSource, fValue);
+      }
+      /* Room left for a source attached later in the frame? */
+      else if(sstInput.u32ReplayPendingCount < orxINPUT_KU32_REPLAY_PENDING_NUMBER)
+      {
+        /* Stores it */
+        sstInput.astReplayPendingList[sstInput.u32ReplayPendingCount].u32Key  = u32Key;
+        sstInput.astReplayPendingList[sstInput.u32ReplayPendingCount].fValue  = fValue;
+        sstInput.u32ReplayPendingCount++;
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_INPUT, "Too many replayed values for unattached sources in one frame, dropping <%08X>.", u32Key);
+      }
+    }
+    else
+    {
+      break;
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Polls all the bound sources once and invalidates the entries bound to the ones that changed
+ */
+static orxINLINE void orxInput_UpdateSources()
+{
+  /* Replaying? */
+  if(orxFLAG_TEST(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_REPLAY))
+  {
+    /* Replays next frame */
+    if(orxInput_ReplayFrame() == orxSTATUS_FAILURE)
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_INPUT, "End of input replay reached.");
+
+      /* Stops replay */
+      orxInput_StopReplay();
+    }
+  }
+  else
+  {
+    orxINPUT_SOURCE *pstSource;
+
+    /* Recording? */
+    if(orxFLAG_TEST(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_RECORD))
+    {
+      /* Ends previous frame, including the initial values of sources attached during it */
+      orxInput_RecordEndOfFrame();
+    }
+
+    /* For all sources */
+    for(pstSource = (orxINPUT_SOURCE *)orxLinkList_GetFirst(&(sstInput.stSourceList));
+        pstSource != orxNULL;
+        pstSource = (orxINPUT_SOURCE *)orxLinkList_GetNext(&(pstSource->stNode)))
+    {
+      orxFLOAT fValue;
+
+      /* Gets its value */
+      fValue = orxInput_GetBindingValue(pstSource->eType, pstSource->eID);
+
+      /* Changed? */
+      if(fValue != pstSource->fValue)
+      {
+        /* Updates it */
+        orxInput_SetSourceValue(pstSource, fValue);
+
+        /* Recording? */
+        if(orxFLAG_TEST(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_RECORD))
+        {
+          /* Records it */
+          orxInput_RecordSource(pstSource);
+        }
+      }
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
 static orxINLINE orxINPUT_SET *orxInput_LoadSet(const orxSTRING _zSetName)
 {
   orxINPUT_SET *pstResult = orxNULL;
@@ -564,279 +1045,321 @@ static orxINLINE orxINPUT_SET *orxInput_LoadSet(const orxSTRING _zSetName)
   return pstResult;
 }
 
-static orxINLINE void orxInput_UpdateSet(orxINPUT_SET *_pstSet)
+/** Updates an entry
+ * @param[in] _pstSet           Concerned set
+ * @param[in] _pstEntry         Entry to update
+ */
+static orxINLINE void orxInput_UpdateEntry(orxINPUT_SET *_pstSet, orxINPUT_ENTRY *_pstEntry)
 {
-  orxINPUT_ENTRY *pstEntry;
+  orxU32  i, u32ActiveIndex = 0;
+  orxBOOL bActive = orxFALSE, bStatusSet = orxFALSE, bHasBinding = orxFALSE;
 
-  /* For all entries */
-  for(pstEntry = (orxINPUT_ENTRY *)orxLinkList_GetFirst(&(_pstSet->stEntryList));
-      pstEntry != orxNULL;
-      pstEntry = (orxINPUT_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode)))
-  {
-    orxU32  i, u32ActiveIndex = 0;
-    orxBOOL bActive = orxFALSE, bStatusSet = orxFALSE, bHasBinding = orxFALSE;
+  /* Clears dirty status */
+  orxFLAG_SET(_pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_NONE, orxINPUT_KU32_ENTRY_FLAG_DIRTY);
 
-    /* Had external value? */
-    if(orxFLAG_TEST(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_LAST_EXTERNAL))
-    {
-      /* Updates status */
-      orxFLAG_SET(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_NONE, orxINPUT_KU32_ENTRY_FLAG_LAST_EXTERNAL | orxINPUT_KU32_ENTRY_FLAG_EXTERNAL | orxINPUT_KU32_ENTRY_FLAG_RESET_EXTERNAL | orxINPUT_KU32_ENTRY_FLAG_PERMANENT);
-    }
-    /* Need to reset external value? */
-    else if(orxFLAG_TEST(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_RESET_EXTERNAL))
-    {
-      /* Clears external value */
-      pstEntry->fExternalValue = orxFLOAT_0;
+  /* Had external value? */
+  if(orxFLAG_TEST(_pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_LAST_EXTERNAL))
+  {
+    /* Updates status */
+    orxFLAG_SET(_pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_NONE, orxINPUT_KU32_ENTRY_FLAG_LAST_EXTERNAL | orxINPUT_KU32_ENTRY_FLAG_EXTERNAL | orxINPUT_KU32_ENTRY_FLAG_RESET_EXTERNAL | orxINPUT_KU32_ENTRY_FLAG_PERMANENT);
+  }
+  /* Need to reset external value? */
+  else if(orxFLAG_TEST(_pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_RESET_EXTERNAL))
+  {
+    /* Clears external value */
+    _pstEntry->fExternalValue = orxFLOAT_0;
 
-      /* Updates status */
-      orxFLAG_SET(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_LAST_EXTERNAL, orxINPUT_KU32_ENTRY_FLAG_EXTERNAL | orxINPUT_KU32_ENTRY_FLAG_RESET_EXTERNAL | orxINPUT_KU32_ENTRY_FLAG_PERMANENT);
-    }
-    /* Has non permanent external value? */
-    else if(orxFLAG_GET(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_EXTERNAL | orxINPUT_KU32_ENTRY_FLAG_PERMANENT) == orxINPUT_KU32_ENTRY_FLAG_EXTERNAL)
-    {
-      /* Marks it for reset */
-      orxFLAG_SET(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_RESET_EXTERNAL, orxINPUT_KU32_ENTRY_FLAG_NONE);
-    }
+    /* Updates status */
+    orxFLAG_SET(_pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_LAST_EXTERNAL, orxINPUT_KU32_ENTRY_FLAG_EXTERNAL | orxINPUT_KU32_ENTRY_FLAG_RESET_EXTERNAL | orxINPUT_KU32_ENTRY_FLAG_PERMANENT);
+  }
+  /* Has non permanent external value? */
+  else if(orxFLAG_GET(_pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_EXTERNAL | orxINPUT_KU32_ENTRY_FLAG_PERMANENT) == orxINPUT_KU32_ENTRY_FLAG_EXTERNAL)
+  {
+    /* Marks it for reset */
+    orxFLAG_SET(_pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_RESET_EXTERNAL, orxINPUT_KU32_ENTRY_FLAG_NONE);
+  }
 
-    /* For all bindings */
-    for(i = 0; i < orxINPUT_KU32_BINDING_NUMBER; i++)
+  /* For all bindings */
+  for(i = 0; i < orxINPUT_KU32_BINDING_NUMBER; i++)
+  {
+    /* Valid? */
+    if(_pstEntry->astBindingList[i].eType != orxINPUT_TYPE_NONE)
     {
-      /* Valid? */
-      if(pstEntry->astBindingList[i].eType != orxINPUT_TYPE_NONE)
-      {
-        orxFLOAT fValue, fTestValue;
+      orxFLOAT fValue, fTestValue;
 
-        /* Updates binding status */
-        bHasBinding = orxTRUE;
+      /* Updates binding status */
+      bHasBinding = orxTRUE;
 
-        /* Gets raw value */
-        fValue = orxInput_GetBindingValue(pstEntry->astBindingList[i].eType, pstEntry->astBindingList[i].eID);
+      /* Gets raw value */
+      fValue = (_pstEntry->astBindingList[i].pstSource != orxNULL) ? _pstEntry->astBindingList[i].pstSource->fValue : orxFLOAT_0;
 
-        /* Depending on mode */
-        switch(pstEntry->astBindingList[i].eMode)
+      /* Depending on mode */
+      switch(_pstEntry->astBindingList[i].eMode)
+      {
+        default:
+        case orxINPUT_MODE_FULL:
         {
-          default:
-          case orxINPUT_MODE_FULL:
-          {
-            /* Uses raw value */
-            pstEntry->astBindingList[i].fValue = fValue;
+          /* Uses raw value */
+          _pstEntry->astBindingList[i].fValue = fValue;
 
-            break;
-          }
+          break;
+        }
 
-          case orxINPUT_MODE_POSITIVE:
-          {
-            /* Stores it if positive */
-            pstEntry->astBindingList[i].fValue = (fValue > orxFLOAT_0) ? fValue : orxFLOAT_0;
+        case orxINPUT_MODE_POSITIVE:
+        {
+          /* Stores it if positive */
+          _pstEntry->astBindingList[i].fValue = (fValue > orxFLOAT_0) ? fValue : orxFLOAT_0;
 
-            break;
-          }
+          break;
+        }
 
-          case orxINPUT_MODE_NEGATIVE:
-          {
-            /* Stores it if negative */
-            pstEntry->astBindingList[i].fValue = (fValue < orxFLOAT_0) ? -fValue : orxFLOAT_0;
+        case orxINPUT_MODE_NEGATIVE:
+        {
+          /* Stores it if negative */
+          _pstEntry->astBindingList[i].fValue = (fValue < orxFLOAT_0) ? -fValue : orxFLOAT_0;
 
-            break;
-          }
+          break;
         }
+      }
 
-        /* Gets test value */
-        fTestValue = (orxFLAG_TEST(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_EXTERNAL)) ? pstEntry->fExternalValue : pstEntry->astBindingList[i].fValue;
+      /* Gets test value */
+      fTestValue = (orxFLAG_TEST(_pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_EXTERNAL)) ? _pstEntry->fExternalValue : _pstEntry->astBindingList[i].fValue;
 
-        /* Active? */
-        if(orxMath_Abs(fTestValue) > pstEntry->fThreshold)
+      /* Active? */
+      if(orxMath_Abs(fTestValue) > _pstEntry->fThreshold)
+      {
+        /* First one? */
+        if(bStatusSet == orxFALSE)
         {
-          /* First one? */
-          if(bStatusSet == orxFALSE)
-          {
-            /* Stores active index value */
-            u32ActiveIndex = i;
+          /* Stores active index value */
+          u32ActiveIndex = i;
 
-            /* Updates status */
-            bActive = orxTRUE;
+          /* Updates status */
+          bActive = orxTRUE;
 
-            /* Updates set status */
-            bStatusSet = orxTRUE;
-          }
+          /* Updates set status */
+          bStatusSet = orxTRUE;
         }
-        else
+      }
+      else
+      {
+        /* Is in combine mode? */
+        if(orxFLAG_TEST(_pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_COMBINE))
         {
-          /* Is in combine mode? */
-          if(orxFLAG_TEST(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_COMBINE))
-          {
-            /* Updates status */
-            bActive = orxFALSE;
+          /* Updates status */
+          bActive = orxFALSE;
 
-            /* Updates set status */
-            bStatusSet = orxTRUE;
-          }
+          /* Updates set status */
+          bStatusSet = orxTRUE;
         }
       }
     }
+  }
 
-    /* No binding? */
-    if(bHasBinding == orxFALSE)
+  /* No binding? */
+  if(bHasBinding == orxFALSE)
+  {
+    /* Has external value? */
+    if(orxFLAG_TEST(_pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_EXTERNAL))
     {
-      /* Has external value? */
-      if(orxFLAG_TEST(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_EXTERNAL))
-      {
-        /* Updates active status */
-        bActive = (pstEntry->fExternalValue != orxFLOAT_0);
-      }
+      /* Updates active status */
+      bActive = (_pstEntry->fExternalValue != orxFLOAT_0);
     }
+  }
 
-    /* Active? */
-    if(bActive != orxFALSE)
+  /* Active? */
+  if(bActive != orxFALSE)
+  {
+    /* Was not active and should send events? */
+    if(!orxFLAG_TEST(_pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_ACTIVE))
     {
-      /* Was not active and should send events? */
-      if(!orxFLAG_TEST(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_ACTIVE))
+      orxINPUT_EVENT_PAYLOAD stPayload;
+
+      /* Inits event payload */
+      orxMemory_Zero(&stPayload, sizeof(orxINPUT_EVENT_PAYLOAD));
+      stPayload.zSetName    = _pstSet->zName;
+      stPayload.zInputName  = _pstEntry->zName;
+
+      /* Is in combine mode? */
+      if(orxFLAG_GET(_pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_COMBINE | orxINPUT_KU32_ENTRY_FLAG_EXTERNAL) == orxINPUT_KU32_ENTRY_FLAG_COMBINE)
       {
-        orxINPUT_EVENT_PAYLOAD stPayload;
+        orxU32 i;
 
-        /* Inits event payload */
-        orxMemory_Zero(&stPayload, sizeof(orxINPUT_EVENT_PAYLOAD));
-        stPayload.zSetName    = _pstSet->zName;
-        stPayload.zInputName  = pstEntry->zName;
+        /* For all bindings */
+        for(i = 0; i < orxINPUT_KU32_BINDING_NUMBER; i++)
+        {
+          /* Updates payload */
+          stPayload.aeType[i]   = _pstEntry->astBindingList[i].eType;
+          stPayload.aeMode[i]   = _pstEntry->astBindingList[i].eMode;
+          stPayload.aeID[i]     = _pstEntry->astBindingList[i].eID;
+          stPayload.afValue[i]  = orxInput_ScaleValue(_pstEntry->astBindingList[i].fValue, _pstEntry->fThreshold, _pstEntry->fMultiplier);
+        }
 
-        /* Is in combine mode? */
-        if(orxFLAG_GET(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_COMBINE | orxINPUT_KU32_ENTRY_FLAG_EXTERNAL) == orxINPUT_KU32_ENTRY_FLAG_COMBINE)
+        /* Updates status */
+        orxFLAG_SET(_pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_NEW_STATUS | orxINPUT_KU32_ENTRY_FLAG_ACTIVE | orxINPUT_KU32_ENTRY_MASK_LAST_ACTIVE_BINDING, orxINPUT_KU32_ENTRY_FLAG_NONE);
+      }
+      else
+      {
+        orxU32 i;
+
+        /* External value? */
+        if(orxFLAG_TEST(_pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_EXTERNAL))
         {
-          orxU32 i;
+          /* Updates payload values */
+          stPayload.aeType[0]   = orxINPUT_TYPE_EXTERNAL;
+          stPayload.aeID[0]     = orxENUM_NONE;
+          stPayload.aeMode[0]   = orxINPUT_MODE_FULL;
+          stPayload.afValue[0]  = _pstEntry->fExternalValue;
+        }
+        else
+        {
+          /* Updates active binding values */
+          stPayload.aeType[0]   = _pstEntry->astBindingList[u32ActiveIndex].eType;
+          stPayload.aeID[0]     = _pstEntry->astBindingList[u32ActiveIndex].eID;
+          stPayload.aeMode[0]   = _pstEntry->astBindingList[u32ActiveIndex].eMode;
+          stPayload.afValue[0]  = orxInput_ScaleValue(_pstEntry->astBindingList[u32ActiveIndex].fValue, _pstEntry->fThreshold, _pstEntry->fMultiplier);
+        }
 
-          /* For all bindings */
-          for(i = 0; i < orxINPUT_KU32_BINDING_NUMBER; i++)
-          {
-            /* Updates payload */
-            stPayload.aeType[i]   = pstEntry->astBindingList[i].eType;
-            stPayload.aeMode[i]   = pstEntry->astBindingList[i].eMode;
-            stPayload.aeID[i]     = pstEntry->astBindingList[i].eID;
-            stPayload.afValue[i]  = orxInput_ScaleValue(pstEntry->astBindingList[i].fValue, pstEntry->fThreshold, pstEntry->fMultiplier);
-          }
+        /* For all unused bindings */
+        for(i = 1; i < orxINPUT_KU32_BINDING_NUMBER; i++)
+        {
+          /* Cleans it */
+          stPayload.aeType[i] = orxINPUT_TYPE_NONE;
+        }
+
+        /* Updates status */
+        orxFLAG_SET(_pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_NEW_STATUS | orxINPUT_KU32_ENTRY_FLAG_ACTIVE | (u32ActiveIndex << orxINPUT_KU32_ENTRY_SHIFT_LAST_ACTIVE_BINDING), orxINPUT_KU32_ENTRY_MASK_LAST_ACTIVE_BINDING);
+      }
+
+      /* Sends event */
+      orxEVENT_SEND(orxEVENT_TYPE_INPUT, orxINPUT_EVENT_ON, orxNULL, orxNULL, &stPayload);
+    }
+    else
+    {
+      /* Updates status */
+      orxFLAG_SET(_pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_ACTIVE | (u32ActiveIndex << orxINPUT_KU32_ENTRY_SHIFT_LAST_ACTIVE_BINDING), orxINPUT_KU32_ENTRY_MASK_LAST_ACTIVE_BINDING | orxINPUT_KU32_ENTRY_FLAG_NEW_STATUS);
+    }
+  }
+  else
+  {
+    /* Was active and should send events? */
+    if(orxFLAG_TEST(_pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_ACTIVE))
+    {
+      orxINPUT_EVENT_PAYLOAD stPayload;
+
+      /* Inits event payload */
+      orxMemory_Zero(&stPayload, sizeof(orxINPUT_EVENT_PAYLOAD));
+      stPayload.zSetName    = _pstSet->zName;
+      stPayload.zInputName  = _pstEntry->zName;
+
+      /* Is in combine mode? */
+      if(orxFLAG_GET(_pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_COMBINE | orxINPUT_KU32_ENTRY_FLAG_EXTERNAL | orxINPUT_KU32_ENTRY_FLAG_LAST_EXTERNAL) == orxINPUT_KU32_ENTRY_FLAG_COMBINE)
+      {
+        orxU32 i;
+
+        /* For all bindings */
+        for(i = 0; i < orxINPUT_KU32_BINDING_NUMBER; i++)
+        {
+          /* Updates payload */
+          stPayload.aeType[i]   = _pstEntry->astBindingList[i].eType;
+          stPayload.aeMode[i]   = _pstEntry->astBindingList[i].eMode;
+          stPayload.aeID[i]     = _pstEntry->astBindingList[i].eID;
+          stPayload.afValue[i]  = orxInput_ScaleValue(_pstEntry->astBindingList[i].fValue, _pstEntry->fThreshold, _pstEntry->fMultiplier);;
+        }
+      }
+      else
+      {
+        orxU32 i;
 
-          /* Updates status */
-          orxFLAG_SET(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_NEW_STATUS | orxINPUT_KU32_ENTRY_FLAG_ACTIVE | orxINPUT_KU32_ENTRY_MASK_LAST_ACTIVE_BINDING, orxINPUT_KU32_ENTRY_FLAG_NONE);
+        /* External value? */
+        if(orxFLAG_TEST(_pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_EXTERNAL | orxINPUT_KU32_ENTRY_FLAG_LAST_EXTERNAL))
+        {
+          /* Updates payload values */
+          stPayload.aeType[0]   = orxINPUT_TYPE_EXTERNAL;
+          stPayload.aeID[0]     = orxENUM_NONE;
+          stPayload.aeMode[0]   = orxINPUT_MODE_FULL;
+          stPayload.afValue[0]  = _pstEntry->fExternalValue;
         }
         else
         {
-          orxU32 i;
+          orxU32 u32LastActiveIndex;
 
-          /* External value? */
-          if(orxFLAG_TEST(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_EXTERNAL))
-          {
-            /* Updates payload values */
-            stPayload.aeType[0]   = orxINPUT_TYPE_EXTERNAL;
-            stPayload.aeID[0]     = orxENUM_NONE;
-            stPayload.aeMode[0]   = orxINPUT_MODE_FULL;
-            stPayload.afValue[0]  = pstEntry->fExternalValue;
-          }
-          else
-          {
-            /* Updates active binding values */
-            stPayload.aeType[0]   = pstEntry->astBindingList[u32ActiveIndex].eType;
-            stPayload.aeID[0]     = pstEntry->astBindingList[u32ActiveIndex].eID;
-            stPayload.aeMode[0]   = pstEntry->astBindingList[u32ActiveIndex].eMode;
-            stPayload.afValue[0]  = orxInput_ScaleValue(pstEntry->astBindingList[u32ActiveIndex].fValue, pstEntry->fThreshold, pstEntry->fMultiplier);
-          }
+          /* Gets last active index */
+          u32LastActiveIndex = (_pstEntry->u32Status & orxINPUT_KU32_ENTRY_MASK_LAST_ACTIVE_BINDING) >> orxINPUT_KU32_ENTRY_SHIFT_LAST_ACTIVE_BINDING;
 
-          /* For all unused bindings */
-          for(i = 1; i < orxINPUT_KU32_BINDING_NUMBER; i++)
-          {
-            /* Cleans it */
-            stPayload.aeType[i] = orxINPUT_TYPE_NONE;
-          }
+          /* Checks */
+          orxASSERT(u32LastActiveIndex < orxINPUT_KU32_BINDING_NUMBER);
 
-          /* Updates status */
-          orxFLAG_SET(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_NEW_STATUS | orxINPUT_KU32_ENTRY_FLAG_ACTIVE | (u32ActiveIndex << orxINPUT_KU32_ENTRY_SHIFT_LAST_ACTIVE_BINDING), orxINPUT_KU32_ENTRY_MASK_LAST_ACTIVE_BINDING);
+          /* Updates active binding values */
+          stPayload.aeType[0]   = _pstEntry->astBindingList[u32LastActiveIndex].eType;
+          stPayload.aeID[0]     = _pstEntry->astBindingList[u32LastActiveIndex].eID;
+          stPayload.aeMode[0]   = _pstEntry->astBindingList[u32LastActiveIndex].eMode;
+          stPayload.afValue[0]  = orxInput_ScaleValue(_pstEntry->astBindingList[u32LastActiveIndex].fValue, _pstEntry->fThreshold, _pstEntry->fMultiplier);
         }
 
-        /* Sends event */
-        orxEVENT_SEND(orxEVENT_TYPE_INPUT, orxINPUT_EVENT_ON, orxNULL, orxNULL, &stPayload);
-      }
-      else
-      {
-        /* Updates status */
-        orxFLAG_SET(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_ACTIVE | (u32ActiveIndex << orxINPUT_KU32_ENTRY_SHIFT_LAST_ACTIVE_BINDING), orxINPUT_KU32_ENTRY_MASK_LAST_ACTIVE_BINDING | orxINPUT_KU32_ENTRY_FLAG_NEW_STATUS);
+        /* For all unused bindings */
+        for(i = 1; i < orxINPUT_KU32_BINDING_NUMBER; i++)
+        {
+          /* Cleans it */
+          stPayload.aeType[i] = orxINPUT_TYPE_NONE;
+        }
       }
+
+      /* Updates status */
+      orxFLAG_SET(_pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_NEW_STATUS, orxINPUT_KU32_ENTRY_FLAG_ACTIVE);
+
+      /* Sends event */
+      orxEVENT_SEND(orxEVENT_TYPE_INPUT, orxINPUT_EVENT_OFF, orxNULL, orxNULL, &stPayload);
     }
     else
     {
-      /* Was active and should send events? */
-      if(orxFLAG_TEST(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_ACTIVE))
-      {
-        orxINPUT_EVENT_PAYLOAD stPayload;
-
-        /* Inits event payload */
-        orxMemory_Zero(&stPayload, sizeof(orxINPUT_EVENT_PAYLOAD));
-        stPayload.zSetName    = _pstSet->zName;
-        stPayload.zInputName  = pstEntry->zName;
-
-        /* Is in combine mode? */
-        if(orxFLAG_GET(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_COMBINE | orxINPUT_KU32_ENTRY_FLAG_EXTERNAL | orxINPUT_KU32_ENTRY_FLAG_LAST_EXTERNAL) == orxINPUT_KU32_ENTRY_FLAG_COMBINE)
-        {
-          orxU32 i;
+      /* Updates status */
+      orxFLAG_SET(_pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_NONE, orxINPUT_KU32_ENTRY_FLAG_NEW_STATUS);
+    }
+  }
 
-          /* For all bindings */
-          for(i = 0; i < orxINPUT_KU32_BINDING_NUMBER; i++)
-          {
-            /* Updates payload */
-            stPayload.aeType[i]   = pstEntry->astBindingList[i].eType;
-            stPayload.aeMode[i]   = pstEntry->astBindingList[i].eMode;
-            stPayload.aeID[i]     = pstEntry->astBindingList[i].eID;
-            stPayload.afValue[i]  = orxInput_ScaleValue(pstEntry->astBindingList[i].fValue, pstEntry->fThreshold, pstEntry->fMultiplier);;
-          }
-        }
-        else
-        {
-          orxU32 i;
+  /* Done! */
+  return;
+}
 
-          /* External value? */
-          if(orxFLAG_TEST(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_EXTERNAL | orxINPUT_KU32_ENTRY_FLAG_LAST_EXTERNAL))
-          {
-            /* Updates payload values */
-            stPayload.aeType[0]   = orxINPUT_TYPE_EXTERNAL;
-            stPayload.aeID[0]     = orxENUM_NONE;
-            stPayload.aeMode[0]   = orxINPUT_MODE_FULL;
-            stPayload.afValue[0]  = pstEntry->fExternalValue;
-          }
-          else
-          {
-            orxU32 u32LastActiveIndex;
+static orxINLINE void orxInput_UpdateSet(orxINPUT_SET *_pstSet)
+{
+  /* Needs update? */
+  if(orxFLAG_TEST(_pstSet->u32Flags, orxINPUT_KU32_SET_FLAG_PENDING | orxINPUT_KU32_SET_FLAG_DIRTY))
+  {
+    orxINPUT_ENTRY *pstEntry;
+    orxBOOL         bUpdateAll;
 
-            /* Gets last active index */
-            u32LastActiveIndex = (pstEntry->u32Status & orxINPUT_KU32_ENTRY_MASK_LAST_ACTIVE_BINDING) >> orxINPUT_KU32_ENTRY_SHIFT_LAST_ACTIVE_BINDING;
+    /* Should update all entries? */
+    bUpdateAll = orxFLAG_TEST(_pstSet->u32Flags, orxINPUT_KU32_SET_FLAG_DIRTY) ? orxTRUE : orxFALSE;
 
-            /* Checks */
-            orxASSERT(u32LastActiveIndex < orxINPUT_KU32_BINDING_NUMBER);
+    /* Updates status */
+    orxFLAG_SET(_pstSet->u32Flags, orxINPUT_KU32_SET_FLAG_NONE, orxINPUT_KU32_SET_FLAG_PENDING | orxINPUT_KU32_SET_FLAG_DIRTY);
 
-            /* Updates active binding values */
-            stPayload.aeType[0]   = pstEntry->astBindingList[u32LastActiveIndex].eType;
-            stPayload.aeID[0]     = pstEntry->astBindingList[u32LastActiveIndex].eID;
-            stPayload.aeMode[0]   = pstEntry->astBindingList[u32LastActiveIndex].eMode;
-            stPayload.afValue[0]  = orxInput_ScaleValue(pstEntry->astBindingList[u32LastActiveIndex].fValue, pstEntry->fThreshold, pstEntry->fMultiplier);
-          }
+    /* For all entries */
+    for(pstEntry = (orxINPUT_ENTRY *)orxLinkList_GetFirst(&(_pstSet->stEntryList));
+        pstEntry != orxNULL;
+        pstEntry = (orxINPUT_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode)))
+    {
+      /* Needs update? */
+      if((bUpdateAll != orxFALSE)
+      || (orxFLAG_TEST(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_DIRTY | orxINPUT_KU32_ENTRY_MASK_UPDATE)))
+      {
+        /* Updates it */
+        orxInput_UpdateEntry(_pstSet, pstEntry);
 
-          /* For all unused bindings */
-          for(i = 1; i < orxINPUT_KU32_BINDING_NUMBER; i++)
-          {
-            /* Cleans it */
-            stPayload.aeType[i] = orxINPUT_TYPE_NONE;
-          }
+        /* Still needs an update on next frame? */
+        if(orxFLAG_TEST(pstEntry->u32Status, orxINPUT_KU32_ENTRY_MASK_UPDATE))
+        {
+          /* Updates set status */
+          orxFLAG_SET(_pstSet->u32Flags, orxINPUT_KU32_SET_FLAG_PENDING, orxINPUT_KU32_SET_FLAG_NONE);
         }
-
-        /* Updates status */
-        orxFLAG_SET(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_NEW_STATUS, orxINPUT_KU32_ENTRY_FLAG_ACTIVE);
-
-        /* Sends event */
-        orxEVENT_SEND(orxEVENT_TYPE_INPUT, orxINPUT_EVENT_OFF, orxNULL, orxNULL, &stPayload);
-      }
-      else
-      {
-        /* Updates status */
-        orxFLAG_SET(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_NONE, orxINPUT_KU32_ENTRY_FLAG_NEW_STATUS);
       }
     }
   }
+
+  /* Done! */
+  return;
 }
 
 /* Save filter callback */
@@ -895,6 +1418,9 @@ static void orxFASTCALL orxInput_Update(const orxCLOCK_INFO *_pstClockInfo, void
   /* Updates mouse move */
   orxMouse_GetMoveDelta(&(sstInput.vMouseMove));
 
+  /* Polls all bound sources */
+  orxInput_UpdateSources();
+
   /* Gets set from parameter */
   pstSet = (orxINPUT_SET *)_pContext;
 
@@ -961,12 +1487,18 @@ static orxINLINE orxINPUT_ENTRY *orxInput_CreateEntry(const orxSTRING _zEntryNam
       pstResult->u32Status  = orxINPUT_KU32_ENTRY_FLAG_NONE;
       pstResult->fThreshold = orxINPUT_KF_DEFAULT_THRESHOLD;
       pstResult->fMultiplier= orxINPUT_KF_DEFAULT_MULTIPLIER;
+      pstResult->pstSet     = sstInput.pstCurrentSet;
       for(i = 0; i < orxINPUT_KU32_BINDING_NUMBER; i++)
       {
-        pstResult->astBindingList[i].eType  = orxINPUT_TYPE_NONE;
-        pstResult->astBindingList[i].eID    = orxENUM_NONE;
-        pstResult->astBindingList[i].eMode  = orxINPUT_MODE_NONE;
+        pstResult->astBindingList[i].eType    = orxINPUT_TYPE_NONE;
+        pstResult->astBindingList[i].eID      = orxENUM_NONE;
+        pstResult->astBindingList[i].eMode    = orxINPUT_MODE_NONE;
+        pstResult->astBindingList[i].pstSource= orxNULL;
+        pstResult->astBindingList[i].pstEntry = pstResult;
       }
+
+      /* Marks it for update */
+      orxInput_InvalidateEntry(pstResult);
     }
   }
 
@@ -980,10 +1512,19 @@ static orxINLINE orxINPUT_ENTRY *orxInput_CreateEntry(const orxSTRING _zEntryNam
  */
 static orxINLINE void orxInput_DeleteEntry(orxINPUT_SET *_pstSet, orxINPUT_ENTRY *_pstEntry)
 {
+  orxU32 i;
+
   /* Checks */
   orxASSERT(_pstSet != orxNULL);
   orxASSERT(_pstEntry != orxNULL);
 
+  /* For all bindings */
+  for(i = 0; i < orxINPUT_KU32_BINDING_NUMBER; i++)
+  {
+    /* Detaches it from its source */
+    orxInput_DetachSource(&(_pstEntry->astBindingList[i]));
+  }
+
   /* Removes it from list */
   orxLinkList_Remove(&(_pstEntry->stNode));
 
@@ -1029,8 +1570,8 @@ static orxINLINE orxINPUT_SET *orxInput_CreateSet(orxSTRINGID _stSetID)
         /* Sets its ID */
         pstResult->stID = _stSetID;
 
-        /* Clears its flags */
-        pstResult->u32Flags = orxINPUT_KU32_SET_FLAG_NONE;
+        /* Inits its flags */
+        pstResult->u32Flags = orxINPUT_KU32_SET_FLAG_DIRTY;
       }
       else
       {
@@ -1141,6 +1682,7 @@ void orxFASTCALL orxInput_Setup()
   orxModule_AddDependency(orxMODULE_ID_INPUT, orxMODULE_ID_EVENT);
   orxModule_AddDependency(orxMODULE_ID_INPUT, orxMODULE_ID_COMMAND);
   orxModule_AddDependency(orxMODULE_ID_INPUT, orxMODULE_ID_PROFILER);
+  orxModule_AddDependency(orxMODULE_ID_INPUT, orxMODULE_ID_FILE);
   orxModule_AddOptionalDependency(orxMODULE_ID_INPUT, orxMODULE_ID_KEYBOARD);
   orxModule_AddOptionalDependency(orxMODULE_ID_INPUT, orxMODULE_ID_MOUSE);
   orxModule_AddOptionalDependency(orxMODULE_ID_INPUT, orxMODULE_ID_JOYSTICK);
@@ -1161,11 +1703,15 @@ orxSTATUS orxFASTCALL orxInput_Init()
     /* Cleans control structure */
     orxMemory_Zero(&sstInput, sizeof(orxINPUT_STATIC));
 
-    /* Creates set banks */
-    sstInput.pstSetBank = orxBank_Create(orxINPUT_KU32_SET_BANK_SIZE, sizeof(orxINPUT_SET), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+    /* Creates set & source banks */
+    sstInput.pstSetBank     = orxBank_Create(orxINPUT_KU32_SET_BANK_SIZE, sizeof(orxINPUT_SET), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+    sstInput.pstSourceBank  = orxBank_Create(orxINPUT_KU32_SOURCE_BANK_SIZE, sizeof(orxINPUT_SOURCE), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+
+    /* Creates source table */
+    sstInput.pstSourceTable = orxHashTable_Create(orxINPUT_KU32_SOURCE_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
 
     /* Valid? */
-    if(sstInput.pstSetBank != orxNULL)
+    if((sstInput.pstSetBank != orxNULL) && (sstInput.pstSourceBank != orxNULL) && (sstInput.pstSourceTable != orxNULL))
     {
       orxCLOCK *pstClock;
 
@@ -1187,6 +1733,25 @@ orxSTATUS orxFASTCALL orxInput_Init()
           /* Loads from input */
           orxInput_Load(orxSTRING_EMPTY);
 
+          /* Pushes input config section */
+          orxConfig_PushSection(orxINPUT_KZ_CONFIG_SECTION);
+
+          /* Should replay? */
+          if(orxConfig_HasValue(orxINPUT_KZ_CONFIG_REPLAY) != orxFALSE)
+          {
+            /* Starts replay */
+            orxInput_StartReplay(orxConfig_GetString(orxINPUT_KZ_CONFIG_REPLAY));
+          }
+          /* Should record? */
+          else if(orxConfig_HasValue(orxINPUT_KZ_CONFIG_RECORD) != orxFALSE)
+          {
+            /* Starts recording */
+            orxInput_StartRecording(orxConfig_GetString(orxINPUT_KZ_CONFIG_RECORD));
+          }
+
+          /* Pops config section */
+          orxConfig_PopSection();
+
           /* Registers commands */
           orxInput_RegisterCommands();
 
@@ -1199,13 +1764,33 @@ orxSTATUS orxFASTCALL orxInput_Init()
           /* Deletes clock */
           orxClock_Delete(pstClock);
 
-          /* Deletes set bank */
+          /* Deletes source table & banks */
+          orxHashTable_Delete(sstInput.pstSourceTable);
+          orxBank_Delete(sstInput.pstSourceBank);
           orxBank_Delete(sstInput.pstSetBank);
         }
       }
       else
       {
-        /* Deletes set bank */
+        /* Deletes source table & banks */
+        orxHashTable_Delete(sstInput.pstSourceTable);
+        orxBank_Delete(sstInput.pstSourceBank);
+        orxBank_Delete(sstInput.pstSetBank);
+      }
+    }
+    else
+    {
+      /* Deletes whatever was created */
+      if(sstInput.pstSourceTable != orxNULL)
+      {
+        orxHashTable_Delete(sstInput.pstSourceTable);
+      }
+      if(sstInput.pstSourceBank != orxNULL)
+      {
+        orxBank_Delete(sstInput.pstSourceBank);
+      }
+      if(sstInput.pstSetBank != orxNULL)
+      {
         orxBank_Delete(sstInput.pstSetBank);
       }
     }
@@ -1239,6 +1824,10 @@ void orxFASTCALL orxInput_Exit()
     /* Unregisters commands */
     orxInput_UnregisterCommands();
 
+    /* Stops recording & replay */
+    orxInput_StopRecording();
+    orxInput_StopReplay();
+
     /* While there's still a set */
     while((pstSet = (orxINPUT_SET *)orxLinkList_GetFirst(&(sstInput.stSetList))) != orxNULL)
     {
@@ -1250,6 +1839,12 @@ void orxFASTCALL orxInput_Exit()
     orxBank_Delete(sstInput.pstSetBank);
     sstInput.pstSetBank = orxNULL;
 
+    /* Clears source table & bank */
+    orxHashTable_Delete(sstInput.pstSourceTable);
+    sstInput.pstSourceTable = orxNULL;
+    orxBank_Delete(sstInput.pstSourceBank);
+    sstInput.pstSourceBank = orxNULL;
+
     /* Gets core clock */
     pstClock = orxClock_FindFirst(orx2F(-1.0f), orxCLOCK_TYPE_CORE);
 
@@ -1569,6 +2164,9 @@ orxSTATUS orxFASTCALL orxInput_SelectSet(const orxSTRING _zSetName)
       {
         orxINPUT_EVENT_PAYLOAD stPayload;
 
+        /* Updates its status as it might not have been updated while not selected */
+        orxFLAG_SET(sstInput.pstCurrentSet->u32Flags, orxINPUT_KU32_SET_FLAG_DIRTY, orxINPUT_KU32_SET_FLAG_NONE);
+
         /* Inits event payload */
         orxMemory_Zero(&stPayload, sizeof(orxINPUT_EVENT_PAYLOAD));
         stPayload.zSetName = sstInput.pstCurrentSet->zName;
@@ -1648,7 +2246,7 @@ orxSTATUS orxFASTCALL orxInput_EnableSet(const orxSTRING _zSetName, orxBOOL _bEn
         if(_bEnable != orxFALSE)
         {
           /* Enables it */
-          orxFLAG_SET(pstSet->u32Flags, orxINPUT_KU32_SET_FLAG_ENABLED, orxINPUT_KU32_SET_FLAG_NONE);
+          orxFLAG_SET(pstSet->u32Flags, orxINPUT_KU32_SET_FLAG_ENABLED | orxINPUT_KU32_SET_FLAG_DIRTY, orxINPUT_KU32_SET_FLAG_NONE);
         }
         else
         {
@@ -1990,6 +2588,7 @@ orxSTATUS orxFASTCALL orxInput_SetValue(const orxSTRING _zInputName, orxFLOAT _f
 
       /* Updates its status */
       orxFLAG_SET(pstSelectedEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_EXTERNAL, orxINPUT_KU32_ENTRY_FLAG_PERMANENT | orxINPUT_KU32_ENTRY_FLAG_RESET_EXTERNAL | orxINPUT_KU32_ENTRY_FLAG_LAST_EXTERNAL);
+      orxInput_InvalidateEntry(pstSelectedEntry);
 
       /* Updates result */
       eResult = orxSTATUS_SUCCESS;
@@ -2052,6 +2651,7 @@ orxSTATUS orxFASTCALL orxInput_SetPermanentValue(const orxSTRING _zInputName, or
 
       /* Updates its status */
       orxFLAG_SET(pstSelectedEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_EXTERNAL | orxINPUT_KU32_ENTRY_FLAG_PERMANENT, orxINPUT_KU32_ENTRY_FLAG_RESET_EXTERNAL | orxINPUT_KU32_ENTRY_FLAG_LAST_EXTERNAL);
+      orxInput_InvalidateEntry(pstSelectedEntry);
 
       /* Updates result */
       eResult = orxSTATUS_SUCCESS;
@@ -2096,6 +2696,7 @@ orxSTATUS orxFASTCALL orxInput_ResetValue(const orxSTRING _zInputName)
 
         /* Updates its status */
         orxFLAG_SET(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_RESET_EXTERNAL, orxINPUT_KU32_ENTRY_FLAG_EXTERNAL | orxINPUT_KU32_ENTRY_FLAG_PERMANENT);
+        orxInput_InvalidateEntry(pstEntry);
 
         /* Updates result */
         eResult = orxSTATUS_SUCCESS;
@@ -2184,6 +2785,9 @@ orxSTATUS orxFASTCALL orxInput_SetThreshold(const orxSTRING _zInputName, orxFLOA
         /* Stores threshold */
         pstEntry->fThreshold = _fThreshold;
 
+        /* Marks it for update */
+        orxInput_InvalidateEntry(pstEntry);
+
         /* Updates result */
         eResult = orxSTATUS_SUCCESS;
 
@@ -2324,6 +2928,9 @@ orxSTATUS orxFASTCALL orxInput_SetCombineMode(const orxSTRING _zName, orxBOOL _b
           orxFLAG_SET(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_NONE, orxINPUT_KU32_ENTRY_FLAG_COMBINE);
         }
 
+        /* Marks it for update */
+        orxInput_InvalidateEntry(pstEntry);
+
         /* Updates result */
         eResult = orxSTATUS_SUCCESS;
 
@@ -2481,12 +3088,21 @@ orxSTATUS orxFASTCALL orxInput_Bind(const orxSTRING _zName, orxINPUT_TYPE _eType
           orxDEBUG_PRINT(orxDEBUG_LEVEL_INPUT, "Input [%s.%s]: replacing <%s> with <%s>", sstInput.pstCurrentSet->zName, pstEntry->zName, orxInput_GetBindingName(pstEntry->astBindingList[u32Index].eType, pstEntry->astBindingList[u32Index].eID, pstEntry->astBindingList[u32Index].eMode), orxInput_GetBindingName(_eType, _eID, _eMode));
         }
 
+        /* Detaches previous source */
+        orxInput_DetachSource(&(pstEntry->astBindingList[u32Index]));
+
         /* Updates binding */
         pstEntry->astBindingList[u32Index].eType  = _eType;
         pstEntry->astBindingList[u32Index].eID    = _eID;
         pstEntry->astBindingList[u32Index].eMode  = _eMode;
         pstEntry->astBindingList[u32Index].fValue = orxFLOAT_0;
 
+        /* Attaches new source */
+        orxInput_AttachSource(&(pstEntry->astBindingList[u32Index]));
+
+        /* Marks entry for update */
+        orxInput_InvalidateEntry(pstEntry);
+
         /* Gets new oldest index */
         u32Index = (u32Index + 1) % orxINPUT_KU32_BINDING_NUMBER;
 
@@ -2549,6 +3165,7 @@ orxSTATUS orxFASTCALL orxInput_Unbind(const orxSTRING _zName, orxS32 _s32Binding
           for(u32Index = 0; u32Index < orxINPUT_KU32_BINDING_NUMBER; u32Index++)
           {
             /* Unbinds it */
+            orxInput_DetachSource(&(pstEntry->astBindingList[u32Index]));
             pstEntry->astBindingList[u32Index].eType = orxINPUT_TYPE_NONE;
           }
           u32Index = 0;
@@ -2556,6 +3173,7 @@ orxSTATUS orxFASTCALL orxInput_Unbind(const orxSTRING _zName, orxS32 _s32Binding
         else
         {
           /* Updates binding */
+          orxInput_DetachSource(&(pstEntry->astBindingList[_s32BindingIndex]));
           pstEntry->astBindingList[_s32BindingIndex].eType = orxINPUT_TYPE_NONE;
 
           /* For all bindings */
@@ -2572,6 +3190,9 @@ orxSTATUS orxFASTCALL orxInput_Unbind(const orxSTRING _zName, orxS32 _s32Binding
           u32Index = (orxU32)_s32BindingIndex;
         }
 
+        /* Marks entry for update */
+        orxInput_InvalidateEntry(pstEntry);
+
         /* Still bound? */
         if(bBound != orxFALSE)
         {
@@ -3131,3 +3752,244 @@ orxSTATUS orxFASTCALL orxInput_GetActiveBinding(orxINPUT_TYPE *_peType, orxENUM
   /* Done! */
   return eResult;
 }
+
+/** Starts recording all bound peripheral inputs to a file, along with the current random seeds
+ * @param[in]   _zFileName      Name of the record file
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxInput_StartRecording(const orxSTRING _zFileName)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_READY));
+  orxASSERT(_zFileName != orxNULL);
+
+  /* Not already recording nor replaying? */
+  if(!orxFLAG_TEST(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_RECORD | orxINPUT_KU32_STATIC_FLAG_REPLAY))
+  {
+    /* Valid? */
+    if(*_zFileName != orxCHAR_NULL)
+    {
+      /* Opens file */
+      sstInput.pstRecordFile = orxFile_Open(_zFileName, orxFILE_KU32_FLAG_OPEN_WRITE | orxFILE_KU32_FLAG_OPEN_BINARY);
+
+      /* Success? */
+      if(sstInput.pstRecordFile != orxNULL)
+      {
+        orxINPUT_RECORD_HEADER  stHeader;
+        orxINPUT_SOURCE        *pstSource;
+
+        /* Inits header */
+        stHeader.u32Magic   = orxINPUT_KU32_RECORD_MAGIC;
+        stHeader.u32Version = orxINPUT_KU32_RECORD_VERSION;
+        orxMath_GetRandomSeeds(stHeader.au32Seeds);
+
+        /* Writes it */
+        orxFile_Write(&stHeader, sizeof(orxINPUT_RECORD_HEADER), 1, sstInput.pstRecordFile);
+
+        /* For all sources */
+        for(pstSource = (orxINPUT_SOURCE *)orxLinkList_GetFirst(&(sstInput.stSourceList));
+            pstSource != orxNULL;
+            pstSource = (orxINPUT_SOURCE *)orxLinkList_GetNext(&(pstSource->stNode)))
+        {
+          /* Active? */
+          if(pstSource->fValue != orxFLOAT_0)
+          {
+            /* Records its initial state */
+            orxInput_RecordSource(pstSource);
+          }
+        }
+
+        /* Updates status */
+        orxFLAG_SET(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_RECORD, orxINPUT_KU32_STATIC_FLAG_NONE);
+
+        /* Updates result */
+        eResult = orxSTATUS_SUCCESS;
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_INPUT, "Can't record inputs: couldn't open file <%s> for writing.", _zFileName);
+      }
+    }
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_INPUT, "Can't record inputs to <%s>: already recording or replaying.", _zFileName);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Stops recording inputs
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxInput_StopRecording()
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_READY));
+
+  /* Recording? */
+  if(orxFLAG_TEST(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_RECORD))
+  {
+    /* Ends last frame */
+    orxInput_RecordEndOfFrame();
+
+    /* Closes file */
+    orxFile_Close(sstInput.pstRecordFile);
+    sstInput.pstRecordFile = orxNULL;
+
+    /* Updates status */
+    orxFLAG_SET(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_NONE, orxINPUT_KU32_STATIC_FLAG_RECORD);
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Is recording inputs?
+ * @return orxTRUE / orxFALSE
+ */
+orxBOOL orxFASTCALL orxInput_IsRecording()
+{
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_READY));
+
+  /* Done! */
+  return orxFLAG_TEST(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_RECORD) ? orxTRUE : orxFALSE;
+}
+
+/** Starts replaying inputs from a record file, peripherals won't be polled anymore till the end of the replay
+ * @param[in]   _zFileName      Name of the record file
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxInput_StartReplay(const orxSTRING _zFileName)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_READY));
+  orxASSERT(_zFileName != orxNULL);
+
+  /* Not already recording nor replaying? */
+  if(!orxFLAG_TEST(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_RECORD | orxINPUT_KU32_STATIC_FLAG_REPLAY))
+  {
+    /* Valid? */
+    if(*_zFileName != orxCHAR_NULL)
+    {
+      /* Opens file */
+      sstInput.pstReplayFile = orxFile_Open(_zFileName, orxFILE_KU32_FLAG_OPEN_READ | orxFILE_KU32_FLAG_OPEN_BINARY);
+
+      /* Success? */
+      if(sstInput.pstReplayFile != orxNULL)
+      {
+        orxINPUT_RECORD_HEADER stHeader;
+
+        /* Valid header? */
+        if((orxFile_Read(&stHeader, sizeof(orxINPUT_RECORD_HEADER), 1, sstInput.pstReplayFile) == 1)
+        && (stHeader.u32Magic == orxINPUT_KU32_RECORD_MAGIC)
+        && (stHeader.u32Version == orxINPUT_KU32_RECORD_VERSION))
+        {
+          orxINPUT_SOURCE *pstSource;
+
+          /* Restores random seeds */
+          orxMath_SetRandomSeeds(stHeader.au32Seeds);
+
+          /* For all sources */
+          for(pstSource = (orxINPUT_SOURCE *)orxLinkList_GetFirst(&(sstInput.stSourceList));
+              pstSource != orxNULL;
+              pstSource = (orxINPUT_SOURCE *)orxLinkList_GetNext(&(pstSource->stNode)))
+          {
+            /* Resets it */
+            orxInput_SetSourceValue(pstSource, orxFLOAT_0);
+          }
+
+          /* Applies initial frame */
+          if(orxInput_ReplayFrame() != orxSTATUS_FAILURE)
+          {
+            /* Updates status */
+            orxFLAG_SET(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_REPLAY, orxINPUT_KU32_STATIC_FLAG_NONE);
+
+            /* Updates result */
+            eResult = orxSTATUS_SUCCESS;
+          }
+        }
+
+        /* Failure? */
+        if(eResult == orxSTATUS_FAILURE)
+        {
+          /* Logs message */
+          orxDEBUG_PRINT(orxDEBUG_LEVEL_INPUT, "Can't replay inputs: <%s> is not a valid input record.", _zFileName);
+
+          /* Closes file */
+          orxFile_Close(sstInput.pstReplayFile);
+          sstInput.pstReplayFile = orxNULL;
+        }
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_INPUT, "Can't replay inputs: couldn't open file <%s> for reading.", _zFileName);
+      }
+    }
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_INPUT, "Can't replay inputs from <%s>: already recording or replaying.", _zFileName);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Stops replaying inputs
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxInput_StopReplay()
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_READY));
+
+  /* Replaying? */
+  if(orxFLAG_TEST(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_REPLAY))
+  {
+    /* Closes file */
+    orxFile_Close(sstInput.pstReplayFile);
+    sstInput.pstReplayFile = orxNULL;
+
+    /* Clears pending values */
+    sstInput.u32ReplayPendingCount = 0;
+
+    /* Updates status */
+    orxFLAG_SET(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_NONE, orxINPUT_KU32_STATIC_FLAG_REPLAY);
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Is replaying inputs?
+ * @return orxTRUE / orxFALSE
+ */
+orxBOOL orxFASTCALL orxInput_IsReplaying()
+{
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_READY));
+
+  /* Done! */
+  return orxFLAG_TEST(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_REPLAY) ? orxTRUE : orxFALSE;
+}
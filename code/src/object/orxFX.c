@@ -66,6 +66,7 @@
  */
 #define orxFX_SLOT_KU32_FLAG_NONE               0x00000000  /**< No flag */
 
+#define orxFX_SLOT_KU32_FLAG_INSTANT            0x08000000  /**< Instant flag */
 #define orxFX_SLOT_KU32_FLAG_DEFINED            0x10000000  /**< Defined flag */
 #define orxFX_SLOT_KU32_FLAG_AMPLIFICATION      0x20000000  /**< Amplification flag */
 #define orxFX_SLOT_KU32_FLAG_ACCELERATION       0x40000000  /**< Acceleration flag */
@@ -167,23 +168,28 @@ typedef struct __orxFX_SLOT_t
   orxFLOAT    fAmplification;                   /**< Amplification over time : 20 */
   orxFLOAT    fAcceleration;                    /**< Acceleration over time : 24 */
   orxFLOAT    fPow;                             /**< Curve exponent : 28 */
+  orxFLOAT    fRecDuration;                     /**< Compiled reciprocal duration : 32 */
+  orxFLOAT    fAcceleratedRecDuration;          /**< Compiled reciprocal accelerated duration : 36 */
+  orxFLOAT    fPeriod;                          /**< Compiled period : 40 */
+  orxFLOAT    fFrequency;                       /**< Compiled frequency : 44 */
+  orxFLOAT    fSineOffset;                      /**< Compiled sine phase offset : 48 */
 
   union
   {
     struct
     {
-      orxFLOAT fStartValue;                     /**< Alpha start value : 32 */
-      orxFLOAT fEndValue;                       /**< Alpha end value : 36 */
-    };                                          /**< Alpha Fade  : 36 */
+      orxFLOAT fStartValue;                     /**< Alpha start value : 52 */
+      orxFLOAT fEndValue;                       /**< Alpha end value : 56 */
+    };                                          /**< Alpha Fade  : 56 */
 
     struct
     {
-      orxVECTOR vStartValue;                    /**< ColorBlend start value : 40 */
-      orxVECTOR vEndValue;                      /**< ColorBlend end value : 52 */
-    };                                          /** Color blend : 52 */
+      orxVECTOR vStartValue;                    /**< ColorBlend start value : 64 */
+      orxVECTOR vEndValue;                      /**< ColorBlend end value : 76 */
+    };                                          /** Color blend : 76 */
   };
 
-  orxU32 u32Flags;                              /**< Flags : 56 */
+  orxU32 u32Flags;                              /**< Flags : 80 */
 
 } orxFX_SLOT;
 
@@ -194,7 +200,7 @@ struct __orxFX_t
   orxSTRUCTURE    stStructure;                            /**< Public structure, first structure member : 32 */
   const orxSTRING zReference;                             /**< FX reference : 20 */
   orxFLOAT        fDuration;                              /**< FX duration : 24 */
-  orxFX_SLOT      astFXSlotList[orxFX_KU32_SLOT_NUMBER];  /**< FX slot list : 472 */
+  orxFX_SLOT      astFXSlotList[orxFX_KU32_SLOT_NUMBER];  /**< FX slot list : 664 */
 };
 
 /** Static structure
@@ -265,6 +271,194 @@ static orxINLINE orxU32 orxFX_FindEmptySlotIndex(const orxFX *_pstFX)
   return u32Result;
 }
 
+/** Compiles a slot: precomputes all the time-independent values used when applying it
+ * @param[in] _pstFXSlot        Concerned FX slot
+ */
+static orxINLINE void orxFX_CompileSlot(orxFX_SLOT *_pstFXSlot)
+{
+  orxFLOAT fDuration;
+
+  /* Checks */
+  orxASSERT(_pstFXSlot != orxNULL);
+
+  /* Gets duration */
+  fDuration = _pstFXSlot->fEndTime - _pstFXSlot->fStartTime;
+
+  /* Gets reciprocal durations */
+  _pstFXSlot->fRecDuration            = (fDuration > orxFLOAT_0) ? orxFLOAT_1 / fDuration : orxFLOAT_1;
+  _pstFXSlot->fAcceleratedRecDuration = (fDuration > orxFLOAT_0) ? orxFLOAT_1 / (fDuration * _pstFXSlot->fAcceleration) : orxFLOAT_1;
+
+  /* Gets period: cycle period if valid, whole duration otherwise */
+  _pstFXSlot->fPeriod = (_pstFXSlot->fCyclePeriod > orxFLOAT_0) ? _pstFXSlot->fCyclePeriod : fDuration;
+
+  /* Instant update? */
+  if(_pstFXSlot->fPeriod == orxFLOAT_0)
+  {
+    /* Gets fake period and frequency */
+    _pstFXSlot->fPeriod = _pstFXSlot->fFrequency = orxFLOAT_1;
+
+    /* Updates flags */
+    _pstFXSlot->u32Flags |= orxFX_SLOT_KU32_FLAG_INSTANT;
+  }
+  else
+  {
+    /* Gets its corresponding frequency */
+    _pstFXSlot->fFrequency = orxFLOAT_1 / _pstFXSlot->fPeriod;
+
+    /* Updates flags */
+    _pstFXSlot->u32Flags &= ~orxFX_SLOT_KU32_FLAG_INSTANT;
+  }
+
+  /* Gets sine offset: starts at given phase * 2Pi - Pi/2 */
+  _pstFXSlot->fSineOffset = _pstFXSlot->fPeriod * (_pstFXSlot->fCyclePhase - orx2F(0.25f));
+
+  return;
+}
+
+/** Evaluates a compiled slot curve at a slot local time stamp
+ * @param[in]   _pstFXSlot      Concerned FX slot
+ * @param[in]   _fTime          Slot local time stamp
+ * @param[in]   _fRecDuration   Reciprocal duration, used for amplification
+ * @param[out]  _pfCoef         Curve coef
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxINLINE orxSTATUS orxFX_EvaluateSlot(const orxFX_SLOT *_pstFXSlot, orxFLOAT _fTime, orxFLOAT _fRecDuration, orxFLOAT *_pfCoef)
+{
+  orxFLOAT  fCoef;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT(_pstFXSlot != orxNULL);
+  orxASSERT(_pfCoef != orxNULL);
+
+  /* Depending on blend curve */
+  switch(_pstFXSlot->u32Flags & orxFX_SLOT_KU32_MASK_BLEND_CURVE)
+  {
+    case orxFX_CURVE_LINEAR:
+    {
+      /* Gets linear coef in period [0.0; 1.0] starting at given phase */
+      fCoef = (_fTime * _pstFXSlot->fFrequency) + _pstFXSlot->fCyclePhase;
+
+      /* Non zero? */
+      if(fCoef != orxFLOAT_0)
+      {
+        /* Gets its modulo, zero being max value */
+        fCoef = orxMath_Mod(fCoef, orxFLOAT_1);
+        fCoef = (fCoef == orxFLOAT_0) ? orxFLOAT_1 : fCoef;
+      }
+
+      break;
+    }
+
+    case orxFX_CURVE_SMOOTH:
+    {
+      /* Gets linear coef in period [0.0; 1.0] starting at given phase */
+      fCoef = (_fTime * _pstFXSlot->fFrequency) + _pstFXSlot->fCyclePhase;
+
+      /* Non zero? */
+      if(fCoef != orxFLOAT_0)
+      {
+        /* Gets its modulo, zero being max value */
+        fCoef = orxMath_Mod(fCoef, orxFLOAT_1);
+        fCoef = (fCoef == orxFLOAT_0) ? orxFLOAT_1 : (fCoef * fCoef) * (orx2F(3.0f) - (orx2F(2.0f) * fCoef));
+      }
+
+      break;
+    }
+
+    case orxFX_CURVE_SMOOTHER:
+    {
+      /* Gets linear coef in period [0.0; 1.0] starting at given phase */
+      fCoef = (_fTime * _pstFXSlot->fFrequency) + _pstFXSlot->fCyclePhase;
+
+      /* Non zero? */
+      if(fCoef != orxFLOAT_0)
+      {
+        /* Gets its modulo, zero being max value */
+        fCoef = orxMath_Mod(fCoef, orxFLOAT_1);
+        fCoef = (fCoef == orxFLOAT_0) ? orxFLOAT_1 : (fCoef * fCoef * fCoef) * (fCoef * ((fCoef * orx2F(6.0f)) - orx2F(15.0f)) + orx2F(10.0f));
+      }
+
+      break;
+    }
+
+    case orxFX_CURVE_TRIANGLE:
+    {
+      /* Gets linear coef in period [0.0; 2.0] starting at given phase */
+      fCoef = orxMath_Mod(((_fTime * _pstFXSlot->fFrequency) + _pstFXSlot->fCyclePhase) * orx2F(2.0f), orx2F(2.0f));
+
+      /* Gets symetric coef between 1.0 & 2.0 */
+      fCoef = (fCoef > orxFLOAT_1) ? orx2F(2.0f) - fCoef : fCoef;
+
+      break;
+    }
+
+    case orxFX_CURVE_SQUARE:
+    {
+      /* Gets linear coef in period [0.0; 1.0] starting at given phase */
+      fCoef = (_fTime * _pstFXSlot->fFrequency) + _pstFXSlot->fCyclePhase;
+
+      /* Non zero? */
+      if(fCoef != orxFLOAT_0)
+      {
+        /* Gets its modulo */
+        fCoef = orxMath_Mod(fCoef, orxFLOAT_1);
+
+        /* Gets max value in high section, min value otherwise */
+        fCoef = ((fCoef >= orx2F(0.25f)) && (fCoef < orx2F(0.75f))) ? orxFLOAT_1 : orxFLOAT_0;
+      }
+
+      break;
+    }
+
+    case orxFX_CURVE_SINE:
+    {
+      /* Gets sine coef starting at given phase * 2Pi - Pi/2 */
+      fCoef = (orxMath_Sin((orxMATH_KF_2_PI * (_fTime + _pstFXSlot->fSineOffset)) * _pstFXSlot->fFrequency) + orxFLOAT_1) * orx2F(0.5f);
+
+      break;
+    }
+
+    default:
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, "Invalid curve.");
+
+      /* Clears coef */
+      fCoef = orxFLOAT_0;
+
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+
+      break;
+    }
+  }
+
+  /* Success? */
+  if(eResult != orxSTATUS_FAILURE)
+  {
+    /* Has amplification? */
+    if(orxFLAG_TEST(_pstFXSlot->u32Flags, orxFX_SLOT_KU32_FLAG_AMPLIFICATION))
+    {
+      /* Updates coef */
+      fCoef *= orxLERP(orxFLOAT_1, _pstFXSlot->fAmplification, _fTime * _fRecDuration);
+    }
+
+    /* Using an exponential curve? */
+    if(orxFLAG_TEST(_pstFXSlot->u32Flags, orxFX_SLOT_KU32_FLAG_POW))
+    {
+      /* Updates coef */
+      fCoef = orxMath_Pow(fCoef, _pstFXSlot->fPow);
+    }
+
+    /* Stores it */
+    *_pfCoef = fCoef;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 /** Processes config data
  */
 static orxINLINE orxSTATUS orxFX_ProcessData(orxFX *_pstFX)
@@ -797,7 +991,7 @@ orxSTATUS orxFASTCALL orxFX_Apply(const orxFX *_pstFX, orxOBJECT *_pstObject, or
       /* Is defined? */
       if(orxFLAG_TEST(pstFXSlot->u32Flags, orxFX_SLOT_KU32_FLAG_DEFINED))
       {
-        orxFLOAT fStartTime, fPeriod, fFrequency, fStartCoef, fEndCoef;
+        orxFLOAT fStartTime, fStartCoef, fEndCoef;
 
 /* Some versions of GCC have an optimization bug on fEndTime which leads to a bogus value when reaching the end of a slot */
 #if defined(__orxGCC__)
@@ -822,26 +1016,26 @@ orxSTATUS orxFASTCALL orxFX_Apply(const orxFX *_pstFX, orxOBJECT *_pstObject, or
           fStartTime -= pstFXSlot->fStartTime;
           fEndTime   -= pstFXSlot->fStartTime;
 
-          /* Gets reciprocal duration */
-          fRecDuration = pstFXSlot->fEndTime - pstFXSlot->fStartTime;
-          fRecDuration = (fRecDuration > orxFLOAT_0) ? orxFLOAT_1 / fRecDuration : orxFLOAT_1;
-
           /* Has acceleration? */
           if(orxFLAG_TEST(pstFXSlot->u32Flags, orxFX_SLOT_KU32_FLAG_ACCELERATION))
           {
             orxFLOAT fStartAcceleration, fEndAcceleration;
 
             /* Gets acceleration coefs */
-            fStartAcceleration  = orxLERP(orxFLOAT_1, pstFXSlot->fAcceleration, fStartTime * fRecDuration);
-            fEndAcceleration    = orxLERP(orxFLOAT_1, pstFXSlot->fAcceleration, fEndTime * fRecDuration);
+            fStartAcceleration  = orxLERP(orxFLOAT_1, pstFXSlot->fAcceleration, fStartTime * pstFXSlot->fRecDuration);
+            fEndAcceleration    = orxLERP(orxFLOAT_1, pstFXSlot->fAcceleration, fEndTime * pstFXSlot->fRecDuration);
 
             /* Updates the times */
             fStartTime *= fStartAcceleration;
             fEndTime   *= fEndAcceleration;
 
-            /* Updates reciprocal duration */
-            fRecDuration = (pstFXSlot->fEndTime - pstFXSlot->fStartTime);
-            fRecDuration = (fRecDuration > orxFLOAT_0) ? orxFLOAT_1 / (fRecDuration * pstFXSlot->fAcceleration) : orxFLOAT_1;
+            /* Gets accelerated reciprocal duration */
+            fRecDuration = pstFXSlot->fAcceleratedRecDuration;
+          }
+          else
+          {
+            /* Gets reciprocal duration */
+            fRecDuration = pstFXSlot->fRecDuration;
           }
 
           /* Gets FX type */
@@ -850,291 +1044,20 @@ orxSTATUS orxFASTCALL orxFX_Apply(const orxFX *_pstFX, orxOBJECT *_pstObject, or
           /* Is FX type not blocked? */
           if(abLockList[eFXType] == orxFALSE)
           {
-            /* Has a valid cycle period? */
-            if(pstFXSlot->fCyclePeriod > orxFLOAT_0)
-            {
-              /* Gets it */
-              fPeriod = pstFXSlot->fCyclePeriod;
-            }
-            else
-            {
-              /* Gets whole duration as period */
-              fPeriod = pstFXSlot->fEndTime - pstFXSlot->fStartTime;
-            }
-
             /* Instant update? */
-            if(fPeriod == orxFLOAT_0)
+            if(orxFLAG_TEST(pstFXSlot->u32Flags, orxFX_SLOT_KU32_FLAG_INSTANT))
             {
-              /* Gets fake period and frequency */
-              fPeriod = fFrequency = orxFLOAT_1;
-
-              /* Updates times */
+              /* Uses whole fake period */
               fStartTime  = orxFLOAT_0;
               fEndTime    = orxFLOAT_1;
             }
-            else
-            {
-              /* Gets its corresponding frequency */
-              fFrequency = orxFLOAT_1 / fPeriod;
-            }
 
-            /* Depending on blend curve */
-            switch(pstFXSlot->u32Flags & orxFX_SLOT_KU32_MASK_BLEND_CURVE)
+            /* Evaluates both coefs */
+            if((orxFX_EvaluateSlot(pstFXSlot, fStartTime, fRecDuration, &fStartCoef) == orxSTATUS_FAILURE)
+            || (orxFX_EvaluateSlot(pstFXSlot, fEndTime, fRecDuration, &fEndCoef) == orxSTATUS_FAILURE))
             {
-              case orxFX_CURVE_LINEAR:
-              {
-                /* Gets linear start coef in period [0.0; 1.0] starting at given phase */
-                fStartCoef = (fStartTime * fFrequency) + pstFXSlot->fCyclePhase;
-
-                /* Non zero? */
-                if(fStartCoef != orxFLOAT_0)
-                {
-                  /* Gets its modulo */
-                  fStartCoef = orxMath_Mod(fStartCoef, orxFLOAT_1);
-
-                  /* Zero? */
-                  if(fStartCoef == orxFLOAT_0)
-                  {
-                    /* Sets it at max value */
-                    fStartCoef = orxFLOAT_1;
-                  }
-                }
-
-                /* Gets linear end coef in period [0.0; 1.0] starting at given phase */
-                fEndCoef = (fEndTime * fFrequency) + pstFXSlot->fCyclePhase;
-
-                /* Non zero? */
-                if(fEndCoef != orxFLOAT_0)
-                {
-                  /* Gets its modulo */
-                  fEndCoef = orxMath_Mod(fEndCoef, orxFLOAT_1);
-
-                  /* Zero? */
-                  if(fEndCoef == orxFLOAT_0)
-                  {
-                    /* Sets it at max value */
-                    fEndCoef = orxFLOAT_1;
-                  }
-                }
-
-                break;
-              }
-
-              case orxFX_CURVE_SMOOTH:
-              {
-                /* Gets linear start coef in period [0.0; 1.0] starting at given phase */
-                fStartCoef = (fStartTime * fFrequency) + pstFXSlot->fCyclePhase;
-
-                /* Non zero? */
-                if(fStartCoef != orxFLOAT_0)
-                {
-                  /* Gets its modulo */
-                  fStartCoef = orxMath_Mod(fStartCoef, orxFLOAT_1);
-
-                  /* Zero? */
-                  if(fStartCoef == orxFLOAT_0)
-                  {
-                    /* Sets it at max value */
-                    fStartCoef = orxFLOAT_1;
-                  }
-                  else
-                  {
-                    /* Gets smoothed value */
-                    fStartCoef = (fStartCoef * fStartCoef) * (orx2F(3.0f) - (orx2F(2.0f) * fStartCoef));
-                  }
-                }
-
-                /* Gets linear end coef in period [0.0; 1.0] starting at given phase */
-                fEndCoef = (fEndTime * fFrequency) + pstFXSlot->fCyclePhase;
-
-                /* Non zero? */
-                if(fEndCoef != orxFLOAT_0)
-                {
-                  /* Gets its modulo */
-                  fEndCoef = orxMath_Mod(fEndCoef, orxFLOAT_1);
-
-                  /* Zero? */
-                  if(fEndCoef == orxFLOAT_0)
-                  {
-                    /* Sets it at max value */
-                    fEndCoef = orxFLOAT_1;
-                  }
-                  else
-                  {
-                    /* Gets smoothed value */
-                    fEndCoef = (fEndCoef * fEndCoef) * (orx2F(3.0f) - (orx2F(2.0f) * fEndCoef));
-                  }
-                }
-
-                break;
-              }
-
-              case orxFX_CURVE_SMOOTHER:
-              {
-                /* Gets linear start coef in period [0.0; 1.0] starting at given phase */
-                fStartCoef = (fStartTime * fFrequency) + pstFXSlot->fCyclePhase;
-
-                /* Non zero? */
-                if(fStartCoef != orxFLOAT_0)
-                {
-                  /* Gets its modulo */
-                  fStartCoef = orxMath_Mod(fStartCoef, orxFLOAT_1);
-
-                  /* Zero? */
-                  if(fStartCoef == orxFLOAT_0)
-                  {
-                    /* Sets it at max value */
-                    fStartCoef = orxFLOAT_1;
-                  }
-                  else
-                  {
-                    /* Gets smoothed value */
-                    fStartCoef = (fStartCoef * fStartCoef * fStartCoef) * (fStartCoef * ((fStartCoef * orx2F(6.0f)) - orx2F(15.0f)) + orx2F(10.0f));
-                  }
-                }
-
-                /* Gets linear end coef in period [0.0; 1.0] starting at given phase */
-                fEndCoef = (fEndTime * fFrequency) + pstFXSlot->fCyclePhase;
-
-                /* Non zero? */
-                if(fEndCoef != orxFLOAT_0)
-                {
-                  /* Gets its modulo */
-                  fEndCoef = orxMath_Mod(fEndCoef, orxFLOAT_1);
-
-                  /* Zero? */
-                  if(fEndCoef == orxFLOAT_0)
-                  {
-                    /* Sets it at max value */
-                    fEndCoef = orxFLOAT_1;
-                  }
-                  else
-                  {
-                    /* Gets smoothed value */
-                    fEndCoef = (fEndCoef * fEndCoef * fEndCoef) * (fEndCoef * ((fEndCoef * orx2F(6.0f)) - orx2F(15.0f)) + orx2F(10.0f));
-                  }
-                }
-
-                break;
-              }
-
-              case orxFX_CURVE_TRIANGLE:
-              {
-                /* Gets linear coef in period [0.0; 2.0] starting at given phase */
-                fStartCoef = (fStartTime * fFrequency) + pstFXSlot->fCyclePhase;
-                fStartCoef = orxMath_Mod(fStartCoef * orx2F(2.0f), orx2F(2.0f));
-
-                /* Gets symetric coef between 1.0 & 2.0 */
-                if(fStartCoef > orxFLOAT_1)
-                {
-                  fStartCoef = orx2F(2.0f) - fStartCoef;
-                }
-
-                /* Gets linear coef in period [0.0; 2.0] starting at given phase */
-                fEndCoef = (fEndTime * fFrequency) + pstFXSlot->fCyclePhase;
-                fEndCoef = orxMath_Mod(fEndCoef * orx2F(2.0f), orx2F(2.0f));
-
-                /* Gets symetric coef between 1.0 & 2.0 */
-                if(fEndCoef > orxFLOAT_1)
-                {
-                  fEndCoef = orx2F(2.0f) - fEndCoef;
-                }
-
-                break;
-              }
-
-              case orxFX_CURVE_SQUARE:
-              {
-                /* Gets linear start coef in period [0.0; 1.0] starting at given phase */
-                fStartCoef = (fStartTime * fFrequency) + pstFXSlot->fCyclePhase;
-
-                /* Non zero? */
-                if(fStartCoef != orxFLOAT_0)
-                {
-                    /* Gets its modulo */
-                    fStartCoef = orxMath_Mod(fStartCoef, orxFLOAT_1);
-
-                    /* High section? */
-                    if((fStartCoef >= orx2F(0.25f))
-                    && (fStartCoef < orx2F(0.75f)))
-                    {
-                        /* Sets it at max value */
-                        fStartCoef = orxFLOAT_1;
-                    }
-                    else
-                    {
-                        /* Sets it at min value */
-                        fStartCoef = orxFLOAT_0;
-                    }
-                }
-
-                /* Gets linear End coef in period [0.0; 1.0] Ending at given phase */
-                fEndCoef = (fEndTime * fFrequency) + pstFXSlot->fCyclePhase;
-
-                /* Non zero? */
-                if(fEndCoef != orxFLOAT_0)
-                {
-                    /* Gets its modulo */
-                    fEndCoef = orxMath_Mod(fEndCoef, orxFLOAT_1);
-
-                    /* High section? */
-                    if((fEndCoef >= orx2F(0.25f))
-                    && (fEndCoef < orx2F(0.75f)))
-                    {
-                        /* Sets it at max value */
-                        fEndCoef = orxFLOAT_1;
-                    }
-                    else
-                    {
-                        /* Sets it at min value */
-                        fEndCoef = orxFLOAT_0;
-                    }
-                }
-
-                break;
-              }
-
-              case orxFX_CURVE_SINE:
-              {
-                /* Gets sine coef starting at given phase * 2Pi - Pi/2 */
-                fStartCoef = (orxMath_Sin((orxMATH_KF_2_PI * (fStartTime + (fPeriod * (pstFXSlot->fCyclePhase - orx2F(0.25f))))) * fFrequency) + orxFLOAT_1) * orx2F(0.5f);
-
-                /* Gets sine coef starting at given phase * 2Pi - Pi/2 */
-                fEndCoef = (orxMath_Sin((orxMATH_KF_2_PI * (fEndTime + (fPeriod * (pstFXSlot->fCyclePhase - orx2F(0.25f))))) * fFrequency) + orxFLOAT_1) * orx2F(0.5f);
-
-                break;
-              }
-
-              default:
-              {
-                /* Logs message */
-                orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, "Invalid curve.");
-
-                /* Skips it */
-                continue;
-              }
-            }
-
-            /* Has amplification? */
-            if(orxFLAG_TEST(pstFXSlot->u32Flags, orxFX_SLOT_KU32_FLAG_AMPLIFICATION))
-            {
-              orxFLOAT fStartAmplification, fEndAmplification;
-
-              /* Gets amplification coefs */
-              fStartAmplification = orxLERP(orxFLOAT_1, pstFXSlot->fAmplification, fStartTime * fRecDuration);
-              fEndAmplification   = orxLERP(orxFLOAT_1, pstFXSlot->fAmplification, fEndTime * fRecDuration);
-
-              /* Updates the coefs */
-              fStartCoef *= fStartAmplification;
-              fEndCoef   *= fEndAmplification;
-            }
-
-            /* Using an exponential curve? */
-            if(orxFLAG_TEST(pstFXSlot->u32Flags, orxFX_SLOT_KU32_FLAG_POW))
-            {
-              /* Updates both coefs */
-              fStartCoef = orxMath_Pow(fStartCoef, pstFXSlot->fPow);
-              fEndCoef   = orxMath_Pow(fEndCoef, pstFXSlot->fPow);
+              /* Skips it */
+              continue;
             }
 
             /* Depending on FX type */
@@ -1711,6 +1634,9 @@ orxSTATUS orxFASTCALL orxFX_AddAlpha(orxFX *_pstFX, orxFLOAT _fStartTime, orxFLO
         pstFXSlot->u32Flags |= orxFX_SLOT_KU32_FLAG_POW;
     }
 
+    /* Compiles it */
+    orxFX_CompileSlot(pstFXSlot);
+
     /* Is longer than current FX duration? */
     if(_fEndTime > _pstFX->fDuration)
     {
@@ -1791,6 +1717,9 @@ orxSTATUS orxFASTCALL orxFX_AddRGB(orxFX *_pstFX, orxFLOAT _fStartTime, orxFLOAT
         pstFXSlot->u32Flags |= orxFX_SLOT_KU32_FLAG_POW;
     }
 
+    /* Compiles it */
+    orxFX_CompileSlot(pstFXSlot);
+
     /* Is longer than current FX duration? */
     if(_fEndTime > _pstFX->fDuration)
     {
@@ -1871,6 +1800,9 @@ orxSTATUS orxFASTCALL orxFX_AddHSL(orxFX *_pstFX, orxFLOAT _fStartTime, orxFLOAT
         pstFXSlot->u32Flags |= orxFX_SLOT_KU32_FLAG_POW;
     }
 
+    /* Compiles it */
+    orxFX_CompileSlot(pstFXSlot);
+
     /* Is longer than current FX duration? */
     if(_fEndTime > _pstFX->fDuration)
     {
@@ -1951,6 +1883,9 @@ orxSTATUS orxFASTCALL orxFX_AddHSV(orxFX *_pstFX, orxFLOAT _fStartTime, orxFLOAT
         pstFXSlot->u32Flags |= orxFX_SLOT_KU32_FLAG_POW;
     }
 
+    /* Compiles it */
+    orxFX_CompileSlot(pstFXSlot);
+
     /* Is longer than current FX duration? */
     if(_fEndTime > _pstFX->fDuration)
     {
@@ -2029,6 +1964,9 @@ orxSTATUS orxFASTCALL orxFX_AddRotation(orxFX *_pstFX, orxFLOAT _fStartTime, orx
         pstFXSlot->u32Flags |= orxFX_SLOT_KU32_FLAG_POW;
     }
 
+    /* Compiles it */
+    orxFX_CompileSlot(pstFXSlot);
+
     /* Is longer than current FX duration? */
     if(_fEndTime > _pstFX->fDuration)
     {
@@ -2109,6 +2047,9 @@ orxSTATUS orxFASTCALL orxFX_AddScale(orxFX *_pstFX, orxFLOAT _fStartTime, orxFLO
         pstFXSlot->u32Flags |= orxFX_SLOT_KU32_FLAG_POW;
     }
 
+    /* Compiles it */
+    orxFX_CompileSlot(pstFXSlot);
+
     /* Is longer than current FX duration? */
     if(_fEndTime > _pstFX->fDuration)
     {
@@ -2189,6 +2130,9 @@ orxSTATUS orxFASTCALL orxFX_AddPosition(orxFX *_pstFX, orxFLOAT _fStartTime, orx
         pstFXSlot->u32Flags |= orxFX_SLOT_KU32_FLAG_POW;
     }
 
+    /* Compiles it */
+    orxFX_CompileSlot(pstFXSlot);
+
     /* Is longer than current FX duration? */
     if(_fEndTime > _pstFX->fDuration)
     {
@@ -2269,6 +2213,9 @@ orxSTATUS orxFASTCALL orxFX_AddSpeed(orxFX *_pstFX, orxFLOAT _fStartTime, orxFLO
         pstFXSlot->u32Flags |= orxFX_SLOT_KU32_FLAG_POW;
     }
 
+    /* Compiles it */
+    orxFX_CompileSlot(pstFXSlot);
+
     /* Is longer than current FX duration? */
     if(_fEndTime > _pstFX->fDuration)
     {
@@ -2347,6 +2294,9 @@ orxSTATUS orxFASTCALL orxFX_AddVolume(orxFX *_pstFX, orxFLOAT _fStartTime, orxFL
         pstFXSlot->u32Flags |= orxFX_SLOT_KU32_FLAG_POW;
     }
 
+    /* Compiles it */
+    orxFX_CompileSlot(pstFXSlot);
+
     /* Is longer than current FX duration? */
     if(_fEndTime > _pstFX->fDuration)
     {
@@ -2425,6 +2375,9 @@ orxSTATUS orxFASTCALL orxFX_AddPitch(orxFX *_pstFX, orxFLOAT _fStartTime, orxFLO
         pstFXSlot->u32Flags |= orxFX_SLOT_KU32_FLAG_POW;
     }
 
+    /* Compiles it */
+    orxFX_CompileSlot(pstFXSlot);
+
     /* Is longer than current FX duration? */
     if(_fEndTime > _pstFX->fDuration)
     {
@@ -104,6 +104,7 @@ struct __orxFRAME_t
 {
   orxSTRUCTURE      stStructure;            /**< Public structure, first structure member : 32 */
   orxFRAME_DATA_2D  stData;                 /**< Frame data : 64 */
+  orxU32            u32Version;             /**< Global data version : 68 */
 };
 
 /** Static structure
@@ -151,6 +152,9 @@ static orxINLINE orxBOOL _orxFrame_SetPosition(orxFRAME *_pstFrame, const orxVEC
       /* Stores it */
       orxVector_Copy(&(_pstFrame->stData.vGlobalPos), _pvPos);
 
+      /* Updates version */
+      _pstFrame->u32Version++;
+
       /* Updates result */
       bResult = orxTRUE;
     }
@@ -193,6 +197,9 @@ static orxINLINE orxBOOL _orxFrame_SetRotation(orxFRAME *_pstFrame, orxFLOAT _fR
       /* Stores it */
       _pstFrame->stData.fGlobalRotation = _fRotation;
 
+      /* Updates version */
+      _pstFrame->u32Version++;
+
       /* Updates result */
       bResult = orxTRUE;
     }
@@ -235,6 +242,9 @@ static orxINLINE orxBOOL _orxFrame_SetScale(orxFRAME *_pstFrame, const orxVECTOR
       _pstFrame->stData.fGlobalScaleX = _pvScale->fX;
       _pstFrame->stData.fGlobalScaleY = _pvScale->fY;
 
+      /* Updates version */
+      _pstFrame->u32Version++;
+
       /* Updates result */
       bResult = orxTRUE;
     }
@@ -1075,6 +1085,25 @@ orxBOOL orxFASTCALL orxFrame_IsRootChild(const orxFRAME *_pstFrame)
   return bResult;
 }
 
+/** Gets frame version, incremented every time its global data changes
+ * @param[in]   _pstFrame       Concerned frame
+ * @return Frame version
+ */
+orxU32 orxFASTCALL orxFrame_GetVersion(const orxFRAME *_pstFrame)
+{
+  orxU32 u32Result;
+
+  /* Checks */
+  orxASSERT(sstFrame.u32Flags & orxFRAME_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstFrame);
+
+  /* Updates result */
+  u32Result = _pstFrame->u32Version;
+
+  /* Done! */
+  return u32Result;
+}
+
 /** Sets frame position
  * @param[in]   _pstFrame       Concerned frame
  * @param[in]   _eSpace         Coordinate space system to use
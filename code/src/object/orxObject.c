@@ -57,6 +57,7 @@
 #define orxOBJECT_KU32_STATIC_FLAG_READY        0x00000001  /**< Ready static flag */
 #define orxOBJECT_KU32_STATIC_FLAG_CLOCK        0x00000002  /**< Clock static flag */
 #define orxOBJECT_KU32_STATIC_FLAG_AGE          0x00000004  /**< Age static flag */
+#define orxOBJECT_KU32_STATIC_FLAG_GROUP_DIRTY  0x00000008  /**< Group dirty static flag */
 
 #define orxOBJECT_KU32_STATIC_MASK_ALL          0xFFFFFFFF  /**< Internal static mask */
 
@@ -75,6 +76,8 @@
 #define orxOBJECT_KU32_FLAG_IS_JOINT_CHILD      0x08000000  /**< Is joint child flag */
 #define orxOBJECT_KU32_FLAG_DETACH_JOINT_CHILD  0x00100000  /**< Detach joint child flag */
 #define orxOBJECT_KU32_FLAG_DEATH_ROW           0x00200000  /**< Death row flag */
+#define orxOBJECT_KU32_FLAG_CACHED_BOX          0x00400000  /**< Cached bounding box flag */
+#define orxOBJECT_KU32_FLAG_POOLED              0x00800000  /**< Pooled flag */
 
 #define orxOBJECT_KU32_MASK_LINKED_STRUCTURE    0x0000FFFF  /**< Linked structure mask */
 
@@ -97,6 +100,8 @@
 
 #define orxOBJECT_KU32_GROUP_BANK_SIZE          64
 #define orxOBJECT_KU32_GROUP_TABLE_SIZE         64
+#define orxOBJECT_KU32_GROUP_ARRAY_SIZE         16
+#define orxOBJECT_KU32_GROUP_MEMBERSHIP_NUMBER  4
 
 #define orxOBJECT_KZ_CONFIG_GRAPHIC_NAME        "Graphic"
 #define orxOBJECT_KZ_CONFIG_ANIMPOINTER_NAME    "AnimationSet"
@@ -186,6 +191,28 @@ typedef struct __orxOBJECT_STORAGE_t
 
 } orxOBJECT_STORAGE;
 
+/** Object group structure
+ */
+typedef struct __orxOBJECT_GROUP_t
+{
+  orxOBJECT       **apstObjectList;             /**< Object list (can contain holes) : 4 */
+  orxU32            u32Size;                    /**< Used size : 8 */
+  orxU32            u32Capacity;                /**< Allocated capacity : 12 */
+  orxU32            u32HoleCount;               /**< Hole count : 16 */
+  orxU64            u64Flag;                    /**< Membership filter flag : 24 */
+  orxSTRINGID       stID;                       /**< Group ID : 32 */
+
+} orxOBJECT_GROUP;
+
+/** Object group membership structure
+ */
+typedef struct __orxOBJECT_MEMBERSHIP_t
+{
+  orxOBJECT_GROUP  *pstGroup;                   /**< Group : 4 */
+  orxU32            u32Index;                   /**< Index in group's object list : 8 */
+
+} orxOBJECT_MEMBERSHIP;
+
 /** Object structure
  */
 struct __orxOBJECT_t
@@ -203,7 +230,14 @@ struct __orxOBJECT_t
   orxVECTOR         vSpeed;                     /**< Object speed : 132 */
   orxVECTOR         vSize;                      /**< Object size : 144 */
   orxVECTOR         vPivot;                     /**< Object pivot : 156 */
-  orxLINKLIST_NODE  stGroupNode;                /**< Group node: 176 */
+  orxOBJECT_MEMBERSHIP astMembershipList[orxOBJECT_KU32_GROUP_MEMBERSHIP_NUMBER]; /**< Group memberships, first one is the main group : 188 */
+  orxU64            u64GroupMask;               /**< Group membership filter mask : 196 */
+  const orxOBJECT_GROUP *pstLeftGroup;          /**< Last left group : 200 */
+  orxU32            u32LeftIndex;               /**< Index in last left group : 204 */
+  orxOBOX           stCachedBox;                /**< Cached bounding box : 252 */
+  const orxFRAME   *pstCachedFrame;             /**< Cached box frame : 256 */
+  orxU32            u32CachedFrameVersion;      /**< Cached box frame version : 260 */
+  orxU32            u32CachedGraphicVersion;    /**< Cached box graphic version : 264 */
 };
 
 /** Static structure
@@ -214,10 +248,11 @@ typedef struct __orxOBJECT_STATIC_t
   orxBANK      *pstGroupBank;                   /**< Group bank */
   orxBANK      *pstAgeBank;                     /**< Age bank */
   orxHASHTABLE *pstGroupTable;                  /**< Group table */
-  orxLINKLIST  *pstCachedGroupList;             /**< Cached group list */
+  orxOBJECT_GROUP *pstCachedGroup;              /**< Cached group */
   orxSTRINGID   stDefaultGroupID;               /**< Default group ID */
   orxSTRINGID   stCurrentGroupID;               /**< Current group ID */
   orxSTRINGID   stCachedGroupID;                /**< Cached group ID */
+  orxU32        u32GroupCount;                  /**< Created group count */
   orxU32        u32Flags;                       /**< Control flags */
 
 } orxOBJECT_STATIC;
@@ -236,6 +271,305 @@ static orxOBJECT_STATIC sstObject;
  * Private functions                                                       *
  ***************************************************************************/
 
+/** Gets a group
+ * @param[in]   _stGroupID      Concerned group ID
+ * @param[in]   _bCreate        Creates it if not found
+ * @return      orxOBJECT_GROUP / orxNULL
+ */
+static orxOBJECT_GROUP *orxFASTCALL orxObject_GetGroup(orxSTRINGID _stGroupID, orxBOOL _bCreate)
+{
+  orxOBJECT_GROUP *pstResult;
+
+  /* Is cached one? */
+  if((_stGroupID == sstObject.stCachedGroupID) && (sstObject.pstCachedGroup != orxNULL))
+  {
+    /* Updates result */
+    pstResult = sstObject.pstCachedGroup;
+  }
+  else
+  {
+    /* Should create? */
+    if(_bCreate != orxFALSE)
+    {
+      orxOBJECT_GROUP **ppstBucket;
+
+      /* Gets group bucket */
+      ppstBucket = (orxOBJECT_GROUP **)orxHashTable_Retrieve(sstObject.pstGroupTable, _stGroupID);
+
+      /* Checks */
+      orxASSERT(ppstBucket != orxNULL);
+
+      /* Not found? */
+      if(*ppstBucket == orxNULL)
+      {
+        /* Allocates it */
+        pstResult = (orxOBJECT_GROUP *)orxBank_Allocate(sstObject.pstGroupBank);
+
+        /* Checks */
+        orxASSERT(pstResult != orxNULL);
+
+        /* Inits it */
+        orxMemory_Zero(pstResult, sizeof(orxOBJECT_GROUP));
+        pstResult->stID     = _stGroupID;
+        pstResult->u64Flag  = ((orxU64)1) << (sstObject.u32GroupCount++ & 63);
+
+        /* Stores it */
+        *ppstBucket = pstResult;
+      }
+      else
+      {
+        /* Gets it */
+        pstResult = *ppstBucket;
+      }
+    }
+    else
+    {
+      /* Gets it */
+      pstResult = (orxOBJECT_GROUP *)orxHashTable_Get(sstObject.pstGroupTable, _stGroupID);
+    }
+
+    /* Found? */
+    if(pstResult != orxNULL)
+    {
+      /* Caches it */
+      sstObject.pstCachedGroup  = pstResult;
+      sstObject.stCachedGroupID = _stGroupID;
+    }
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Gets an object's membership slot for a group
+ * @param[in]   _pstObject      Concerned object
+ * @param[in]   _pstGroup       Concerned group
+ * @return      Slot index / orxU32_UNDEFINED
+ */
+static orxINLINE orxU32 orxObject_GetMembershipSlot(const orxOBJECT *_pstObject, const orxOBJECT_GROUP *_pstGroup)
+{
+  orxU32 u32Result = orxU32_UNDEFINED;
+
+  /* Might be a member? */
+  if((_pstGroup != orxNULL) && (_pstObject->u64GroupMask & _pstGroup->u64Flag))
+  {
+    orxU32 i;
+
+    /* For all slots */
+    for(i = 0; i < orxOBJECT_KU32_GROUP_MEMBERSHIP_NUMBER; i++)
+    {
+      /* Found? */
+      if(_pstObject->astMembershipList[i].pstGroup == _pstGroup)
+      {
+        /* Updates result */
+        u32Result = i;
+        break;
+      }
+    }
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Makes sure a group has room for one more object, growing its list if needed (the list is left untouched on failure)
+ * @param[in]   _pstGroup       Concerned group
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxObject_GrowGroup(orxOBJECT_GROUP *_pstGroup)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Full? */
+  if(_pstGroup->u32Size == _pstGroup->u32Capacity)
+  {
+    orxOBJECT **apstNewList;
+    orxU32      u32NewCapacity;
+
+    /* Gets new capacity */
+    u32NewCapacity = (_pstGroup->u32Capacity != 0) ? _pstGroup->u32Capacity << 1 : orxOBJECT_KU32_GROUP_ARRAY_SIZE;
+
+    /* Grows object list */
+    apstNewList = (orxOBJECT **)((_pstGroup->apstObjectList != orxNULL) ? orxMemory_Reallocate(_pstGroup->apstObjectList, u32NewCapacity * sizeof(orxOBJECT *)) : orxMemory_Allocate(u32NewCapacity * sizeof(orxOBJECT *), orxMEMORY_TYPE_MAIN));
+
+    /* Success? */
+    if(apstNewList != orxNULL)
+    {
+      /* Stores it */
+      _pstGroup->apstObjectList = apstNewList;
+      _pstGroup->u32Capacity    = u32NewCapacity;
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, "Couldn't grow group [%s] to %u objects.", orxString_GetFromID(_pstGroup->stID), u32NewCapacity);
+
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Adds an object to a group, using the given membership slot
+ * @param[in]   _pstObject      Concerned object
+ * @param[in]   _pstGroup       Group to join
+ * @param[in]   _u32Slot        Membership slot to use
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxObject_JoinGroup(orxOBJECT *_pstObject, orxOBJECT_GROUP *_pstGroup, orxU32 _u32Slot)
+{
+  orxSTATUS eResult;
+
+  /* Checks */
+  orxASSERT(_u32Slot < orxOBJECT_KU32_GROUP_MEMBERSHIP_NUMBER);
+  orxASSERT(_pstObject->astMembershipList[_u32Slot].pstGroup == orxNULL);
+
+  /* Has room? */
+  if((eResult = orxObject_GrowGroup(_pstGroup)) != orxSTATUS_FAILURE)
+  {
+    /* Stores membership */
+    _pstObject->astMembershipList[_u32Slot].pstGroup  = _pstGroup;
+    _pstObject->astMembershipList[_u32Slot].u32Index  = _pstGroup->u32Size;
+    _pstObject->u64GroupMask                         |= _pstGroup->u64Flag;
+
+    /* Adds object to end of list */
+    _pstGroup->apstObjectList[_pstGroup->u32Size++]   = _pstObject;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Removes an object from the group stored in the given membership slot
+ * @param[in]   _pstObject      Concerned object
+ * @param[in]   _u32Slot        Membership slot to clear
+ */
+static void orxFASTCALL orxObject_LeaveGroup(orxOBJECT *_pstObject, orxU32 _u32Slot)
+{
+  orxOBJECT_GROUP  *pstGroup;
+  orxU32            u32Index, i;
+
+  /* Checks */
+  orxASSERT(_u32Slot < orxOBJECT_KU32_GROUP_MEMBERSHIP_NUMBER);
+  orxASSERT(_pstObject->astMembershipList[_u32Slot].pstGroup != orxNULL);
+
+  /* Gets group & index */
+  pstGroup  = _pstObject->astMembershipList[_u32Slot].pstGroup;
+  u32Index  = _pstObject->astMembershipList[_u32Slot].u32Index;
+
+  /* Checks */
+  orxASSERT(u32Index < pstGroup->u32Size);
+  orxASSERT(pstGroup->apstObjectList[u32Index] == _pstObject);
+
+  /* Last one? */
+  if(u32Index == pstGroup->u32Size - 1)
+  {
+    /* Removes it */
+    pstGroup->u32Size--;
+
+    /* Removes trailing holes */
+    while((pstGroup->u32Size != 0) && (pstGroup->apstObjectList[pstGroup->u32Size - 1] == orxNULL))
+    {
+      pstGroup->u32Size--;
+      pstGroup->u32HoleCount--;
+    }
+  }
+  else
+  {
+    /* Leaves a hole, to keep any ongoing iteration valid */
+    pstGroup->apstObjectList[u32Index] = orxNULL;
+    pstGroup->u32HoleCount++;
+
+    /* Marks groups for compaction */
+    orxFLAG_SET(sstObject.u32Flags, orxOBJECT_KU32_STATIC_FLAG_GROUP_DIRTY, orxOBJECT_KU32_STATIC_FLAG_NONE);
+  }
+
+  /* Remembers where it was, so that an ongoing iteration can resume from there */
+  _pstObject->pstLeftGroup  = pstGroup;
+  _pstObject->u32LeftIndex  = u32Index;
+
+  /* Clears membership */
+  _pstObject->astMembershipList[_u32Slot].pstGroup = orxNULL;
+
+  /* Rebuilds filter mask (flags are shared beyond 64 groups) */
+  for(_pstObject->u64GroupMask = 0, i = 0; i < orxOBJECT_KU32_GROUP_MEMBERSHIP_NUMBER; i++)
+  {
+    /* Valid? */
+    if(_pstObject->astMembershipList[i].pstGroup != orxNULL)
+    {
+      /* Updates mask */
+      _pstObject->u64GroupMask |= _pstObject->astMembershipList[i].pstGroup->u64Flag;
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Compacts all groups, removing their holes while keeping their order
+ */
+static void orxFASTCALL orxObject_CompactGroups()
+{
+  orxOBJECT_GROUP *pstGroup;
+
+  /* For all groups */
+  for(pstGroup = (orxOBJECT_GROUP *)orxBank_GetNext(sstObject.pstGroupBank, orxNULL);
+      pstGroup != orxNULL;
+      pstGroup = (orxOBJECT_GROUP *)orxBank_GetNext(sstObject.pstGroupBank, pstGroup))
+  {
+    /* Has holes? */
+    if(pstGroup->u32HoleCount != 0)
+    {
+      orxU32 i, j;
+
+      /* For all entries */
+      for(i = 0, j = 0; i < pstGroup->u32Size; i++)
+      {
+        orxOBJECT *pstObject;
+
+        /* Gets object */
+        pstObject = pstGroup->apstObjectList[i];
+
+        /* Valid? */
+        if(pstObject != orxNULL)
+        {
+          /* Needs to move? */
+          if(j != i)
+          {
+            orxU32 u32Slot;
+
+            /* Gets its membership slot */
+            u32Slot = orxObject_GetMembershipSlot(pstObject, pstGroup);
+
+            /* Checks */
+            orxASSERT(u32Slot != orxU32_UNDEFINED);
+
+            /* Moves it */
+            pstGroup->apstObjectList[j]                       = pstObject;
+            pstObject->astMembershipList[u32Slot].u32Index    = j;
+          }
+
+          /* Updates packed size */
+          j++;
+        }
+      }
+
+      /* Updates group */
+      pstGroup->u32Size       = j;
+      pstGroup->u32HoleCount  = 0;
+    }
+  }
+
+  /* Updates flags */
+  orxFLAG_SET(sstObject.u32Flags, orxOBJECT_KU32_STATIC_FLAG_NONE, orxOBJECT_KU32_STATIC_FLAG_GROUP_DIRTY);
+
+  /* Done! */
+  return;
+}
+
 /** Update body scale
  */
 void orxFASTCALL orxObject_UpdateBodyScale(orxOBJECT *_pstObject)
@@ -2927,9 +3261,229 @@ static orxINLINE orxOBJECT *orxObject_CreateInternal()
   return pstResult;
 }
 
+/** Gets color from current config section
+ * @param[out]  _pstColor     Color to fill
+ * @return      orxTRUE if a color or an alpha value was defined, orxFALSE otherwise
+ */
+static orxBOOL orxFASTCALL orxObject_GetConfigColor(orxCOLOR *_pstColor)
+{
+  orxVECTOR vColor;
+  orxBOOL   bResult = orxTRUE;
+
+  /* Inits color */
+  orxColor_Set(_pstColor, &orxVECTOR_WHITE, orxFLOAT_1);
+
+  /* Has color? */
+  if(orxConfig_GetVector(orxOBJECT_KZ_CONFIG_COLOR, &vColor) != orxNULL)
+  {
+    /* Normalizes and applies it */
+    orxVector_Mulf(&(_pstColor->vRGB), &vColor, orxCOLOR_NORMALIZER);
+  }
+  /* Has RGB values? */
+  else if(orxConfig_HasValue(orxOBJECT_KZ_CONFIG_RGB) != orxFALSE)
+  {
+    /* Gets its value */
+    orxConfig_GetVector(orxOBJECT_KZ_CONFIG_RGB, &(_pstColor->vRGB));
+  }
+  /* Has HSL values? */
+  else if(orxConfig_HasValue(orxOBJECT_KZ_CONFIG_HSL) != orxFALSE)
+  {
+    /* Gets its value */
+    orxConfig_GetVector(orxOBJECT_KZ_CONFIG_HSL, &(_pstColor->vHSL));
+
+    /* Stores its RGB equivalent */
+    orxColor_FromHSLToRGB(_pstColor, _pstColor);
+  }
+  /* Has HSV values? */
+  else if(orxConfig_HasValue(orxOBJECT_KZ_CONFIG_HSV) != orxFALSE)
+  {
+    /* Gets its value */
+    orxConfig_GetVector(orxOBJECT_KZ_CONFIG_HSV, &(_pstColor->vHSV));
+
+    /* Stores its RGB equivalent */
+    orxColor_FromHSVToRGB(_pstColor, _pstColor);
+  }
+  else
+  {
+    /* Updates result */
+    bResult = orxFALSE;
+  }
+
+  /* Has alpha? */
+  if(orxConfig_HasValue(orxOBJECT_KZ_CONFIG_ALPHA) != orxFALSE)
+  {
+    /* Applies it */
+    orxColor_SetAlpha(_pstColor, orxConfig_GetFloat(orxOBJECT_KZ_CONFIG_ALPHA));
+
+    /* Updates result */
+    bResult = orxTRUE;
+  }
+
+  /* Done! */
+  return bResult;
+}
+
+/** Creates children from current config section's child list
+ * @param[in]   _pstObject      Concerned object
+ * @param[in]   _pstBody        Object's body, used for child joints
+ * @return      Object flags to add (children & joint children)
+ */
+static orxU32 orxFASTCALL orxObject_CreateConfigChildren(orxOBJECT *_pstObject, orxBODY *_pstBody)
+{
+  orxS32 s32Number;
+  orxU32 u32Result = orxOBJECT_KU32_FLAG_NONE;
+
+  /* Has child list? */
+  if((s32Number = orxConfig_GetListCount(orxOBJECT_KZ_CONFIG_CHILD_LIST)) > 0)
+  {
+    orxS32      i, s32JointNumber;
+    orxOBJECT  *pstLastChild;
+
+    /* Gets child joint list number */
+    s32JointNumber = orxConfig_GetListCount(orxOBJECT_KZ_CONFIG_CHILD_JOINT_LIST);
+
+    /* For all defined objects */
+    for(i = 0, pstLastChild = orxNULL; i < s32Number; i++)
+    {
+      orxOBJECT *pstChild;
+
+      /* Stores current group ID */
+      sstObject.stCurrentGroupID = _pstObject->stGroupID;
+
+      /* Creates it */
+      pstChild = orxObject_CreateFromConfig(orxConfig_GetListString(orxOBJECT_KZ_CONFIG_CHILD_LIST, i));
+
+      /* Clears current group ID */
+      sstObject.stCurrentGroupID = sstObject.stDefaultGroupID;
+
+      /* Valid? */
+      if(pstChild != orxNULL)
+      {
+        /* Stores its owner */
+        orxStructure_SetOwner(pstChild, _pstObject);
+
+        /* Has last child? */
+        if(pstLastChild != orxNULL)
+        {
+          /* Sets its sibling */
+          pstLastChild->pstSibling = pstChild;
+        }
+        else
+        {
+          /* Sets first child */
+          _pstObject->pstChild = pstChild;
+        }
+
+        /* Stores last child */
+        pstLastChild = pstChild;
+
+        /* Doesn't already have a parent? */
+        if(orxFrame_IsRootChild(orxOBJECT_GET_STRUCTURE(pstChild, FRAME)) != orxFALSE)
+        {
+          orxBODY *pstChildBody;
+
+          /* Gets its body */
+          pstChildBody = orxOBJECT_GET_STRUCTURE(pstChild, BODY);
+
+          /* Sets its parent */
+          orxObject_SetParent(pstChild, _pstObject);
+
+          /* Valid joint can be added? */
+          if((_pstBody != orxNULL)
+          && (pstChildBody != orxNULL)
+          && (i < s32JointNumber)
+          && (orxBody_AddJointFromConfig(_pstBody, pstChildBody, orxConfig_GetListString(orxOBJECT_KZ_CONFIG_CHILD_JOINT_LIST, i)) != orxNULL))
+          {
+            /* Marks it as a joint child */
+            orxStructure_SetFlags(pstChild, orxOBJECT_KU32_FLAG_IS_JOINT_CHILD | orxOBJECT_KU32_FLAG_DETACH_JOINT_CHILD, orxOBJECT_KU32_FLAG_NONE);
+
+            /* Updates flags */
+            u32Result |= orxOBJECT_KU32_FLAG_HAS_JOINT_CHILDREN;
+          }
+        }
+
+        /* Updates flags */
+        u32Result |= orxOBJECT_KU32_FLAG_HAS_CHILDREN;
+      }
+    }
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Releases all owned children, marking them for deletion
+ * @param[in]   _pstObject      Concerned object
+ */
+static void orxFASTCALL orxObject_ReleaseOwnedChildren(orxOBJECT *_pstObject)
+{
+  /* Has children? */
+  if(orxStructure_TestFlags(_pstObject, orxOBJECT_KU32_FLAG_HAS_CHILDREN))
+  {
+    orxOBJECT *pstChild;
+
+    /* For all children */
+    for(pstChild = _pstObject->pstChild;
+        pstChild != orxNULL;
+        pstChild = _pstObject->pstChild)
+    {
+      /* Removes its owner */
+      orxObject_SetOwner(pstChild, orxNULL);
+
+      /* Marks it for deletion */
+      orxObject_SetLifeTime(pstChild, orxFLOAT_0);
+    }
+
+    /* Updates flags */
+    orxStructure_SetFlags(_pstObject, orxOBJECT_KU32_FLAG_NONE, orxOBJECT_KU32_FLAG_HAS_CHILDREN | orxOBJECT_KU32_FLAG_HAS_JOINT_CHILDREN);
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Renews object's GUID, keeping the structures it owns attached to it
+ * @param[in]   _pstObject      Concerned object
+ */
+static void orxFASTCALL orxObject_RenewGUID(orxOBJECT *_pstObject)
+{
+  orxU32 u32OwnedMask = 0, i;
+
+  /* For all linked structures */
+  for(i = 0; i < orxSTRUCTURE_ID_LINKABLE_NUMBER; i++)
+  {
+    /* Owned by object? */
+    if((_pstObject->astStructureList[i].pstStructure != orxNULL)
+    && (orxStructure_GetOwner(_pstObject->astStructureList[i].pstStructure) == orxSTRUCTURE(_pstObject)))
+    {
+      /* Remembers it */
+      u32OwnedMask |= (orxU32)1 << i;
+    }
+  }
+
+  /* Renews GUID */
+  orxStructure_RenewGUID(_pstObject);
+
+  /* For all owned structures */
+  for(i = 0; i < orxSTRUCTURE_ID_LINKABLE_NUMBER; i++)
+  {
+    /* Was owned? */
+    if(u32OwnedMask & ((orxU32)1 << i))
+    {
+      /* Updates its owner */
+      orxStructure_SetOwner(_pstObject->astStructureList[i].pstStructure, _pstObject);
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
 /** Deletes an object
+ * @param[in]   _pstObject      Concerned object
+ * @param[in]   _bExpired       Is object deleted because its lifetime expired? Only expired objects can be pooled by their spawner
  */
-static orxINLINE orxSTATUS orxObject_DeleteInternal(orxOBJECT *_pstObject)
+static orxINLINE orxSTATUS orxObject_DeleteInternal(orxOBJECT *_pstObject, orxBOOL _bExpired)
 {
   orxSTATUS eResult = orxSTATUS_SUCCESS;
 
@@ -2939,62 +3493,113 @@ static orxINLINE orxSTATUS orxObject_DeleteInternal(orxOBJECT *_pstObject)
   /* Not referenced? */
   if(orxStructure_GetRefCount(_pstObject) == 0)
   {
-    orxEVENT  stEvent;
-    orxU32    i;
+    orxSPAWNER *pstSpawner;
+    orxBOOL     bDelete;
+    orxU32      i;
 
-    /* Inits event */
-    orxEVENT_INIT(stEvent, orxEVENT_TYPE_OBJECT, orxOBJECT_EVENT_DELETE, _pstObject, orxNULL, orxNULL);
+    /* Gets its spawner */
+    pstSpawner = orxSPAWNER(orxStructure_GetOwner(_pstObject));
 
-    /* Sends event */
-    if(orxEvent_Send(&stEvent) != orxSTATUS_FAILURE)
+    /* Pooled? */
+    if(orxStructure_TestFlags(_pstObject, orxOBJECT_KU32_FLAG_POOLED))
     {
-      /* Unlink all structures */
-      for(i = 0; i < orxSTRUCTURE_ID_LINKABLE_NUMBER; i++)
+      /* Has spawner? */
+      if(pstSpawner != orxNULL)
       {
-        orxObject_UnlinkStructure(_pstObject, (orxSTRUCTURE_ID)i);
+        /* Removes it from the pool */
+        orxSpawner_UnpoolObject(pstSpawner, orxSTRUCTURE(_pstObject));
       }
 
-      /* Has children? */
-      if(orxStructure_TestFlags(_pstObject, orxOBJECT_KU32_FLAG_HAS_CHILDREN))
-      {
-        orxOBJECT *pstChild;
+      /* Its delete event was already sent when it got pooled */
+      bDelete = orxTRUE;
+    }
+    else
+    {
+      orxEVENT stEvent;
+
+      /* Inits event */
+      orxEVENT_INIT(stEvent, orxEVENT_TYPE_OBJECT, orxOBJECT_EVENT_DELETE, _pstObject, orxNULL, orxNULL);
 
-        /* For all children */
-        for(pstChild = _pstObject->pstChild;
-            pstChild != orxNULL;
-            pstChild = _pstObject->pstChild)
+      /* Sends event */
+      if(orxEvent_Send(&stEvent) != orxSTATUS_FAILURE)
+      {
+        /* Expired and accepted by its spawner's pool? */
+        if((_bExpired != orxFALSE)
+        && (pstSpawner != orxNULL)
+        && (orxSpawner_PoolObject(pstSpawner, orxSTRUCTURE(_pstObject)) != orxSTATUS_FAILURE))
         {
-          /* Removes its owner */
-          orxObject_SetOwner(pstChild, orxNULL);
+          /* Increases count */
+          orxStructure_IncreaseCount(_pstObject);
+
+          /* Releases its children, they'll be recreated when recycled */
+          orxObject_ReleaseOwnedChildren(_pstObject);
+
+          /* Renews its GUID: references to its previous life won't resolve anymore */
+          orxObject_RenewGUID(_pstObject);
+
+          /* Clears its lifetime */
+          orxObject_SetLifeTime(_pstObject, orx2F(-1.0f));
 
-          /* Marks it for deletion */
-          orxObject_SetLifeTime(pstChild, orxFLOAT_0);
+          /* Disables it */
+          orxObject_Enable(_pstObject, orxFALSE);
+
+          /* Updates flags */
+          orxStructure_SetFlags(_pstObject, orxOBJECT_KU32_FLAG_POOLED, orxOBJECT_KU32_FLAG_NONE);
+
+          /* Keeps it */
+          bDelete = orxFALSE;
+        }
+        else
+        {
+          /* Deletes it */
+          bDelete = orxTRUE;
         }
       }
+      else
+      {
+        /* Increases count */
+        orxStructure_IncreaseCount(_pstObject);
+
+        /* Resets its active time: going undead */
+        _pstObject->fActiveTime = orxFLOAT_0;
+
+        /* Disables it */
+        orxObject_Enable(_pstObject, orxFALSE);
+
+        /* Keeps it */
+        bDelete = orxFALSE;
+      }
+    }
+
+    /* Should delete? */
+    if(bDelete != orxFALSE)
+    {
+      /* Unlink all structures */
+      for(i = 0; i < orxSTRUCTURE_ID_LINKABLE_NUMBER; i++)
+      {
+        orxObject_UnlinkStructure(_pstObject, (orxSTRUCTURE_ID)i);
+      }
+
+      /* Releases its children */
+      orxObject_ReleaseOwnedChildren(_pstObject);
 
       /* Removes owner */
       orxObject_SetOwner(_pstObject, orxNULL);
 
-      /* Removes object from its current group */
-      if(orxLinkList_GetList(&(_pstObject->stGroupNode)) != orxNULL)
+      /* For all group memberships */
+      for(i = 0; i < orxOBJECT_KU32_GROUP_MEMBERSHIP_NUMBER; i++)
       {
-        orxLinkList_Remove(&(_pstObject->stGroupNode));
+        /* Valid? */
+        if(_pstObject->astMembershipList[i].pstGroup != orxNULL)
+        {
+          /* Leaves group */
+          orxObject_LeaveGroup(_pstObject, i);
+        }
       }
 
       /* Deletes structure */
       orxStructure_Delete(_pstObject);
     }
-    else
-    {
-      /* Increases count */
-      orxStructure_IncreaseCount(_pstObject);
-
-      /* Resets its active time: going undead */
-      _pstObject->fActiveTime = orxFLOAT_0;
-
-      /* Disables it */
-      orxObject_Enable(_pstObject, orxFALSE);
-    }
   }
   else
   {
@@ -3083,7 +3688,7 @@ static orxOBJECT *orxFASTCALL orxObject_UpdateInternal(orxOBJECT *_pstObject, co
         pstResult = orxOBJECT(orxStructure_GetNext(_pstObject));
 
         /* Deletes it */
-        orxObject_Delete(_pstObject);
+        orxObject_DeleteInternal(_pstObject, orxTRUE);
 
         /* Marks as deleted */
         bDeleted = orxTRUE;
@@ -3192,6 +3797,13 @@ static void orxFASTCALL orxObject_UpdateAll(const orxCLOCK_INFO *_pstClockInfo,
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxObject_UpdateAll");
 
+  /* Should compact groups? */
+  if(orxFLAG_TEST(sstObject.u32Flags, orxOBJECT_KU32_STATIC_FLAG_GROUP_DIRTY))
+  {
+    /* Compacts them */
+    orxObject_CompactGroups();
+  }
+
   /* For all objects */
   for(pstObject = (orxOBJECT *)orxStructure_GetFirst(orxSTRUCTURE_ID_OBJECT);
       pstObject != orxNULL;
@@ -3277,7 +3889,7 @@ orxSTATUS orxFASTCALL orxObject_Init()
         if(eResult != orxSTATUS_FAILURE)
         {
           /* Creates banks */
-          sstObject.pstGroupBank  = orxBank_Create(orxOBJECT_KU32_GROUP_BANK_SIZE, sizeof(orxLINKLIST), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+          sstObject.pstGroupBank  = orxBank_Create(orxOBJECT_KU32_GROUP_BANK_SIZE, sizeof(orxOBJECT_GROUP), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
           sstObject.pstAgeBank    = orxBank_Create(orxOBJECT_KU32_AGE_BANK_SIZE, sizeof(orxOBJECT *), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
 
           /* Success? */
@@ -3370,6 +3982,8 @@ void orxFASTCALL orxObject_Exit()
   /* Initialized? */
   if(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY)
   {
+    orxOBJECT_GROUP *pstGroup;
+
     /* Unregisters commands */
     orxObject_UnregisterCommands();
 
@@ -3392,6 +4006,19 @@ void orxFASTCALL orxObject_Exit()
     /* Unregisters structure type */
     orxStructure_Unregister(orxSTRUCTURE_ID_OBJECT);
 
+    /* For all groups */
+    for(pstGroup = (orxOBJECT_GROUP *)orxBank_GetNext(sstObject.pstGroupBank, orxNULL);
+        pstGroup != orxNULL;
+        pstGroup = (orxOBJECT_GROUP *)orxBank_GetNext(sstObject.pstGroupBank, pstGroup))
+    {
+      /* Has object list? */
+      if(pstGroup->apstObjectList != orxNULL)
+      {
+        /* Frees it */
+        orxMemory_Free(pstGroup->apstObjectList);
+      }
+    }
+
     /* Deletes group table */
     orxHashTable_Delete(sstObject.pstGroupTable);
 
@@ -3449,28 +4076,203 @@ orxSTATUS orxFASTCALL orxObject_Delete(orxOBJECT *_pstObject)
   orxASSERT((orxEvent_IsSending() == orxFALSE) && "Calling orxObject_Delete() from inside an event handler is *NOT* safe: please consider calling orxObject_SetLifeTime(orxFLOAT_0) instead.");
 
   /* Deletes it */
-  eResult = orxObject_DeleteInternal(_pstObject);
+  eResult = orxObject_DeleteInternal(_pstObject, orxFALSE);
+
+  /* Done! */
+  return eResult;
+}
+
+/** Updates an object.
+ * @param[in] _pstObject        Concerned object
+ * @param[in] _pstClockInfo     Clock information used to compute new object's state
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxObject_Update(orxOBJECT *_pstObject, const orxCLOCK_INFO *_pstClockInfo)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstObject != orxNULL);
+  orxASSERT(_pstClockInfo != orxNULL);
+
+  /* Updates object */
+  orxObject_UpdateInternal(_pstObject, _pstClockInfo);
+
+  /* Done! */
+  return eResult;
+}
+
+/** Recycles an object as if it was newly created from its config section: resets its state (position, rotation, scale, speed, color, lifetime, active time),
+ * restarts its anim set's start animation, FXs, sounds & timeline tracks, recreates its children, re-enables it recursively and sends an orxOBJECT_EVENT_CREATE event.
+ * Graphic and body are kept as is. A pooled object got a new GUID when pooled: references to its previous GUID resolve to orxNULL.
+ * @param[in] _pstObject        Concerned object
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxObject_Recycle(orxOBJECT *_pstObject)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstObject);
+
+  /* Has config section? */
+  if((_pstObject->zReference != orxNULL)
+  && (orxConfig_PushSection(_pstObject->zReference) != orxSTATUS_FAILURE))
+  {
+    orxVECTOR       vValue;
+    orxCOLOR        stColor;
+    orxANIMPOINTER *pstAnimPointer;
+    orxS32          s32Number, i;
+    orxU32          u32Flags;
+
+    /* Releases its current children */
+    orxObject_ReleaseOwnedChildren(_pstObject);
+
+    /* No position? */
+    if(orxConfig_GetVector(orxOBJECT_KZ_CONFIG_POSITION, &vValue) == orxNULL)
+    {
+      /* Uses origin */
+      orxVector_Copy(&vValue, &orxVECTOR_0);
+    }
+
+    /* Resets position */
+    orxObject_SetPosition(_pstObject, &vValue);
+
+    /* Resets rotation */
+    orxObject_SetRotation(_pstObject, orxMATH_KF_DEG_TO_RAD * orxConfig_GetFloat(orxOBJECT_KZ_CONFIG_ROTATION));
+
+    /* Has scale? */
+    if(orxConfig_HasValue(orxOBJECT_KZ_CONFIG_SCALE) != orxFALSE)
+    {
+      /* Is config scale not a vector? */
+      if(orxConfig_GetVector(orxOBJECT_KZ_CONFIG_SCALE, &vValue) == orxNULL)
+      {
+        /* Gets config uniformed scale */
+        orxVector_SetAll(&vValue, orxConfig_GetFloat(orxOBJECT_KZ_CONFIG_SCALE));
+      }
+    }
+    else
+    {
+      /* Uses default scale */
+      orxVector_SetAll(&vValue, orxFLOAT_1);
+    }
+
+    /* Resets scale */
+    orxObject_SetScale(_pstObject, &vValue);
+
+    /* No speed? */
+    if(orxConfig_GetVector(orxOBJECT_KZ_CONFIG_SPEED, &vValue) == orxNULL)
+    {
+      /* Uses null speed */
+      orxVector_Copy(&vValue, &orxVECTOR_0);
+    }
+
+    /* Uses relative speed? */
+    if(orxConfig_GetBool(orxOBJECT_KZ_CONFIG_USE_RELATIVE_SPEED) != orxFALSE)
+    {
+      /* Resets relative speed */
+      orxObject_SetRelativeSpeed(_pstObject, &vValue);
+    }
+    else
+    {
+      /* Resets speed */
+      orxObject_SetSpeed(_pstObject, &vValue);
+    }
+
+    /* Resets angular velocity */
+    orxObject_SetAngularVelocity(_pstObject, orxMATH_KF_DEG_TO_RAD * orxConfig_GetFloat(orxOBJECT_KZ_CONFIG_ANGULAR_VELOCITY));
+
+    /* Resets color */
+    orxObject_SetColor(_pstObject, (orxObject_GetConfigColor(&stColor) != orxFALSE) ? &stColor : orxNULL);
+
+    /* Resets lifetime */
+    orxObject_SetLifeTime(_pstObject, (orxConfig_HasValue(orxOBJECT_KZ_CONFIG_LIFETIME) != orxFALSE) ? orxConfig_GetFloat(orxOBJECT_KZ_CONFIG_LIFETIME) : orx2F(-1.0f));
+
+    /* Resets active time */
+    _pstObject->fActiveTime = orxFLOAT_0;
+
+    /* Gets animation pointer */
+    pstAnimPointer = orxOBJECT_GET_STRUCTURE(_pstObject, ANIMPOINTER);
+
+    /* Valid? */
+    if(pstAnimPointer != orxNULL)
+    {
+      /* Restarts from its anim set's start animation */
+      orxAnimPointer_SetCurrentAnim(pstAnimPointer, orxAnimSet_GetStartAnimID(orxAnimPointer_GetAnimSet(pstAnimPointer)));
+      orxAnimPointer_SetTime(pstAnimPointer, orxFLOAT_0);
+    }
+
+    /* Removes current FXs, sounds & timeline tracks */
+    orxObject_UnlinkStructure(_pstObject, orxSTRUCTURE_ID_FXPOINTER);
+    orxObject_UnlinkStructure(_pstObject, orxSTRUCTURE_ID_SOUNDPOINTER);
+    orxObject_UnlinkStructure(_pstObject, orxSTRUCTURE_ID_TIMELINE);
+
+    /* Recreates children */
+    u32Flags = orxObject_CreateConfigChildren(_pstObject, orxOBJECT_GET_STRUCTURE(_pstObject, BODY));
+
+    /* Updates flags */
+    orxStructure_SetFlags(_pstObject, u32Flags, orxOBJECT_KU32_FLAG_POOLED);
+
+    /* For all defined sounds */
+    for(i = 0, s32Number = orxConfig_GetListCount(orxOBJECT_KZ_CONFIG_SOUND_LIST); i < s32Number; i++)
+    {
+      /* Adds it */
+      orxObject_AddSound(_pstObject, orxConfig_GetListString(orxOBJECT_KZ_CONFIG_SOUND_LIST, i));
+    }
+
+    /* For all defined timeline tracks */
+    for(i = 0, s32Number = orxConfig_GetListCount(orxOBJECT_KZ_CONFIG_TRACK_LIST); i < s32Number; i++)
+    {
+      /* Adds it */
+      orxObject_AddTimeLineTrack(_pstObject, orxConfig_GetListString(orxOBJECT_KZ_CONFIG_TRACK_LIST, i));
+    }
+
+    /* Has FX? */
+    if((s32Number = orxConfig_GetListCount(orxOBJECT_KZ_CONFIG_FX_LIST)) > 0)
+    {
+      orxS32 s32DelayNumber;
+
+      /* Gets number of delays */
+      s32DelayNumber = orxConfig_GetListCount(orxOBJECT_KZ_CONFIG_FX_DELAY_LIST);
+
+      /* For all defined FXs */
+      for(i = 0; i < s32Number; i++)
+      {
+        orxFLOAT fDelay;
+
+        /* Gets its delay */
+        fDelay = (i < s32DelayNumber) ? orxConfig_GetListFloat(orxOBJECT_KZ_CONFIG_FX_DELAY_LIST, i) : orxFLOAT_0;
+
+        /* Adds it */
+        orxObject_AddDelayedFX(_pstObject, orxConfig_GetListString(orxOBJECT_KZ_CONFIG_FX_LIST, i), orxMAX(fDelay, orxFLOAT_0));
+      }
+
+      /* Success? */
+      if(_pstObject->astStructureList[orxSTRUCTURE_ID_FXPOINTER].pstStructure != orxNULL)
+      {
+        orxCLOCK_INFO stClockInfo;
+
+        /* Applies FXs directly to prevent any potential 1-frame visual glitches */
+        orxMemory_Zero(&stClockInfo, sizeof(orxCLOCK_INFO));
+        stClockInfo.fDT = orxMATH_KF_EPSILON;
+        orxStructure_Update(_pstObject->astStructureList[orxSTRUCTURE_ID_FXPOINTER].pstStructure, _pstObject, &stClockInfo);
+      }
+    }
 
-  /* Done! */
-  return eResult;
-}
+    /* Pops section */
+    orxConfig_PopSection();
 
-/** Updates an object.
- * @param[in] _pstObject        Concerned object
- * @param[in] _pstClockInfo     Clock information used to compute new object's state
- * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
- */
-orxSTATUS orxFASTCALL orxObject_Update(orxOBJECT *_pstObject, const orxCLOCK_INFO *_pstClockInfo)
-{
-  orxSTATUS eResult = orxSTATUS_SUCCESS;
+    /* Re-enables it with its children */
+    orxObject_EnableRecursive(_pstObject, orxTRUE);
 
-  /* Checks */
-  orxASSERT(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY);
-  orxASSERT(_pstObject != orxNULL);
-  orxASSERT(_pstClockInfo != orxNULL);
+    /* Sends event */
+    orxEVENT_SEND(orxEVENT_TYPE_OBJECT, orxOBJECT_EVENT_CREATE, _pstObject, orxNULL, orxNULL);
 
-  /* Updates object */
-  orxObject_UpdateInternal(_pstObject, _pstClockInfo);
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
 
   /* Done! */
   return eResult;
@@ -3506,7 +4308,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
       /* Sends event */
       if(orxEvent_Send(&stEvent) != orxSTATUS_FAILURE)
       {
-        orxVECTOR       vValue, vParentSize, vColor;
+        orxVECTOR       vValue, vParentSize;
         const orxSTRING zGraphicFileName;
         const orxSTRING zAnimPointerName;
         const orxSTRING zAutoScrolling;
@@ -3522,7 +4324,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         orxU32          u32FrameFlags, u32Flags = orxOBJECT_KU32_FLAG_NONE;
         orxS32          s32Number;
         orxCOLOR        stColor;
-        orxBOOL         bHasParent = orxFALSE, bUseParentScale = orxTRUE, bUseParentPosition = orxTRUE, bHasColor = orxFALSE;
+        orxBOOL         bHasParent = orxFALSE, bUseParentScale = orxTRUE, bUseParentPosition = orxTRUE;
 
         /* Gets age */
         fAge = orxConfig_GetFloat(orxOBJECT_KZ_CONFIG_AGE);
@@ -3862,63 +4664,8 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
 
         /* *** Color *** */
 
-        /* Inits color */
-        orxColor_Set(&stColor, &orxVECTOR_WHITE, orxFLOAT_1);
-
         /* Has color? */
-        if(orxConfig_GetVector(orxOBJECT_KZ_CONFIG_COLOR, &vColor) != orxNULL)
-        {
-          /* Normalizes and applies it */
-          orxVector_Mulf(&(stColor.vRGB), &vColor, orxCOLOR_NORMALIZER);
-
-          /* Updates status */
-          bHasColor = orxTRUE;
-        }
-        /* Has RGB values? */
-        else if(orxConfig_HasValue(orxOBJECT_KZ_CONFIG_RGB) != orxFALSE)
-        {
-          /* Gets its value */
-          orxConfig_GetVector(orxOBJECT_KZ_CONFIG_RGB, &(stColor.vRGB));
-
-          /* Updates status */
-          bHasColor = orxTRUE;
-        }
-        /* Has HSL values? */
-        else if(orxConfig_HasValue(orxOBJECT_KZ_CONFIG_HSL) != orxFALSE)
-        {
-          /* Gets its value */
-          orxConfig_GetVector(orxOBJECT_KZ_CONFIG_HSL, &(stColor.vHSL));
-
-          /* Stores its RGB equivalent */
-          orxColor_FromHSLToRGB(&stColor, &stColor);
-
-          /* Updates status */
-          bHasColor = orxTRUE;
-        }
-        /* Has HSV values? */
-        else if(orxConfig_HasValue(orxOBJECT_KZ_CONFIG_HSV) != orxFALSE)
-        {
-          /* Gets its value */
-          orxConfig_GetVector(orxOBJECT_KZ_CONFIG_HSV, &(stColor.vHSV));
-
-          /* Stores its RGB equivalent */
-          orxColor_FromHSVToRGB(&stColor, &stColor);
-
-          /* Updates status */
-          bHasColor = orxTRUE;
-        }
-
-        /* Has alpha? */
-        if(orxConfig_HasValue(orxOBJECT_KZ_CONFIG_ALPHA) != orxFALSE)
-        {
-          /* Applies it */
-          orxColor_SetAlpha(&stColor, orxConfig_GetFloat(orxOBJECT_KZ_CONFIG_ALPHA));
-
-          /* Updates color */
-          orxObject_SetColor(pstResult, &stColor);
-        }
-        /* Should apply color? */
-        else if(bHasColor != orxFALSE)
+        if(orxObject_GetConfigColor(&stColor) != orxFALSE)
         {
           /* Updates color */
           orxObject_SetColor(pstResult, &stColor);
@@ -4025,80 +4772,8 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
 
         /* *** Children *** */
 
-        /* Has child list? */
-        if((s32Number = orxConfig_GetListCount(orxOBJECT_KZ_CONFIG_CHILD_LIST)) > 0)
-        {
-          orxS32      i, s32JointNumber;
-          orxOBJECT  *pstLastChild;
-
-          /* Gets child joint list number */
-          s32JointNumber = orxConfig_GetListCount(orxOBJECT_KZ_CONFIG_CHILD_JOINT_LIST);
-
-          /* For all defined objects */
-          for(i = 0, pstLastChild = orxNULL; i < s32Number; i++)
-          {
-            orxOBJECT *pstChild;
-
-            /* Stores current group ID */
-            sstObject.stCurrentGroupID = pstResult->stGroupID;
-
-            /* Creates it */
-            pstChild = orxObject_CreateFromConfig(orxConfig_GetListString(orxOBJECT_KZ_CONFIG_CHILD_LIST, i));
-
-            /* Clears current group ID */
-            sstObject.stCurrentGroupID = sstObject.stDefaultGroupID;
-
-            /* Valid? */
-            if(pstChild != orxNULL)
-            {
-              /* Stores its owner */
-              orxStructure_SetOwner(pstChild, pstResult);
-
-              /* Has last child? */
-              if(pstLastChild != orxNULL)
-              {
-                /* Sets its sibling */
-                pstLastChild->pstSibling = pstChild;
-              }
-              else
-              {
-                /* Sets first child */
-                pstResult->pstChild = pstChild;
-              }
-
-              /* Stores last child */
-              pstLastChild = pstChild;
-
-              /* Doesn't already have a parent? */
-              if(orxFrame_IsRootChild(orxOBJECT_GET_STRUCTURE(pstChild, FRAME)) != orxFALSE)
-              {
-                orxBODY *pstChildBody;
-
-                /* Gets its body */
-                pstChildBody = orxOBJECT_GET_STRUCTURE(pstChild, BODY);
-
-                /* Sets its parent */
-                orxObject_SetParent(pstChild, pstResult);
-
-                /* Valid joint can be added? */
-                if((pstBody != orxNULL)
-                && (pstChildBody != orxNULL)
-                && (i < s32JointNumber)
-                && (orxBody_AddJointFromConfig(pstBody, pstChildBody, orxConfig_GetListString(orxOBJECT_KZ_CONFIG_CHILD_JOINT_LIST, i)) != orxNULL))
-                {
-                  /* Marks it as a joint child */
-                  orxStructure_SetFlags(pstChild, orxOBJECT_KU32_FLAG_IS_JOINT_CHILD | orxOBJECT_KU32_FLAG_DETACH_JOINT_CHILD, orxOBJECT_KU32_FLAG_NONE);
-
-                  /* Updates flags */
-                  u32Flags |= orxOBJECT_KU32_FLAG_HAS_JOINT_CHILDREN;
-                }
-              }
-
-              /* Updates flags */
-              u32Flags |= orxOBJECT_KU32_FLAG_HAS_CHILDREN;
-            }
-          }
-        }
+        /* Creates children */
+        u32Flags |= orxObject_CreateConfigChildren(pstResult, pstBody);
 
         /* *** Speed *** */
 
@@ -4334,7 +5009,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
       else
       {
         /* Deletes object */
-        orxObject_DeleteInternal(pstResult);
+        orxObject_DeleteInternal(pstResult, orxFALSE);
         pstResult = orxNULL;
       }
     }
@@ -4391,7 +5066,7 @@ orxSTATUS orxFASTCALL orxObject_LinkStructure(orxOBJECT *_pstObject, orxSTRUCTUR
     _pstObject->astStructureList[eStructureID].u32Flags     = orxOBJECT_KU32_STORAGE_FLAG_NONE;
 
     /* Updates flags */
-    orxStructure_SetFlags(_pstObject, 1 << eStructureID, orxOBJECT_KU32_FLAG_NONE);
+    orxStructure_SetFlags(_pstObject, 1 << eStructureID, orxOBJECT_KU32_FLAG_CACHED_BOX);
   }
   else
   {
@@ -4512,7 +5187,7 @@ void orxFASTCALL orxObject_UnlinkStructure(orxOBJECT *_pstObject, orxSTRUCTURE_I
     orxMemory_Zero(&(_pstObject->astStructureList[_eStructureID]), sizeof(orxOBJECT_STORAGE));
 
     /* Updates flags */
-    orxStructure_SetFlags(_pstObject, orxOBJECT_KU32_FLAG_NONE, 1 << _eStructureID);
+    orxStructure_SetFlags(_pstObject, orxOBJECT_KU32_FLAG_NONE, (1 << _eStructureID) | orxOBJECT_KU32_FLAG_CACHED_BOX);
   }
 
   return;
@@ -5016,6 +5691,9 @@ orxSTATUS orxFASTCALL orxObject_SetPivot(orxOBJECT *_pstObject, const orxVECTOR
     /* Stores it */
     orxVector_Copy(&(_pstObject->vPivot), _pvPivot);
 
+    /* Drops cached box */
+    orxStructure_SetFlags(_pstObject, orxOBJECT_KU32_FLAG_NONE, orxOBJECT_KU32_FLAG_CACHED_BOX);
+
     /* Updates result */
     eResult = orxSTATUS_SUCCESS;
   }
@@ -5096,6 +5774,9 @@ orxSTATUS orxFASTCALL orxObject_SetSize(orxOBJECT *_pstObject, const orxVECTOR *
     /* Stores it */
     orxVector_Copy(&(_pstObject->vSize), _pvSize);
 
+    /* Drops cached box */
+    orxStructure_SetFlags(_pstObject, orxOBJECT_KU32_FLAG_NONE, orxOBJECT_KU32_FLAG_CACHED_BOX);
+
     /* Updates result */
     eResult = orxSTATUS_SUCCESS;
   }
@@ -6757,6 +7438,71 @@ orxOBJECT *orxFASTCALL orxObject_Raycast(const orxVECTOR *_pvBegin, const orxVEC
   return pstResult;
 }
 
+/** Issues a batch of raycasts against objects with bodies, each query's hResult will contain the colliding orxOBJECT / orxHANDLE_UNDEFINED
+ * @param[in,out] _astRaycastList List of raycast queries
+ * @param[in]   _u32Number      Number of queries
+ * @return Number of raycasts that hit an object
+ */
+orxU32 orxFASTCALL orxObject_RaycastBatch(orxPHYSICS_RAYCAST *_astRaycastList, orxU32 _u32Number)
+{
+  orxU32 i, u32Result;
+
+  /* Checks */
+  orxASSERT(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY);
+  orxASSERT((_astRaycastList != orxNULL) || (_u32Number == 0));
+
+  /* Issues raycasts */
+  u32Result = orxBody_RaycastBatch(_astRaycastList, _u32Number);
+
+  /* For all queries */
+  for(i = 0; i < _u32Number; i++)
+  {
+    /* Hit? */
+    if(_astRaycastList[i].hResult != orxHANDLE_UNDEFINED)
+    {
+      /* Replaces body with its owner */
+      _astRaycastList[i].hResult = (orxHANDLE)orxStructure_GetOwner(orxBODY(_astRaycastList[i].hResult));
+    }
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Issues a batch of box overlap queries against objects with bodies, each query's result buffer will receive the overlapping orxOBJECT.
+ * Contrary to orxObject_BoxPick(), this relies on the physics broadphase and doesn't allocate any memory.
+ * @param[in,out] _astOverlapList List of overlap queries
+ * @param[in]   _u32Number      Number of queries
+ * @return Total number of overlapping objects found
+ */
+orxU32 orxFASTCALL orxObject_OverlapBatch(orxPHYSICS_OVERLAP *_astOverlapList, orxU32 _u32Number)
+{
+  orxU32 i, u32Result;
+
+  /* Checks */
+  orxASSERT(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY);
+  orxASSERT((_astOverlapList != orxNULL) || (_u32Number == 0));
+
+  /* Issues queries */
+  u32Result = orxBody_OverlapBatch(_astOverlapList, _u32Number);
+
+  /* For all queries */
+  for(i = 0; i < _u32Number; i++)
+  {
+    orxU32 j;
+
+    /* For all found bodies */
+    for(j = 0; j < _astOverlapList[i].u32Count; j++)
+    {
+      /* Replaces body with its owner */
+      _astOverlapList[i].ahResultList[j] = (orxHANDLE)orxStructure_GetOwner(orxBODY(_astOverlapList[i].ahResultList[j]));
+    }
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
 /** Sets object text string, if object is associated to a text.
  * @param[in]   _pstObject      Concerned object
  * @param[in]   _zString        String to set
@@ -6844,28 +7590,68 @@ const orxSTRING orxFASTCALL orxObject_GetTextString(orxOBJECT *_pstObject)
  */
 orxOBOX *orxFASTCALL orxObject_GetBoundingBox(const orxOBJECT *_pstObject, orxOBOX *_pstBoundingBox)
 {
-  orxVECTOR vSize, vPivot, vPosition, vScale;
-  orxFLOAT  fAngle;
-  orxOBOX  *pstResult;
+  orxFRAME   *pstFrame;
+  orxGRAPHIC *pstGraphic;
+  orxOBOX    *pstResult;
 
   /* Checks */
   orxASSERT(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY);
   orxSTRUCTURE_ASSERT(_pstObject);
   orxASSERT(_pstBoundingBox != orxNULL);
 
-  /* Gets size, pivot, position, scale & rotation */
-  orxObject_GetSize(_pstObject, &vSize);
-  orxObject_GetPivot(_pstObject, &vPivot);
-  orxObject_GetWorldPosition(_pstObject, &vPosition);
-  orxObject_GetWorldScale(_pstObject, &vScale);
-  fAngle = orxObject_GetWorldRotation(_pstObject);
+  /* Gets frame & graphic */
+  pstFrame    = orxOBJECT_GET_STRUCTURE(_pstObject, FRAME);
+  pstGraphic  = orxOBJECT_GET_STRUCTURE(_pstObject, GRAPHIC);
+
+  /* Is cached box still valid? (linking/unlinking structures or changing the object's own size/pivot drops it) */
+  if((orxStructure_TestFlags(_pstObject, orxOBJECT_KU32_FLAG_CACHED_BOX) != orxFALSE)
+  && (pstFrame == _pstObject->pstCachedFrame)
+  && (orxFrame_GetVersion(pstFrame) == _pstObject->u32CachedFrameVersion)
+  && ((pstGraphic == orxNULL) || (orxGraphic_GetVersion(pstGraphic) == _pstObject->u32CachedGraphicVersion)))
+  {
+    /* Copies it */
+    orxOBox_Copy(_pstBoundingBox, &(_pstObject->stCachedBox));
+  }
+  else
+  {
+    orxVECTOR  vSize, vPivot, vPosition, vScale;
+    orxFLOAT   fAngle;
+    orxOBJECT *pstObject;
+
+    /* Gets mutable object */
+    pstObject = (orxOBJECT *)_pstObject;
 
-  /* Updates pivot & size */
-  orxVector_Mul(&vSize, &vSize, &vScale);
-  orxVector_Mul(&vPivot, &vPivot, &vScale);
+    /* Gets size & pivot */
+    orxObject_GetSize(_pstObject, &vSize);
+    orxObject_GetPivot(_pstObject, &vPivot);
 
-  /* Updates box */
-  orxOBox_2DSet(_pstBoundingBox, &vPosition, &vPivot, &vSize, fAngle);
+    /* Stores frame & graphic version */
+    pstObject->pstCachedFrame           = pstFrame;
+    pstObject->u32CachedGraphicVersion  = (pstGraphic != orxNULL) ? orxGraphic_GetVersion(pstGraphic) : 0;
+
+    /* Gets position, scale & rotation */
+    orxObject_GetWorldPosition(_pstObject, &vPosition);
+    orxObject_GetWorldScale(_pstObject, &vScale);
+    fAngle = orxObject_GetWorldRotation(_pstObject);
+
+    /* Updates pivot & size */
+    orxVector_Mul(&vSize, &vSize, &vScale);
+    orxVector_Mul(&vPivot, &vPivot, &vScale);
+
+    /* Updates box */
+    orxOBox_2DSet(_pstBoundingBox, &vPosition, &vPivot, &vSize, fAngle);
+
+    /* Has frame? */
+    if(pstFrame != orxNULL)
+    {
+      /* Stores box */
+      orxOBox_Copy(&(pstObject->stCachedBox), _pstBoundingBox);
+      pstObject->u32CachedFrameVersion = orxFrame_GetVersion(pstFrame);
+
+      /* Updates status */
+      orxStructure_SetFlags(pstObject, orxOBJECT_KU32_FLAG_CACHED_BOX, orxOBJECT_KU32_FLAG_NONE);
+    }
+  }
 
   /* Updates result */
   pstResult = _pstBoundingBox;
@@ -8436,47 +9222,48 @@ extern orxDLLAPI orxSTRINGID orxFASTCALL orxObject_GetGroupID(const orxOBJECT *_
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL orxObject_SetGroupID(orxOBJECT *_pstObject, orxSTRINGID _stGroupID)
 {
-  orxLINKLIST **ppstBucket;
-  orxLINKLIST  *pstGroupList;
-  orxSTATUS     eResult = orxSTATUS_SUCCESS;
+  orxOBJECT_GROUP  *pstGroup;
+  orxU32            u32Slot;
+  orxSTATUS         eResult = orxSTATUS_SUCCESS;
 
   /* Checks */
   orxASSERT(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY);
   orxSTRUCTURE_ASSERT(_pstObject);
   orxASSERT((_stGroupID != 0) && (_stGroupID != orxSTRINGID_UNDEFINED));
 
-  /* Removes object from its current group */
-  if(orxLinkList_GetList(&(_pstObject->stGroupNode)) != orxNULL)
-  {
-    orxLinkList_Remove(&(_pstObject->stGroupNode));
-  }
+  /* Gets group */
+  pstGroup = orxObject_GetGroup(_stGroupID, orxTRUE);
 
-  /* Gets group list bucker*/
-  ppstBucket = (orxLINKLIST **)orxHashTable_Retrieve(sstObject.pstGroupTable, _stGroupID);
+  /* Has room for the object? (checked before leaving any group, so that a failure leaves memberships untouched) */
+  if((pstGroup != orxNULL) && (orxObject_GrowGroup(pstGroup) != orxSTATUS_FAILURE))
+  {
+    /* Removes object from its current group */
+    if(_pstObject->astMembershipList[0].pstGroup != orxNULL)
+    {
+      orxObject_LeaveGroup(_pstObject, 0);
+    }
 
-  /* Checks */
-  orxASSERT(ppstBucket != orxNULL);
+    /* Already an additional group? */
+    if((u32Slot = orxObject_GetMembershipSlot(_pstObject, pstGroup)) != orxU32_UNDEFINED)
+    {
+      /* Leaves it */
+      orxObject_LeaveGroup(_pstObject, u32Slot);
+    }
 
-  /* Not found? */
-  if(*ppstBucket == orxNULL)
-  {
-    /* Allocates it */
-    pstGroupList = (orxLINKLIST *)orxBank_Allocate(sstObject.pstGroupBank);
+    /* Adds object to end of group */
+    eResult = orxObject_JoinGroup(_pstObject, pstGroup, 0);
 
-    /* Stores it */
-    *ppstBucket = pstGroupList;
+    /* Stores group ID */
+    _pstObject->stGroupID = _stGroupID;
   }
   else
   {
-    /* Gets it */
-    pstGroupList = *ppstBucket;
-  }
-
-  /* Adds object to end of list */
-  orxLinkList_AddEnd(pstGroupList, &(_pstObject->stGroupNode));
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, "[%s]: Couldn't set group [%s].", orxObject_GetName(_pstObject), orxString_GetFromID(_stGroupID));
 
-  /* Stores group ID */
-  _pstObject->stGroupID = _stGroupID;
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
 
   /* Done! */
   return eResult;
@@ -8488,7 +9275,8 @@ extern orxDLLAPI orxSTATUS orxFASTCALL orxObject_SetGroupID(orxOBJECT *_pstObjec
  */
 orxOBJECT_MAKE_RECURSIVE(SetGroupID, orxSTRINGID);
 
-/** Gets next object in group.
+/** Gets next object in group. The given object can have left the group since it was returned, as long as the object module
+ * hasn't been updated in between.
  * @param[in]   _pstObject      Concerned object, orxNULL to get the first one
  * @param[in]   _stGroupID     Group ID to consider, orxU32_UNDEFINED for all
  * @return      orxOBJECT / orxNULL
@@ -8500,48 +9288,65 @@ extern orxDLLAPI orxOBJECT *orxFASTCALL orxObject_GetNext(const orxOBJECT *_pstO
   /* Checks */
   orxASSERT(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY);
   orxASSERT((_pstObject == orxNULL) || (orxStructure_GetID((orxSTRUCTURE *)_pstObject) < orxSTRUCTURE_ID_NUMBER));
-  orxASSERT((_pstObject == orxNULL) || (_stGroupID == orxSTRINGID_UNDEFINED) || (orxLinkList_GetList(&(_pstObject->stGroupNode)) == orxHashTable_Get(sstObject.pstGroupTable, _stGroupID)));
 
   /* Has group? */
   if(_stGroupID != orxSTRINGID_UNDEFINED)
   {
-    orxLINKLIST *pstGroupList;
+    orxOBJECT_GROUP *pstGroup;
 
-    /* Is cached one? */
-    if(_stGroupID == sstObject.stCachedGroupID)
-    {
-      /* Gets group list */
-      pstGroupList = sstObject.pstCachedGroupList;
-    }
-    else
-    {
-      /* Gets group list */
-      pstGroupList = (orxLINKLIST *)orxHashTable_Get(sstObject.pstGroupTable, _stGroupID);
-    }
+    /* Gets group */
+    pstGroup = orxObject_GetGroup(_stGroupID, orxFALSE);
 
     /* Valid? */
-    if(pstGroupList != orxNULL)
+    if(pstGroup != orxNULL)
     {
-      orxLINKLIST_NODE *pstNode;
-
-      /* Gets node */
-      pstNode = (_pstObject == orxNULL) ? orxLinkList_GetFirst(pstGroupList) : orxLinkList_GetNext(&(_pstObject->stGroupNode));
+      orxU32 u32Index;
 
-      /* Valid? */
-      if(pstNode != orxNULL)
+      /* First one? */
+      if(_pstObject == orxNULL)
       {
-        /* Updates result */
-        pstResult = orxSTRUCT_GET_FROM_FIELD(orxOBJECT, stGroupNode, pstNode);
+        /* Starts from beginning */
+        u32Index = 0;
       }
       else
       {
-        /* Updates result */
-        pstResult = orxNULL;
+        orxU32 u32Slot;
+
+        /* Gets membership slot */
+        u32Slot = orxObject_GetMembershipSlot(_pstObject, pstGroup);
+
+        /* Found? */
+        if(u32Slot != orxU32_UNDEFINED)
+        {
+          /* Starts after it */
+          u32Index = _pstObject->astMembershipList[u32Slot].u32Index + 1;
+        }
+        /* Left this group since it was returned? */
+        else if((_pstObject->pstLeftGroup == pstGroup)
+             && ((_pstObject->u32LeftIndex >= pstGroup->u32Size)
+              || (pstGroup->apstObjectList[_pstObject->u32LeftIndex] == orxNULL)))
+        {
+          /* Starts after its former place */
+          u32Index = _pstObject->u32LeftIndex + 1;
+        }
+        else
+        {
+          /* Checks */
+          orxASSERT(orxFALSE && "Object is not part of the iterated group.");
+
+          /* Stops iterating */
+          u32Index = pstGroup->u32Size;
+        }
       }
 
-      /* Caches group list */
-      sstObject.pstCachedGroupList  = pstGroupList;
-      sstObject.stCachedGroupID     = _stGroupID;
+      /* Skips holes */
+      while((u32Index < pstGroup->u32Size) && (pstGroup->apstObjectList[u32Index] == orxNULL))
+      {
+        u32Index++;
+      }
+
+      /* Updates result */
+      pstResult = (u32Index < pstGroup->u32Size) ? pstGroup->apstObjectList[u32Index] : orxNULL;
     }
     else
     {
@@ -8559,6 +9364,146 @@ extern orxDLLAPI orxOBJECT *orxFASTCALL orxObject_GetNext(const orxOBJECT *_pstO
   return pstResult;
 }
 
+/** Adds object to an additional group. The object stays in its main group (see orxObject_SetGroupID()).
+ * @param[in]   _pstObject      Concerned object
+ * @param[in]   _stGroupID      Group ID to add. This is the string ID (see orxString_GetID()) of the group name.
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL orxObject_AddGroupID(orxOBJECT *_pstObject, orxSTRINGID _stGroupID)
+{
+  orxOBJECT_GROUP  *pstGroup;
+  orxSTATUS         eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstObject);
+  orxASSERT((_stGroupID != 0) && (_stGroupID != orxSTRINGID_UNDEFINED));
+
+  /* Gets group */
+  pstGroup = orxObject_GetGroup(_stGroupID, orxTRUE);
+
+  /* Not already a member? */
+  if(orxObject_GetMembershipSlot(_pstObject, pstGroup) == orxU32_UNDEFINED)
+  {
+    orxU32 i;
+
+    /* Finds a free additional slot */
+    for(i = 1; (i < orxOBJECT_KU32_GROUP_MEMBERSHIP_NUMBER) && (_pstObject->astMembershipList[i].pstGroup != orxNULL); i++);
+
+    /* Found? */
+    if(i < orxOBJECT_KU32_GROUP_MEMBERSHIP_NUMBER)
+    {
+      /* Joins group */
+      eResult = orxObject_JoinGroup(_pstObject, pstGroup, i);
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, "[%s]: Can't add group [%s], object is already part of %u groups.", orxObject_GetName(_pstObject), orxString_GetFromID(_stGroupID), orxOBJECT_KU32_GROUP_MEMBERSHIP_NUMBER);
+
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Removes object from an additional group. The main group can't be removed, only changed with orxObject_SetGroupID().
+ * @param[in]   _pstObject      Concerned object
+ * @param[in]   _stGroupID      Group ID to remove. This is the string ID (see orxString_GetID()) of the group name.
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL orxObject_RemoveGroupID(orxOBJECT *_pstObject, orxSTRINGID _stGroupID)
+{
+  orxU32    u32Slot;
+  orxSTATUS eResult;
+
+  /* Checks */
+  orxASSERT(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstObject);
+
+  /* Gets membership slot */
+  u32Slot = orxObject_GetMembershipSlot(_pstObject, orxObject_GetGroup(_stGroupID, orxFALSE));
+
+  /* Additional group? */
+  if((u32Slot != orxU32_UNDEFINED) && (u32Slot != 0))
+  {
+    /* Leaves it */
+    orxObject_LeaveGroup(_pstObject, u32Slot);
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Is object part of a group, either as its main group or as an additional one?
+ * @param[in]   _pstObject      Concerned object
+ * @param[in]   _stGroupID      Group ID to test. This is the string ID (see orxString_GetID()) of the group name.
+ * @return      orxTRUE / orxFALSE
+ */
+extern orxDLLAPI orxBOOL orxFASTCALL orxObject_IsInGroup(const orxOBJECT *_pstObject, orxSTRINGID _stGroupID)
+{
+  orxBOOL bResult;
+
+  /* Checks */
+  orxASSERT(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstObject);
+
+  /* Updates result */
+  bResult = (orxObject_GetMembershipSlot(_pstObject, orxObject_GetGroup(_stGroupID, orxFALSE)) != orxU32_UNDEFINED) ? orxTRUE : orxFALSE;
+
+  /* Done! */
+  return bResult;
+}
+
+/** Gets the contiguous object array of a group, for batch or chunked processing (disjoint chunks can be processed in parallel).
+ * Callers must skip orxNULL entries: objects leaving a group leave a hole instead of being swapped with the last entry, so that
+ * ongoing iterations (see orxObject_GetNext()) neither skip nor revisit objects. Holes are compacted on the next object module update.
+ * The array is only valid until the next object creation, deletion or group change.
+ * @param[in]   _stGroupID      Concerned group ID
+ * @param[out]  _pu32Count      Number of entries in the array, holes included
+ * @return      Object array / orxNULL
+ */
+extern orxDLLAPI orxOBJECT *const *orxFASTCALL orxObject_GetGroupArray(orxSTRINGID _stGroupID, orxU32 *_pu32Count)
+{
+  orxOBJECT_GROUP    *pstGroup;
+  orxOBJECT *const   *apstResult;
+
+  /* Checks */
+  orxASSERT(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pu32Count != orxNULL);
+
+  /* Gets group */
+  pstGroup = orxObject_GetGroup(_stGroupID, orxFALSE);
+
+  /* Valid? */
+  if(pstGroup != orxNULL)
+  {
+    /* Updates result */
+    apstResult  = pstGroup->apstObjectList;
+    *_pu32Count = pstGroup->u32Size;
+  }
+  else
+  {
+    /* Updates result */
+    apstResult  = orxNULL;
+    *_pu32Count = 0;
+  }
+
+  /* Done! */
+  return apstResult;
+}
+
 /** Picks the first active object with size "under" the given position, within a given group. See
  * orxObject_BoxPick(), orxObject_CreateNeighborList() and orxObject_Raycast for other ways of picking
  * objects.
@@ -92,6 +92,7 @@
 #define orxSPAWNER_KZ_CONFIG_INTERPOLATE          "Interpolate"
 #define orxSPAWNER_KZ_CONFIG_IMMEDIATE            "Immediate"
 #define orxSPAWNER_KZ_CONFIG_IGNORE_FROM_PARENT   "IgnoreFromParent"
+#define orxSPAWNER_KZ_CONFIG_POOL_SIZE            "PoolSize"
 
 #define orxSPAWNER_KU32_BANK_SIZE                 128         /**< Bank size */
 
@@ -100,6 +101,15 @@
  * Structure declaration                                                   *
  ***************************************************************************/
 
+/** Pool entry structure
+ */
+typedef struct __orxSPAWNER_POOL_ENTRY_t
+{
+  orxOBJECT          *pstObject;                  /**< Pooled object : 4 */
+  orxSTRINGID         stNameID;                   /**< Pooled object name ID : 16 */
+
+} orxSPAWNER_POOL_ENTRY;
+
 /** Spawner structure
  */
 struct __orxSPAWNER_t
@@ -122,6 +132,11 @@ struct __orxSPAWNER_t
   orxFLOAT            fLastRotation;              /**< Last rotation: 100 */
   orxVECTOR           vLastPosition;              /**< Last position: 112 */
   orxVECTOR           vLastScale;                 /**< Last scale: 124 */
+  orxSPAWNER_POOL_ENTRY *astPool;                 /**< Object pool : 128 */
+  orxU32              u32PoolSize;                /**< Object pool size, 0 for no pooling : 132 */
+  orxU32              u32PoolCount;               /**< Pooled objects count : 136 */
+  orxU32              u32PoolHitCount;            /**< Spawns served by the pool : 140 */
+  orxU32              u32PoolMissCount;           /**< Spawns that couldn't be served by the pool : 144 */
 };
 
 /** Static structure
@@ -148,6 +163,248 @@ static orxSPAWNER_STATIC sstSpawner;
  * Private functions                                                       *
  ***************************************************************************/
 
+/** Is object waiting in the spawner's pool?
+ * @param[in]   _pstSpawner     Concerned spawner
+ * @param[in]   _pstObject      Concerned object
+ * @return      Pool index if found, orxU32_UNDEFINED otherwise
+ */
+static orxINLINE orxU32 orxSpawner_FindPooledObject(const orxSPAWNER *_pstSpawner, const orxOBJECT *_pstObject)
+{
+  orxU32 u32Result = orxU32_UNDEFINED;
+
+  /* Has pooled objects? */
+  if(_pstSpawner->u32PoolCount != 0)
+  {
+    orxU32 i;
+
+    /* For all pooled objects */
+    for(i = 0; i < _pstSpawner->u32PoolCount; i++)
+    {
+      /* Found? */
+      if(_pstSpawner->astPool[i].pstObject == _pstObject)
+      {
+        /* Updates result */
+        u32Result = i;
+
+        break;
+      }
+    }
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Clears a spawner's pool, pooled objects are released and marked for deletion
+ * @param[in]   _pstSpawner     Concerned spawner
+ */
+static void orxFASTCALL orxSpawner_ClearPool(orxSPAWNER *_pstSpawner)
+{
+  orxU32 i;
+
+  /* For all pooled objects */
+  for(i = 0; i < _pstSpawner->u32PoolCount; i++)
+  {
+    /* Removes its owner */
+    orxObject_SetOwner(_pstSpawner->astPool[i].pstObject, orxNULL);
+
+    /* Marks it for deletion */
+    orxObject_SetLifeTime(_pstSpawner->astPool[i].pstObject, orxFLOAT_0);
+  }
+
+  /* Clears pool count */
+  _pstSpawner->u32PoolCount = 0;
+
+  return;
+}
+
+/** Sets a spawner's pool size
+ * @param[in]   _pstSpawner     Concerned spawner
+ * @param[in]   _u32Size        Pool size, 0 for no pooling
+ */
+static void orxFASTCALL orxSpawner_SetPoolSize(orxSPAWNER *_pstSpawner, orxU32 _u32Size)
+{
+  /* Clears current pool */
+  orxSpawner_ClearPool(_pstSpawner);
+
+  /* New size? */
+  if(_u32Size != _pstSpawner->u32PoolSize)
+  {
+    /* Has pool? */
+    if(_pstSpawner->astPool != orxNULL)
+    {
+      /* Frees it */
+      orxMemory_Free(_pstSpawner->astPool);
+      _pstSpawner->astPool = orxNULL;
+    }
+
+    /* Should pool? */
+    if(_u32Size != 0)
+    {
+      /* Allocates pool */
+      _pstSpawner->astPool = (orxSPAWNER_POOL_ENTRY *)orxMemory_Allocate(_u32Size * sizeof(orxSPAWNER_POOL_ENTRY), orxMEMORY_TYPE_MAIN);
+
+      /* Failure? */
+      if(_pstSpawner->astPool == orxNULL)
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, "Spawner <%s>: Couldn't allocate pool for %u objects, pooling disabled.", orxSpawner_GetName(_pstSpawner), _u32Size);
+
+        /* Updates size */
+        _u32Size = 0;
+      }
+    }
+
+    /* Stores size */
+    _pstSpawner->u32PoolSize = _u32Size;
+  }
+
+  return;
+}
+
+/** Sets up a newly spawned or recycled object
+ * @param[in]   _pstSpawner     Concerned spawner
+ * @param[in]   _pstObject      Concerned object
+ */
+static void orxFASTCALL orxSpawner_SetupObject(orxSPAWNER *_pstSpawner, orxOBJECT *_pstObject)
+{
+  orxVECTOR   vPosition, vScale;
+  orxOBJECT  *pstOwner;
+
+  /* Updates active object count */
+  _pstSpawner->u32ActiveObjectCount++;
+
+  /* Updates total object count */
+  _pstSpawner->u32TotalObjectCount++;
+
+  /* Sets spawner as owner */
+  orxObject_SetOwner(_pstObject, _pstSpawner);
+
+  /* Should use self as parent? */
+  if(orxStructure_TestFlags(_pstSpawner, orxSPAWNER_KU32_FLAG_USE_SELF_AS_PARENT))
+  {
+    /* Updates spawned object's parent */
+    orxObject_SetParent(_pstObject, _pstSpawner);
+  }
+
+  /* Should update rotation? */
+  if(orxStructure_TestFlags(_pstSpawner, orxSPAWNER_KU32_FLAG_USE_ROTATION))
+  {
+    /* Updates object rotation */
+    orxObject_SetRotation(_pstObject, orxObject_GetRotation(_pstObject) + _pstSpawner->fPendingRotation);
+  }
+
+  /* Should update scale? */
+  if(orxStructure_TestFlags(_pstSpawner, orxSPAWNER_KU32_FLAG_USE_SCALE))
+  {
+    /* Updates object scale */
+    orxObject_SetScale(_pstObject, orxVector_Mul(&vScale, orxObject_GetScale(_pstObject, &vScale), _pstSpawner->pvPendingScale));
+  }
+
+  /* Not using self as parent? */
+  if(!orxStructure_TestFlags(_pstSpawner, orxSPAWNER_KU32_FLAG_USE_SELF_AS_PARENT))
+  {
+    /* Updates object position */
+    orxObject_SetPosition(_pstObject, orxVector_Add(&vPosition, orxVector_2DRotate(&vPosition, orxVector_Mul(&vPosition, orxObject_GetPosition(_pstObject, &vPosition), _pstSpawner->pvPendingScale), _pstSpawner->fPendingRotation), _pstSpawner->pvPendingPosition));
+  }
+
+  /* Should apply speed? */
+  if(orxStructure_TestFlags(_pstSpawner, orxSPAWNER_KU32_FLAG_OBJECT_SPEED))
+  {
+    /* Use random speed? */
+    if(orxStructure_TestFlags(_pstSpawner, orxSPAWNER_KU32_FLAG_RANDOM_OBJECT_SPEED))
+    {
+      /* Updates its value */
+      orxConfig_PushSection(_pstSpawner->zReference);
+      orxConfig_GetVector(orxSPAWNER_KZ_CONFIG_OBJECT_SPEED, &(_pstSpawner->vSpeed));
+      orxConfig_PopSection();
+    }
+
+    /* Use relative speed? */
+    if(orxStructure_TestFlags(_pstSpawner, orxSPAWNER_KU32_FLAG_USE_RELATIVE_SPEED))
+    {
+      orxVECTOR vSpeed;
+
+      /* Applies relative speed */
+      orxVector_Mul(&vSpeed, orxVector_2DRotate(&vSpeed, &(_pstSpawner->vSpeed), _pstSpawner->fPendingRotation), _pstSpawner->pvPendingScale);
+      orxObject_SetSpeed(_pstObject, &vSpeed);
+    }
+    else
+    {
+      /* Applies speed */
+      orxObject_SetSpeed(_pstObject, &(_pstSpawner->vSpeed));
+    }
+  }
+
+  /* Gets owner */
+  pstOwner = orxOBJECT(orxStructure_GetOwner(_pstSpawner));
+
+  /* Valid? */
+  if(pstOwner != orxNULL)
+  {
+    /* Doesn't have a group? */
+    if(orxObject_GetGroupID(_pstObject) == sstSpawner.stDefaultGroupID)
+    {
+      /* Transfers group ID */
+      orxObject_SetGroupID(_pstObject, orxObject_GetGroupID(pstOwner));
+    }
+
+    /* Should apply color or alpha? */
+    if(orxStructure_TestFlags(_pstSpawner, orxSPAWNER_KU32_FLAG_USE_ALPHA | orxSPAWNER_KU32_FLAG_USE_COLOR))
+    {
+      orxCOLOR stColor, stTemp;
+
+      /* Inits color */
+      orxColor_Set(&stColor, &orxVECTOR_WHITE, orxFLOAT_1);
+
+      /* Should apply color? */
+      if(orxStructure_TestFlags(_pstSpawner, orxSPAWNER_KU32_FLAG_USE_COLOR))
+      {
+        /* Has color? */
+        if(orxObject_HasColor(pstOwner) != orxFALSE)
+        {
+          /* Gets it */
+          orxObject_GetColor(pstOwner, &stColor);
+        }
+      }
+      else
+      {
+        /* Has color? */
+        if(orxObject_HasColor(_pstObject) != orxFALSE)
+        {
+          /* Uses object's one */
+          orxObject_GetColor(_pstObject, &stColor);
+        }
+      }
+
+      /* Should apply alpha? */
+      if(orxStructure_TestFlags(_pstSpawner, orxSPAWNER_KU32_FLAG_USE_ALPHA))
+      {
+        /* Has color? */
+        if(orxObject_HasColor(pstOwner) != orxFALSE)
+        {
+          /* Stores it */
+          stColor.fAlpha = orxObject_GetColor(pstOwner, &stTemp)->fAlpha;
+        }
+      }
+      else
+      {
+        /* Has color? */
+        if(orxObject_HasColor(_pstObject) != orxFALSE)
+        {
+          /* Uses object's alpha */
+          stColor.fAlpha = orxObject_GetColor(_pstObject, &stTemp)->fAlpha;
+        }
+      }
+
+      /* Applies new value */
+      orxObject_SetColor(_pstObject, &stColor);
+    }
+  }
+
+  return;
+}
+
 static orxSTATUS orxFASTCALL orxSpawner_ProcessConfigData(orxSPAWNER *_pstSpawner, orxBOOL _bFirstCall)
 {
   orxSTATUS eResult = orxSTATUS_FAILURE;
@@ -166,6 +423,9 @@ static orxSTATUS orxFASTCALL orxSpawner_ProcessConfigData(orxSPAWNER *_pstSpawne
     /* Not first call? */
     if(_bFirstCall == orxFALSE)
     {
+      /* Clears its pool */
+      orxSpawner_ClearPool(_pstSpawner);
+
       /* Has spawned objects? */
       if(_pstSpawner->u32TotalObjectCount != 0)
       {
@@ -282,6 +542,9 @@ static orxSTATUS orxFASTCALL orxSpawner_ProcessConfigData(orxSPAWNER *_pstSpawne
       orxStructure_SetFlags(_pstSpawner, orxSPAWNER_KU32_FLAG_CLEAN_ON_DELETE, orxSPAWNER_KU32_FLAG_NONE);
     }
 
+    /* Sets pool size */
+    orxSpawner_SetPoolSize(_pstSpawner, orxConfig_GetU32(orxSPAWNER_KZ_CONFIG_POOL_SIZE));
+
     /* Has speed? */
     if(orxConfig_GetVector(orxSPAWNER_KZ_CONFIG_OBJECT_SPEED, &(_pstSpawner->vSpeed)) != orxNULL)
     {
@@ -505,25 +768,106 @@ orxU32 orxFASTCALL orxSpawner_SpawnInternal(orxSPAWNER *_pstSpawner, orxU32 _u32
       /* For all objects to spawn */
       for(i = 0; i < u32SpawnNumber; i++)
       {
-        orxOBJECT  *pstObject;
-        orxSPAWNER *pstPreviousSpawner;
+        const orxSTRING zName;
+        orxOBJECT      *pstObject = orxNULL;
+        orxSPAWNER     *pstPreviousSpawner;
+
+        /* Gets object name */
+        zName = (zObjectName != orxNULL) ? zObjectName : orxConfig_GetString(orxSPAWNER_KZ_CONFIG_OBJECT);
+
+        /* Uses pool? */
+        if(_pstSpawner->u32PoolSize != 0)
+        {
+          orxSTRINGID stNameID;
+          orxU32      j;
+
+          /* Gets name ID */
+          stNameID = orxString_ToCRC(zName);
 
-        /* Backups current spawner */
-        pstPreviousSpawner = sstSpawner.pstCurrentSpawner;
+          /* For all pooled objects, most recent first */
+          for(j = _pstSpawner->u32PoolCount; j > 0; j--)
+          {
+            /* Matches? */
+            if(_pstSpawner->astPool[j - 1].stNameID == stNameID)
+            {
+              /* Gets it */
+              pstObject = _pstSpawner->astPool[j - 1].pstObject;
 
-        /* Stores current spawner */
-        sstSpawner.pstCurrentSpawner = _pstSpawner;
+              /* Removes it from the pool */
+              _pstSpawner->astPool[j - 1] = _pstSpawner->astPool[--_pstSpawner->u32PoolCount];
+
+              break;
+            }
+          }
+        }
 
         /* Stores pending transformations */
         _pstSpawner->pvPendingPosition  = _pvPosition;
         _pstSpawner->pvPendingScale     = _pvScale;
         _pstSpawner->fPendingRotation   = _fRotation;
 
-        /* Creates object */
-        pstObject = orxObject_CreateFromConfig((zObjectName != orxNULL) ? zObjectName : orxConfig_GetString(orxSPAWNER_KZ_CONFIG_OBJECT));
+        /* Found in pool? */
+        if(pstObject != orxNULL)
+        {
+          orxSTATUS eRecycleResult;
+
+          /* Backups current spawner */
+          pstPreviousSpawner = sstSpawner.pstCurrentSpawner;
+
+          /* Stores current spawner and pending object: it'll be set up by its create event, as a newly created one */
+          sstSpawner.pstCurrentSpawner  = _pstSpawner;
+          _pstSpawner->pstPendingObject = pstObject;
+
+          /* Recycles it */
+          eRecycleResult = orxObject_Recycle(pstObject);
+
+          /* Clears pending object */
+          _pstSpawner->pstPendingObject = orxNULL;
+
+          /* Restores previous spawner */
+          sstSpawner.pstCurrentSpawner = pstPreviousSpawner;
+
+          /* Success? */
+          if(eRecycleResult != orxSTATUS_FAILURE)
+          {
+            /* Updates stats */
+            _pstSpawner->u32PoolHitCount++;
+          }
+          else
+          {
+            /* Removes its owner */
+            orxObject_SetOwner(pstObject, orxNULL);
+
+            /* Marks it for deletion */
+            orxObject_SetLifeTime(pstObject, orxFLOAT_0);
+
+            /* Will create a new one */
+            pstObject = orxNULL;
+          }
+        }
+
+        /* Should create object? */
+        if(pstObject == orxNULL)
+        {
+          /* Uses pool? */
+          if(_pstSpawner->u32PoolSize != 0)
+          {
+            /* Updates stats */
+            _pstSpawner->u32PoolMissCount++;
+          }
+
+          /* Backups current spawner */
+          pstPreviousSpawner = sstSpawner.pstCurrentSpawner;
 
-        /* Restores previous spawner */
-        sstSpawner.pstCurrentSpawner = pstPreviousSpawner;
+          /* Stores current spawner */
+          sstSpawner.pstCurrentSpawner = _pstSpawner;
+
+          /* Creates object */
+          pstObject = orxObject_CreateFromConfig(zName);
+
+          /* Restores previous spawner */
+          sstSpawner.pstCurrentSpawner = pstPreviousSpawner;
+        }
 
         /* Valid? */
         if(pstObject != orxNULL)
@@ -642,9 +986,8 @@ static orxSTATUS orxFASTCALL orxSpawner_EventHandler(const orxEVENT *_pstEvent)
           /* Has current spawner and is pending object? */
           if((sstSpawner.pstCurrentSpawner != orxNULL) && (sstSpawner.pstCurrentSpawner->pstPendingObject == (orxOBJECT *)_pstEvent->hSender))
           {
-            orxVECTOR vPosition, vScale;
             orxSPAWNER *pstSpawner;
-            orxOBJECT  *pstObject, *pstOwner;
+            orxOBJECT  *pstObject;
 
             /* Gets current spawner and object */
             pstSpawner  = sstSpawner.pstCurrentSpawner;
@@ -653,136 +996,8 @@ static orxSTATUS orxFASTCALL orxSpawner_EventHandler(const orxEVENT *_pstEvent)
             /* Clears pending object */
             pstSpawner->pstPendingObject = orxNULL;
 
-            /* Updates active object count */
-            pstSpawner->u32ActiveObjectCount++;
-
-            /* Updates total object count */
-            pstSpawner->u32TotalObjectCount++;
-
-            /* Sets spawner as owner */
-            orxObject_SetOwner(pstObject, pstSpawner);
-
-            /* Should use self as parent? */
-            if(orxStructure_TestFlags(pstSpawner, orxSPAWNER_KU32_FLAG_USE_SELF_AS_PARENT))
-            {
-              /* Updates spawned object's parent */
-              orxObject_SetParent(pstObject, pstSpawner);
-            }
-
-            /* Should update rotation? */
-            if(orxStructure_TestFlags(pstSpawner, orxSPAWNER_KU32_FLAG_USE_ROTATION))
-            {
-              /* Updates object rotation */
-              orxObject_SetRotation(pstObject, orxObject_GetRotation(pstObject) + pstSpawner->fPendingRotation);
-            }
-
-            /* Should update scale? */
-            if(orxStructure_TestFlags(pstSpawner, orxSPAWNER_KU32_FLAG_USE_SCALE))
-            {
-              /* Updates object scale */
-              orxObject_SetScale(pstObject, orxVector_Mul(&vScale, orxObject_GetScale(pstObject, &vScale), pstSpawner->pvPendingScale));
-            }
-
-            /* Not using self as parent? */
-            if(!orxStructure_TestFlags(pstSpawner, orxSPAWNER_KU32_FLAG_USE_SELF_AS_PARENT))
-            {
-              /* Updates object position */
-              orxObject_SetPosition(pstObject, orxVector_Add(&vPosition, orxVector_2DRotate(&vPosition, orxVector_Mul(&vPosition, orxObject_GetPosition(pstObject, &vPosition), pstSpawner->pvPendingScale), pstSpawner->fPendingRotation), pstSpawner->pvPendingPosition));
-            }
-
-            /* Should apply speed? */
-            if(orxStructure_TestFlags(pstSpawner, orxSPAWNER_KU32_FLAG_OBJECT_SPEED))
-            {
-              /* Use random speed? */
-              if(orxStructure_TestFlags(pstSpawner, orxSPAWNER_KU32_FLAG_RANDOM_OBJECT_SPEED))
-              {
-                /* Updates its value */
-                orxConfig_PushSection(pstSpawner->zReference);
-                orxConfig_GetVector(orxSPAWNER_KZ_CONFIG_OBJECT_SPEED, &(pstSpawner->vSpeed));
-                orxConfig_PopSection();
-              }
-
-              /* Use relative speed? */
-              if(orxStructure_TestFlags(pstSpawner, orxSPAWNER_KU32_FLAG_USE_RELATIVE_SPEED))
-              {
-                orxVECTOR vSpeed;
-
-                /* Applies relative speed */
-                orxVector_Mul(&vSpeed, orxVector_2DRotate(&vSpeed, &(pstSpawner->vSpeed), pstSpawner->fPendingRotation), pstSpawner->pvPendingScale);
-                orxObject_SetSpeed(pstObject, &vSpeed);
-              }
-              else
-              {
-                /* Applies speed */
-                orxObject_SetSpeed(pstObject, &(pstSpawner->vSpeed));
-              }
-            }
-
-            /* Gets owner */
-            pstOwner = orxOBJECT(orxStructure_GetOwner(pstSpawner));
-
-            /* Valid? */
-            if(pstOwner != orxNULL)
-            {
-              /* Doesn't have a group? */
-              if(orxObject_GetGroupID(pstObject) == sstSpawner.stDefaultGroupID)
-              {
-                /* Transfers group ID */
-                orxObject_SetGroupID(pstObject, orxObject_GetGroupID(pstOwner));
-              }
-
-              /* Should apply color or alpha? */
-              if(orxStructure_TestFlags(pstSpawner, orxSPAWNER_KU32_FLAG_USE_ALPHA | orxSPAWNER_KU32_FLAG_USE_COLOR))
-              {
-                orxCOLOR stColor, stTemp;
-
-                /* Inits color */
-                orxColor_Set(&stColor, &orxVECTOR_WHITE, orxFLOAT_1);
-
-                /* Should apply color? */
-                if(orxStructure_TestFlags(pstSpawner, orxSPAWNER_KU32_FLAG_USE_COLOR))
-                {
-                  /* Has color? */
-                  if(orxObject_HasColor(pstOwner) != orxFALSE)
-                  {
-                    /* Gets it */
-                    orxObject_GetColor(pstOwner, &stColor);
-                  }
-                }
-                else
-                {
-                  /* Has color? */
-                  if(orxObject_HasColor(pstObject) != orxFALSE)
-                  {
-                    /* Uses object's one */
-                    orxObject_GetColor(pstObject, &stColor);
-                  }
-                }
-
-                /* Should apply alpha? */
-                if(orxStructure_TestFlags(pstSpawner, orxSPAWNER_KU32_FLAG_USE_ALPHA))
-                {
-                  /* Has color? */
-                  if(orxObject_HasColor(pstOwner) != orxFALSE)
-                  {
-                    /* Stores it */
-                    stColor.fAlpha = orxObject_GetColor(pstOwner, &stTemp)->fAlpha;
-                  }
-                }
-                else
-                {
-                  /* Has color? */
-                  if(orxObject_HasColor(pstObject) != orxFALSE)
-                  {
-                    /* Uses object's alpha */
-                    stColor.fAlpha = orxObject_GetColor(pstObject, &stTemp)->fAlpha;
-                  }
-                }
-
-                /* Applies new value */
-                orxObject_SetColor(pstObject, &stColor);
-              }
-            }
+            /* Sets it up */
+            orxSpawner_SetupObject(pstSpawner, pstObject);
           }
 
           break;
@@ -1233,6 +1448,9 @@ orxSTATUS orxFASTCALL orxSpawner_Delete(orxSPAWNER *_pstSpawner)
     /* Sends event */
     orxEVENT_SEND(orxEVENT_TYPE_SPAWNER, orxSPAWNER_EVENT_DELETE, _pstSpawner, orxNULL, orxNULL);
 
+    /* Deletes its pool */
+    orxSpawner_SetPoolSize(_pstSpawner, 0);
+
     /* Should clean? */
     if(orxStructure_TestFlags(_pstSpawner, orxSPAWNER_KU32_FLAG_CLEAN_ON_DELETE))
     {
@@ -1372,8 +1590,9 @@ void orxFASTCALL orxSpawner_Reset(orxSPAWNER *_pstSpawner)
       pstObject != orxNULL;
       pstObject = orxOBJECT(orxStructure_GetNext(pstObject)))
   {
-    /* Is spawner the owner */
-    if(orxSPAWNER(orxObject_GetOwner(pstObject)) == _pstSpawner)
+    /* Is spawner the owner and object isn't pooled? */
+    if((orxSPAWNER(orxObject_GetOwner(pstObject)) == _pstSpawner)
+    && (orxSpawner_FindPooledObject(_pstSpawner, pstObject) == orxU32_UNDEFINED))
     {
       /* Removes it */
       orxObject_SetOwner(pstObject, orxNULL);
@@ -1531,6 +1750,116 @@ orxU32 orxFASTCALL orxSpawner_GetActiveObjectCount(const orxSPAWNER *_pstSpawner
   return u32Result;
 }
 
+/** Gets spawner pool stats
+ * @param[in]   _pstSpawner     Concerned spawner
+ * @param[out]  _pu32HitCount   Number of spawns served by the pool, orxNULL to ignore
+ * @param[out]  _pu32MissCount  Number of spawns that had to create a new object, orxNULL to ignore
+ * @param[out]  _pu32PooledCount Number of objects currently waiting in the pool, orxNULL to ignore
+ * @return      Pool size, 0 if the spawner isn't pooling its objects
+ */
+orxU32 orxFASTCALL orxSpawner_GetPoolStats(const orxSPAWNER *_pstSpawner, orxU32 *_pu32HitCount, orxU32 *_pu32MissCount, orxU32 *_pu32PooledCount)
+{
+  orxU32 u32Result;
+
+  /* Checks */
+  orxASSERT(sstSpawner.u32Flags & orxSPAWNER_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstSpawner);
+
+  /* Should get hit count? */
+  if(_pu32HitCount != orxNULL)
+  {
+    /* Stores it */
+    *_pu32HitCount = _pstSpawner->u32PoolHitCount;
+  }
+
+  /* Should get miss count? */
+  if(_pu32MissCount != orxNULL)
+  {
+    /* Stores it */
+    *_pu32MissCount = _pstSpawner->u32PoolMissCount;
+  }
+
+  /* Should get pooled count? */
+  if(_pu32PooledCount != orxNULL)
+  {
+    /* Stores it */
+    *_pu32PooledCount = _pstSpawner->u32PoolCount;
+  }
+
+  /* Updates result */
+  u32Result = _pstSpawner->u32PoolSize;
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Stores an expired spawned object in the spawner's pool instead of deleting it. Called by the object module once the object's
+ * delete event has been accepted: the object will be disabled and recycled by a later spawn of the same object.
+ * @param[in]   _pstSpawner     Concerned spawner
+ * @param[in]   _pstObject      Concerned object, has to be owned by the spawner
+ * @return      orxSTATUS_SUCCESS if pooled, orxSTATUS_FAILURE if it should be deleted
+ */
+orxSTATUS orxFASTCALL orxSpawner_PoolObject(orxSPAWNER *_pstSpawner, orxSTRUCTURE *_pstObject)
+{
+  orxOBJECT  *pstObject;
+  orxSTATUS   eResult;
+
+  /* Checks */
+  orxASSERT(sstSpawner.u32Flags & orxSPAWNER_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstSpawner);
+  orxSTRUCTURE_ASSERT(_pstObject);
+
+  /* Gets object */
+  pstObject = orxOBJECT(_pstObject);
+
+  /* Checks */
+  orxASSERT(pstObject != orxNULL);
+  orxASSERT(orxSPAWNER(orxObject_GetOwner(pstObject)) == _pstSpawner);
+
+  /* Has room left in its pool? */
+  if(_pstSpawner->u32PoolCount < _pstSpawner->u32PoolSize)
+  {
+    /* Stores it */
+    _pstSpawner->astPool[_pstSpawner->u32PoolCount].pstObject = pstObject;
+    _pstSpawner->astPool[_pstSpawner->u32PoolCount].stNameID  = orxString_ToCRC(orxObject_GetName(pstObject));
+    _pstSpawner->u32PoolCount++;
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Removes an object from the spawner's pool. Called by the object module when a pooled object gets deleted.
+ * @param[in]   _pstSpawner     Concerned spawner
+ * @param[in]   _pstObject      Concerned object
+ */
+void orxFASTCALL orxSpawner_UnpoolObject(orxSPAWNER *_pstSpawner, const orxSTRUCTURE *_pstObject)
+{
+  orxU32 u32Index;
+
+  /* Checks */
+  orxASSERT(sstSpawner.u32Flags & orxSPAWNER_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstSpawner);
+
+  /* Is pooled? */
+  if((u32Index = orxSpawner_FindPooledObject(_pstSpawner, orxOBJECT(_pstObject))) != orxU32_UNDEFINED)
+  {
+    /* Removes it from the pool */
+    _pstSpawner->astPool[u32Index] = _pstSpawner->astPool[--_pstSpawner->u32PoolCount];
+  }
+
+  /* Done! */
+  return;
+}
+
 /** Sets spawner wave size
  * @param[in]   _pstSpawner     Concerned spawner
  * @param[in]   _u32WaveSize    Number of objects to spawn in a wave / 0 for deactivating wave mode
@@ -58,6 +58,8 @@
 #define orxSTRUCTURE_KU32_LOG_COLOR_MARKER    orxANSI_KZ_COLOR_FG_DEFAULT
 #define orxSTRUCTURE_KU32_LOG_COLOR_TREE      orxANSI_KZ_COLOR_FG_GREEN
 
+#define orxSTRUCTURE_KU32_HANDLE_TABLE_SIZE   64          /**< Initial handle table size */
+
 
 /***************************************************************************
  * Structure declaration                                                   *
@@ -68,7 +70,9 @@
 typedef struct __orxSTRUCTURE_STORAGE_t
 {
   orxBANK                  *pstStructureBank; /**< Associated structure bank : 4 */
-  orxSTRUCTURE_STORAGE_TYPE eType;            /**< Storage type : 4 */
+  orxSTRUCTURE            **apstHandleTable;  /**< Handle table (item ID -> structure) : 8 */
+  orxU32                    u32HandleTableSize; /**< Handle table size : 12 */
+  orxSTRUCTURE_STORAGE_TYPE eType;            /**< Storage type : 16 */
 
   union
   {
@@ -309,6 +313,68 @@ static orxINLINE void orxStructure_LogNode(const orxTREE_NODE *_pstNode)
 }
 
 
+/** Stores a structure in its type's handle table, growing it if needed (the table is left untouched if it can't grow)
+ * @param[in]   _eStructureID   Concerned structure ID
+ * @param[in]   _u32ItemID      Item ID (bank index)
+ * @param[in]   _pstStructure   Structure to store, orxNULL to clear the handle
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxINLINE orxSTATUS orxStructure_SetHandle(orxSTRUCTURE_ID _eStructureID, orxU32 _u32ItemID, orxSTRUCTURE *_pstStructure)
+{
+  orxSTRUCTURE_STORAGE *pstStorage;
+  orxSTATUS             eResult = orxSTATUS_FAILURE;
+
+  /* Gets storage */
+  pstStorage = &(sstStructure.astStorage[_eStructureID]);
+
+  /* Needs to grow? */
+  if((_u32ItemID >= pstStorage->u32HandleTableSize) && (_pstStructure != orxNULL))
+  {
+    orxSTRUCTURE  **apstNewTable;
+    orxU32          u32NewSize;
+
+    /* Gets new size */
+    for(u32NewSize = (pstStorage->u32HandleTableSize != 0) ? pstStorage->u32HandleTableSize << 1 : orxSTRUCTURE_KU32_HANDLE_TABLE_SIZE;
+        u32NewSize <= _u32ItemID;
+        u32NewSize <<= 1);
+
+    /* Allocates / reallocates it */
+    apstNewTable = (pstStorage->apstHandleTable != orxNULL)
+                 ? (orxSTRUCTURE **)orxMemory_Reallocate(pstStorage->apstHandleTable, u32NewSize * sizeof(orxSTRUCTURE *))
+                 : (orxSTRUCTURE **)orxMemory_Allocate(u32NewSize * sizeof(orxSTRUCTURE *), orxMEMORY_TYPE_MAIN);
+
+    /* Success? */
+    if(apstNewTable != orxNULL)
+    {
+      /* Clears new handles */
+      orxMemory_Zero(apstNewTable + pstStorage->u32HandleTableSize, (u32NewSize - pstStorage->u32HandleTableSize) * sizeof(orxSTRUCTURE *));
+
+      /* Stores it */
+      pstStorage->apstHandleTable     = apstNewTable;
+      pstStorage->u32HandleTableSize  = u32NewSize;
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, "Couldn't grow handle table to %u entries.", u32NewSize);
+    }
+  }
+
+  /* In table? */
+  if(_u32ItemID < pstStorage->u32HandleTableSize)
+  {
+    /* Stores handle */
+    pstStorage->apstHandleTable[_u32ItemID] = _pstStructure;
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+
 /***************************************************************************
  * Public functions                                                        *
  ***************************************************************************/
@@ -413,6 +479,13 @@ void orxFASTCALL orxStructure_Exit()
         /* Deletes it */
         orxBank_Delete(sstStructure.astStorage[i].pstStructureBank);
       }
+
+      /* Has handle table? */
+      if(sstStructure.astStorage[i].apstHandleTable != orxNULL)
+      {
+        /* Deletes it */
+        orxMemory_Free(sstStructure.astStorage[i].apstHandleTable);
+      }
     }
 
     /* Updates flags */
@@ -502,6 +575,15 @@ orxSTATUS orxFASTCALL orxStructure_Unregister(orxSTRUCTURE_ID _eStructureID)
     /* Deletes structure storage bank */
     orxBank_Delete(sstStructure.astStorage[_eStructureID].pstStructureBank);
 
+    /* Has handle table? */
+    if(sstStructure.astStorage[_eStructureID].apstHandleTable != orxNULL)
+    {
+      /* Deletes it */
+      orxMemory_Free(sstStructure.astStorage[_eStructureID].apstHandleTable);
+      sstStructure.astStorage[_eStructureID].apstHandleTable    = orxNULL;
+      sstStructure.astStorage[_eStructureID].u32HandleTableSize = 0;
+    }
+
     /* Unregisters it */
     orxMemory_Zero(&(sstStructure.astInfo[_eStructureID]), sizeof(orxSTRUCTURE_REGISTER_INFO));
     sstStructure.astStorage[_eStructureID].pstStructureBank = orxNULL;
@@ -596,6 +678,27 @@ orxSTRUCTURE *orxFASTCALL orxStructure_Create(orxSTRUCTURE_ID _eStructureID)
         }
       }
 
+      /* Successful? */
+      if(eResult != orxSTATUS_FAILURE)
+      {
+        /* Stores its handle */
+        eResult = orxStructure_SetHandle(_eStructureID, u32ItemID, pstStructure);
+
+        /* Failure? */
+        if(eResult == orxSTATUS_FAILURE)
+        {
+          /* Removes it from storage */
+          if(sstStructure.astStorage[_eStructureID].eType == orxSTRUCTURE_STORAGE_TYPE_LINKLIST)
+          {
+            orxLinkList_Remove(&(pstStructure->stStorage.stLinkListNode));
+          }
+          else
+          {
+            orxTree_Remove(&(pstStructure->stStorage.stTreeNode));
+          }
+        }
+      }
+
       /* Successful? */
       if(eResult != orxSTATUS_FAILURE)
       {
@@ -618,7 +721,7 @@ orxSTRUCTURE *orxFASTCALL orxStructure_Create(orxSTRUCTURE_ID _eStructureID)
       else
       {
         /* Logs message */
-        orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, "Failed to add node to list.");
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, "Failed to add node to storage or handle table.");
 
         /* Frees allocated structure */
         orxBank_Free(sstStructure.astStorage[_eStructureID].pstStructureBank, pstStructure);
@@ -694,6 +797,9 @@ orxSTATUS orxFASTCALL orxStructure_Delete(void *_pStructure)
   /* Gets structure ID */
   eStructureID = orxStructure_GetID(_pStructure);
 
+  /* Clears its handle */
+  orxStructure_SetHandle(eStructureID, (orxU32)((pstStructure->u64GUID & orxSTRUCTURE_GUID_MASK_ITEM_ID) >> orxSTRUCTURE_GUID_SHIFT_ITEM_ID), orxNULL);
+
   /* Tags structure as deleted */
   orxSTRUCTURE(_pStructure)->u64GUID = orxSTRUCTURE_GUID_MAGIC_TAG_DELETED;
 
@@ -823,8 +929,15 @@ orxSTRUCTURE *orxFASTCALL orxStructure_Get(orxU64 _u64GUID)
   /* Valid? */
   if(u64StructureID < orxSTRUCTURE_ID_NUMBER)
   {
-    /* Gets structure at index */
-    pstResult = (orxSTRUCTURE *)orxBank_GetAtIndex(sstStructure.astStorage[u64StructureID].pstStructureBank, (orxU32)((_u64GUID & orxSTRUCTURE_GUID_MASK_ITEM_ID) >> orxSTRUCTURE_GUID_SHIFT_ITEM_ID));
+    const orxSTRUCTURE_STORAGE *pstStorage;
+    orxU32                      u32ItemID;
+
+    /* Gets storage & item ID */
+    pstStorage  = &(sstStructure.astStorage[u64StructureID]);
+    u32ItemID   = (orxU32)((_u64GUID & orxSTRUCTURE_GUID_MASK_ITEM_ID) >> orxSTRUCTURE_GUID_SHIFT_ITEM_ID);
+
+    /* Gets structure from handle table (all live structures are stored there) */
+    pstResult = (u32ItemID < pstStorage->u32HandleTableSize) ? pstStorage->apstHandleTable[u32ItemID] : (orxSTRUCTURE *)orxNULL;
 
     /* Valid? */
     if(pstResult != orxNULL)
@@ -895,6 +1008,50 @@ orxSTATUS orxFASTCALL orxStructure_SetOwner(void *_pStructure, void *_pOwner)
   return eResult;
 }
 
+/** Renews structure's GUID: keeps its item ID but gives it a new instance ID, previous GUID won't resolve anymore
+ * @param[in]   _pStructure    Concerned structure
+ * @return      New GUID
+ */
+orxU64 orxFASTCALL orxStructure_RenewGUID(void *_pStructure)
+{
+  orxSTRUCTURE   *pstStructure;
+  orxSTRUCTURE_ID eStructureID;
+  orxU64          u64OldGUID;
+
+  /* Checks */
+  orxASSERT(sstStructure.u32Flags & orxSTRUCTURE_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pStructure);
+
+  /* Gets structure, its ID & its current GUID */
+  pstStructure  = orxSTRUCTURE(_pStructure);
+  eStructureID  = orxStructure_GetID(pstStructure);
+  u64OldGUID    = pstStructure->u64GUID;
+
+  /* Same instance ID as the current one (counter wrapped around)? */
+  if(((u64OldGUID & orxSTRUCTURE_GUID_MASK_INSTANCE_ID) >> orxSTRUCTURE_GUID_SHIFT_INSTANCE_ID) == (orxU64)sstStructure.au32InstanceCount[eStructureID])
+  {
+    /* Skips it */
+    sstStructure.au32InstanceCount[eStructureID] = (sstStructure.au32InstanceCount[eStructureID] + 1) & (orxSTRUCTURE_GUID_MASK_INSTANCE_ID >> orxSTRUCTURE_GUID_SHIFT_INSTANCE_ID);
+  }
+
+  /* Stores new GUID */
+  pstStructure->u64GUID = (u64OldGUID & ~orxSTRUCTURE_GUID_MASK_INSTANCE_ID)
+                        | ((orxU64)sstStructure.au32InstanceCount[eStructureID] << orxSTRUCTURE_GUID_SHIFT_INSTANCE_ID);
+
+  /* Was self-owned? */
+  if(pstStructure->u64OwnerGUID == u64OldGUID)
+  {
+    /* Updates owner GUID */
+    pstStructure->u64OwnerGUID = pstStructure->u64GUID;
+  }
+
+  /* Updates instance ID */
+  sstStructure.au32InstanceCount[eStructureID] = (sstStructure.au32InstanceCount[eStructureID] + 1) & (orxSTRUCTURE_GUID_MASK_INSTANCE_ID >> orxSTRUCTURE_GUID_SHIFT_INSTANCE_ID);
+
+  /* Done! */
+  return pstStructure->u64GUID;
+}
+
 /** Gets first stored structure (first list cell or tree root depending on storage type)
  * @param[in]   _eStructureID   Concerned structure ID
  * @return      orxSTRUCTURE
@@ -93,6 +93,7 @@
 #define orxBODY_KZ_CONFIG_CHECK_MASK          "CheckMask"
 #define orxBODY_KZ_CONFIG_TYPE                "Type"
 #define orxBODY_KZ_CONFIG_SOLID               "Solid"
+#define orxBODY_KZ_CONFIG_CONTACT_EVENT       "ContactEvent"
 #define orxBODY_KZ_CONFIG_TOP_LEFT            "TopLeft"
 #define orxBODY_KZ_CONFIG_BOTTOM_RIGHT        "BottomRight"
 #define orxBODY_KZ_CONFIG_CENTER              "Center"
@@ -903,6 +904,10 @@ orxBODY_PART *orxFASTCALL orxBody_AddPartFromConfig(orxBODY *_pstBody, const orx
     {
       stBodyPartDef.u32Flags |= orxBODY_PART_DEF_KU32_FLAG_SOLID;
     }
+    if((orxConfig_HasValue(orxBODY_KZ_CONFIG_CONTACT_EVENT) != orxFALSE) && (orxConfig_GetBool(orxBODY_KZ_CONFIG_CONTACT_EVENT) == orxFALSE))
+    {
+      stBodyPartDef.u32Flags |= orxBODY_PART_DEF_KU32_FLAG_NO_CONTACT_EVENT;
+    }
     /* Sphere? */
     if(orxString_ICompare(zBodyPartType, orxBODY_KZ_TYPE_SPHERE) == 0)
     {
@@ -2916,6 +2921,61 @@ orxSTATUS orxFASTCALL orxBody_SetPartSolid(orxBODY_PART *_pstBodyPart, orxBOOL _
   return eResult;
 }
 
+/** Enables / disables contact events for a body part: contacts are only reported when at least one of their parts has them enabled
+ * @param[in]   _pstBodyPart    Concerned body part
+ * @param[in]   _bEnable        Enable / disable
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxBody_EnablePartContactEvent(orxBODY_PART *_pstBodyPart, orxBOOL _bEnable)
+{
+  orxSTATUS eResult;
+
+  /* Checks */
+  orxASSERT(sstBody.u32Flags & orxBODY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBodyPart != orxNULL);
+
+  /* Notifies physics plugin: its contact listener reads the def, possibly from its step thread */
+  eResult = orxPhysics_EnablePartContactEvent(_pstBodyPart->pstData, _bEnable);
+
+  /* Success? */
+  if(eResult != orxSTATUS_FAILURE)
+  {
+    /* Enable? */
+    if(_bEnable != orxFALSE)
+    {
+      /* Updates def */
+      orxFLAG_SET(_pstBodyPart->pstDef->u32Flags, orxBODY_PART_DEF_KU32_FLAG_NONE, orxBODY_PART_DEF_KU32_FLAG_NO_CONTACT_EVENT);
+    }
+    else
+    {
+      /* Updates def */
+      orxFLAG_SET(_pstBodyPart->pstDef->u32Flags, orxBODY_PART_DEF_KU32_FLAG_NO_CONTACT_EVENT, orxBODY_PART_DEF_KU32_FLAG_NONE);
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Are contact events enabled for a body part?
+ * @param[in]   _pstBodyPart    Concerned body part
+ * @return      orxTRUE / orxFALSE
+ */
+orxBOOL orxFASTCALL orxBody_IsPartContactEventEnabled(const orxBODY_PART *_pstBodyPart)
+{
+  orxBOOL bResult;
+
+  /* Checks */
+  orxASSERT(sstBody.u32Flags & orxBODY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBodyPart != orxNULL);
+
+  /* Updates result */
+  bResult = orxFLAG_TEST(_pstBodyPart->pstDef->u32Flags, orxBODY_PART_DEF_KU32_FLAG_NO_CONTACT_EVENT) ? orxFALSE : orxTRUE;
+
+  /* Done! */
+  return bResult;
+}
+
 /** Issues a raycast to test for potential bodies in the way
  * @param[in]   _pvBegin        Beginning of raycast
  * @param[in]   _pvEnd          End of raycast
@@ -2949,3 +3009,43 @@ orxBODY *orxFASTCALL orxBody_Raycast(const orxVECTOR *_pvBegin, const orxVECTOR
   /* Done! */
   return pstResult;
 }
+
+/** Issues a batch of raycasts, each query's hResult will contain the colliding orxBODY / orxHANDLE_UNDEFINED
+ * @param[in,out] _astRaycastList List of raycast queries
+ * @param[in]   _u32Number      Number of queries
+ * @return Number of raycasts that hit a body
+ */
+orxU32 orxFASTCALL orxBody_RaycastBatch(orxPHYSICS_RAYCAST *_astRaycastList, orxU32 _u32Number)
+{
+  orxU32 u32Result;
+
+  /* Checks */
+  orxASSERT(sstBody.u32Flags & orxBODY_KU32_STATIC_FLAG_READY);
+  orxASSERT((_astRaycastList != orxNULL) || (_u32Number == 0));
+
+  /* Issues raycasts (bodies are stored as physics user data) */
+  u32Result = orxPhysics_RaycastBatch(_astRaycastList, _u32Number);
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Issues a batch of box overlap queries, each query's result buffer will receive the overlapping orxBODY
+ * @param[in,out] _astOverlapList List of overlap queries
+ * @param[in]   _u32Number      Number of queries
+ * @return Total number of overlapping bodies found
+ */
+orxU32 orxFASTCALL orxBody_OverlapBatch(orxPHYSICS_OVERLAP *_astOverlapList, orxU32 _u32Number)
+{
+  orxU32 u32Result;
+
+  /* Checks */
+  orxASSERT(sstBody.u32Flags & orxBODY_KU32_STATIC_FLAG_READY);
+  orxASSERT((_astOverlapList != orxNULL) || (_u32Number == 0));
+
+  /* Issues queries (bodies are stored as physics user data) */
+  u32Result = orxPhysics_OverlapBatch(_astOverlapList, _u32Number);
+
+  /* Done! */
+  return u32Result;
+}
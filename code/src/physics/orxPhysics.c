@@ -119,6 +119,7 @@ void orxFASTCALL orxPhysics_Setup()
   orxModule_AddDependency(orxMODULE_ID_PHYSICS, orxMODULE_ID_CLOCK);
   orxModule_AddDependency(orxMODULE_ID_PHYSICS, orxMODULE_ID_CONFIG);
   orxModule_AddDependency(orxMODULE_ID_PHYSICS, orxMODULE_ID_EVENT);
+  orxModule_AddDependency(orxMODULE_ID_PHYSICS, orxMODULE_ID_THREAD);
 
   return;
 }
@@ -300,7 +301,10 @@ orxPLUGIN_DEFINE_CORE_FUNCTION(orxPhysics_GetPartSelfFlags, orxU16, const orxPHY
 orxPLUGIN_DEFINE_CORE_FUNCTION(orxPhysics_GetPartCheckMask, orxU16, const orxPHYSICS_BODY_PART *);
 orxPLUGIN_DEFINE_CORE_FUNCTION(orxPhysics_IsPartSolid, orxBOOL, const orxPHYSICS_BODY_PART *);
 orxPLUGIN_DEFINE_CORE_FUNCTION(orxPhysics_SetPartSolid, orxSTATUS, orxPHYSICS_BODY_PART *, orxBOOL);
+orxPLUGIN_DEFINE_CORE_FUNCTION(orxPhysics_EnablePartContactEvent, orxSTATUS, orxPHYSICS_BODY_PART *, orxBOOL);
 orxPLUGIN_DEFINE_CORE_FUNCTION(orxPhysics_Raycast, orxHANDLE, const orxVECTOR *, const orxVECTOR *, orxU16, orxU16, orxBOOL, orxVECTOR *, orxVECTOR *);
+orxPLUGIN_DEFINE_CORE_FUNCTION(orxPhysics_RaycastBatch, orxU32, orxPHYSICS_RAYCAST *, orxU32);
+orxPLUGIN_DEFINE_CORE_FUNCTION(orxPhysics_OverlapBatch, orxU32, orxPHYSICS_OVERLAP *, orxU32);
 orxPLUGIN_DEFINE_CORE_FUNCTION(orxPhysics_EnableSimulation, void, orxBOOL);
 
 
@@ -348,12 +352,15 @@ orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(PHYSICS, GET_PART_SELF_FLAGS, orxPhysics_GetPa
 orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(PHYSICS, GET_PART_CHECK_MASK, orxPhysics_GetPartCheckMask)
 orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(PHYSICS, IS_PART_SOLID, orxPhysics_IsPartSolid)
 orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(PHYSICS, SET_PART_SOLID, orxPhysics_SetPartSolid)
+orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(PHYSICS, ENABLE_PART_CONTACT_EVENT, orxPhysics_EnablePartContactEvent)
 orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(PHYSICS, ENABLE_MOTOR, orxPhysics_EnableMotor)
 orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(PHYSICS, SET_JOINT_MOTOR_SPEED, orxPhysics_SetJointMotorSpeed)
 orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(PHYSICS, SET_JOINT_MAX_MOTOR_TORQUE, orxPhysics_SetJointMaxMotorTorque)
 orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(PHYSICS, GET_JOINT_REACTION_FORCE, orxPhysics_GetJointReactionForce)
 orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(PHYSICS, GET_JOINT_REACTION_TORQUE, orxPhysics_GetJointReactionTorque)
 orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(PHYSICS, RAYCAST, orxPhysics_Raycast)
+orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(PHYSICS, RAYCAST_BATCH, orxPhysics_RaycastBatch)
+orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(PHYSICS, OVERLAP_BATCH, orxPhysics_OverlapBatch)
 orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(PHYSICS, ENABLE_SIMULATION, orxPhysics_EnableSimulation)
 
 orxPLUGIN_END_CORE_FUNCTION_ARRAY(PHYSICS)
@@ -568,6 +575,11 @@ orxSTATUS orxFASTCALL orxPhysics_SetPartSolid(orxPHYSICS_BODY_PART *_pstBodyPart
   return orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxPhysics_SetPartSolid)(_pstBodyPart, _bSolid);
 }
 
+orxSTATUS orxFASTCALL orxPhysics_EnablePartContactEvent(orxPHYSICS_BODY_PART *_pstBodyPart, orxBOOL _bEnable)
+{
+  return orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxPhysics_EnablePartContactEvent)(_pstBodyPart, _bEnable);
+}
+
 void orxFASTCALL orxPhysics_EnableMotor(orxPHYSICS_BODY_JOINT *_pstBodyJoint, orxBOOL _bEnable)
 {
   orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxPhysics_EnableMotor)(_pstBodyJoint, _bEnable);
@@ -598,6 +610,16 @@ orxHANDLE orxFASTCALL orxPhysics_Raycast(const orxVECTOR *_pvBegin, const orxVEC
   return orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxPhysics_Raycast)(_pvBegin, _pvEnd, _u16SelfFlags, _u16CheckMask, _bEarlyExit, _pvContact, _pvNormal);
 }
 
+orxU32 orxFASTCALL orxPhysics_RaycastBatch(orxPHYSICS_RAYCAST *_astRaycastList, orxU32 _u32Number)
+{
+  return orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxPhysics_RaycastBatch)(_astRaycastList, _u32Number);
+}
+
+orxU32 orxFASTCALL orxPhysics_OverlapBatch(orxPHYSICS_OVERLAP *_astOverlapList, orxU32 _u32Number)
+{
+  return orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxPhysics_OverlapBatch)(_astOverlapList, _u32Number);
+}
+
 void orxFASTCALL orxPhysics_EnableSimulation(orxBOOL _bEnable)
 {
   orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxPhysics_EnableSimulation)(_bEnable);
@@ -58,8 +58,20 @@
 #include "../plugins/Render/Home/orxRender.c"
 #include "../plugins/Sound/android/orxSoundSystem.c"
 
+/* Headless? */
+#elif defined(__orxHEADLESS__)
+
+/* Dummy display, input & sound, Box2D */
+#include "../plugins/Display/Dummy/orxDisplay.c"
+#include "../plugins/Joystick/Dummy/orxJoystick.c"
+#include "../plugins/Keyboard/Dummy/orxKeyboard.c"
+#include "../plugins/Mouse/Dummy/orxMouse.c"
+#include "../plugins/Physics/LiquidFun/orxPhysics.cpp"
+#include "../plugins/Render/Home/orxRender.c"
+#include "../plugins/Sound/Dummy/orxSoundSystem.c"
+
 /* Others */
-#else /* __orxANDROID__ || __orxANDROID_NATIVE__ */
+#else /* __orxHEADLESS__ */
 
 /** Includes all plugins to embed
  */
@@ -73,6 +85,6 @@
 #include "../plugins/Render/Home/orxRender.c"
 #include "../plugins/Sound/OpenAL/orxSoundSystem.c"
 
-#endif /* __orxANDROID__ || __orxANDROID_NATIVE__ */
+#endif /* __orxHEADLESS__ */
 
 #endif /* __orxEMBEDDED__ */
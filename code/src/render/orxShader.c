@@ -1800,6 +1800,83 @@ const orxSTRING orxFASTCALL orxShader_GetName(const orxSHADER *_pstShader)
   return zResult;
 }
 
+/** Gets shader texture count, ie. the number of texture parameter values currently bound
+ * @param[in]   _pstShader            Concerned Shader
+ * @return      Number of bound textures
+ */
+orxU32 orxFASTCALL orxShader_GetTextureCount(const orxSHADER *_pstShader)
+{
+  orxSHADER_PARAM_VALUE  *pstParamValue;
+  orxU32                  u32Result = 0;
+
+  /* Checks */
+  orxASSERT(sstShader.u32Flags & orxSHADER_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstShader);
+
+  /* For all param values */
+  for(pstParamValue = (orxSHADER_PARAM_VALUE *)orxLinkList_GetFirst(&(_pstShader->stParamValueList));
+      pstParamValue != orxNULL;
+      pstParamValue = (orxSHADER_PARAM_VALUE *)orxLinkList_GetNext(&(pstParamValue->stNode)))
+  {
+    /* Is a bound texture? */
+    if((pstParamValue->pstParam->eType == orxSHADER_PARAM_TYPE_TEXTURE)
+    && (pstParamValue->pstValue != orxNULL))
+    {
+      /* Updates result */
+      u32Result++;
+    }
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Gets shader textures, ie. the textures currently bound to its texture parameters
+ * @param[in]   _pstShader            Concerned Shader
+ * @param[in]   _u32TextureNumber     Number of textures to retrieve
+ * @param[out]  _apstTextureList      List of textures
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxShader_GetTextureList(const orxSHADER *_pstShader, orxU32 _u32TextureNumber, const orxTEXTURE **_apstTextureList)
+{
+  orxSHADER_PARAM_VALUE  *pstParamValue;
+  orxU32                  i;
+  orxSTATUS               eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT(sstShader.u32Flags & orxSHADER_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstShader);
+  orxASSERT(_u32TextureNumber != 0);
+  orxASSERT(_apstTextureList != orxNULL);
+
+  /* For all param values */
+  for(i = 0, pstParamValue = (orxSHADER_PARAM_VALUE *)orxLinkList_GetFirst(&(_pstShader->stParamValueList));
+      (i < _u32TextureNumber) && (pstParamValue != orxNULL);
+      pstParamValue = (orxSHADER_PARAM_VALUE *)orxLinkList_GetNext(&(pstParamValue->stNode)))
+  {
+    /* Is a bound texture? */
+    if((pstParamValue->pstParam->eType == orxSHADER_PARAM_TYPE_TEXTURE)
+    && (pstParamValue->pstValue != orxNULL))
+    {
+      /* Stores it */
+      _apstTextureList[i++] = pstParamValue->pstValue;
+    }
+  }
+
+  /* Not enough textures? */
+  if(i != _u32TextureNumber)
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_RENDER, "Shader [%s]: Can't get %u textures, only %u are bound.", orxShader_GetName(_pstShader), _u32TextureNumber, i);
+
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 #ifdef __orxGCC__
 
   #pragma GCC diagnostic pop
@@ -59,6 +59,7 @@
 #define orxVIEWPORT_KU32_FLAG_USE_SCREEN_SIZE   0x00000008  /**< Uses screen size flag */
 #define orxVIEWPORT_KU32_FLAG_AUTO_RESIZE       0x00000010  /**< Auto-resize flag */
 #define orxVIEWPORT_KU32_FLAG_FIXED_RATIO       0x00000020  /**< Fixed ratio flag */
+#define orxVIEWPORT_KU32_FLAG_CACHED            0x00000040  /**< Cached flag */
 #define orxVIEWPORT_KU32_FLAG_INTERNAL_TEXTURES 0x00100000  /**< Internal texture handling flag  */
 #define orxVIEWPORT_KU32_FLAG_INTERNAL_SHADER   0x00200000  /**< Internal shader pointer handling flag  */
 #define orxVIEWPORT_KU32_FLAG_INTERNAL_CAMERA   0x00400000  /**< Internal camera handling flag  */
@@ -89,6 +90,7 @@
 #define orxVIEWPORT_KZ_CONFIG_AUTO_RESIZE       "AutoResize"
 #define orxVIEWPORT_KZ_CONFIG_KEEP_IN_CACHE     "KeepInCache"
 #define orxVIEWPORT_KZ_CONFIG_NO_DEBUG          "NoDebug"
+#define orxVIEWPORT_KZ_CONFIG_CACHED            "Cached"
 
 #define orxVIEWPORT_KZ_LEFT                     "left"
 #define orxVIEWPORT_KZ_RIGHT                    "right"
@@ -465,6 +467,13 @@ orxVIEWPORT *orxFASTCALL orxViewport_CreateFromConfig(const orxSTRING _zConfigID
         orxStructure_SetFlags(pstResult, orxVIEWPORT_KU32_FLAG_NO_DEBUG, orxVIEWPORT_KU32_FLAG_NONE);
       }
 
+      /* Cached? */
+      if(orxConfig_GetBool(orxVIEWPORT_KZ_CONFIG_CACHED) != orxFALSE)
+      {
+        /* Updates flags */
+        orxStructure_SetFlags(pstResult, orxVIEWPORT_KU32_FLAG_CACHED, orxVIEWPORT_KU32_FLAG_NONE);
+      }
+
       /* Has plain size */
       if(orxConfig_HasValue(orxVIEWPORT_KZ_CONFIG_SIZE) != orxFALSE)
       {
@@ -1305,6 +1314,45 @@ orxBOOL orxFASTCALL orxViewport_IsEnabled(const orxVIEWPORT *_pstViewport)
   return(orxStructure_TestFlags(_pstViewport, orxVIEWPORT_KU32_FLAG_ENABLED));
 }
 
+/** Enables / disables a viewport's cache: a cached viewport is only re-rendered when its content changes
+ * @param[in]   _pstViewport    Concerned viewport
+ * @param[in]   _bEnable        Enable / disable
+ */
+void orxFASTCALL orxViewport_EnableCache(orxVIEWPORT *_pstViewport, orxBOOL _bEnable)
+{
+  /* Checks */
+  orxASSERT(sstViewport.u32Flags & orxVIEWPORT_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstViewport);
+
+  /* Enable? */
+  if(_bEnable != orxFALSE)
+  {
+    /* Updates flags */
+    orxStructure_SetFlags(_pstViewport, orxVIEWPORT_KU32_FLAG_CACHED, orxVIEWPORT_KU32_FLAG_NONE);
+  }
+  else
+  {
+    /* Updates flags */
+    orxStructure_SetFlags(_pstViewport, orxVIEWPORT_KU32_FLAG_NONE, orxVIEWPORT_KU32_FLAG_CACHED);
+  }
+
+  return;
+}
+
+/** Is a viewport's cache enabled?
+ * @param[in]   _pstViewport    Concerned viewport
+ * @return      orxTRUE / orxFALSE
+ */
+orxBOOL orxFASTCALL orxViewport_IsCacheEnabled(const orxVIEWPORT *_pstViewport)
+{
+  /* Checks */
+  orxASSERT(sstViewport.u32Flags & orxVIEWPORT_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstViewport);
+
+  /* Tests */
+  return(orxStructure_TestFlags(_pstViewport, orxVIEWPORT_KU32_FLAG_CACHED));
+}
+
 /** Sets a viewport camera
  * @param[in]   _pstViewport    Concerned viewport
  * @param[in]   _pstCamera      Associated camera
@@ -54,6 +54,9 @@
 #define orxSOUND_KU32_STATIC_FLAG_NONE                  0x00000000  /**< No flags */
 
 #define orxSOUND_KU32_STATIC_FLAG_READY                 0x00000001  /**< Ready flag */
+#define orxSOUND_KU32_STATIC_FLAG_VOICES                0x00000002  /**< Voices flag */
+#define orxSOUND_KU32_STATIC_FLAG_SAMPLE_CACHE          0x00000004  /**< Sample cache flag */
+#define orxSOUND_KU32_STATIC_FLAG_TRIM_SAMPLE_CACHE     0x00000008  /**< Trim sample cache flag */
 
 #define orxSOUND_KU32_STATIC_MASK_ALL                   0xFFFFFFFF  /**< All mask */
 
@@ -64,6 +67,12 @@
 
 #define orxSOUND_KU32_FLAG_HAS_SAMPLE                   0x00000001  /**< Has referenced sample flag */
 #define orxSOUND_KU32_FLAG_HAS_STREAM                   0x00000002  /**< Has referenced stream flag */
+#define orxSOUND_KU32_FLAG_LOOP                         0x00000004  /**< Loop flag */
+#define orxSOUND_KU32_FLAG_VIRTUAL                      0x00000010  /**< Virtual flag */
+#define orxSOUND_KU32_FLAG_VIRTUAL_PLAY                 0x00000020  /**< Virtual play flag */
+#define orxSOUND_KU32_FLAG_VIRTUAL_PAUSE                0x00000040  /**< Virtual pause flag */
+
+#define orxSOUND_KU32_MASK_VIRTUAL_ALL                  0x00000070  /**< Virtual all mask */
 
 #define orxSOUND_KU32_FLAG_BACKUP_PLAY                  0x10000000  /**< Backup play flag */
 #define orxSOUND_KU32_FLAG_BACKUP_PAUSE                 0x20000000  /**< Backup pause flag */
@@ -76,8 +85,11 @@
  */
 #define orxSOUND_SAMPLE_KU32_FLAG_NONE                  0x00000000  /**< No flag */
 
+#define orxSOUND_SAMPLE_KU32_FLAG_READY                 0x00000001  /**< Ready (ie. decoded) flag */
+
 #define orxSOUND_SAMPLE_KU32_FLAG_INTERNAL              0x10000000  /**< Internal flag */
 #define orxSOUND_SAMPLE_KU32_FLAG_CACHED                0x20000000  /**< Cached flag */
+#define orxSOUND_SAMPLE_KU32_FLAG_IDLE                  0x40000000  /**< Idle (ie. unreferenced but still resident) flag */
 
 #define orxSOUND_SAMPLE_KU32_MASK_ALL                   0xFFFFFFFF  /**< All mask */
 
@@ -94,6 +106,9 @@
 #define orxSOUND_KU32_BUS_BANK_SIZE                     64
 #define orxSOUND_KU32_BUS_TABLE_SIZE                    64
 
+#define orxSOUND_KU32_VOICE_LIST_SIZE                   64
+#define orxSOUND_KF_VOICE_HYSTERESIS                    orx2F(1.25f) /**< Audibility boost of real voices, avoids swapping voices around the budget cutoff */
+
 #define orxSOUND_KZ_CONFIG_SOUND                        "Sound"
 #define orxSOUND_KZ_CONFIG_MUSIC                        "Music"
 #define orxSOUND_KZ_CONFIG_LOOP                         "Loop"
@@ -104,6 +119,12 @@
 #define orxSOUND_KZ_CONFIG_ATTENUATION                  "Attenuation"
 #define orxSOUND_KZ_CONFIG_KEEP_IN_CACHE                "KeepInCache"
 #define orxSOUND_KZ_CONFIG_BUS                          "Bus"
+#define orxSOUND_KZ_CONFIG_PRIORITY                     "Priority"
+
+#define orxSOUND_KZ_CONFIG_SECTION                      "Sound"
+#define orxSOUND_KZ_CONFIG_VOICE_BUDGET                 "VoiceBudget"
+#define orxSOUND_KZ_CONFIG_MIN_AUDIBLE_VOLUME           "MinAudibleVolume"
+#define orxSOUND_KZ_CONFIG_SAMPLE_CACHE_SIZE            "SampleCacheSize"
 
 #define orxSOUND_KC_LOCALE_MARKER                       '$'
 
@@ -130,10 +151,12 @@ typedef struct __orxSOUND_BUS_t
  */
 typedef struct __orxSOUND_SAMPLE_t
 {
-  orxSOUNDSYSTEM_SAMPLE  *pstData;                      /**< Sound data : 4 */
-  orxSTRINGID             stID;                         /**< Sample ID : 8 */
-  orxU32                  u32Count;                     /**< Reference count : 12 */
-  orxU32                  u32Flags;                     /**< Flags : 16 */
+  orxLINKLIST_NODE        stNode;                       /**< Linklist node : 12/24 */
+  orxSOUNDSYSTEM_SAMPLE  *pstData;                      /**< Sound data : 16/32 */
+  orxSTRINGID             stID;                         /**< Sample ID : 20/36 */
+  orxU32                  u32Count;                     /**< Reference count : 24/40 */
+  orxU32                  u32Size;                      /**< Decoded size : 28/44 */
+  orxU32                  u32Flags;                     /**< Flags : 32/48 */
 
 } orxSOUND_SAMPLE;
 
@@ -151,8 +174,24 @@ struct __orxSOUND_t
   orxFLOAT              fVolume;                        /**< Sound volume : 68/92 */
   orxFLOAT              fPitch;                         /**< Sound pitch : 72/96 */
   orxFLOAT              fPitchModifier;                 /**< Sound pitch modifier : 76/100 */
+  orxVECTOR             vPosition;                      /**< Sound position : 88/112 */
+  orxFLOAT              fAttenuation;                   /**< Sound attenuation : 92/116 */
+  orxFLOAT              fReferenceDistance;             /**< Sound reference distance : 96/120 */
+  orxFLOAT              fPriority;                      /**< Sound priority : 100/124 */
+  orxFLOAT              fTime;                          /**< Virtual sound time : 104/128 */
+  orxFLOAT              fDuration;                      /**< Virtual sound duration : 108/132 */
 };
 
+/** Sound voice structure
+ */
+typedef struct __orxSOUND_VOICE_t
+{
+  orxSOUND             *pstSound;                       /**< Sound : 4/8 */
+  orxFLOAT              fPriority;                      /**< Priority : 8/12 */
+  orxFLOAT              fAudibility;                    /**< Audibility : 12/16 */
+
+} orxSOUND_VOICE;
+
 /** Static structure
  */
 typedef struct __orxSOUND_STATIC_t
@@ -164,6 +203,18 @@ typedef struct __orxSOUND_STATIC_t
   orxTREE       stBusTree;                              /**< Bus tree */
   orxSOUND_BUS *pstCachedBus;                           /**< Bus cache */
   orxSTRINGID   stMasterBusID;                          /**< Master bus ID */
+  orxSOUND_VOICE *astVoiceList;                         /**< Voice list */
+  orxU32        u32VoiceListSize;                       /**< Voice list size */
+  orxU32        u32VoiceBudget;                         /**< Voice budget */
+  orxFLOAT      fMinAudibleVolume;                      /**< Min audible volume */
+  orxFLOAT      fDimensionRatio;                        /**< Sound system dimension ratio */
+  orxU32        u32RealVoiceCount;                      /**< Real voice count */
+  orxU32        u32VirtualVoiceCount;                   /**< Virtual voice count */
+  orxLINKLIST   stSampleList;                           /**< Sample list, least recently played first */
+  orxU32        u32SampleCacheSize;                     /**< Sample cache size, in bytes */
+  orxU32        u32SampleHitCount;                      /**< Sample cache hit count */
+  orxU32        u32SampleMissCount;                     /**< Sample cache miss count */
+  orxU32        u32SampleEvictionCount;                 /**< Sample cache eviction count */
   orxU32        u32Flags;                               /**< Control flags */
 
 } orxSOUND_STATIC;
@@ -202,8 +253,20 @@ static orxINLINE orxSOUND_SAMPLE *orxSound_LoadSample(const orxSTRING _zFileName
   /* Found? */
   if(pstResult != orxNULL)
   {
-    /* Increases its reference count */
-    pstResult->u32Count++;
+    /* Is idle? */
+    if(orxFLAG_TEST(pstResult->u32Flags, orxSOUND_SAMPLE_KU32_FLAG_IDLE))
+    {
+      /* Revives it */
+      orxFLAG_SET(pstResult->u32Flags, orxSOUND_SAMPLE_KU32_FLAG_NONE, orxSOUND_SAMPLE_KU32_FLAG_IDLE);
+    }
+    else
+    {
+      /* Increases its reference count */
+      pstResult->u32Count++;
+    }
+
+    /* Updates stats */
+    sstSound.u32SampleHitCount++;
   }
   else
   {
@@ -213,7 +276,10 @@ static orxINLINE orxSOUND_SAMPLE *orxSound_LoadSample(const orxSTRING _zFileName
     /* Valid? */
     if(pstResult != orxNULL)
     {
-      /* Loads its data */
+      /* Clears it */
+      orxMemory_Zero(pstResult, sizeof(orxSOUND_SAMPLE));
+
+      /* Loads its data (decoded in the background by the sound system) */
       pstResult->pstData = orxSoundSystem_LoadSample(_zFileName);
 
       /* Adds it to sample table */
@@ -240,6 +306,15 @@ static orxINLINE orxSOUND_SAMPLE *orxSound_LoadSample(const orxSTRING _zFileName
 
         /* Stores its ID */
         pstResult->stID = stID;
+
+        /* Adds it as most recently used */
+        orxLinkList_AddEnd(&(sstSound.stSampleList), &(pstResult->stNode));
+
+        /* Updates stats */
+        sstSound.u32SampleMissCount++;
+
+        /* Asks for cache trimming */
+        orxFLAG_SET(sstSound.u32Flags, orxSOUND_KU32_STATIC_FLAG_TRIM_SAMPLE_CACHE, orxSOUND_KU32_STATIC_FLAG_NONE);
       }
       else
       {
@@ -270,22 +345,39 @@ static orxINLINE void orxSound_UnloadSample(orxSOUND_SAMPLE *_pstSample)
   /* Not referenced anymore? */
   if(_pstSample->u32Count == 0)
   {
-    /* Is internal? */
-    if(orxFLAG_TEST(_pstSample->u32Flags, orxSOUND_SAMPLE_KU32_FLAG_INTERNAL))
+    /* Should stay resident in cache? */
+    if((orxFLAG_TEST(sstSound.u32Flags, orxSOUND_KU32_STATIC_FLAG_SAMPLE_CACHE))
+    && (orxFLAG_TEST(_pstSample->u32Flags, orxSOUND_SAMPLE_KU32_FLAG_INTERNAL))
+    && (!orxFLAG_TEST(_pstSample->u32Flags, orxSOUND_SAMPLE_KU32_FLAG_IDLE)))
     {
-      /* Has data? */
-      if(_pstSample->pstData != orxNULL)
+      /* Marks it as idle */
+      orxFLAG_SET(_pstSample->u32Flags, orxSOUND_SAMPLE_KU32_FLAG_IDLE, orxSOUND_SAMPLE_KU32_FLAG_NONE);
+
+      /* Asks for cache trimming */
+      orxFLAG_SET(sstSound.u32Flags, orxSOUND_KU32_STATIC_FLAG_TRIM_SAMPLE_CACHE, orxSOUND_KU32_STATIC_FLAG_NONE);
+    }
+    else
+    {
+      /* Is internal? */
+      if(orxFLAG_TEST(_pstSample->u32Flags, orxSOUND_SAMPLE_KU32_FLAG_INTERNAL))
       {
-        /* Unloads its data */
-        orxSoundSystem_DeleteSample(_pstSample->pstData);
+        /* Has data? */
+        if(_pstSample->pstData != orxNULL)
+        {
+          /* Unloads its data */
+          orxSoundSystem_DeleteSample(_pstSample->pstData);
+        }
+
+        /* Removes it from sample list */
+        orxLinkList_Remove(&(_pstSample->stNode));
       }
-    }
 
-    /* Removes it from sample table */
-    orxHashTable_Remove(sstSound.pstSampleTable, _pstSample->stID);
+      /* Removes it from sample table */
+      orxHashTable_Remove(sstSound.pstSampleTable, _pstSample->stID);
 
-    /* Deletes it */
-    orxBank_Free(sstSound.pstSampleBank, _pstSample);
+      /* Deletes it */
+      orxBank_Free(sstSound.pstSampleBank, _pstSample);
+    }
   }
   else
   {
@@ -320,6 +412,144 @@ static orxINLINE void orxSound_UnloadAllSample()
   return;
 }
 
+/** Is a sample ready (ie. decoded)? Also retrieves its decoded size
+ * @param[in]   _pstSample                    Concerned sample
+ * @return      orxTRUE / orxFALSE
+ */
+static orxINLINE orxBOOL orxSound_IsSampleReady(orxSOUND_SAMPLE *_pstSample)
+{
+  /* Not ready yet? */
+  if(!orxFLAG_TEST(_pstSample->u32Flags, orxSOUND_SAMPLE_KU32_FLAG_READY))
+  {
+    orxU32 u32ChannelNumber, u32FrameNumber, u32SampleRate;
+
+    /* Has data and finished decoding? */
+    if((_pstSample->pstData != orxNULL)
+    && (orxSoundSystem_GetSampleInfo(_pstSample->pstData, &u32ChannelNumber, &u32FrameNumber, &u32SampleRate) != orxSTATUS_FAILURE))
+    {
+      /* Stores its size */
+      _pstSample->u32Size = u32ChannelNumber * u32FrameNumber * sizeof(orxS16);
+
+      /* Updates flags */
+      orxFLAG_SET(_pstSample->u32Flags, orxSOUND_SAMPLE_KU32_FLAG_READY, orxSOUND_SAMPLE_KU32_FLAG_NONE);
+    }
+  }
+
+  /* Done! */
+  return orxFLAG_TEST(_pstSample->u32Flags, orxSOUND_SAMPLE_KU32_FLAG_READY);
+}
+
+/** Marks a sample as most recently played
+ * @param[in]   _pstSample                    Concerned sample
+ */
+static orxINLINE void orxSound_TouchSample(orxSOUND_SAMPLE *_pstSample)
+{
+  /* Is internal and not already the most recent one? */
+  if((orxFLAG_TEST(_pstSample->u32Flags, orxSOUND_SAMPLE_KU32_FLAG_INTERNAL))
+  && (orxLinkList_GetLast(&(sstSound.stSampleList)) != &(_pstSample->stNode)))
+  {
+    /* Moves it at the end of the list */
+    orxLinkList_Remove(&(_pstSample->stNode));
+    orxLinkList_AddEnd(&(sstSound.stSampleList), &(_pstSample->stNode));
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Evicts least recently played idle samples until the sample cache fits within its size
+ * @param[in]   _u32Size                      Size to fit in, in bytes
+ */
+static void orxFASTCALL orxSound_TrimSampleCache(orxU32 _u32Size)
+{
+  orxLINKLIST_NODE *pstNode, *pstNextNode;
+  orxU32            u32Size = 0;
+  orxBOOL           bPending = orxFALSE;
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxSound_TrimSampleCache");
+
+  /* For all samples */
+  for(pstNode = orxLinkList_GetFirst(&(sstSound.stSampleList));
+      pstNode != orxNULL;
+      pstNode = orxLinkList_GetNext(pstNode))
+  {
+    orxSOUND_SAMPLE *pstSample;
+
+    /* Gets it */
+    pstSample = orxSTRUCT_GET_FROM_FIELD(orxSOUND_SAMPLE, stNode, pstNode);
+
+    /* Is ready? */
+    if(orxSound_IsSampleReady(pstSample) != orxFALSE)
+    {
+      /* Updates size */
+      u32Size += pstSample->u32Size;
+    }
+    else
+    {
+      /* Updates status */
+      bPending = orxTRUE;
+    }
+  }
+
+  /* For all samples, least recently played first, while above size */
+  for(pstNode = orxLinkList_GetFirst(&(sstSound.stSampleList));
+      (pstNode != orxNULL) && (u32Size > _u32Size);
+      pstNode = pstNextNode)
+  {
+    orxSOUND_SAMPLE *pstSample;
+
+    /* Gets next node */
+    pstNextNode = orxLinkList_GetNext(pstNode);
+
+    /* Gets sample */
+    pstSample = orxSTRUCT_GET_FROM_FIELD(orxSOUND_SAMPLE, stNode, pstNode);
+
+    /* Is idle and ready? */
+    if(orxFLAG_TEST_ALL(pstSample->u32Flags, orxSOUND_SAMPLE_KU32_FLAG_IDLE | orxSOUND_SAMPLE_KU32_FLAG_READY))
+    {
+      /* Updates size */
+      u32Size -= pstSample->u32Size;
+
+      /* Evicts it */
+      orxSound_UnloadSample(pstSample);
+
+      /* Updates stats */
+      sstSound.u32SampleEvictionCount++;
+    }
+  }
+
+  /* No pending sample? */
+  if(bPending == orxFALSE)
+  {
+    /* Updates flags */
+    orxFLAG_SET(sstSound.u32Flags, orxSOUND_KU32_STATIC_FLAG_NONE, orxSOUND_KU32_STATIC_FLAG_TRIM_SAMPLE_CACHE);
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return;
+}
+
+/** Updates the sample cache
+ * @param[in]   _pstClockInfo                 Clock info of the clock used upon registration
+ * @param[in]   _pContext                     Context sent when registering callback to the clock
+ */
+static void orxFASTCALL orxSound_UpdateSampleCache(const orxCLOCK_INFO *_pstClockInfo, void *_pContext)
+{
+  /* Should trim? */
+  if(orxFLAG_TEST(sstSound.u32Flags, orxSOUND_KU32_STATIC_FLAG_TRIM_SAMPLE_CACHE))
+  {
+    /* Trims it */
+    orxSound_TrimSampleCache(sstSound.u32SampleCacheSize);
+  }
+
+  /* Done! */
+  return;
+}
+
 /** Processes config data
  */
 static orxSTATUS orxFASTCALL orxSound_ProcessConfigData(orxSOUND *_pstSound, orxBOOL _bOnlySettings)
@@ -358,7 +588,7 @@ static orxSTATUS orxFASTCALL orxSound_ProcessConfigData(orxSOUND *_pstSound, orx
       _pstSound->fPitchModifier = orxFLOAT_1;
 
       /* Updates flags */
-      orxStructure_SetFlags(_pstSound, orxSOUND_KU32_FLAG_NONE, orxSOUND_KU32_FLAG_HAS_SAMPLE | orxSOUND_KU32_FLAG_HAS_STREAM);
+      orxStructure_SetFlags(_pstSound, orxSOUND_KU32_FLAG_NONE, orxSOUND_KU32_FLAG_HAS_SAMPLE | orxSOUND_KU32_FLAG_HAS_STREAM | orxSOUND_KU32_MASK_VIRTUAL_ALL);
 
       /* Is a sound? */
       if(((zName = orxConfig_GetString(orxSOUND_KZ_CONFIG_SOUND)) != orxSTRING_EMPTY)
@@ -449,7 +679,8 @@ static orxSTATUS orxFASTCALL orxSound_ProcessConfigData(orxSOUND *_pstSound, orx
     }
 
     /* Valid content? */
-    if(_pstSound->pstData != orxNULL)
+    if((_pstSound->pstData != orxNULL)
+    || (orxStructure_TestFlags(_pstSound, orxSOUND_KU32_FLAG_VIRTUAL)))
     {
       /* Has bus? */
       if(orxConfig_HasValue(orxSOUND_KZ_CONFIG_BUS) != orxFALSE)
@@ -481,12 +712,12 @@ static orxSTATUS orxFASTCALL orxSound_ProcessConfigData(orxSOUND *_pstSound, orx
       if(orxConfig_GetBool(orxSOUND_KZ_CONFIG_LOOP) != orxFALSE)
       {
         /* Updates looping status */
-        orxSoundSystem_Loop(_pstSound->pstData, orxTRUE);
+        orxSound_Loop(_pstSound, orxTRUE);
       }
       else
       {
         /* Updates looping status */
-        orxSoundSystem_Loop(_pstSound->pstData, orxFALSE);
+        orxSound_Loop(_pstSound, orxFALSE);
       }
 
       /* Has volume? */
@@ -517,26 +748,29 @@ static orxSTATUS orxFASTCALL orxSound_ProcessConfigData(orxSOUND *_pstSound, orx
       if(orxConfig_HasValue(orxSOUND_KZ_CONFIG_ATTENUATION) != orxFALSE)
       {
         /* Updates attenuation */
-        orxSoundSystem_SetAttenuation(_pstSound->pstData, orxConfig_GetFloat(orxSOUND_KZ_CONFIG_ATTENUATION));
+        orxSound_SetAttenuation(_pstSound, orxConfig_GetFloat(orxSOUND_KZ_CONFIG_ATTENUATION));
       }
       else
       {
         /* Updates attenuation */
-        orxSoundSystem_SetAttenuation(_pstSound->pstData, orxFLOAT_1);
+        orxSound_SetAttenuation(_pstSound, orxFLOAT_1);
       }
 
       /* Has reference distance? */
       if(orxConfig_HasValue(orxSOUND_KZ_CONFIG_REFERENCE_DISTANCE) != orxFALSE)
       {
         /* Updates distance */
-        orxSoundSystem_SetReferenceDistance(_pstSound->pstData, orxConfig_GetFloat(orxSOUND_KZ_CONFIG_REFERENCE_DISTANCE));
+        orxSound_SetReferenceDistance(_pstSound, orxConfig_GetFloat(orxSOUND_KZ_CONFIG_REFERENCE_DISTANCE));
       }
       else
       {
         /* Updates distance */
-        orxSoundSystem_SetReferenceDistance(_pstSound->pstData, orxFLOAT_1);
+        orxSound_SetReferenceDistance(_pstSound, orxFLOAT_1);
       }
 
+      /* Updates priority */
+      _pstSound->fPriority = orxConfig_GetFloat(orxSOUND_KZ_CONFIG_PRIORITY);
+
       /* Updates result */
       eResult = orxSTATUS_SUCCESS;
     }
@@ -684,18 +918,23 @@ static orxSTATUS orxFASTCALL orxSound_EventHandler(const orxEVENT *_pstEvent)
               /* Stops it */
               orxSound_Stop(pstSound);
 
-              /* Deletes its data */
-              orxSoundSystem_Delete(pstSound->pstData);
-              pstSound->pstData = orxNULL;
+              /* Has data? */
+              if(pstSound->pstData != orxNULL)
+              {
+                /* Deletes it */
+                orxSoundSystem_Delete(pstSound->pstData);
+                pstSound->pstData = orxNULL;
+              }
 
               /* Updates flags */
-              orxStructure_SetFlags(pstSound, u32BackupFlags, orxSOUND_KU32_MASK_BACKUP_ALL);
+              orxStructure_SetFlags(pstSound, u32BackupFlags, orxSOUND_KU32_MASK_BACKUP_ALL | orxSOUND_KU32_MASK_VIRTUAL_ALL);
             }
           }
 
           /* Updates sample */
           orxSoundSystem_DeleteSample(pstSample->pstData);
           pstSample->pstData = orxSoundSystem_LoadSample(orxString_GetFromID(pstSample->stID));
+          orxFLAG_SET(pstSample->u32Flags, orxSOUND_SAMPLE_KU32_FLAG_NONE, orxSOUND_SAMPLE_KU32_FLAG_READY);
 
           /* Updates load status */
           bLoaded = (pstSample->pstData != orxNULL) ? orxTRUE : orxFALSE;
@@ -947,7 +1186,7 @@ static orxSTATUS orxFASTCALL orxSound_Update(orxSTRUCTURE *_pstStructure, const
   pstSound = orxSOUND(_pstStructure);
 
   /* Updates its position */
-  orxSoundSystem_SetPosition(pstSound->pstData, orxObject_GetWorldPosition(pstObject, &vPosition));
+  orxSound_SetPosition(pstSound, orxObject_GetWorldPosition(pstObject, &vPosition));
 
   /* Has clock? */
   if(_pstClockInfo != orxNULL)
@@ -1175,6 +1414,403 @@ static orxSTATUS orxFASTCALL orxSound_UpdateBus(orxSOUND_BUS *pstBus)
   return eResult;
 }
 
+/** Virtualizes a sound (ie. releases its sound system voice while keeping track of its cursor)
+ * @param[in]   _pstSound                     Concerned sound
+ */
+static void orxFASTCALL orxSound_Virtualize(orxSOUND *_pstSound)
+{
+  orxU32 u32VirtualFlags;
+
+  /* Checks */
+  orxASSERT(orxStructure_TestFlags(_pstSound, orxSOUND_KU32_FLAG_HAS_SAMPLE));
+  orxASSERT(_pstSound->pstData != orxNULL);
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxSound_Virtualize");
+
+  /* Stores its duration */
+  _pstSound->fDuration = orxSoundSystem_GetDuration(_pstSound->pstData);
+
+  /* Depending on its status */
+  switch(orxSoundSystem_GetStatus(_pstSound->pstData))
+  {
+    case orxSOUNDSYSTEM_STATUS_PLAY:
+    {
+      /* Stores its cursor */
+      _pstSound->fTime  = orxSoundSystem_GetTime(_pstSound->pstData);
+      u32VirtualFlags   = orxSOUND_KU32_FLAG_VIRTUAL | orxSOUND_KU32_FLAG_VIRTUAL_PLAY;
+
+      break;
+    }
+
+    case orxSOUNDSYSTEM_STATUS_PAUSE:
+    {
+      /* Stores its cursor */
+      _pstSound->fTime  = orxSoundSystem_GetTime(_pstSound->pstData);
+      u32VirtualFlags   = orxSOUND_KU32_FLAG_VIRTUAL | orxSOUND_KU32_FLAG_VIRTUAL_PAUSE;
+
+      break;
+    }
+
+    default:
+    {
+      /* Stores its cursor */
+      _pstSound->fTime  = orxSoundSystem_GetTime(_pstSound->pstData);
+      u32VirtualFlags   = orxSOUND_KU32_FLAG_VIRTUAL;
+
+      break;
+    }
+  }
+
+  /* Releases its voice */
+  orxSoundSystem_Delete(_pstSound->pstData);
+  _pstSound->pstData = orxNULL;
+
+  /* Updates flags */
+  orxStructure_SetFlags(_pstSound, u32VirtualFlags, orxSOUND_KU32_MASK_VIRTUAL_ALL);
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return;
+}
+
+/** Realizes a virtual sound (ie. gets it a sound system voice back and restores its state)
+ * @param[in]   _pstSound                     Concerned sound
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxSound_Realize(orxSOUND *_pstSound)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(orxStructure_TestFlags(_pstSound, orxSOUND_KU32_FLAG_VIRTUAL));
+  orxASSERT(_pstSound->pstData == orxNULL);
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxSound_Realize");
+
+  /* Creates sound data based on its sample */
+  _pstSound->pstData = orxSoundSystem_CreateFromSample(_pstSound->pstSample->pstData);
+
+  /* Valid? */
+  if(_pstSound->pstData != orxNULL)
+  {
+    orxSOUND_BUS *pstBus;
+
+    /* Gets bus */
+    pstBus = orxSound_GetBus(_pstSound->stBusID, orxFALSE);
+
+    /* Checks */
+    orxASSERT(pstBus != orxNULL);
+
+    /* Restores its settings */
+    orxSoundSystem_SetVolume(_pstSound->pstData, pstBus->fGlobalVolume * _pstSound->fVolume);
+    orxSoundSystem_SetPitch(_pstSound->pstData, pstBus->fGlobalPitch * _pstSound->fPitchModifier * _pstSound->fPitch);
+    orxSoundSystem_SetPosition(_pstSound->pstData, &(_pstSound->vPosition));
+    orxSoundSystem_SetAttenuation(_pstSound->pstData, _pstSound->fAttenuation);
+    orxSoundSystem_SetReferenceDistance(_pstSound->pstData, _pstSound->fReferenceDistance);
+    orxSoundSystem_Loop(_pstSound->pstData, orxStructure_TestFlags(_pstSound, orxSOUND_KU32_FLAG_LOOP));
+
+    /* Restores its cursor */
+    orxSoundSystem_SetTime(_pstSound->pstData, _pstSound->fTime);
+
+    /* Was playing or paused? */
+    if(orxStructure_TestFlags(_pstSound, orxSOUND_KU32_FLAG_VIRTUAL_PLAY | orxSOUND_KU32_FLAG_VIRTUAL_PAUSE))
+    {
+      /* Plays it */
+      orxSoundSystem_Play(_pstSound->pstData);
+
+      /* Was paused? */
+      if(orxStructure_TestFlags(_pstSound, orxSOUND_KU32_FLAG_VIRTUAL_PAUSE))
+      {
+        /* Pauses it */
+        orxSoundSystem_Pause(_pstSound->pstData);
+      }
+    }
+
+    /* Updates flags */
+    orxStructure_SetFlags(_pstSound, orxSOUND_KU32_FLAG_NONE, orxSOUND_KU32_MASK_VIRTUAL_ALL);
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return eResult;
+}
+
+/** Updates voices: advances virtual cursors and distributes the voice budget among playing sounds by priority & audibility
+ * @param[in]   _pstClockInfo                 Clock info of the clock used upon registration
+ * @param[in]   _pContext                     Context sent when registering callback to the clock
+ */
+static void orxFASTCALL orxSound_UpdateVoices(const orxCLOCK_INFO *_pstClockInfo, void *_pContext)
+{
+  orxSOUND *pstSound;
+  orxVECTOR vListenerPosition;
+  orxU32    u32VoiceCount = 0, u32RealCount = 0, u32VirtualCount = 0, u32BudgetCount, i;
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxSound_UpdateVoices");
+
+  /* Gets listener position */
+  if(orxSoundSystem_GetListenerPosition(&vListenerPosition) == orxNULL)
+  {
+    /* Clears it */
+    orxVector_Copy(&vListenerPosition, &orxVECTOR_0);
+  }
+
+  /* For all sounds */
+  for(pstSound = orxSOUND(orxStructure_GetFirst(orxSTRUCTURE_ID_SOUND));
+      pstSound != orxNULL;
+      pstSound = orxSOUND(orxStructure_GetNext(pstSound)))
+  {
+    /* Has a decoded sample? (streams are never virtualized) */
+    if((orxStructure_TestFlags(pstSound, orxSOUND_KU32_FLAG_HAS_SAMPLE))
+    && (orxSound_IsSampleReady(pstSound->pstSample) != orxFALSE))
+    {
+      orxBOOL bPlaying = orxFALSE;
+
+      /* Is virtual? */
+      if(orxStructure_TestFlags(pstSound, orxSOUND_KU32_FLAG_VIRTUAL))
+      {
+        /* Is playing? */
+        if(orxStructure_TestFlags(pstSound, orxSOUND_KU32_FLAG_VIRTUAL_PLAY))
+        {
+          orxSOUND_BUS *pstBus;
+
+          /* Gets bus */
+          pstBus = orxSound_GetBus(pstSound->stBusID, orxFALSE);
+
+          /* Checks */
+          orxASSERT(pstBus != orxNULL);
+
+          /* Advances its cursor */
+          pstSound->fTime += _pstClockInfo->fDT * pstBus->fGlobalPitch * pstSound->fPitchModifier * pstSound->fPitch;
+
+          /* Reached its end? */
+          if(pstSound->fTime >= pstSound->fDuration)
+          {
+            /* Is looping? */
+            if((orxStructure_TestFlags(pstSound, orxSOUND_KU32_FLAG_LOOP))
+            && (pstSound->fDuration > orxFLOAT_0))
+            {
+              /* Wraps its cursor */
+              pstSound->fTime = orxMath_Mod(pstSound->fTime, pstSound->fDuration);
+
+              /* Updates status */
+              bPlaying = orxTRUE;
+            }
+            else
+            {
+              /* Stops it */
+              pstSound->fTime = orxFLOAT_0;
+              orxStructure_SetFlags(pstSound, orxSOUND_KU32_FLAG_NONE, orxSOUND_KU32_FLAG_VIRTUAL_PLAY);
+            }
+          }
+          else
+          {
+            /* Updates status */
+            bPlaying = orxTRUE;
+          }
+        }
+        else if(orxStructure_TestFlags(pstSound, orxSOUND_KU32_FLAG_VIRTUAL_PAUSE))
+        {
+          /* Updates count */
+          u32VirtualCount++;
+        }
+      }
+      /* Has data? (a failed reload leaves none) */
+      else if(pstSound->pstData != orxNULL)
+      {
+        /* Depending on its status */
+        switch(orxSoundSystem_GetStatus(pstSound->pstData))
+        {
+          case orxSOUNDSYSTEM_STATUS_PLAY:
+          {
+            /* Updates status */
+            bPlaying = orxTRUE;
+
+            break;
+          }
+
+          case orxSOUNDSYSTEM_STATUS_PAUSE:
+          {
+            /* Keeps its voice */
+            u32RealCount++;
+
+            break;
+          }
+
+          default:
+          {
+            /* Stopped sounds don't compete for voices */
+            break;
+          }
+        }
+      }
+
+      /* Is playing? */
+      if(bPlaying != orxFALSE)
+      {
+        orxSOUND_BUS  *pstBus;
+        orxFLOAT       fDistance, fAudibility;
+
+        /* Is voice list full? */
+        if(u32VoiceCount == sstSound.u32VoiceListSize)
+        {
+          orxSOUND_VOICE *astNewVoiceList;
+
+          /* Allocates a larger list */
+          astNewVoiceList = (orxSOUND_VOICE *)orxMemory_Allocate(2 * sstSound.u32VoiceListSize * sizeof(orxSOUND_VOICE), orxMEMORY_TYPE_AUDIO);
+
+          /* Checks */
+          orxASSERT(astNewVoiceList != orxNULL);
+
+          /* Copies current voices */
+          orxMemory_Copy(astNewVoiceList, sstSound.astVoiceList, u32VoiceCount * sizeof(orxSOUND_VOICE));
+
+          /* Deletes previous list */
+          orxMemory_Free(sstSound.astVoiceList);
+
+          /* Stores new one */
+          sstSound.astVoiceList     = astNewVoiceList;
+          sstSound.u32VoiceListSize = 2 * sstSound.u32VoiceListSize;
+        }
+
+        /* Gets bus */
+        pstBus = orxSound_GetBus(pstSound->stBusID, orxFALSE);
+
+        /* Checks */
+        orxASSERT(pstBus != orxNULL);
+
+        /* Gets distance to listener */
+        fDistance = orxVector_GetDistance(&(pstSound->vPosition), &vListenerPosition);
+
+        /* Gets its audibility (inverse distance clamped model) */
+        fAudibility = pstBus->fGlobalVolume * pstSound->fVolume;
+
+        /* Beyond its reference distance? */
+        if((fDistance > pstSound->fReferenceDistance)
+        && (pstSound->fReferenceDistance > orxFLOAT_0))
+        {
+          fAudibility *= pstSound->fReferenceDistance / (pstSound->fReferenceDistance + pstSound->fAttenuation * sstSound.fDimensionRatio * (fDistance - pstSound->fReferenceDistance));
+        }
+
+        /* Is real? */
+        if(!orxStructure_TestFlags(pstSound, orxSOUND_KU32_FLAG_VIRTUAL))
+        {
+          /* Boosts its audibility, so that it only gets demoted when clearly outranked or inaudible */
+          fAudibility *= orxSOUND_KF_VOICE_HYSTERESIS;
+        }
+
+        /* Finds its rank (by decreasing priority, then audibility) */
+        for(i = u32VoiceCount;
+            (i > 0)
+         && ((sstSound.astVoiceList[i - 1].fPriority < pstSound->fPriority)
+          || ((sstSound.astVoiceList[i - 1].fPriority == pstSound->fPriority)
+           && (sstSound.astVoiceList[i - 1].fAudibility < fAudibility)));
+            i--)
+        {
+          /* Shifts lower voice */
+          orxMemory_Copy(&(sstSound.astVoiceList[i]), &(sstSound.astVoiceList[i - 1]), sizeof(orxSOUND_VOICE));
+        }
+
+        /* Stores it */
+        sstSound.astVoiceList[i].pstSound     = pstSound;
+        sstSound.astVoiceList[i].fPriority    = pstSound->fPriority;
+        sstSound.astVoiceList[i].fAudibility  = fAudibility;
+
+        /* Updates count */
+        u32VoiceCount++;
+      }
+    }
+  }
+
+  /* Gets available voice count (paused voices are kept) */
+  u32BudgetCount = (sstSound.u32VoiceBudget == 0) ? u32VoiceCount : (sstSound.u32VoiceBudget > u32RealCount) ? sstSound.u32VoiceBudget - u32RealCount : 0;
+
+  /* Steals voices from lowest ranked or inaudible sounds first */
+  for(i = 0; i < u32VoiceCount; i++)
+  {
+    orxSOUND_VOICE *pstVoice;
+
+    /* Gets voice */
+    pstVoice = &(sstSound.astVoiceList[i]);
+
+    /* Is audible and within budget? */
+    if((pstVoice->fAudibility >= sstSound.fMinAudibleVolume)
+    && (u32BudgetCount > 0))
+    {
+      /* Updates budget */
+      u32BudgetCount--;
+    }
+    else
+    {
+      /* Not already virtual? */
+      if(!orxStructure_TestFlags(pstVoice->pstSound, orxSOUND_KU32_FLAG_VIRTUAL))
+      {
+        /* Virtualizes it */
+        orxSound_Virtualize(pstVoice->pstSound);
+      }
+
+      /* Marks it as virtual */
+      pstVoice->pstSound = orxNULL;
+
+      /* Updates count */
+      u32VirtualCount++;
+    }
+  }
+
+  /* Restores voices of highest ranked sounds */
+  for(i = 0; i < u32VoiceCount; i++)
+  {
+    orxSOUND *pstVoiceSound;
+
+    /* Gets its sound */
+    pstVoiceSound = sstSound.astVoiceList[i].pstSound;
+
+    /* Should be real? */
+    if(pstVoiceSound != orxNULL)
+    {
+      /* Is virtual? */
+      if(orxStructure_TestFlags(pstVoiceSound, orxSOUND_KU32_FLAG_VIRTUAL))
+      {
+        /* Realizes it */
+        if(orxSound_Realize(pstVoiceSound) != orxSTATUS_FAILURE)
+        {
+          /* Updates count */
+          u32RealCount++;
+        }
+        else
+        {
+          /* Updates count */
+          u32VirtualCount++;
+        }
+      }
+      else
+      {
+        /* Updates count */
+        u32RealCount++;
+      }
+    }
+  }
+
+  /* Stores stats */
+  sstSound.u32RealVoiceCount    = u32RealCount;
+  sstSound.u32VirtualVoiceCount = u32VirtualCount;
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return;
+}
+
 /** Command: SetBusParent
  */
 void orxFASTCALL orxSound_CommandSetBusParent(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
@@ -1457,6 +2093,88 @@ orxSTATUS orxFASTCALL orxSound_Init()
 
               /* Registers commands */
               orxSound_RegisterCommands();
+
+              /* Pushes sound system config section */
+              orxConfig_PushSection(orxSOUNDSYSTEM_KZ_CONFIG_SECTION);
+
+              /* Stores dimension ratio */
+              sstSound.fDimensionRatio = (orxConfig_HasValue(orxSOUNDSYSTEM_KZ_CONFIG_RATIO) != orxFALSE) ? orxConfig_GetFloat(orxSOUNDSYSTEM_KZ_CONFIG_RATIO) : orxFLOAT_1;
+
+              /* Pops config section */
+              orxConfig_PopSection();
+
+              /* Pushes config section */
+              orxConfig_PushSection(orxSOUND_KZ_CONFIG_SECTION);
+
+              /* Stores voice settings */
+              sstSound.u32VoiceBudget     = orxConfig_GetU32(orxSOUND_KZ_CONFIG_VOICE_BUDGET);
+              sstSound.fMinAudibleVolume  = orxConfig_GetFloat(orxSOUND_KZ_CONFIG_MIN_AUDIBLE_VOLUME);
+
+              /* Stores sample cache size (KB) */
+              sstSound.u32SampleCacheSize = orxConfig_GetU32(orxSOUND_KZ_CONFIG_SAMPLE_CACHE_SIZE) * 1024;
+
+              /* Pops config section */
+              orxConfig_PopSection();
+
+              /* Should manage voices? */
+              if((sstSound.u32VoiceBudget != 0)
+              || (sstSound.fMinAudibleVolume > orxFLOAT_0))
+              {
+                /* Allocates voice list */
+                sstSound.astVoiceList = (orxSOUND_VOICE *)orxMemory_Allocate(orxSOUND_KU32_VOICE_LIST_SIZE * sizeof(orxSOUND_VOICE), orxMEMORY_TYPE_AUDIO);
+
+                /* Success? */
+                if(sstSound.astVoiceList != orxNULL)
+                {
+                  /* Stores its size */
+                  sstSound.u32VoiceListSize = orxSOUND_KU32_VOICE_LIST_SIZE;
+
+                  /* Registers voice update on core clock */
+                  if(orxClock_Register(orxClock_FindFirst(orx2F(-1.0f), orxCLOCK_TYPE_CORE), orxSound_UpdateVoices, orxNULL, orxMODULE_ID_SOUND, orxCLOCK_PRIORITY_LOWER) != orxSTATUS_FAILURE)
+                  {
+                    /* Updates flags */
+                    orxFLAG_SET(sstSound.u32Flags, orxSOUND_KU32_STATIC_FLAG_VOICES, orxSOUND_KU32_STATIC_FLAG_NONE);
+                  }
+                  else
+                  {
+                    /* Deletes voice list */
+                    orxMemory_Free(sstSound.astVoiceList);
+                    sstSound.astVoiceList = orxNULL;
+
+                    /* Logs message */
+                    orxDEBUG_PRINT(orxDEBUG_LEVEL_SOUND, "Failed to register voice update: voice budget will be ignored.");
+                  }
+                }
+                else
+                {
+                  /* Logs message */
+                  orxDEBUG_PRINT(orxDEBUG_LEVEL_SOUND, "Failed to allocate voice list: voice budget will be ignored.");
+                }
+
+                /* Not managing voices? */
+                if(!orxFLAG_TEST(sstSound.u32Flags, orxSOUND_KU32_STATIC_FLAG_VOICES))
+                {
+                  /* Clears voice settings */
+                  sstSound.u32VoiceBudget     = 0;
+                  sstSound.fMinAudibleVolume  = orxFLOAT_0;
+                }
+              }
+
+              /* Has sample cache size? */
+              if(sstSound.u32SampleCacheSize != 0)
+              {
+                /* Registers sample cache update on core clock */
+                if(orxClock_Register(orxClock_FindFirst(orx2F(-1.0f), orxCLOCK_TYPE_CORE), orxSound_UpdateSampleCache, orxNULL, orxMODULE_ID_SOUND, orxCLOCK_PRIORITY_LOWER) != orxSTATUS_FAILURE)
+                {
+                  /* Updates flags */
+                  orxFLAG_SET(sstSound.u32Flags, orxSOUND_KU32_STATIC_FLAG_SAMPLE_CACHE, orxSOUND_KU32_STATIC_FLAG_NONE);
+                }
+                else
+                {
+                  /* Logs message */
+                  orxDEBUG_PRINT(orxDEBUG_LEVEL_SOUND, "Failed to register sample cache update: unreferenced samples will be unloaded immediately.");
+                }
+              }
             }
             else
             {
@@ -1541,6 +2259,24 @@ void orxFASTCALL orxSound_Exit()
     /* Unregisters commands */
     orxSound_UnregisterCommands();
 
+    /* Manages voices? */
+    if(orxFLAG_TEST(sstSound.u32Flags, orxSOUND_KU32_STATIC_FLAG_VOICES))
+    {
+      /* Unregisters voice update */
+      orxClock_Unregister(orxClock_FindFirst(orx2F(-1.0f), orxCLOCK_TYPE_CORE), orxSound_UpdateVoices);
+
+      /* Deletes voice list */
+      orxMemory_Free(sstSound.astVoiceList);
+      sstSound.astVoiceList = orxNULL;
+    }
+
+    /* Uses sample cache? */
+    if(orxFLAG_TEST(sstSound.u32Flags, orxSOUND_KU32_STATIC_FLAG_SAMPLE_CACHE))
+    {
+      /* Unregisters sample cache update */
+      orxClock_Unregister(orxClock_FindFirst(orx2F(-1.0f), orxCLOCK_TYPE_CORE), orxSound_UpdateSampleCache);
+    }
+
     /* Removes event handlers */
     orxEvent_RemoveHandler(orxEVENT_TYPE_RESOURCE, orxSound_EventHandler);
     orxEvent_RemoveHandler(orxEVENT_TYPE_LOCALE, orxSound_EventHandler);
@@ -1603,6 +2339,13 @@ orxSOUND *orxFASTCALL orxSound_Create()
 
     /* Clears its status */
     pstResult->eStatus = orxSOUND_STATUS_NONE;
+
+    /* Inits its settings */
+    pstResult->fVolume            = orxFLOAT_1;
+    pstResult->fPitch             = orxFLOAT_1;
+    pstResult->fPitchModifier     = orxFLOAT_1;
+    pstResult->fAttenuation       = orxFLOAT_1;
+    pstResult->fReferenceDistance = orxFLOAT_1;
   }
   else
   {
@@ -1795,6 +2538,13 @@ orxSTATUS orxFASTCALL orxSound_ClearCache()
     }
   }
 
+  /* Uses sample cache? */
+  if(orxFLAG_TEST(sstSound.u32Flags, orxSOUND_KU32_STATIC_FLAG_SAMPLE_CACHE))
+  {
+    /* Evicts all idle samples */
+    orxSound_TrimSampleCache(0);
+  }
+
   /* Done! */
   return eResult;
 }
@@ -1842,6 +2592,7 @@ orxSOUNDSYSTEM_SAMPLE *orxFASTCALL orxSound_CreateSample(orxU32 _u32ChannelNumbe
         if(pstSoundSample != orxNULL)
         {
           /* Inits it */
+          orxMemory_Zero(pstSoundSample, sizeof(orxSOUND_SAMPLE));
           pstSoundSample->pstData     = pstSample;
           pstSoundSample->u32Count    = 0;
           pstSoundSample->stID        = stID;
@@ -1943,6 +2694,13 @@ orxSTATUS orxFASTCALL orxSound_DeleteSample(const orxSTRING _zName)
         /* Deletes its data */
         orxSoundSystem_DeleteSample(pstSoundSample->pstData);
 
+        /* Is internal? */
+        if(orxFLAG_TEST(pstSoundSample->u32Flags, orxSOUND_SAMPLE_KU32_FLAG_INTERNAL))
+        {
+          /* Removes it from sample list */
+          orxLinkList_Remove(&(pstSoundSample->stNode));
+        }
+
         /* Removes it from sample table */
         orxHashTable_Remove(sstSound.pstSampleTable, pstSoundSample->stID);
 
@@ -2069,7 +2827,7 @@ orxSTATUS orxFASTCALL orxSound_UnlinkSample(orxSOUND *_pstSound)
     _pstSound->pstSample = orxNULL;
 
     /* Updates its status */
-    orxStructure_SetFlags(_pstSound, orxSOUND_KU32_FLAG_NONE, orxSOUND_KU32_FLAG_HAS_SAMPLE);
+    orxStructure_SetFlags(_pstSound, orxSOUND_KU32_FLAG_NONE, orxSOUND_KU32_FLAG_HAS_SAMPLE | orxSOUND_KU32_MASK_VIRTUAL_ALL);
   }
   else
   {
@@ -2112,12 +2870,48 @@ orxSTATUS orxFASTCALL orxSound_Play(orxSOUND *_pstSound)
   orxASSERT(sstSound.u32Flags & orxSOUND_KU32_STATIC_FLAG_READY);
   orxSTRUCTURE_ASSERT(_pstSound);
 
+  /* Uses sample cache and has sample? */
+  if((orxFLAG_TEST(sstSound.u32Flags, orxSOUND_KU32_STATIC_FLAG_SAMPLE_CACHE))
+  && (orxStructure_TestFlags(_pstSound, orxSOUND_KU32_FLAG_HAS_SAMPLE)))
+  {
+    /* Marks its sample as most recently played */
+    orxSound_TouchSample(_pstSound->pstSample);
+  }
+
   /* Has sound? */
   if(_pstSound->pstData != orxNULL)
   {
     /* Plays it */
     eResult = orxSoundSystem_Play(_pstSound->pstData);
   }
+  /* Is virtual? */
+  else if(orxStructure_TestFlags(_pstSound, orxSOUND_KU32_FLAG_VIRTUAL))
+  {
+    /* Was playing? */
+    if(orxStructure_TestFlags(_pstSound, orxSOUND_KU32_FLAG_VIRTUAL_PLAY))
+    {
+      /* Rewinds it */
+      _pstSound->fTime = orxFLOAT_0;
+    }
+
+    /* Updates flags */
+    orxStructure_SetFlags(_pstSound, orxSOUND_KU32_FLAG_VIRTUAL_PLAY, orxSOUND_KU32_FLAG_VIRTUAL_PAUSE);
+
+    /* Voice available? */
+    if((sstSound.u32VoiceBudget == 0)
+    || (sstSound.u32RealVoiceCount < sstSound.u32VoiceBudget))
+    {
+      /* Realizes it */
+      if(orxSound_Realize(_pstSound) != orxSTATUS_FAILURE)
+      {
+        /* Updates count */
+        sstSound.u32RealVoiceCount++;
+      }
+    }
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
   else
   {
     /* Updates result */
@@ -2146,6 +2940,19 @@ orxSTATUS orxFASTCALL orxSound_Pause(orxSOUND *_pstSound)
     /* Pauses it */
     eResult = orxSoundSystem_Pause(_pstSound->pstData);
   }
+  /* Is virtual? */
+  else if(orxStructure_TestFlags(_pstSound, orxSOUND_KU32_FLAG_VIRTUAL))
+  {
+    /* Is playing? */
+    if(orxStructure_TestFlags(_pstSound, orxSOUND_KU32_FLAG_VIRTUAL_PLAY))
+    {
+      /* Updates flags */
+      orxStructure_SetFlags(_pstSound, orxSOUND_KU32_FLAG_VIRTUAL_PAUSE, orxSOUND_KU32_FLAG_VIRTUAL_PLAY);
+    }
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
   else
   {
     /* Updates result */
@@ -2174,6 +2981,18 @@ orxSTATUS orxFASTCALL orxSound_Stop(orxSOUND *_pstSound)
     /* Stops it */
     eResult = orxSoundSystem_Stop(_pstSound->pstData);
   }
+  /* Is virtual? */
+  else if(orxStructure_TestFlags(_pstSound, orxSOUND_KU32_FLAG_VIRTUAL))
+  {
+    /* Rewinds it */
+    _pstSound->fTime = orxFLOAT_0;
+
+    /* Updates flags */
+    orxStructure_SetFlags(_pstSound, orxSOUND_KU32_FLAG_NONE, orxSOUND_KU32_FLAG_VIRTUAL_PLAY | orxSOUND_KU32_FLAG_VIRTUAL_PAUSE);
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
   else
   {
     /* Updates result */
@@ -2276,6 +3095,15 @@ orxSTATUS orxFASTCALL orxSound_SetVolume(orxSOUND *_pstSound, orxFLOAT _fVolume)
         _pstSound->fVolume = _fVolume;
       }
     }
+    /* Is virtual? */
+    else if(orxStructure_TestFlags(_pstSound, orxSOUND_KU32_FLAG_VIRTUAL))
+    {
+      /* Stores it */
+      _pstSound->fVolume = _fVolume;
+
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
     else
     {
       /* Updates result */
@@ -2329,6 +3157,15 @@ orxSTATUS orxFASTCALL orxSound_SetPitch(orxSOUND *_pstSound, orxFLOAT _fPitch)
       _pstSound->fPitch = _fPitch;
     }
   }
+  /* Is virtual? */
+  else if(orxStructure_TestFlags(_pstSound, orxSOUND_KU32_FLAG_VIRTUAL))
+  {
+    /* Stores it */
+    _pstSound->fPitch = _fPitch;
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
   else
   {
     /* Updates result */
@@ -2353,13 +3190,26 @@ orxSTATUS orxFASTCALL orxSound_SetTime(orxSOUND *_pstSound, orxFLOAT _fTime)
   orxSTRUCTURE_ASSERT(_pstSound);
 
   /* Has sound? */
-  if(_pstSound->pstData != orxNULL)
+  if((_pstSound->pstData != orxNULL)
+  || (orxStructure_TestFlags(_pstSound, orxSOUND_KU32_FLAG_VIRTUAL)))
   {
     /* Valid? */
     if((_fTime >= orxFLOAT_0) && (_fTime < orxSound_GetDuration(_pstSound)))
     {
-      /* Sets its time */
-      eResult = orxSoundSystem_SetTime(_pstSound->pstData, _fTime);
+      /* Has data? */
+      if(_pstSound->pstData != orxNULL)
+      {
+        /* Sets its time */
+        eResult = orxSoundSystem_SetTime(_pstSound->pstData, _fTime);
+      }
+      else
+      {
+        /* Stores it */
+        _pstSound->fTime = _fTime;
+
+        /* Updates result */
+        eResult = orxSTATUS_SUCCESS;
+      }
     }
     else
     {
@@ -2399,6 +3249,22 @@ orxSTATUS orxFASTCALL orxSound_SetPosition(orxSOUND *_pstSound, const orxVECTOR
   {
     /* Sets its position */
     eResult = orxSoundSystem_SetPosition(_pstSound->pstData, _pvPosition);
+
+    /* Success? */
+    if(eResult != orxSTATUS_FAILURE)
+    {
+      /* Stores it */
+      orxVector_Copy(&(_pstSound->vPosition), _pvPosition);
+    }
+  }
+  /* Is virtual? */
+  else if(orxStructure_TestFlags(_pstSound, orxSOUND_KU32_FLAG_VIRTUAL))
+  {
+    /* Stores it */
+    orxVector_Copy(&(_pstSound->vPosition), _pvPosition);
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
   }
   else
   {
@@ -2428,6 +3294,22 @@ orxSTATUS orxFASTCALL orxSound_SetAttenuation(orxSOUND *_pstSound, orxFLOAT _fAt
   {
     /* Sets its position */
     eResult = orxSoundSystem_SetAttenuation(_pstSound->pstData, _fAttenuation);
+
+    /* Success? */
+    if(eResult != orxSTATUS_FAILURE)
+    {
+      /* Stores it */
+      _pstSound->fAttenuation = _fAttenuation;
+    }
+  }
+  /* Is virtual? */
+  else if(orxStructure_TestFlags(_pstSound, orxSOUND_KU32_FLAG_VIRTUAL))
+  {
+    /* Stores it */
+    _pstSound->fAttenuation = _fAttenuation;
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
   }
   else
   {
@@ -2457,6 +3339,22 @@ orxSTATUS orxFASTCALL orxSound_SetReferenceDistance(orxSOUND *_pstSound, orxFLOA
   {
     /* Sets its position */
     eResult = orxSoundSystem_SetReferenceDistance(_pstSound->pstData, _fDistance);
+
+    /* Success? */
+    if(eResult != orxSTATUS_FAILURE)
+    {
+      /* Stores it */
+      _pstSound->fReferenceDistance = _fDistance;
+    }
+  }
+  /* Is virtual? */
+  else if(orxStructure_TestFlags(_pstSound, orxSOUND_KU32_FLAG_VIRTUAL))
+  {
+    /* Stores it */
+    _pstSound->fReferenceDistance = _fDistance;
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
   }
   else
   {
@@ -2486,6 +3384,22 @@ orxSTATUS orxFASTCALL orxSound_Loop(orxSOUND *_pstSound, orxBOOL _bLoop)
   {
     /* Sets its looping status */
     eResult = orxSoundSystem_Loop(_pstSound->pstData, _bLoop);
+
+    /* Success? */
+    if(eResult != orxSTATUS_FAILURE)
+    {
+      /* Stores it */
+      orxStructure_SetFlags(_pstSound, (_bLoop != orxFALSE) ? orxSOUND_KU32_FLAG_LOOP : orxSOUND_KU32_FLAG_NONE, (_bLoop != orxFALSE) ? orxSOUND_KU32_FLAG_NONE : orxSOUND_KU32_FLAG_LOOP);
+    }
+  }
+  /* Is virtual? */
+  else if(orxStructure_TestFlags(_pstSound, orxSOUND_KU32_FLAG_VIRTUAL))
+  {
+    /* Stores it */
+    orxStructure_SetFlags(_pstSound, (_bLoop != orxFALSE) ? orxSOUND_KU32_FLAG_LOOP : orxSOUND_KU32_FLAG_NONE, (_bLoop != orxFALSE) ? orxSOUND_KU32_FLAG_NONE : orxSOUND_KU32_FLAG_LOOP);
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
   }
   else
   {
@@ -2497,6 +3411,26 @@ orxSTATUS orxFASTCALL orxSound_Loop(orxSOUND *_pstSound, orxBOOL _bLoop)
   return eResult;
 }
 
+/** Sets sound priority
+ * @param[in] _pstSound       Concerned Sound
+ * @param[in] _fPriority      Desired priority, sounds with higher priorities keep their voices when the voice budget is exceeded
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxSound_SetPriority(orxSOUND *_pstSound, orxFLOAT _fPriority)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT(sstSound.u32Flags & orxSOUND_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstSound);
+
+  /* Stores it */
+  _pstSound->fPriority = _fPriority;
+
+  /* Done! */
+  return eResult;
+}
+
 /** Gets sound volume
  * @param[in] _pstSound       Concerned Sound
  * @return orxFLOAT
@@ -2510,7 +3444,8 @@ orxFLOAT orxFASTCALL orxSound_GetVolume(const orxSOUND *_pstSound)
   orxSTRUCTURE_ASSERT(_pstSound);
 
   /* Has sound? */
-  if(_pstSound->pstData != orxNULL)
+  if((_pstSound->pstData != orxNULL)
+  || (orxStructure_TestFlags(_pstSound, orxSOUND_KU32_FLAG_VIRTUAL)))
   {
     /* Updates result */
     fResult = _pstSound->fVolume;
@@ -2538,7 +3473,8 @@ orxFLOAT orxFASTCALL orxSound_GetPitch(const orxSOUND *_pstSound)
   orxSTRUCTURE_ASSERT(_pstSound);
 
   /* Has sound? */
-  if(_pstSound->pstData != orxNULL)
+  if((_pstSound->pstData != orxNULL)
+  || (orxStructure_TestFlags(_pstSound, orxSOUND_KU32_FLAG_VIRTUAL)))
   {
     /* Updates result */
     fResult = _pstSound->fPitch;
@@ -2571,6 +3507,12 @@ orxFLOAT orxFASTCALL orxSound_GetTime(const orxSOUND *_pstSound)
     /* Updates result */
     fResult = orxSoundSystem_GetTime(_pstSound->pstData);
   }
+  /* Is virtual? */
+  else if(orxStructure_TestFlags(_pstSound, orxSOUND_KU32_FLAG_VIRTUAL))
+  {
+    /* Updates result */
+    fResult = _pstSound->fTime;
+  }
   else
   {
     /* Updates result */
@@ -2601,6 +3543,12 @@ orxVECTOR *orxFASTCALL orxSound_GetPosition(const orxSOUND *_pstSound, orxVECTOR
     /* Updates result */
     pvResult = orxSoundSystem_GetPosition(_pstSound->pstData, _pvPosition);
   }
+  /* Is virtual? */
+  else if(orxStructure_TestFlags(_pstSound, orxSOUND_KU32_FLAG_VIRTUAL))
+  {
+    /* Updates result */
+    pvResult = orxVector_Copy(_pvPosition, &(_pstSound->vPosition));
+  }
   else
   {
     /* Updates result */
@@ -2629,6 +3577,12 @@ orxFLOAT orxFASTCALL orxSound_GetAttenuation(const orxSOUND *_pstSound)
     /* Updates result */
     fResult = orxSoundSystem_GetAttenuation(_pstSound->pstData);
   }
+  /* Is virtual? */
+  else if(orxStructure_TestFlags(_pstSound, orxSOUND_KU32_FLAG_VIRTUAL))
+  {
+    /* Updates result */
+    fResult = _pstSound->fAttenuation;
+  }
   else
   {
     /* Updates result */
@@ -2657,6 +3611,12 @@ orxFLOAT orxFASTCALL orxSound_GetReferenceDistance(const orxSOUND *_pstSound)
     /* Updates result */
     fResult = orxSoundSystem_GetReferenceDistance(_pstSound->pstData);
   }
+  /* Is virtual? */
+  else if(orxStructure_TestFlags(_pstSound, orxSOUND_KU32_FLAG_VIRTUAL))
+  {
+    /* Updates result */
+    fResult = _pstSound->fReferenceDistance;
+  }
   else
   {
     /* Updates result */
@@ -2685,6 +3645,12 @@ orxBOOL orxFASTCALL orxSound_IsLooping(const orxSOUND *_pstSound)
     /* Updates result */
     bResult = orxSoundSystem_IsLooping(_pstSound->pstData);
   }
+  /* Is virtual? */
+  else if(orxStructure_TestFlags(_pstSound, orxSOUND_KU32_FLAG_VIRTUAL))
+  {
+    /* Updates result */
+    bResult = orxStructure_TestFlags(_pstSound, orxSOUND_KU32_FLAG_LOOP);
+  }
   else
   {
     /* Updates result */
@@ -2695,6 +3661,25 @@ orxBOOL orxFASTCALL orxSound_IsLooping(const orxSOUND *_pstSound)
   return bResult;
 }
 
+/** Gets sound priority
+ * @param[in] _pstSound       Concerned Sound
+ * @return orxFLOAT
+ */
+orxFLOAT orxFASTCALL orxSound_GetPriority(const orxSOUND *_pstSound)
+{
+  orxFLOAT fResult;
+
+  /* Checks */
+  orxASSERT(sstSound.u32Flags & orxSOUND_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstSound);
+
+  /* Updates result */
+  fResult = _pstSound->fPriority;
+
+  /* Done! */
+  return fResult;
+}
+
 /** Gets sound duration
  * @param[in] _pstSound       Concerned Sound
  * @return orxFLOAT
@@ -2713,6 +3698,12 @@ orxFLOAT orxFASTCALL orxSound_GetDuration(const orxSOUND *_pstSound)
     /* Updates result */
     fResult = orxSoundSystem_GetDuration(_pstSound->pstData);
   }
+  /* Is virtual? */
+  else if(orxStructure_TestFlags(_pstSound, orxSOUND_KU32_FLAG_VIRTUAL))
+  {
+    /* Updates result */
+    fResult = _pstSound->fDuration;
+  }
   else
   {
     /* Updates result */
@@ -2767,6 +3758,12 @@ orxSOUND_STATUS orxFASTCALL orxSound_GetStatus(const orxSOUND *_pstSound)
       }
     }
   }
+  /* Is virtual? */
+  else if(orxStructure_TestFlags(_pstSound, orxSOUND_KU32_FLAG_VIRTUAL))
+  {
+    /* Updates result */
+    eResult = (orxStructure_TestFlags(_pstSound, orxSOUND_KU32_FLAG_VIRTUAL_PLAY)) ? orxSOUND_STATUS_PLAY : (orxStructure_TestFlags(_pstSound, orxSOUND_KU32_FLAG_VIRTUAL_PAUSE)) ? orxSOUND_STATUS_PAUSE : orxSOUND_STATUS_STOP;
+  }
   else
   {
     /* Updates result */
@@ -2777,6 +3774,145 @@ orxSOUND_STATUS orxFASTCALL orxSound_GetStatus(const orxSOUND *_pstSound)
   return eResult;
 }
 
+/** Is sound virtual (ie. currently without any sound system voice)?
+ * @param[in] _pstSound       Concerned Sound
+ * @return orxTRUE / orxFALSE
+ */
+orxBOOL orxFASTCALL orxSound_IsVirtual(const orxSOUND *_pstSound)
+{
+  orxBOOL bResult;
+
+  /* Checks */
+  orxASSERT(sstSound.u32Flags & orxSOUND_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstSound);
+
+  /* Updates result */
+  bResult = orxStructure_TestFlags(_pstSound, orxSOUND_KU32_FLAG_VIRTUAL);
+
+  /* Done! */
+  return bResult;
+}
+
+/** Is sound ready (ie. its sample has been decoded)? A sound that isn't ready yet can still be played: it'll start once decoded
+ * @param[in] _pstSound       Concerned Sound
+ * @return orxTRUE / orxFALSE
+ */
+orxBOOL orxFASTCALL orxSound_IsReady(const orxSOUND *_pstSound)
+{
+  orxBOOL bResult;
+
+  /* Checks */
+  orxASSERT(sstSound.u32Flags & orxSOUND_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstSound);
+
+  /* Has sample? */
+  if(orxStructure_TestFlags(_pstSound, orxSOUND_KU32_FLAG_HAS_SAMPLE))
+  {
+    /* Updates result */
+    bResult = orxSound_IsSampleReady(_pstSound->pstSample);
+  }
+  else
+  {
+    /* Updates result */
+    bResult = (_pstSound->pstData != orxNULL) ? orxTRUE : orxFALSE;
+  }
+
+  /* Done! */
+  return bResult;
+}
+
+/** Gets sample cache info
+ * @param[out] _pstInfo       Sample cache info
+ * @return orxSOUND_SAMPLE_CACHE_INFO
+ */
+orxSOUND_SAMPLE_CACHE_INFO *orxFASTCALL orxSound_GetSampleCacheInfo(orxSOUND_SAMPLE_CACHE_INFO *_pstInfo)
+{
+  orxLINKLIST_NODE *pstNode;
+
+  /* Checks */
+  orxASSERT(sstSound.u32Flags & orxSOUND_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstInfo != orxNULL);
+
+  /* Clears it */
+  orxMemory_Zero(_pstInfo, sizeof(orxSOUND_SAMPLE_CACHE_INFO));
+
+  /* For all samples */
+  for(pstNode = orxLinkList_GetFirst(&(sstSound.stSampleList));
+      pstNode != orxNULL;
+      pstNode = orxLinkList_GetNext(pstNode))
+  {
+    orxSOUND_SAMPLE *pstSample;
+
+    /* Gets it */
+    pstSample = orxSTRUCT_GET_FROM_FIELD(orxSOUND_SAMPLE, stNode, pstNode);
+
+    /* Is ready? */
+    if(orxSound_IsSampleReady(pstSample) != orxFALSE)
+    {
+      /* Updates size */
+      _pstInfo->u32Size += pstSample->u32Size;
+    }
+    else
+    {
+      /* Updates count */
+      _pstInfo->u32PendingCount++;
+    }
+
+    /* Is idle? */
+    if(orxFLAG_TEST(pstSample->u32Flags, orxSOUND_SAMPLE_KU32_FLAG_IDLE))
+    {
+      /* Updates count */
+      _pstInfo->u32IdleCount++;
+    }
+
+    /* Updates count */
+    _pstInfo->u32SampleCount++;
+  }
+
+  /* Stores the rest */
+  _pstInfo->u32MaxSize       = sstSound.u32SampleCacheSize;
+  _pstInfo->u32HitCount      = sstSound.u32SampleHitCount;
+  _pstInfo->u32MissCount     = sstSound.u32SampleMissCount;
+  _pstInfo->u32EvictionCount = sstSound.u32SampleEvictionCount;
+
+  /* Done! */
+  return _pstInfo;
+}
+
+/** Gets real voice count (ie. playing or paused sounds currently owning a sound system voice), as of the last voice update
+ * @return Real voice count
+ */
+orxU32 orxFASTCALL orxSound_GetRealVoiceCount()
+{
+  orxU32 u32Result;
+
+  /* Checks */
+  orxASSERT(sstSound.u32Flags & orxSOUND_KU32_STATIC_FLAG_READY);
+
+  /* Updates result */
+  u32Result = sstSound.u32RealVoiceCount;
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Gets virtual voice count (ie. playing or paused sounds whose cursor is tracked without any sound system voice), as of the last voice update
+ * @return Virtual voice count
+ */
+orxU32 orxFASTCALL orxSound_GetVirtualVoiceCount()
+{
+  orxU32 u32Result;
+
+  /* Checks */
+  orxASSERT(sstSound.u32Flags & orxSOUND_KU32_STATIC_FLAG_READY);
+
+  /* Updates result */
+  u32Result = sstSound.u32VirtualVoiceCount;
+
+  /* Done! */
+  return u32Result;
+}
+
 /** Gets sound config name
  * @param[in]   _pstSound     Concerned sound
  * @return      orxSTRING / orxSTRING_EMPTY
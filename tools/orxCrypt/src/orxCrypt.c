@@ -39,6 +39,8 @@
 
 #define orxCRYPT_KU32_STATIC_FLAG_INPUT_LOADED    0x00000001  /**< Input loaded flag */
 #define orxCRYPT_KU32_STATIC_FLAG_USE_ENCRYPTION  0x00000002  /**< Use encryption flag */
+#define orxCRYPT_KU32_STATIC_FLAG_BINARY          0x00000004  /**< Binary output flag */
+#define orxCRYPT_KU32_STATIC_FLAG_BENCHMARK       0x00000008  /**< Benchmark flag */
 
 #define orxCRYPT_KU32_STATIC_MASK_ALL             0xFFFFFFFF  /**< All mask */
 
@@ -47,6 +49,8 @@
  */
 #define orxCRYPT_KZ_DEFAULT_OUTPUT                "orxcrypt.out"
 
+#define orxCRYPT_KU32_DEFAULT_BENCHMARK_COUNT     100
+
 #define orxCRYPT_KZ_LOG_TAG_LENGTH                "10"
 
 #if defined(__orxGCC__) || defined(__orxLLVM__)
@@ -71,6 +75,7 @@ typedef struct __orxCRYPT_STATIC_t
   orxSTRING  *azInputFile;
   orxSTRING   zOutputFile;
   orxU32      u32InputNumber;
+  orxU32      u32BenchmarkCount;
   orxU32      u32Flags;
 
 } orxCRYPT_STATIC;
@@ -118,7 +123,9 @@ static orxBOOL orxFASTCALL SaveFilter(const orxSTRING _zSectionName, const orxST
      || !orxString_Compare(_zKeyName, "filelist")
      || !orxString_Compare(_zKeyName, "key")
      || !orxString_Compare(_zKeyName, "output")
-     || !orxString_Compare(_zKeyName, "decrypt")))
+     || !orxString_Compare(_zKeyName, "decrypt")
+     || !orxString_Compare(_zKeyName, "binary")
+     || !orxString_Compare(_zKeyName, "benchmark")))
     {
       // Don't save it
       bResult = orxFALSE;
@@ -325,6 +332,87 @@ static orxSTATUS orxFASTCALL ProcessDecryptParams(orxU32 _u32ParamCount, const o
   return eResult;
 }
 
+static orxSTATUS orxFASTCALL ProcessBinaryParams(orxU32 _u32ParamCount, const orxSTRING _azParams[])
+{
+  orxSTATUS eResult;
+
+  // Has a valid binary parameter?
+  if(_u32ParamCount >= 1)
+  {
+    // Updates status
+    orxFLAG_SET(sstCrypt.u32Flags, orxCRYPT_KU32_STATIC_FLAG_BINARY, orxCRYPT_KU32_STATIC_FLAG_NONE);
+
+    // Updates result
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    // Updates result
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  // Done!
+  return eResult;
+}
+
+static orxSTATUS orxFASTCALL ProcessBenchmarkParams(orxU32 _u32ParamCount, const orxSTRING _azParams[])
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  // Defaults count
+  sstCrypt.u32BenchmarkCount = orxCRYPT_KU32_DEFAULT_BENCHMARK_COUNT;
+
+  // Has a count?
+  if(_u32ParamCount > 1)
+  {
+    orxU32 u32Count;
+
+    // Valid?
+    if((orxString_ToU32(_azParams[1], &u32Count, orxNULL) != orxSTATUS_FAILURE) && (u32Count > 0))
+    {
+      // Stores it
+      sstCrypt.u32BenchmarkCount = u32Count;
+    }
+    else
+    {
+      // Logs message
+      orxCRYPT_LOG(BENCHMARK, "Invalid count <%s>, using default", _azParams[1]);
+    }
+  }
+
+  // Updates status
+  orxFLAG_SET(sstCrypt.u32Flags, orxCRYPT_KU32_STATIC_FLAG_BENCHMARK, orxCRYPT_KU32_STATIC_FLAG_NONE);
+
+  // Done!
+  return eResult;
+}
+
+static orxDOUBLE orxFASTCALL Benchmark(const orxSTRING *_azFileList, orxU32 _u32FileNumber)
+{
+  orxDOUBLE dStartTime;
+  orxU32    i, j;
+
+  // Gets start time
+  dStartTime = orxSystem_GetTime();
+
+  // For all runs
+  for(i = 0; i < sstCrypt.u32BenchmarkCount; i++)
+  {
+    // Clears config
+    orxConfig_Clear();
+
+    // For all files
+    for(j = 0; j < _u32FileNumber; j++)
+    {
+      // Loads it
+      orxConfig_Load(_azFileList[j]);
+    }
+  }
+
+  // Done!
+  return (orxSystem_GetTime() - dStartTime) / orx2D(sstCrypt.u32BenchmarkCount);
+}
+
 static void orxFASTCALL Setup()
 {
   // Adds module dependencies
@@ -344,6 +432,8 @@ static orxSTATUS orxFASTCALL Init()
     orxCRYPT_DECLARE_PARAM("f", "filelist", "Input file list", "List of root config files to decode/encode, only 1 input file is allowed in non-merge mode", ProcessInputParams)
     orxCRYPT_DECLARE_PARAM("o", "output", "Output file", "Single output file where decoded/encoded config info will be saved", ProcessOutputParams)
     orxCRYPT_DECLARE_PARAM("d", "decrypt", "decrypt mode", "If this switch is provided, the saved file will *NOT* be encrypted, otherwise it will, by default", ProcessDecryptParams)
+    orxCRYPT_DECLARE_PARAM("b", "binary", "binary mode", "If this switch is provided, the saved file will be a binary config snapshot, loaded without any parsing (no encryption)", ProcessBinaryParams)
+    orxCRYPT_DECLARE_PARAM("t", "benchmark", "Benchmark run count", "Measures the average load time of the input files and of the saved file over the given number of runs (default: 100)", ProcessBenchmarkParams)
   };
 
   // Clears static controller
@@ -395,19 +485,46 @@ static void Run()
   if(orxFLAG_TEST(sstCrypt.u32Flags, orxCRYPT_KU32_STATIC_FLAG_INPUT_LOADED))
   {
     const orxSTRING zOutputFile;
-    orxBOOL         bEncrypt;
+    orxBOOL         bEncrypt, bBinary;
+    orxSTATUS       eResult;
 
-    // Gets encryption status
-    bEncrypt = orxFLAG_TEST(sstCrypt.u32Flags, orxCRYPT_KU32_STATIC_FLAG_USE_ENCRYPTION);
+    // Gets encryption & binary status
+    bBinary   = orxFLAG_TEST(sstCrypt.u32Flags, orxCRYPT_KU32_STATIC_FLAG_BINARY);
+    bEncrypt  = orxFLAG_TEST(sstCrypt.u32Flags, orxCRYPT_KU32_STATIC_FLAG_USE_ENCRYPTION) && !bBinary;
 
     // Selects correct output file
     zOutputFile = (sstCrypt.zOutputFile) ? sstCrypt.zOutputFile : orxCRYPT_KZ_DEFAULT_OUTPUT;
 
-    // Merge files
-    if(orxConfig_MergeFiles(zOutputFile, (const orxSTRING *)sstCrypt.azInputFile, sstCrypt.u32InputNumber, bEncrypt ? orxConfig_GetEncryptionKey() : orxNULL) != orxSTATUS_FAILURE)
+    // Binary?
+    if(bBinary)
+    {
+      // Saves loaded config as a binary snapshot
+      eResult = orxConfig_SaveBinary(zOutputFile, SaveFilter);
+    }
+    else
+    {
+      // Merge files
+      eResult = orxConfig_MergeFiles(zOutputFile, (const orxSTRING *)sstCrypt.azInputFile, sstCrypt.u32InputNumber, bEncrypt ? orxConfig_GetEncryptionKey() : orxNULL);
+    }
+
+    // Success?
+    if(eResult != orxSTATUS_FAILURE)
     {
       // Logs message
-      orxCRYPT_LOG(SAVE, "==== %-24.24s SUCCESS%s%s", zOutputFile, (sstCrypt.u32InputNumber > 1) ? " (MERGED)" : orxSTRING_EMPTY, bEncrypt ? " (ENCRYPTED)" : orxSTRING_EMPTY);
+      orxCRYPT_LOG(SAVE, "==== %-24.24s SUCCESS%s%s%s", zOutputFile, (sstCrypt.u32InputNumber > 1) ? " (MERGED)" : orxSTRING_EMPTY, bEncrypt ? " (ENCRYPTED)" : orxSTRING_EMPTY, bBinary ? " (BINARY)" : orxSTRING_EMPTY);
+
+      // Benchmark?
+      if(orxFLAG_TEST(sstCrypt.u32Flags, orxCRYPT_KU32_STATIC_FLAG_BENCHMARK))
+      {
+        orxDOUBLE dInputTime, dOutputTime;
+
+        // Measures both
+        dInputTime  = Benchmark((const orxSTRING *)sstCrypt.azInputFile, sstCrypt.u32InputNumber);
+        dOutputTime = Benchmark(&zOutputFile, 1);
+
+        // Logs message
+        orxCRYPT_LOG(BENCHMARK, "%u runs: input %.3fms, output %.3fms (x%.2f)", sstCrypt.u32BenchmarkCount, dInputTime * orx2D(1000.0), dOutputTime * orx2D(1000.0), (dOutputTime > orx2D(0.0)) ? dInputTime / dOutputTime : orx2D(0.0));
+      }
     }
     else
     {